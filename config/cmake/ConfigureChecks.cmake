@@ -184,6 +184,19 @@ if (NOT WINDOWS)
   endif ()
 endif ()
 
+#-----------------------------------------------------------------------------
+#  Check if the io_uring driver can be built
+#-----------------------------------------------------------------------------
+if (CMAKE_SYSTEM_NAME MATCHES "Linux")
+  option (HDF5_ENABLE_IOURING_VFD "Build the io_uring Virtual File Driver" OFF)
+  if (HDF5_ENABLE_IOURING_VFD)
+    HDF_FUNCTION_TEST (HAVE_IOURING)
+    if (NOT ${HDF_PREFIX}_HAVE_IOURING)
+      message (WARNING "The io_uring VFD was requested but <linux/io_uring.h> or its features weren't found")
+    endif ()
+  endif ()
+endif ()
+
 #-----------------------------------------------------------------------------
 #  Check if ROS3 driver can be built
 #-----------------------------------------------------------------------------
@@ -217,6 +230,21 @@ if (H5FD_ENABLE_MIRROR_VFD)
   endif()
 endif()
 
+# ----------------------------------------------------------------------
+# Check whether we can build the read-only memory-mapped VFD
+# Header and function checks set in config/cmake_ext_mod/ConfigureChecks.cmake
+# ----------------------------------------------------------------------
+option (HDF5_ENABLE_MMAP_VFD "Build the read-only memory-mapped Virtual File Driver" OFF)
+if (HDF5_ENABLE_MMAP_VFD)
+  if ( ${HDF_PREFIX}_HAVE_SYS_MMAN_H AND
+       ${HDF_PREFIX}_HAVE_MMAP       AND
+       ${HDF_PREFIX}_HAVE_MADVISE)
+      set (${HDF_PREFIX}_HAVE_MMAP_VFD 1)
+  else()
+    message(WARNING "The memory-mapped VFD was requested but cannot be built. System prerequisites are not met.")
+  endif()
+endif()
+
 #-----------------------------------------------------------------------------
 # Check if C has __float128 extension
 #-----------------------------------------------------------------------------
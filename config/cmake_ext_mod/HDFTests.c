@@ -281,6 +281,29 @@ int main(void)
        SIMPLE_TEST(posix_memalign());
 #endif
 
+#ifdef HAVE_IOURING
+/* check the io_uring system call interface */
+#include <string.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+
+int
+main(void)
+{
+  struct io_uring_params p;
+  unsigned               head = 0;
+
+  memset(&p, 0, sizeof(p));
+  __atomic_store_n(&head, (unsigned)IORING_OP_READ, __ATOMIC_RELEASE);
+  if (__atomic_load_n(&head, __ATOMIC_ACQUIRE) != IORING_OP_READ)
+      return 1;
+  p.features = IORING_FEAT_SINGLE_MMAP;
+  (void)syscall(__NR_io_uring_setup, 0, &p);
+  return 0;
+}
+#endif
+
 #ifdef HAVE_DEFAULT_SOURCE
 /* check default source */
 #include <features.h>
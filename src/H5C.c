@@ -155,6 +155,9 @@ static herr_t H5C__generate_image(H5F_t *f, H5C_t *cache_ptr, H5C_cache_entry_t
 static herr_t H5C__verify_len_eoa(H5F_t *f, const H5C_class_t *type, haddr_t addr, size_t *len,
                                   hbool_t actual);
 
+static herr_t H5C__get_mapped_image(H5F_t *f, const H5C_class_t *type, haddr_t addr, size_t *len,
+                                    void *udata, const void **image);
+
 #if H5C_DO_SLIST_SANITY_CHECKS
 static hbool_t H5C__entry_in_skip_list(H5C_t *cache_ptr, H5C_cache_entry_t *target_ptr);
 #endif /* H5C_DO_SLIST_SANITY_CHECKS */
@@ -7096,6 +7099,85 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__verify_len_eoa() */
 
+/*-------------------------------------------------------------------------
+ *
+ * Function:    H5C__get_mapped_image
+ *
+ * Purpose:     Points *IMAGE at the on-disk image of the entry at the
+ *              specified address and with the specified type, when the
+ *              file driver has mapped the file into memory, so that the
+ *              entry can be deserialized without being read first.
+ *
+ *              *LEN is the initial size of the image on entry, and is set
+ *              to the final size of a speculatively loaded entry.
+ *
+ *              *IMAGE is set to NULL when the image isn't mapped, or when
+ *              its final size or checksum can't be resolved; reading the
+ *              image then retries and reports the error as usual.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__get_mapped_image(H5F_t *f, const H5C_class_t *type, haddr_t addr, size_t *len, void *udata,
+                      const void **image)
+{
+    const void *mapped     = NULL;    /* Pointer to the image in the mapping */
+    size_t      actual_len = *len;    /* The actual length of the image */
+    htri_t      chk_ret;              /* Return from verify_chksum callback */
+    herr_t      ret_value  = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(type);
+    HDassert(len);
+    HDassert(image);
+
+    *image = NULL;
+
+    if (H5F_shared_get_mapping(f->shared, type->mem_type, addr, *len, &mapped) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "can't get mapping of image")
+    if (NULL == mapped)
+        HGOTO_DONE(SUCCEED)
+
+    /* Resolve the actual length of a speculatively loaded entry */
+    if (type->flags & H5C__CLASS_SPECULATIVE_LOAD_FLAG) {
+        if (type->get_final_load_size(mapped, *len, udata, &actual_len) < 0)
+            HGOTO_DONE(SUCCEED)
+
+        if (actual_len != *len) {
+            /* Verify that the length isn't past the EOA for the file */
+            if (H5C__verify_len_eoa(f, type, addr, &actual_len, TRUE) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "actual_len exceeds EOA")
+
+            /* Check that the rest of the image is mapped as well */
+            if (actual_len > *len) {
+                if (H5F_shared_get_mapping(f->shared, type->mem_type, addr, actual_len, &mapped) < 0)
+                    HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "can't get mapping of image")
+                if (NULL == mapped)
+                    HGOTO_DONE(SUCCEED)
+            } /* end if */
+        }     /* end if */
+    }         /* end if */
+
+    /* Verify the checksum for the metadata image */
+    if (type->verify_chksum) {
+        if ((chk_ret = type->verify_chksum(mapped, actual_len, udata)) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "failure from verify_chksum callback")
+        if (chk_ret == FALSE)
+            HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    *len   = actual_len;
+    *image = mapped;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__get_mapped_image() */
+
 /*-------------------------------------------------------------------------
  *
  * Function:    H5C__load_entry
@@ -7121,11 +7203,12 @@ H5C__load_entry(H5F_t *f,
 #endif /* H5_HAVE_PARALLEL */
                 const H5C_class_t *type, haddr_t addr, void *udata)
 {
-    hbool_t            dirty = FALSE; /* Flag indicating whether thing was dirtied during deserialize */
-    uint8_t *          image = NULL;  /* Buffer for disk image                    */
-    void *             thing = NULL;  /* Pointer to thing loaded                  */
-    H5C_cache_entry_t *entry = NULL;  /* Alias for thing loaded, as cache entry   */
-    size_t             len;           /* Size of image in file                    */
+    hbool_t            dirty  = FALSE; /* Flag indicating whether thing was dirtied during deserialize */
+    uint8_t *          image  = NULL;  /* Buffer for disk image                    */
+    const void *       mapped = NULL;  /* Disk image in the file's mapping         */
+    void *             thing  = NULL;  /* Pointer to thing loaded                  */
+    H5C_cache_entry_t *entry  = NULL;  /* Alias for thing loaded, as cache entry   */
+    size_t             len;            /* Size of image in file                    */
 #ifdef H5_HAVE_PARALLEL
     int      mpi_rank = 0;             /* MPI process rank                         */
     MPI_Comm comm     = MPI_COMM_NULL; /* File MPI Communicator                    */
@@ -7163,12 +7246,26 @@ H5C__load_entry(H5F_t *f,
         if (H5C__verify_len_eoa(f, type, addr, &len, FALSE) < 0)
             HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, NULL, "invalid len with respect to EOA")
 
+    /* Deserialize straight from the file when the file driver has mapped
+     * it and the file is only read: the cache never needs the image of an
+     * entry it won't write.
+     */
+    if (0 == (type->flags & H5C__CLASS_SKIP_READS) && !(H5F_INTENT(f) & H5F_ACC_RDWR)
+#ifdef H5_HAVE_PARALLEL
+        && !coll_access
+#endif /* H5_HAVE_PARALLEL */
+    )
+        if (H5C__get_mapped_image(f, type, addr, &len, udata, &mapped) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, NULL, "can't get mapped image")
+
     /* Allocate the buffer for reading the on-disk entry image */
-    if (NULL == (image = (uint8_t *)H5MM_malloc(len + H5C_IMAGE_EXTRA_SPACE)))
-        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, NULL, "memory allocation failed for on disk image buffer")
+    if (NULL == mapped) {
+        if (NULL == (image = (uint8_t *)H5MM_malloc(len + H5C_IMAGE_EXTRA_SPACE)))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, NULL, "memory allocation failed for on disk image buffer")
 #if H5C_DO_MEMORY_SANITY_CHECKS
-    H5MM_memcpy(image + len, H5C_IMAGE_SANITY_VALUE, H5C_IMAGE_EXTRA_SPACE);
+        H5MM_memcpy(image + len, H5C_IMAGE_SANITY_VALUE, H5C_IMAGE_EXTRA_SPACE);
 #endif /* H5C_DO_MEMORY_SANITY_CHECKS */
+    }  /* end if */
 
 #ifdef H5_HAVE_PARALLEL
     if (H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI)) {
@@ -7180,7 +7277,7 @@ H5C__load_entry(H5F_t *f,
 #endif /* H5_HAVE_PARALLEL */
 
     /* Get the on-disk entry image */
-    if (0 == (type->flags & H5C__CLASS_SKIP_READS)) {
+    if (NULL == mapped && 0 == (type->flags & H5C__CLASS_SKIP_READS)) {
         unsigned tries, max_tries;   /* The # of read attempts               */
         unsigned retries;            /* The # of retries                     */
         htri_t   chk_ret;            /* return from verify_chksum callback   */
@@ -7319,7 +7416,7 @@ H5C__load_entry(H5F_t *f,
     } /* end if !H5C__CLASS_SKIP_READS */
 
     /* Deserialize the on-disk image into the native memory form */
-    if (NULL == (thing = type->deserialize(image, len, udata, &dirty)))
+    if (NULL == (thing = type->deserialize(mapped ? mapped : image, len, udata, &dirty)))
         HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, NULL, "Can't deserialize image")
 
     entry = (H5C_cache_entry_t *)thing;
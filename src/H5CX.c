@@ -206,6 +206,9 @@ typedef struct H5CX_t {
     /* Internal: Metadata cache info */
     H5AC_ring_t ring; /* Current metadata cache ring for entries */
 
+    /* Internal: Inline variable-length data */
+    H5T_vlen_inline_t *vl_inline; /* Sequence data of the chunk being accessed */
+
 #ifdef H5_HAVE_PARALLEL
     /* Internal: Parallel I/O settings */
     hbool_t      coll_metadata_read; /* Whether to use collective I/O for metadata read */
@@ -252,6 +255,14 @@ typedef struct H5CX_t {
     hbool_t               vl_alloc_info_valid;  /* Whether VL datatype alloc info is valid */
     H5T_conv_cb_t         dt_conv_cb;           /* Datatype conversion struct (H5D_XFER_CONV_CB_NAME) */
     hbool_t               dt_conv_cb_valid;     /* Whether datatype conversion struct is valid */
+    unsigned              conv_nthreads;        /* # of datatype conversion threads (H5D_XFER_CONV_NTHREADS_NAME) */
+    hbool_t               conv_nthreads_valid;  /* Whether # of datatype conversion threads is valid */
+    hbool_t               tconv_overlap;        /* Overlap I/O & conversion (H5D_XFER_TCONV_OVERLAP_NAME) */
+    hbool_t               tconv_overlap_valid;  /* Whether overlapping I/O & conversion flag is valid */
+    hbool_t               sort_points;          /* Sort point selections (H5D_XFER_SORT_POINTS_NAME) */
+    hbool_t               sort_points_valid;    /* Whether sorting point selections flag is valid */
+    hbool_t               bypass_cache;         /* Read around caches (H5D_XFER_BYPASS_CACHE_NAME) */
+    hbool_t               bypass_cache_valid;   /* Whether bypassing caches flag is valid */
 
     /* Return-only DXPL properties to return to application */
 #ifdef H5_HAVE_PARALLEL
@@ -379,6 +390,10 @@ typedef struct H5CX_dxpl_cache_t {
     H5Z_data_xform_t *    data_transform; /* Data transform info (H5D_XFER_XFORM_NAME) */
     H5T_vlen_alloc_info_t vl_alloc_info;  /* VL datatype alloc info (H5D_XFER_VLEN_*_NAME) */
     H5T_conv_cb_t         dt_conv_cb;     /* Datatype conversion struct (H5D_XFER_CONV_CB_NAME) */
+    unsigned              conv_nthreads;  /* # of datatype conversion threads (H5D_XFER_CONV_NTHREADS_NAME) */
+    hbool_t               tconv_overlap;  /* Overlap I/O & conversion (H5D_XFER_TCONV_OVERLAP_NAME) */
+    hbool_t               sort_points;    /* Sort point selections (H5D_XFER_SORT_POINTS_NAME) */
+    hbool_t               bypass_cache;   /* Read around caches (H5D_XFER_BYPASS_CACHE_NAME) */
 } H5CX_dxpl_cache_t;
 
 /* Typedef for cached default link creation property list information */
@@ -570,6 +585,22 @@ H5CX__init_package(void)
     if (H5P_get(dx_plist, H5D_XFER_CONV_CB_NAME, &H5CX_def_dxpl_cache.dt_conv_cb) < 0)
         HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve datatype conversion exception callback")
 
+    /* Get # of datatype conversion threads */
+    if (H5P_get(dx_plist, H5D_XFER_CONV_NTHREADS_NAME, &H5CX_def_dxpl_cache.conv_nthreads) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve # of datatype conversion threads")
+
+    /* Get overlapping I/O & datatype conversion flag */
+    if (H5P_get(dx_plist, H5D_XFER_TCONV_OVERLAP_NAME, &H5CX_def_dxpl_cache.tconv_overlap) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve overlapping I/O & conversion flag")
+
+    /* Get sorting point selections flag */
+    if (H5P_get(dx_plist, H5D_XFER_SORT_POINTS_NAME, &H5CX_def_dxpl_cache.sort_points) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve sorting point selections flag")
+
+    /* Get bypassing caches flag */
+    if (H5P_get(dx_plist, H5D_XFER_BYPASS_CACHE_NAME, &H5CX_def_dxpl_cache.bypass_cache) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve bypassing caches flag")
+
     /* Reset the "default LCPL cache" information */
     HDmemset(&H5CX_def_lcpl_cache, 0, sizeof(H5CX_lcpl_cache_t));
 
@@ -1720,6 +1751,32 @@ H5CX_get_ring(void)
     FUNC_LEAVE_NOAPI((*head)->ctx.ring)
 } /* end H5CX_get_ring() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_vlen_inline
+ *
+ * Purpose:     Retrieves the inline variable-length sequence data of the
+ *              dataset chunk being accessed in the current API call
+ *              context, or NULL if variable-length data goes to the
+ *              global heap.
+ *
+ * Return:      Pointer to the sequence data / NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+H5T_vlen_inline_t *
+H5CX_get_vlen_inline(void)
+{
+    H5CX_node_t **head =
+        H5CX_get_my_context(); /* Get the pointer to the head of the API context, for this thread */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(head && *head);
+
+    FUNC_LEAVE_NOAPI((*head)->ctx.vl_inline)
+} /* end H5CX_get_vlen_inline() */
+
 #ifdef H5_HAVE_PARALLEL
 
 /*-------------------------------------------------------------------------
@@ -2530,6 +2587,138 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5CX_get_dt_conv_cb() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_conv_nthreads
+ *
+ * Purpose:     Retrieves the # of threads which may be used for datatype
+ *              conversion in the current API call context.
+ *
+ * Return:      Non-negative on success / Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5CX_get_conv_nthreads(unsigned *conv_nthreads)
+{
+    H5CX_node_t **head =
+        H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(conv_nthreads);
+    HDassert(head && *head);
+    HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
+
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_CONV_NTHREADS_NAME, conv_nthreads)
+
+    /* Get the value */
+    *conv_nthreads = (*head)->ctx.conv_nthreads;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5CX_get_conv_nthreads() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_tconv_overlap
+ *
+ * Purpose:     Retrieves whether I/O should be overlapped with datatype
+ *              conversion in the current API call context.
+ *
+ * Return:      Non-negative on success / Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5CX_get_tconv_overlap(hbool_t *tconv_overlap)
+{
+    H5CX_node_t **head =
+        H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(tconv_overlap);
+    HDassert(head && *head);
+    HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
+
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_TCONV_OVERLAP_NAME, tconv_overlap)
+
+    /* Get the value */
+    *tconv_overlap = (*head)->ctx.tconv_overlap;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5CX_get_tconv_overlap() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_sort_points
+ *
+ * Purpose:     Retrieves whether point selections in the file should be
+ *              sorted into file order for the current API call context.
+ *
+ * Return:      Non-negative on success / Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5CX_get_sort_points(hbool_t *sort_points)
+{
+    H5CX_node_t **head =
+        H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(sort_points);
+    HDassert(head && *head);
+    HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
+
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_SORT_POINTS_NAME, sort_points)
+
+    /* Get the value */
+    *sort_points = (*head)->ctx.sort_points;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5CX_get_sort_points() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_bypass_cache
+ *
+ * Purpose:     Retrieves whether reads should go around the data sieve
+ *              buffer and chunk cache for the current API call context.
+ *
+ * Return:      Non-negative on success / Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5CX_get_bypass_cache(hbool_t *bypass_cache)
+{
+    H5CX_node_t **head =
+        H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(bypass_cache);
+    HDassert(head && *head);
+    HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
+
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_BYPASS_CACHE_NAME, bypass_cache)
+
+    /* Get the value */
+    *bypass_cache = (*head)->ctx.bypass_cache;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5CX_get_bypass_cache() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5CX_get_encoding
  *
@@ -2883,6 +3072,34 @@ H5CX_set_ring(H5AC_ring_t ring)
     FUNC_LEAVE_NOAPI_VOID
 } /* end H5CX_set_ring() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_set_vlen_inline
+ *
+ * Purpose:     Sets the inline variable-length sequence data of the
+ *              dataset chunk being accessed in the current API call
+ *              context.  NULL sends variable-length data back to the
+ *              global heap.
+ *
+ * Return:      <none>
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5CX_set_vlen_inline(H5T_vlen_inline_t *vl_inline)
+{
+    H5CX_node_t **head =
+        H5CX_get_my_context(); /* Get the pointer to the head of the API context, for this thread */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(head && *head);
+
+    (*head)->ctx.vl_inline = vl_inline;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5CX_set_vlen_inline() */
+
 #ifdef H5_HAVE_PARALLEL
 
 /*-------------------------------------------------------------------------
@@ -86,12 +86,13 @@ H5_DLL herr_t H5CX_set_vol_wrap_ctx(void *wrap_ctx);
 H5_DLL herr_t H5CX_set_vol_connector_prop(const H5VL_connector_prop_t *vol_connector_prop);
 
 /* "Getter" routines for API context info */
-H5_DLL hid_t       H5CX_get_dxpl(void);
-H5_DLL hid_t       H5CX_get_lapl(void);
-H5_DLL herr_t      H5CX_get_vol_wrap_ctx(void **wrap_ctx);
-H5_DLL herr_t      H5CX_get_vol_connector_prop(H5VL_connector_prop_t *vol_connector_prop);
-H5_DLL haddr_t     H5CX_get_tag(void);
-H5_DLL H5AC_ring_t H5CX_get_ring(void);
+H5_DLL hid_t              H5CX_get_dxpl(void);
+H5_DLL hid_t              H5CX_get_lapl(void);
+H5_DLL herr_t             H5CX_get_vol_wrap_ctx(void **wrap_ctx);
+H5_DLL herr_t             H5CX_get_vol_connector_prop(H5VL_connector_prop_t *vol_connector_prop);
+H5_DLL haddr_t            H5CX_get_tag(void);
+H5_DLL H5AC_ring_t        H5CX_get_ring(void);
+H5_DLL H5T_vlen_inline_t *H5CX_get_vlen_inline(void);
 #ifdef H5_HAVE_PARALLEL
 H5_DLL hbool_t H5CX_get_coll_metadata_read(void);
 H5_DLL herr_t  H5CX_get_mpi_coll_datatypes(MPI_Datatype *btype, MPI_Datatype *ftype);
@@ -120,6 +121,10 @@ H5_DLL herr_t H5CX_get_filter_cb(H5Z_cb_t *filter_cb);
 H5_DLL herr_t H5CX_get_data_transform(H5Z_data_xform_t **data_transform);
 H5_DLL herr_t H5CX_get_vlen_alloc_info(H5T_vlen_alloc_info_t *vl_alloc_info);
 H5_DLL herr_t H5CX_get_dt_conv_cb(H5T_conv_cb_t *cb_struct);
+H5_DLL herr_t H5CX_get_conv_nthreads(unsigned *conv_nthreads);
+H5_DLL herr_t H5CX_get_tconv_overlap(hbool_t *tconv_overlap);
+H5_DLL herr_t H5CX_get_sort_points(hbool_t *sort_points);
+H5_DLL herr_t H5CX_get_bypass_cache(hbool_t *bypass_cache);
 
 /* "Getter" routines for LCPL properties cached in API context */
 H5_DLL herr_t H5CX_get_encoding(H5T_cset_t *encoding);
@@ -142,6 +147,7 @@ H5_DLL herr_t H5CX_get_libver_bounds(H5F_libver_t *low_bound, H5F_libver_t *high
 /* "Setter" routines for API context info */
 H5_DLL void H5CX_set_tag(haddr_t tag);
 H5_DLL void H5CX_set_ring(H5AC_ring_t ring);
+H5_DLL void H5CX_set_vlen_inline(H5T_vlen_inline_t *vl_inline);
 #ifdef H5_HAVE_PARALLEL
 H5_DLL void   H5CX_set_coll_metadata_read(hbool_t cmdr);
 H5_DLL herr_t H5CX_set_mpi_coll_datatypes(MPI_Datatype btype, MPI_Datatype ftype);
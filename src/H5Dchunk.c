@@ -80,6 +80,10 @@
              (H5D_CHUNK_IDX_SINGLE == (storage)->idx_type && H5D_COPS_SINGLE == (storage)->ops) ||           \
              (H5D_CHUNK_IDX_NONE == (storage)->idx_type && H5D_COPS_NONE == (storage)->ops));
 
+/* Whether a dataset's chunks hold its variable-length sequence data */
+#define H5D_CHUNK_VLEN_INLINE(dset)                                                                          \
+    (H5Z_filter_in_pline(&((dset)->shared->dcpl_cache.pline), H5Z_FILTER_VLEN_INLINE) > 0)
+
 /*
  * Feature: If this constant is defined then every cache preemption and load
  *        causes a character to be printed on the standard error stream:
@@ -128,6 +132,7 @@ typedef struct H5D_rdcc_ent_t {
     H5F_block_t            chunk_block;              /*offset/length of chunk in file        */
     hsize_t                chunk_idx;                /*index of chunk in dataset             */
     uint8_t *              chunk;                    /*the unfiltered chunk data        */
+    H5T_vlen_inline_t      vl_inline;                /*inline VL sequence data of the chunk */
     unsigned               idx;                      /*index in hash table            */
     struct H5D_rdcc_ent_t *next;                     /*next item in doubly-linked list    */
     struct H5D_rdcc_ent_t *prev;                     /*previous item in doubly-linked list    */
@@ -191,8 +196,9 @@ typedef struct H5D_chunk_it_ud3_t {
     H5O_copy_t *cpy_info; /* Copy options */
 
     /* needed for getting raw data from chunk cache */
-    hbool_t  chunk_in_cache;
-    uint8_t *chunk; /* the unfiltered chunk data        */
+    hbool_t                  chunk_in_cache;
+    uint8_t *                chunk;     /* the unfiltered chunk data        */
+    const H5T_vlen_inline_t *vl_inline; /* the chunk's inline VL sequence data */
 } H5D_chunk_it_ud3_t;
 
 /* Callback info for iteration to dump index */
@@ -2461,6 +2467,8 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_
     hbool_t       cpt_dirty;                     /* Temporary placeholder for compact storage "dirty" flag */
     uint32_t      src_accessed_bytes  = 0;       /* Total accessed size in a chunk */
     hbool_t       skip_missing_chunks = FALSE;   /* Whether to skip missing chunks */
+    hbool_t       bypass_cache        = FALSE;   /* Whether to read uncached chunks around the cache */
+    hbool_t       use_select_io;                 /* Whether chunks in the file are read as selections */
     herr_t        ret_value           = SUCCEED; /*return value        */
 
     FUNC_ENTER_STATIC
@@ -2509,6 +2517,13 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_
             skip_missing_chunks = TRUE;
     }
 
+    /* Check whether to read straight into the destination buffer */
+    if (H5CX_get_bypass_cache(&bypass_cache) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get bypassing caches flag")
+
+    /* Check whether chunks read from the file can be handed to the file driver whole */
+    use_select_io = H5D__contig_may_use_select_io(&ctg_io_info, FALSE);
+
     /* Iterate through nodes in chunk skip list */
     chunk_node = H5D_CHUNK_GET_FIRST_NODE(fm);
     while (chunk_node) {
@@ -2539,6 +2554,29 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_
             /* Determine if we should use the chunk cache */
             if ((cacheable = H5D__chunk_cacheable(io_info, udata.chunk_block.offset, FALSE)) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't tell if chunk is cacheable")
+
+            /* Read unfiltered chunks that aren't in the cache straight into the
+             * destination buffer, when that takes a single read */
+            if (cacheable && bypass_cache && UINT_MAX == udata.idx_hint &&
+                0 == io_info->dset->shared->dcpl_cache.pline.nused &&
+                H5S_SELECT_IS_CONTIGUOUS(chunk_info->fspace) == TRUE &&
+                H5S_SELECT_IS_CONTIGUOUS(chunk_info->mspace) == TRUE)
+                cacheable = FALSE;
+
+            /* Copy unfiltered chunks that aren't in the cache straight out of
+             * the file, when the file driver has mapped it into memory */
+            if (cacheable && UINT_MAX == udata.idx_hint &&
+                0 == io_info->dset->shared->dcpl_cache.pline.nused &&
+                H5F_addr_defined(udata.chunk_block.offset)) {
+                const void *mapped = NULL; /* The chunk in the file's mapping */
+
+                if (H5F_shared_get_mapping(io_info->f_sh, H5FD_MEM_DRAW, udata.chunk_block.offset,
+                                           (size_t)udata.chunk_block.length, &mapped) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get mapping of chunk")
+                if (mapped)
+                    cacheable = FALSE;
+            } /* end if */
+
             if (cacheable) {
                 /* Load the chunk into cache and lock it. */
 
@@ -2568,10 +2606,19 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_
                 chk_io_info = &nonexistent_io_info;
             } /* end else */
 
+            /* Point VL conversions at the chunk's VL sequence data, if it has any */
+            H5CX_set_vlen_inline(chunk ? udata.vl_inline : NULL);
+
             /* Perform the actual read operation */
-            if ((io_info->io_ops.single_read)(chk_io_info, type_info, (hsize_t)chunk_info->chunk_points,
-                                              chunk_info->fspace, chunk_info->mspace) < 0)
+            if (chk_io_info == &ctg_io_info && use_select_io) {
+                if (H5D__contig_select_io(chk_io_info, type_info, chunk_info->fspace, chunk_info->mspace,
+                                          FALSE) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "chunked read failed")
+            } /* end if */
+            else if ((io_info->io_ops.single_read)(chk_io_info, type_info, (hsize_t)chunk_info->chunk_points,
+                                                   chunk_info->fspace, chunk_info->mspace) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "chunked read failed")
+            H5CX_set_vlen_inline(NULL);
 
             /* Release the cache lock on the chunk. */
             if (chunk && H5D__chunk_unlock(io_info, &udata, FALSE, chunk, src_accessed_bytes) < 0)
@@ -2583,6 +2630,8 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_
     } /* end while */
 
 done:
+    H5CX_set_vlen_inline(NULL);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__chunk_read() */
 
@@ -2610,6 +2659,7 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize
     H5D_storage_t cpt_store;                    /* Chunk storage information as compact dataset */
     hbool_t       cpt_dirty;                    /* Temporary placeholder for compact storage "dirty" flag */
     uint32_t      dst_accessed_bytes = 0;       /* Total accessed size in a chunk */
+    hbool_t       use_select_io;                /* Whether chunks in the file are written as selections */
     herr_t        ret_value          = SUCCEED; /* Return value        */
 
     FUNC_ENTER_STATIC
@@ -2637,6 +2687,9 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize
     /* Initialize temporary compact storage info */
     cpt_store.compact.dirty = &cpt_dirty;
 
+    /* Check whether chunks written to the file can be handed to the file driver whole */
+    use_select_io = H5D__contig_may_use_select_io(&ctg_io_info, TRUE);
+
     /* Iterate through nodes in chunk skip list */
     chunk_node = H5D_CHUNK_GET_FIRST_NODE(fm);
     while (chunk_node) {
@@ -2689,6 +2742,10 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize
 
             /* Point I/O info at main I/O info for this chunk */
             chk_io_info = &cpt_io_info;
+
+            /* The old VL sequence data won't be needed when the whole chunk is written */
+            if (udata.vl_inline && entire_chunk)
+                udata.vl_inline->size = 0;
         } /* end if */
         else {
             /* If the chunk hasn't been allocated on disk, do so now. */
@@ -2726,10 +2783,27 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize
             chk_io_info = &ctg_io_info;
         } /* end else */
 
+        /* Point VL conversions at the chunk's VL sequence data, if it has any */
+        H5CX_set_vlen_inline(chunk ? udata.vl_inline : NULL);
+
         /* Perform the actual write operation */
-        if ((io_info->io_ops.single_write)(chk_io_info, type_info, (hsize_t)chunk_info->chunk_points,
-                                           chunk_info->fspace, chunk_info->mspace) < 0)
+        if (chk_io_info == &ctg_io_info && use_select_io) {
+            if (H5D__contig_select_io(chk_io_info, type_info, chunk_info->fspace, chunk_info->mspace, TRUE) <
+                0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "chunked write failed")
+        } /* end if */
+        else if ((io_info->io_ops.single_write)(chk_io_info, type_info, (hsize_t)chunk_info->chunk_points,
+                                                chunk_info->fspace, chunk_info->mspace) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "chunked write failed")
+        H5CX_set_vlen_inline(NULL);
+
+        /* Drop the replaced VL sequence data once it outgrows the rest of the chunk */
+        if (chunk && udata.vl_inline &&
+            udata.vl_inline->size > 2 * MAX(udata.vl_inline->packed, (size_t)ctg_store.contig.dset_size))
+            if (H5T_vlen_inline_pack(io_info->dset->shared->type, chunk,
+                                     (size_t)ctg_store.contig.dset_size / type_info->dst_type_size,
+                                     udata.vl_inline) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTPACK, FAIL, "unable to pack VL sequence data")
 
         /* Release the cache lock on the chunk, or insert chunk into index. */
         if (chunk) {
@@ -2747,6 +2821,8 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize
     } /* end while */
 
 done:
+    H5CX_set_vlen_inline(NULL);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__chunk_write() */
 
@@ -3176,6 +3252,7 @@ H5D__chunk_lookup(const H5D_t *dset, const hsize_t *scaled, H5D_chunk_ud_t *udat
     udata->chunk_block.length = 0;
     udata->filter_mask        = 0;
     udata->new_unfilt_chunk   = FALSE;
+    udata->vl_inline          = NULL;
 
     /* Check for chunk in cache */
     if (dset->shared->cache.chunk.nslots > 0) {
@@ -3332,8 +3409,24 @@ H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get error detection info")
             if (H5CX_get_filter_cb(&filter_cb) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get I/O filter callback function")
+            H5_CHECKED_ASSIGN(nbytes, size_t, udata.chunk_block.length, hsize_t);
 
-            if (!reset) {
+            if (H5D_CHUNK_VLEN_INLINE(dset)) {
+                /* Drop the unused VL sequence data and copy the rest after
+                 * the elements, so they go through the pipeline together
+                 */
+                if (H5T_vlen_inline_pack(dset->shared->type, ent->chunk,
+                                         nbytes / H5T_get_size(dset->shared->type), &ent->vl_inline) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTPACK, FAIL, "unable to pack VL sequence data")
+                alloc += ent->vl_inline.size;
+                if (NULL == (buf = H5MM_malloc(alloc)))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for pipeline")
+                H5MM_memcpy(buf, ent->chunk, nbytes);
+                if (ent->vl_inline.size > 0)
+                    H5MM_memcpy((uint8_t *)buf + nbytes, ent->vl_inline.buf, ent->vl_inline.size);
+                nbytes = alloc;
+            } /* end if */
+            else if (!reset) {
                 /*
                  * Copy the chunk to a new buffer before running it through
                  * the pipeline because we'll want to save the original buffer
@@ -3354,7 +3447,6 @@ H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset)
                 point_of_no_return = TRUE;
                 ent->chunk         = NULL;
             } /* end else */
-            H5_CHECKED_ASSIGN(nbytes, size_t, udata.chunk_block.length, hsize_t);
             if (H5Z_pipeline(&(dset->shared->dcpl_cache.pline), 0, &(udata.filter_mask), err_detect,
                              filter_cb, &nbytes, &alloc, &buf) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "output pipeline failed")
@@ -3443,6 +3535,8 @@ H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset)
                                                          ((ent->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS)
                                                               ? NULL
                                                               : &(dset->shared->dcpl_cache.pline)));
+        ent->vl_inline.buf = (uint8_t *)H5MM_xfree(ent->vl_inline.buf);
+        ent->vl_inline.size = ent->vl_inline.alloc = ent->vl_inline.packed = 0;
     } /* end if */
 
 done:
@@ -3507,6 +3601,9 @@ H5D__chunk_cache_evict(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t flush)
                                                               : &(dset->shared->dcpl_cache.pline)));
     } /* end else */
 
+    /* Free the VL sequence data, if the flush didn't */
+    ent->vl_inline.buf = (uint8_t *)H5MM_xfree(ent->vl_inline.buf);
+
     /* Unlink from list */
     if (ent->prev)
         ent->prev->next = ent->next;
@@ -3696,8 +3793,10 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
     H5D_rdcc_ent_t *    ent;                                         /*cache entry        */
     size_t              chunk_size;                                  /*size of a chunk    */
     hbool_t             disable_filters = FALSE; /* Whether to disable filters (when adding to cache) */
-    void *              chunk           = NULL;  /*the file chunk    */
-    void *              ret_value       = NULL;  /* Return value         */
+    hbool_t             has_vl_inline;           /* Whether the chunks hold VL sequence data */
+    H5T_vlen_inline_t   vl_inline;               /* Inline VL sequence data read with the chunk */
+    void *              chunk     = NULL;        /*the file chunk    */
+    void *              ret_value = NULL;        /* Return value         */
 
     FUNC_ENTER_STATIC
 
@@ -3713,6 +3812,11 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
     HDassert(layout->u.chunk.size > 0);
     H5_CHECKED_ASSIGN(chunk_size, size_t, layout->u.chunk.size, uint32_t);
 
+    /* Check if the chunks hold their VL sequence data */
+    has_vl_inline = H5D_CHUNK_VLEN_INLINE(dset);
+    HDmemset(&vl_inline, 0, sizeof(vl_inline));
+    udata->vl_inline = NULL;
+
     /* Check if the chunk is in the cache */
     if (UINT_MAX != udata->idx_hint) {
         /* Sanity check */
@@ -3905,6 +4009,20 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
                                      filter_cb, &my_chunk_alloc, &buf_alloc, &chunk) < 0)
                         HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, NULL, "data pipeline read failed")
 
+                    /* Split off the VL sequence data after the elements */
+                    if (has_vl_inline) {
+                        if (my_chunk_alloc < chunk_size)
+                            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, NULL,
+                                        "chunk is too small for its elements")
+                        if (my_chunk_alloc > chunk_size) {
+                            vl_inline.size = vl_inline.alloc = vl_inline.packed = my_chunk_alloc - chunk_size;
+                            if (NULL == (vl_inline.buf = (uint8_t *)H5MM_malloc(vl_inline.alloc)))
+                                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL,
+                                            "memory allocation failed for VL sequence data")
+                            H5MM_memcpy(vl_inline.buf, (uint8_t *)chunk + chunk_size, vl_inline.size);
+                        } /* end if */
+                    }     /* end if */
+
                     /* Reallocate chunk if necessary */
                     if (udata->new_unfilt_chunk) {
                         void *tmp_chunk = chunk;
@@ -4000,6 +4118,10 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
                 H5_CHECKED_ASSIGN(ent->wr_count, uint32_t, chunk_size, size_t);
                 ent->chunk = (uint8_t *)chunk;
 
+                /* Hand the VL sequence data over to the entry */
+                ent->vl_inline = vl_inline;
+                HDmemset(&vl_inline, 0, sizeof(vl_inline));
+
                 /* Add it to the cache */
                 HDassert(NULL == rdcc->slot[udata->idx_hint]);
                 rdcc->slot[udata->idx_hint] = ent;
@@ -4032,8 +4154,11 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
         HDassert(!ent->locked);
         ent->locked = TRUE;
         chunk       = ent->chunk;
+
+        if (has_vl_inline)
+            udata->vl_inline = &ent->vl_inline;
     } /* end if */
-    else
+    else {
         /*
          * The chunk cannot be placed in cache so we don't cache it. This is the
          * reason all those arguments have to be repeated for the unlock
@@ -4041,6 +4166,15 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
          */
         udata->idx_hint = UINT_MAX;
 
+        /* Keep the VL sequence data with the caller until the unlock */
+        if (has_vl_inline) {
+            if (NULL == (udata->vl_inline = (H5T_vlen_inline_t *)H5MM_malloc(sizeof(H5T_vlen_inline_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for VL sequence data")
+            *udata->vl_inline = vl_inline;
+            HDmemset(&vl_inline, 0, sizeof(vl_inline));
+        } /* end if */
+    }     /* end else */
+
     /* Set return value */
     ret_value = chunk;
 
@@ -4054,6 +4188,9 @@ done:
         if (chunk)
             chunk = H5D__chunk_mem_xfree(chunk, pline);
 
+    /* Release VL sequence data not handed over */
+    H5MM_xfree(vl_inline.buf);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_lock() */
 
@@ -4128,6 +4265,10 @@ H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata, hbo
             fake_ent.chunk_block.offset = udata->chunk_block.offset;
             fake_ent.chunk_block.length = udata->chunk_block.length;
             fake_ent.chunk              = (uint8_t *)chunk;
+            if (udata->vl_inline) {
+                fake_ent.vl_inline = *udata->vl_inline;
+                HDmemset(udata->vl_inline, 0, sizeof(H5T_vlen_inline_t));
+            } /* end if */
 
             if (H5D__chunk_flush_entry(io_info->dset, &fake_ent, TRUE) < 0)
                 HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
@@ -4161,6 +4302,12 @@ H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata, hbo
     } /* end else */
 
 done:
+    /* Release the VL sequence data of a chunk that isn't cached */
+    if (UINT_MAX == udata->idx_hint && udata->vl_inline) {
+        H5MM_xfree(udata->vl_inline->buf);
+        H5MM_xfree(udata->vl_inline);
+    } /* end if */
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_unlock() */
 
@@ -6026,6 +6173,7 @@ H5D__chunk_copy_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
 
             H5_CHECKED_ASSIGN(nbytes, size_t, shared_fo->layout.u.chunk.size, uint32_t);
             H5MM_memcpy(buf, ent->chunk, nbytes);
+            udata->vl_inline = &ent->vl_inline;
         }
         else {
             /* read chunk data from the source file */
@@ -6034,6 +6182,22 @@ H5D__chunk_copy_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
         }
     }
 
+    /* Append the inline VL sequence data of a chunk found in cache, as it would be flushed */
+    if (udata->chunk_in_cache && udata->vl_inline && udata->vl_inline->size > 0) {
+        if (nbytes + udata->vl_inline->size > buf_size) {
+            void *new_buf; /* New buffer for data */
+
+            if (NULL == (new_buf = H5MM_realloc(udata->buf, nbytes + udata->vl_inline->size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, H5_ITER_ERROR,
+                            "memory allocation failed for raw data chunk")
+            buf             = udata->buf = new_buf;
+            udata->buf_size = buf_size = nbytes + udata->vl_inline->size;
+        } /* end if */
+        H5MM_memcpy((uint8_t *)buf + nbytes, udata->vl_inline->buf, udata->vl_inline->size);
+        nbytes += udata->vl_inline->size;
+    } /* end if */
+    udata->vl_inline = NULL;
+
     /* Need to uncompress filtered variable-length & reference data elements that are not found in chunk cache
      */
     if (must_filter && (is_vlen || fix_ref) && !udata->chunk_in_cache) {
@@ -6247,8 +6411,11 @@ H5D__chunk_copy(H5F_t *f_src, H5O_storage_chunk_t *storage_src, H5O_layout_chunk
     if ((tid_src = H5I_register(H5I_DATATYPE, dt_src, FALSE)) < 0)
         HGOTO_ERROR(H5E_DATATYPE, H5E_CANTREGISTER, FAIL, "unable to register source file datatype")
 
-    /* If there's a VLEN source datatype, set up type conversion information */
-    if (H5T_detect_class(dt_src, H5T_VLEN, FALSE) > 0) {
+    /* If there's a VLEN source datatype, set up type conversion information
+     * (chunks holding their VL sequence data can be copied as they are)
+     */
+    if (H5T_detect_class(dt_src, H5T_VLEN, FALSE) > 0 &&
+        H5Z_filter_in_pline(pline, H5Z_FILTER_VLEN_INLINE) <= 0) {
         H5T_t *  dt_dst;      /* Destination datatype */
         H5T_t *  dt_mem;      /* Memory datatype */
         size_t   mem_dt_size; /* Memory datatype size */
@@ -6391,6 +6558,7 @@ H5D__chunk_copy(H5F_t *f_src, H5O_storage_chunk_t *storage_src, H5O_layout_chunk
             if (!H5F_addr_defined(ent->chunk_block.offset)) {
                 H5MM_memcpy(chunk_rec.scaled, ent->scaled, sizeof(chunk_rec.scaled));
                 udata.chunk          = ent->chunk;
+                udata.vl_inline      = &ent->vl_inline;
                 udata.chunk_in_cache = TRUE;
                 if (H5D__chunk_copy_cb(&chunk_rec, &udata) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "unable to copy chunk data in cache")
@@ -49,6 +49,17 @@
 /* Local Macros */
 /****************/
 
+/* Smallest amount of data read into a new sieve window */
+#define H5D_SIEVE_MIN_FILL_SIZE 512
+
+/* Sequences at least this long are read around the sieve buffer when
+ * bypassing caches (smaller ones are better combined into one read) */
+#define H5D_SIEVE_BYPASS_SIZE 4096
+
+/* Number of sequences passed to the file driver in one vector request
+ * when data sieving isn't used */
+#define H5D_CONTIG_VECTOR_SIZE 64
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -59,13 +70,19 @@ typedef struct H5D_contig_readvv_sieve_ud_t {
     H5D_rdcdc_t *               dset_contig;  /* Cached information about contiguous data */
     const H5D_contig_storage_t *store_contig; /* Contiguous storage info for this I/O operation */
     unsigned char *             rbuf;         /* Pointer to buffer to fill */
+    size_t                      max_len;      /* Longest sequence to read through the sieve buffer */
 } H5D_contig_readvv_sieve_ud_t;
 
 /* Callback info for [plain] readvv operation */
 typedef struct H5D_contig_readvv_ud_t {
-    H5F_shared_t * f_sh;      /* Shared file for dataset */
-    haddr_t        dset_addr; /* Address of dataset */
-    unsigned char *rbuf;      /* Pointer to buffer to fill */
+    H5F_shared_t * f_sh;                          /* Shared file for dataset */
+    haddr_t        dset_addr;                     /* Address of dataset */
+    unsigned char *rbuf;                          /* Pointer to buffer to fill */
+    uint32_t       nqueued;                       /* Number of sequences queued for reading */
+    H5FD_mem_t     types[H5D_CONTIG_VECTOR_SIZE]; /* Memory types of the queued sequences */
+    haddr_t        addrs[H5D_CONTIG_VECTOR_SIZE]; /* File addresses of the queued sequences */
+    size_t         sizes[H5D_CONTIG_VECTOR_SIZE]; /* Lengths of the queued sequences */
+    void *         bufs[H5D_CONTIG_VECTOR_SIZE];  /* Destinations of the queued sequences */
 } H5D_contig_readvv_ud_t;
 
 /* Callback info for sieve buffer writevv operation */
@@ -78,9 +95,14 @@ typedef struct H5D_contig_writevv_sieve_ud_t {
 
 /* Callback info for [plain] writevv operation */
 typedef struct H5D_contig_writevv_ud_t {
-    H5F_shared_t *       f_sh;      /* Shared file for dataset */
-    haddr_t              dset_addr; /* Address of dataset */
-    const unsigned char *wbuf;      /* Pointer to buffer to write */
+    H5F_shared_t *       f_sh;                          /* Shared file for dataset */
+    haddr_t              dset_addr;                     /* Address of dataset */
+    const unsigned char *wbuf;                          /* Pointer to buffer to write */
+    uint32_t             nqueued;                       /* Number of sequences queued for writing */
+    H5FD_mem_t           types[H5D_CONTIG_VECTOR_SIZE]; /* Memory types of the queued sequences */
+    haddr_t              addrs[H5D_CONTIG_VECTOR_SIZE]; /* File addresses of the queued sequences */
+    size_t               sizes[H5D_CONTIG_VECTOR_SIZE]; /* Lengths of the queued sequences */
+    const void *         bufs[H5D_CONTIG_VECTOR_SIZE];  /* Sources of the queued sequences */
 } H5D_contig_writevv_ud_t;
 
 /********************/
@@ -102,7 +124,15 @@ static ssize_t H5D__contig_writevv(const H5D_io_info_t *io_info, size_t dset_max
 static herr_t  H5D__contig_flush(H5D_t *dset);
 
 /* Helper routines */
-static herr_t H5D__contig_write_one(H5D_io_info_t *io_info, hsize_t offset, size_t size);
+static herr_t  H5D__contig_write_one(H5D_io_info_t *io_info, hsize_t offset, size_t size);
+static void    H5D__contig_sieve_swap(H5D_rdcdc_t *dset_contig, unsigned idx);
+static hbool_t H5D__contig_sieve_find(H5D_rdcdc_t *dset_contig, haddr_t addr, size_t len);
+static herr_t  H5D__contig_sieve_release(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig, haddr_t addr,
+                                         hsize_t len, hbool_t discard);
+static herr_t  H5D__contig_sieve_make_room(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig, haddr_t addr);
+static herr_t  H5D__contig_sieve_fill(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig,
+                                      const H5D_contig_storage_t *store_contig, haddr_t addr, hsize_t dst_off,
+                                      size_t len, hbool_t is_write);
 
 /*********************/
 /* Package Variables */
@@ -533,7 +563,7 @@ H5D__contig_is_data_cached(const H5D_shared_t *shared_dset)
     /* Sanity checks */
     HDassert(shared_dset);
 
-    FUNC_LEAVE_NOAPI(shared_dset->cache.contig.sieve_size > 0)
+    FUNC_LEAVE_NOAPI(shared_dset->cache.contig.sieve_size > 0 || shared_dset->cache.contig.nwin > 0)
 } /* end H5D__contig_is_data_cached() */
 
 /*-------------------------------------------------------------------------
@@ -561,6 +591,96 @@ H5D__contig_io_init(const H5D_io_info_t *io_info, const H5D_type_info_t H5_ATTR_
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5D__contig_io_init() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__contig_may_use_select_io
+ *
+ * Purpose:     Checks whether the selections for an I/O operation on
+ *              contiguous storage (or a chunk read or written as if it
+ *              were contiguous) can be handed to the file driver whole,
+ *              instead of being broken into sequences that go through
+ *              the sieve buffer.
+ *
+ *              That's possible when the elements don't need to be
+ *              converted or transformed, the file driver has selection
+ *              callbacks, and nothing is held in the sieve buffer that
+ *              the driver would miss or that would go stale.
+ *
+ * Return:      TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5D__contig_may_use_select_io(const H5D_io_info_t *io_info, hbool_t is_write)
+{
+    hbool_t ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity check */
+    HDassert(io_info);
+
+    /* Compact and external storage share the contiguous read & write routines */
+    if (io_info->layout_ops.readvv == H5D__contig_readvv &&
+        (is_write ? io_info->io_ops.single_write == H5D__select_write
+                  : io_info->io_ops.single_read == H5D__select_read) &&
+        !H5D__contig_is_data_cached(io_info->dset->shared) &&
+        H5F_shared_has_select_io(H5F_SHARED(io_info->dset->oloc.file)))
+        ret_value = TRUE;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_may_use_select_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__contig_select_io
+ *
+ * Purpose:     Reads or writes the elements selected in FILE_SPACE of the
+ *              contiguous storage in IO_INFO, from or to the elements
+ *              selected in MEM_SPACE of the application's buffer, as one
+ *              selection request to the file driver.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__contig_select_io(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+                      const H5S_t *file_space, const H5S_t *mem_space, hbool_t is_write)
+{
+    H5F_shared_t *f_sh = H5F_SHARED(io_info->dset->oloc.file); /* Shared file info */
+    haddr_t       addr;                                        /* Address of the storage */
+    size_t        elmt_size;                                   /* Size of each element */
+    herr_t        ret_value = SUCCEED;                         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(io_info);
+    HDassert(type_info);
+    HDassert(file_space);
+    HDassert(mem_space);
+
+    addr = io_info->store->contig.dset_addr;
+    if (is_write) {
+        const void *buf = io_info->u.wbuf; /* Buffer to write from */
+
+        elmt_size = type_info->dst_type_size;
+        if (H5F_shared_select_write(f_sh, H5FD_MEM_DRAW, (uint32_t)1, &mem_space, &file_space, &addr,
+                                    &elmt_size, &buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "selection write failed")
+    } /* end if */
+    else {
+        void *buf = io_info->u.rbuf; /* Buffer to read into */
+
+        elmt_size = type_info->src_type_size;
+        if (H5F_shared_select_read(f_sh, H5FD_MEM_DRAW, (uint32_t)1, &mem_space, &file_space, &addr,
+                                   &elmt_size, &buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "selection read failed")
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_select_io() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__contig_read
  *
@@ -589,7 +709,11 @@ H5D__contig_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize
     HDassert(file_space);
 
     /* Read data */
-    if ((io_info->io_ops.single_read)(io_info, type_info, nelmts, file_space, mem_space) < 0)
+    if (H5D__contig_may_use_select_io(io_info, FALSE)) {
+        if (H5D__contig_select_io(io_info, type_info, file_space, mem_space, FALSE) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "contiguous read failed")
+    } /* end if */
+    else if ((io_info->io_ops.single_read)(io_info, type_info, nelmts, file_space, mem_space) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "contiguous read failed")
 
 done:
@@ -624,7 +748,11 @@ H5D__contig_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsiz
     HDassert(file_space);
 
     /* Write data */
-    if ((io_info->io_ops.single_write)(io_info, type_info, nelmts, file_space, mem_space) < 0)
+    if (H5D__contig_may_use_select_io(io_info, TRUE)) {
+        if (H5D__contig_select_io(io_info, type_info, file_space, mem_space, TRUE) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "contiguous write failed")
+    } /* end if */
+    else if ((io_info->io_ops.single_write)(io_info, type_info, nelmts, file_space, mem_space) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "contiguous write failed")
 
 done:
@@ -668,6 +796,355 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__contig_write_one() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_swap
+ *
+ * Purpose:	Makes one of the other sieve windows the current one, moving
+ *		the current window to the front of the other windows.
+ *
+ * Return:	None
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__contig_sieve_swap(H5D_rdcdc_t *dset_contig, unsigned idx)
+{
+    H5D_sieve_win_t win; /* Window becoming current */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(dset_contig);
+    HDassert(idx < dset_contig->nwin);
+
+    win = dset_contig->win[idx];
+    HDmemmove(&dset_contig->win[1], &dset_contig->win[0], idx * sizeof(H5D_sieve_win_t));
+    dset_contig->win[0].buf   = dset_contig->sieve_buf;
+    dset_contig->win[0].loc   = dset_contig->sieve_loc;
+    dset_contig->win[0].size  = dset_contig->sieve_size;
+    dset_contig->win[0].dirty = dset_contig->sieve_dirty;
+    dset_contig->win[0].nhits = dset_contig->sieve_nhits;
+
+    dset_contig->sieve_buf   = win.buf;
+    dset_contig->sieve_loc   = win.loc;
+    dset_contig->sieve_size  = win.size;
+    dset_contig->sieve_dirty = win.dirty;
+    dset_contig->sieve_nhits = win.nhits;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__contig_sieve_swap() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_find
+ *
+ * Purpose:	Looks for a sieve window, other than the current one, that
+ *		holds all of the LEN bytes at ADDR and makes it current.
+ *
+ * Return:	TRUE if the data is now in the current window, FALSE if not
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5D__contig_sieve_find(H5D_rdcdc_t *dset_contig, haddr_t addr, size_t len)
+{
+    unsigned u;                 /* Local index variable */
+    hbool_t  ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(dset_contig);
+
+    for (u = 0; u < dset_contig->nwin; u++)
+        if (addr >= dset_contig->win[u].loc &&
+            (addr + len) <= (dset_contig->win[u].loc + dset_contig->win[u].size)) {
+            H5D__contig_sieve_swap(dset_contig, u);
+            ret_value = TRUE;
+            break;
+        } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_sieve_find() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_release
+ *
+ * Purpose:	Writes out the sieve windows, other than the current one,
+ *		that overlap the LEN bytes at ADDR if they are dirty.  If
+ *		DISCARD is set the windows are also dropped, because the
+ *		file data they overlap is about to change.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_sieve_release(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig, haddr_t addr, hsize_t len,
+                          hbool_t discard)
+{
+    unsigned u         = 0;       /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(f_sh);
+    HDassert(dset_contig);
+
+    while (u < dset_contig->nwin) {
+        H5D_sieve_win_t *win = &dset_contig->win[u]; /* Window to check */
+
+        if (addr < (win->loc + win->size) && win->loc < (addr + len)) {
+            /* Flush the window, if it's dirty */
+            if (win->dirty) {
+                if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, win->loc, win->size, win->buf) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+                win->dirty = FALSE;
+            } /* end if */
+
+            if (discard) {
+                win->buf = (unsigned char *)H5FL_BLK_FREE(sieve_buf, win->buf);
+                HDmemmove(win, win + 1, (dset_contig->nwin - u - 1) * sizeof(H5D_sieve_win_t));
+                dset_contig->nwin--;
+                continue;
+            } /* end if */
+        }     /* end if */
+
+        u++;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_sieve_release() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_make_room
+ *
+ * Purpose:	Chooses the sieve window to fill for an access at ADDR that
+ *		missed all the windows, and makes it the current window.
+ *
+ *		An access that falls just past a window continues the same
+ *		stream of accesses, so that window is reused.  Otherwise the
+ *		current window is kept for later, in place of the least
+ *		recently used window when there are no free windows, and a
+ *		new, empty, window becomes current.  This lets interleaved
+ *		access to several parts of the data (reading several columns,
+ *		for instance) keep one window for each part.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_sieve_make_room(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig, haddr_t addr)
+{
+    unsigned char *new_buf;             /* Buffer for the new current window */
+    unsigned       u;                   /* Local index variable */
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(f_sh);
+    HDassert(dset_contig);
+    HDassert(dset_contig->sieve_buf);
+
+    /* Nothing to keep if the current window is empty */
+    if (0 == dset_contig->sieve_size || !H5F_addr_defined(dset_contig->sieve_loc))
+        HGOTO_DONE(SUCCEED)
+
+    /* Reuse the window that this access continues, if there is one */
+    if (addr >= dset_contig->sieve_loc &&
+        (addr - dset_contig->sieve_loc) < (dset_contig->sieve_size + dset_contig->sieve_buf_size))
+        HGOTO_DONE(SUCCEED)
+    for (u = 0; u < dset_contig->nwin; u++)
+        if (addr >= dset_contig->win[u].loc &&
+            (addr - dset_contig->win[u].loc) < (dset_contig->win[u].size + dset_contig->sieve_buf_size)) {
+            H5D__contig_sieve_swap(dset_contig, u);
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+
+    /* Get a buffer for the new window, evicting the least recently used window if they're all in use */
+    if (dset_contig->nwin < (H5D_SIEVE_MAX_WINDOWS - 1)) {
+        if (NULL == (new_buf = H5FL_BLK_MALLOC(sieve_buf, dset_contig->sieve_buf_size)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed")
+        dset_contig->nwin++;
+    } /* end if */
+    else {
+        H5D_sieve_win_t *lru = &dset_contig->win[dset_contig->nwin - 1]; /* Window to evict */
+
+        if (lru->dirty)
+            if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, lru->loc, lru->size, lru->buf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+        new_buf = lru->buf;
+    } /* end else */
+
+    /* Keep the current window as the most recently used of the others */
+    HDmemmove(&dset_contig->win[1], &dset_contig->win[0], (dset_contig->nwin - 1) * sizeof(H5D_sieve_win_t));
+    dset_contig->win[0].buf   = dset_contig->sieve_buf;
+    dset_contig->win[0].loc   = dset_contig->sieve_loc;
+    dset_contig->win[0].size  = dset_contig->sieve_size;
+    dset_contig->win[0].dirty = dset_contig->sieve_dirty;
+    dset_contig->win[0].nhits = dset_contig->sieve_nhits;
+
+    /* Set up the new, empty, current window */
+    dset_contig->sieve_buf   = new_buf;
+    dset_contig->sieve_loc   = HADDR_UNDEF;
+    dset_contig->sieve_size  = 0;
+    dset_contig->sieve_dirty = FALSE;
+    dset_contig->sieve_nhits = 0;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_sieve_make_room() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_fill
+ *
+ * Purpose:	Fills the current sieve window, which must be clean, with
+ *		the data starting at ADDR, for an access of LEN bytes.
+ *
+ *		The amount of data read adapts to the gaps between the
+ *		accesses: when an access lands within one fill size past the
+ *		window it replaces, a bigger window would have held it, so
+ *		the fill size doubles (up to the sieve buffer size).  When
+ *		the window it replaces was never hit and the gap is larger,
+ *		reading ahead is wasted, so the fill size halves.
+ *
+ *		When IS_WRITE is set, the window is only read from the file
+ *		if it's bigger than the data about to be written into it.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_sieve_fill(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig, const H5D_contig_storage_t *store_contig,
+                       haddr_t addr, hsize_t dst_off, size_t len, hbool_t is_write)
+{
+    haddr_t rel_eoa;             /* Relative end of file address	*/
+    hsize_t max_data;            /* Actual maximum size of data to cache */
+    hsize_t min;                 /* temporary minimum value (avoids some ugly macro nesting) */
+    herr_t  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(f_sh);
+    HDassert(dset_contig);
+    HDassert(dset_contig->sieve_buf);
+    HDassert(!dset_contig->sieve_dirty);
+    HDassert(store_contig);
+    HDassert(len <= dset_contig->sieve_buf_size);
+
+    /* Adjust the fill size to the gap between the old window and this access */
+    if (0 == dset_contig->sieve_fill_size || dset_contig->sieve_fill_size > dset_contig->sieve_buf_size)
+        dset_contig->sieve_fill_size = dset_contig->sieve_buf_size;
+    else if (dset_contig->sieve_size > 0 && H5F_addr_defined(dset_contig->sieve_loc) &&
+             addr >= (dset_contig->sieve_loc + dset_contig->sieve_size)) {
+        hsize_t gap = addr - (dset_contig->sieve_loc + dset_contig->sieve_size); /* Gap to this access */
+
+        if (gap < dset_contig->sieve_fill_size)
+            dset_contig->sieve_fill_size = MIN(2 * dset_contig->sieve_fill_size, dset_contig->sieve_buf_size);
+        else if (0 == dset_contig->sieve_nhits)
+            dset_contig->sieve_fill_size = MAX(dset_contig->sieve_fill_size / 2,
+                                               MIN(H5D_SIEVE_MIN_FILL_SIZE, dset_contig->sieve_buf_size));
+    } /* end if */
+
+    /* Determine the new sieve buffer location */
+    dset_contig->sieve_loc = addr;
+
+    /* Make certain we don't read off the end of the file */
+    if (HADDR_UNDEF == (rel_eoa = H5F_shared_get_eoa(f_sh, H5FD_MEM_DRAW)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to determine file size")
+
+    /* Only need this when resizing sieve buffer */
+    max_data = store_contig->dset_size - dst_off;
+
+    /* Compute the size of the sieve buffer.
+     * Don't read off the end of the file, don't read past
+     * the end of the data element, and don't read more than
+     * the fill size (but at least the data accessed).
+     */
+    min = MIN3(rel_eoa - dset_contig->sieve_loc, max_data, MAX(dset_contig->sieve_fill_size, len));
+    H5_CHECKED_ASSIGN(dset_contig->sieve_size, size_t, min, hsize_t);
+
+    /* Drop any other windows that the new one overlaps */
+    if (H5D__contig_sieve_release(f_sh, dset_contig, dset_contig->sieve_loc, (hsize_t)dset_contig->sieve_size,
+                                  TRUE) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to release sieve windows")
+
+    /* Read the new sieve buffer, if there is any point in reading it */
+    if (!is_write || dset_contig->sieve_size > len)
+        if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc, dset_contig->sieve_size,
+                                  dset_contig->sieve_buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
+
+    /* Reset sieve buffer dirty flag & hit count */
+    dset_contig->sieve_dirty = FALSE;
+    dset_contig->sieve_nhits = 0;
+    dset_contig->stats.nmisses++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_sieve_fill() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_flush_sieve_windows
+ *
+ * Purpose:	Writes out the dirty sieve windows for contiguous data,
+ *		other than the current one.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__contig_flush_sieve_windows(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig)
+{
+    unsigned u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(f_sh);
+    HDassert(dset_contig);
+
+    for (u = 0; u < dset_contig->nwin; u++)
+        if (dset_contig->win[u].dirty) {
+            if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, dset_contig->win[u].loc, dset_contig->win[u].size,
+                                       dset_contig->win[u].buf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+            dset_contig->win[u].dirty = FALSE;
+        } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_flush_sieve_windows() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_free_sieve
+ *
+ * Purpose:	Releases the sieve buffer and other sieve windows for
+ *		contiguous data, without writing them out.
+ *
+ * Return:	None
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5D__contig_free_sieve(H5D_rdcdc_t *dset_contig)
+{
+    unsigned u; /* Local index variable */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(dset_contig);
+
+    if (dset_contig->sieve_buf)
+        dset_contig->sieve_buf = (unsigned char *)H5FL_BLK_FREE(sieve_buf, dset_contig->sieve_buf);
+    for (u = 0; u < dset_contig->nwin; u++)
+        dset_contig->win[u].buf = (unsigned char *)H5FL_BLK_FREE(sieve_buf, dset_contig->win[u].buf);
+    dset_contig->nwin = 0;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__contig_free_sieve() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__contig_readvv_sieve_cb
  *
@@ -694,10 +1171,7 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *
     haddr_t sieve_start = HADDR_UNDEF, sieve_end = HADDR_UNDEF; /* Start & end locations of sieve buffer */
     haddr_t contig_end;                                         /* End locations of block to write */
     size_t  sieve_size = (size_t)-1;                            /* Size of sieve buffer */
-    haddr_t rel_eoa;                                            /* Relative end of file address	*/
-    hsize_t max_data;                                           /* Actual maximum size of data to cache */
-    hsize_t min;                 /* temporary minimum value (avoids some ugly macro nesting) */
-    herr_t  ret_value = SUCCEED; /* Return value */
+    herr_t  ret_value  = SUCCEED;                               /* Return value */
 
     FUNC_ENTER_STATIC
 
@@ -717,7 +1191,7 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *
     /* Check if the sieve buffer is allocated yet */
     if (NULL == dset_contig->sieve_buf) {
         /* Check if we can actually hold the I/O request in the sieve buffer */
-        if (len > dset_contig->sieve_buf_size) {
+        if (len > udata->max_len) {
             if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
         } /* end if */
@@ -726,30 +1200,12 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *
             if (NULL == (dset_contig->sieve_buf = H5FL_BLK_CALLOC(sieve_buf, dset_contig->sieve_buf_size)))
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed")
 
-            /* Determine the new sieve buffer size & location */
-            dset_contig->sieve_loc = addr;
-
-            /* Make certain we don't read off the end of the file */
-            if (HADDR_UNDEF == (rel_eoa = H5F_shared_get_eoa(f_sh, H5FD_MEM_DRAW)))
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to determine file size")
-
-            /* Set up the buffer parameters */
-            max_data = store_contig->dset_size - dst_off;
-
-            /* Compute the size of the sieve buffer */
-            min = MIN3(rel_eoa - dset_contig->sieve_loc, max_data, dset_contig->sieve_buf_size);
-            H5_CHECKED_ASSIGN(dset_contig->sieve_size, size_t, min, hsize_t);
-
             /* Read the new sieve buffer */
-            if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc, dset_contig->sieve_size,
-                                      dset_contig->sieve_buf) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
+            if (H5D__contig_sieve_fill(f_sh, dset_contig, store_contig, addr, dst_off, len, FALSE) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to fill sieve buffer")
 
             /* Grab the data out of the buffer (must be first piece of data in buffer ) */
             H5MM_memcpy(buf, dset_contig->sieve_buf, len);
-
-            /* Reset sieve buffer dirty flag */
-            dset_contig->sieve_dirty = FALSE;
         } /* end else */
     }     /* end if */
     else {
@@ -762,11 +1218,14 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *
 
             /* Grab the data out of the buffer */
             H5MM_memcpy(buf, base_sieve_buf, len);
+
+            dset_contig->sieve_nhits++;
+            dset_contig->stats.nhits++;
         } /* end if */
         /* Entire request is not within this data sieve buffer */
         else {
             /* Check if we can actually hold the I/O request in the sieve buffer */
-            if (len > dset_contig->sieve_buf_size) {
+            if (len > udata->max_len) {
                 /* Check for any overlap with the current sieve buffer */
                 if ((sieve_start >= addr && sieve_start < (contig_end + 1)) ||
                     ((sieve_end - 1) >= addr && (sieve_end - 1) < (contig_end + 1))) {
@@ -782,51 +1241,45 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *
                     } /* end if */
                 }     /* end if */
 
+                /* Flush any other sieve windows that overlap the request */
+                if (H5D__contig_sieve_release(f_sh, dset_contig, addr, (hsize_t)len, FALSE) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush sieve windows")
+
                 /* Read directly into the user's buffer */
                 if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
             } /* end if */
+            /* Check if another sieve window holds the data */
+            else if (H5D__contig_sieve_find(dset_contig, addr, len)) {
+                /* Grab the data out of the (now current) window */
+                H5MM_memcpy(buf, dset_contig->sieve_buf + (addr - dset_contig->sieve_loc), len);
+
+                dset_contig->sieve_nhits++;
+                dset_contig->stats.nhits++;
+            } /* end if */
             /* Element size fits within the buffer size */
             else {
+                /* Choose the window to fill */
+                if (H5D__contig_sieve_make_room(f_sh, dset_contig, addr) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to set up sieve window")
+
                 /* Flush the sieve buffer if it's dirty */
                 if (dset_contig->sieve_dirty) {
                     /* Write to file */
-                    if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, sieve_start, sieve_size,
-                                               dset_contig->sieve_buf) < 0)
+                    if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc,
+                                               dset_contig->sieve_size, dset_contig->sieve_buf) < 0)
                         HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
 
                     /* Reset sieve buffer dirty flag */
                     dset_contig->sieve_dirty = FALSE;
                 } /* end if */
 
-                /* Determine the new sieve buffer size & location */
-                dset_contig->sieve_loc = addr;
-
-                /* Make certain we don't read off the end of the file */
-                if (HADDR_UNDEF == (rel_eoa = H5F_shared_get_eoa(f_sh, H5FD_MEM_DRAW)))
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to determine file size")
-
-                /* Only need this when resizing sieve buffer */
-                max_data = store_contig->dset_size - dst_off;
-
-                /* Compute the size of the sieve buffer.
-                 * Don't read off the end of the file, don't read past
-                 * the end of the data element, and don't read more than
-                 * the buffer size.
-                 */
-                min = MIN3(rel_eoa - dset_contig->sieve_loc, max_data, dset_contig->sieve_buf_size);
-                H5_CHECKED_ASSIGN(dset_contig->sieve_size, size_t, min, hsize_t);
-
                 /* Read the new sieve buffer */
-                if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc,
-                                          dset_contig->sieve_size, dset_contig->sieve_buf) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
+                if (H5D__contig_sieve_fill(f_sh, dset_contig, store_contig, addr, dst_off, len, FALSE) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to fill sieve buffer")
 
                 /* Grab the data out of the buffer (must be first piece of data in buffer ) */
                 H5MM_memcpy(buf, dset_contig->sieve_buf, len);
-
-                /* Reset sieve buffer dirty flag */
-                dset_contig->sieve_dirty = FALSE;
             } /* end else */
         }     /* end else */
     }         /* end else */
@@ -839,6 +1292,8 @@ done:
  * Function:	H5D__contig_readvv_cb
  *
  * Purpose:	Callback operator for H5D__contig_readvv() without sieve buffer.
+ *              Queues the sequence, passing the queue to the file driver
+ *              as one vector read when it's full.
  *
  * Return:	Non-negative on success/Negative on failure
  *
@@ -855,10 +1310,20 @@ H5D__contig_readvv_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *_udata
 
     FUNC_ENTER_STATIC
 
-    /* Write data */
-    if (H5F_shared_block_read(udata->f_sh, H5FD_MEM_DRAW, (udata->dset_addr + dst_off), len,
-                              (udata->rbuf + src_off)) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+    /* Read the queued sequences when there's no room for another */
+    if (udata->nqueued == H5D_CONTIG_VECTOR_SIZE) {
+        if (H5F_shared_vector_read(udata->f_sh, udata->nqueued, udata->types, udata->addrs, udata->sizes,
+                                   udata->bufs) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "vector read failed")
+        udata->nqueued = 0;
+    } /* end if */
+
+    /* Queue this sequence */
+    udata->types[udata->nqueued] = H5FD_MEM_DRAW;
+    udata->addrs[udata->nqueued] = udata->dset_addr + dst_off;
+    udata->sizes[udata->nqueued] = len;
+    udata->bufs[udata->nqueued]  = udata->rbuf + src_off;
+    udata->nqueued++;
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -887,7 +1352,9 @@ H5D__contig_readvv(const H5D_io_info_t *io_info, size_t dset_max_nseq, size_t *d
                    size_t dset_len_arr[], hsize_t dset_off_arr[], size_t mem_max_nseq, size_t *mem_curr_seq,
                    size_t mem_len_arr[], hsize_t mem_off_arr[])
 {
-    ssize_t ret_value = -1; /* Return value */
+    const void *mapped       = NULL;  /* The storage in the file's mapping */
+    hbool_t     bypass_cache = FALSE; /* Whether to read around the sieve buffer */
+    ssize_t     ret_value    = -1;    /* Return value */
 
     FUNC_ENTER_STATIC
 
@@ -900,8 +1367,24 @@ H5D__contig_readvv(const H5D_io_info_t *io_info, size_t dset_max_nseq, size_t *d
     HDassert(mem_len_arr);
     HDassert(mem_off_arr);
 
+    /* Check whether the file driver has mapped the whole storage into
+     * memory, unless data sieving has buffered some of it
+     */
+    if (NULL == io_info->dset->shared->cache.contig.sieve_buf && io_info->store->contig.dset_size > 0 &&
+        (hsize_t)((size_t)io_info->store->contig.dset_size) == io_info->store->contig.dset_size)
+        if (H5F_shared_get_mapping(io_info->f_sh, H5FD_MEM_DRAW, io_info->store->contig.dset_addr,
+                                   (size_t)io_info->store->contig.dset_size, &mapped) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get mapping of dataset storage")
+
+    if (mapped) {
+        /* Copy the data straight out of the mapping */
+        if ((ret_value = H5VM_memcpyvv(io_info->u.rbuf, mem_max_nseq, mem_curr_seq, mem_len_arr, mem_off_arr,
+                                       mapped, dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "vectorized memcpy from mapping failed")
+    } /* end if */
     /* Check if data sieving is enabled */
-    if (H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE)) {
+    else if (H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE) &&
+             io_info->dset->shared->cache.contig.sieve_buf_size > 0) {
         H5D_contig_readvv_sieve_ud_t udata; /* User data for H5VM_opvv() operator */
 
         /* Set up user data for H5VM_opvv() */
@@ -909,6 +1392,13 @@ H5D__contig_readvv(const H5D_io_info_t *io_info, size_t dset_max_nseq, size_t *d
         udata.dset_contig  = &(io_info->dset->shared->cache.contig);
         udata.store_contig = &(io_info->store->contig);
         udata.rbuf         = (unsigned char *)io_info->u.rbuf;
+        udata.max_len      = udata.dset_contig->sieve_buf_size;
+
+        /* Check whether to read larger sequences straight into the destination buffer */
+        if (H5CX_get_bypass_cache(&bypass_cache) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get bypassing caches flag")
+        if (bypass_cache)
+            udata.max_len = MIN(udata.max_len, H5D_SIEVE_BYPASS_SIZE - 1);
 
         /* Call generic sequence operation routine */
         if ((ret_value =
@@ -923,12 +1413,18 @@ H5D__contig_readvv(const H5D_io_info_t *io_info, size_t dset_max_nseq, size_t *d
         udata.f_sh      = io_info->f_sh;
         udata.dset_addr = io_info->store->contig.dset_addr;
         udata.rbuf      = (unsigned char *)io_info->u.rbuf;
+        udata.nqueued   = 0;
 
         /* Call generic sequence operation routine */
         if ((ret_value = H5VM_opvv(dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr, mem_max_nseq,
                                    mem_curr_seq, mem_len_arr, mem_off_arr, H5D__contig_readvv_cb, &udata)) <
             0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vectorized read")
+
+        /* Read the sequences still queued */
+        if (udata.nqueued > 0 && H5F_shared_vector_read(udata.f_sh, udata.nqueued, udata.types, udata.addrs,
+                                                        udata.sizes, udata.bufs) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "vector read failed")
     } /* end else */
 
 done:
@@ -961,10 +1457,7 @@ H5D__contig_writevv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void
     haddr_t sieve_start = HADDR_UNDEF, sieve_end = HADDR_UNDEF; /* Start & end locations of sieve buffer */
     haddr_t contig_end;                                         /* End locations of block to write */
     size_t  sieve_size = (size_t)-1;                            /* size of sieve buffer */
-    haddr_t rel_eoa;                                            /* Relative end of file address	*/
-    hsize_t max_data;                                           /* Actual maximum size of data to cache */
-    hsize_t min;                 /* temporary minimum value (avoids some ugly macro nesting) */
-    herr_t  ret_value = SUCCEED; /* Return value */
+    herr_t  ret_value  = SUCCEED;                               /* Return value */
 
     FUNC_ENTER_STATIC
 
@@ -993,42 +1486,15 @@ H5D__contig_writevv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void
             if (NULL == (dset_contig->sieve_buf = H5FL_BLK_CALLOC(sieve_buf, dset_contig->sieve_buf_size)))
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed")
 
-            /* Clear memory */
-            if (dset_contig->sieve_size > len)
-                HDmemset(dset_contig->sieve_buf + len, 0, (dset_contig->sieve_size - len));
-
-            /* Determine the new sieve buffer size & location */
-            dset_contig->sieve_loc = addr;
-
-            /* Make certain we don't read off the end of the file */
-            if (HADDR_UNDEF == (rel_eoa = H5F_shared_get_eoa(f_sh, H5FD_MEM_DRAW)))
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to determine file size")
-
-            /* Set up the buffer parameters */
-            max_data = store_contig->dset_size - dst_off;
-
-            /* Compute the size of the sieve buffer */
-            min = MIN3(rel_eoa - dset_contig->sieve_loc, max_data, dset_contig->sieve_buf_size);
-            H5_CHECKED_ASSIGN(dset_contig->sieve_size, size_t, min, hsize_t);
-
-            /* Check if there is any point in reading the data from the file */
-            if (dset_contig->sieve_size > len) {
-                /* Read the new sieve buffer */
-                if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc,
-                                          dset_contig->sieve_size, dset_contig->sieve_buf) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
-            } /* end if */
+            /* Set up the new sieve buffer */
+            if (H5D__contig_sieve_fill(f_sh, dset_contig, store_contig, addr, dst_off, len, TRUE) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to fill sieve buffer")
 
             /* Grab the data out of the buffer (must be first piece of data in buffer ) */
             H5MM_memcpy(dset_contig->sieve_buf, buf, len);
 
             /* Set sieve buffer dirty flag */
             dset_contig->sieve_dirty = TRUE;
-
-            /* Stash local copies of these values */
-            sieve_start = dset_contig->sieve_loc;
-            sieve_size  = dset_contig->sieve_size;
-            sieve_end   = sieve_start + sieve_size;
         } /* end else */
     }     /* end if */
     else {
@@ -1044,6 +1510,9 @@ H5D__contig_writevv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void
 
             /* Set sieve buffer dirty flag */
             dset_contig->sieve_dirty = TRUE;
+
+            dset_contig->sieve_nhits++;
+            dset_contig->stats.nhits++;
         } /* end if */
         /* Entire request is not within this data sieve buffer */
         else {
@@ -1068,15 +1537,34 @@ H5D__contig_writevv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void
                     dset_contig->sieve_size = 0;
                 } /* end if */
 
+                /* Write out & drop any other sieve windows that overlap the request */
+                if (H5D__contig_sieve_release(f_sh, dset_contig, addr, (hsize_t)len, TRUE) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to release sieve windows")
+
                 /* Write directly from the user's buffer */
                 if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
             } /* end if */
+            /* Check if another sieve window holds the data */
+            else if (H5D__contig_sieve_find(dset_contig, addr, len)) {
+                /* Put the data into the (now current) window */
+                H5MM_memcpy(dset_contig->sieve_buf + (addr - dset_contig->sieve_loc), buf, len);
+
+                /* Set sieve buffer dirty flag */
+                dset_contig->sieve_dirty = TRUE;
+
+                dset_contig->sieve_nhits++;
+                dset_contig->stats.nhits++;
+            } /* end if */
             /* Element size fits within the buffer size */
             else {
                 /* Check if it is possible to (exactly) prepend or append to existing (dirty) sieve buffer */
                 if (((addr + len) == sieve_start || addr == sieve_end) &&
                     (len + sieve_size) <= dset_contig->sieve_buf_size && dset_contig->sieve_dirty) {
+                    /* Write out & drop any other sieve windows that overlap the new data */
+                    if (H5D__contig_sieve_release(f_sh, dset_contig, addr, (hsize_t)len, TRUE) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to release sieve windows")
+
                     /* Prepend to existing sieve buffer */
                     if ((addr + len) == sieve_start) {
                         /* Move existing sieve information to correct location */
@@ -1101,42 +1589,24 @@ H5D__contig_writevv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void
                 } /* end if */
                 /* Can't add the new data onto the existing sieve buffer */
                 else {
+                    /* Choose the window to fill */
+                    if (H5D__contig_sieve_make_room(f_sh, dset_contig, addr) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to set up sieve window")
+
                     /* Flush the sieve buffer if it's dirty */
                     if (dset_contig->sieve_dirty) {
                         /* Write to file */
-                        if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, sieve_start, sieve_size,
-                                                   dset_contig->sieve_buf) < 0)
+                        if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc,
+                                                   dset_contig->sieve_size, dset_contig->sieve_buf) < 0)
                             HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
 
                         /* Reset sieve buffer dirty flag */
                         dset_contig->sieve_dirty = FALSE;
                     } /* end if */
 
-                    /* Determine the new sieve buffer size & location */
-                    dset_contig->sieve_loc = addr;
-
-                    /* Make certain we don't read off the end of the file */
-                    if (HADDR_UNDEF == (rel_eoa = H5F_shared_get_eoa(f_sh, H5FD_MEM_DRAW)))
-                        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to determine file size")
-
-                    /* Only need this when resizing sieve buffer */
-                    max_data = store_contig->dset_size - dst_off;
-
-                    /* Compute the size of the sieve buffer.
-                     * Don't read off the end of the file, don't read past
-                     * the end of the data element, and don't read more than
-                     * the buffer size.
-                     */
-                    min = MIN3(rel_eoa - dset_contig->sieve_loc, max_data, dset_contig->sieve_buf_size);
-                    H5_CHECKED_ASSIGN(dset_contig->sieve_size, size_t, min, hsize_t);
-
-                    /* Check if there is any point in reading the data from the file */
-                    if (dset_contig->sieve_size > len) {
-                        /* Read the new sieve buffer */
-                        if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc,
-                                                  dset_contig->sieve_size, dset_contig->sieve_buf) < 0)
-                            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
-                    } /* end if */
+                    /* Set up the new sieve buffer */
+                    if (H5D__contig_sieve_fill(f_sh, dset_contig, store_contig, addr, dst_off, len, TRUE) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to fill sieve buffer")
 
                     /* Grab the data out of the buffer (must be first piece of data in buffer ) */
                     H5MM_memcpy(dset_contig->sieve_buf, buf, len);
@@ -1155,7 +1625,9 @@ done:
 /*-------------------------------------------------------------------------
  * Function:	H5D__contig_writevv_cb
  *
- * Purpose:	Callback operator for H5D__contig_writevv().
+ * Purpose:	Callback operator for H5D__contig_writevv() without sieve
+ *              buffer.  Queues the sequence, passing the queue to the file
+ *              driver as one vector write when it's full.
  *
  * Return:	Non-negative on success/Negative on failure
  *
@@ -1173,10 +1645,20 @@ H5D__contig_writevv_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *_udat
 
     FUNC_ENTER_STATIC
 
-    /* Write data */
-    if (H5F_shared_block_write(udata->f_sh, H5FD_MEM_DRAW, (udata->dset_addr + dst_off), len,
-                               (udata->wbuf + src_off)) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+    /* Write the queued sequences when there's no room for another */
+    if (udata->nqueued == H5D_CONTIG_VECTOR_SIZE) {
+        if (H5F_shared_vector_write(udata->f_sh, udata->nqueued, udata->types, udata->addrs, udata->sizes,
+                                    udata->bufs) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "vector write failed")
+        udata->nqueued = 0;
+    } /* end if */
+
+    /* Queue this sequence */
+    udata->types[udata->nqueued] = H5FD_MEM_DRAW;
+    udata->addrs[udata->nqueued] = udata->dset_addr + dst_off;
+    udata->sizes[udata->nqueued] = len;
+    udata->bufs[udata->nqueued]  = udata->wbuf + src_off;
+    udata->nqueued++;
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1219,7 +1701,8 @@ H5D__contig_writevv(const H5D_io_info_t *io_info, size_t dset_max_nseq, size_t *
     HDassert(mem_off_arr);
 
     /* Check if data sieving is enabled */
-    if (H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE)) {
+    if (H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE) &&
+        io_info->dset->shared->cache.contig.sieve_buf_size > 0) {
         H5D_contig_writevv_sieve_ud_t udata; /* User data for H5VM_opvv() operator */
 
         /* Set up user data for H5VM_opvv() */
@@ -1241,12 +1724,18 @@ H5D__contig_writevv(const H5D_io_info_t *io_info, size_t dset_max_nseq, size_t *
         udata.f_sh      = io_info->f_sh;
         udata.dset_addr = io_info->store->contig.dset_addr;
         udata.wbuf      = (const unsigned char *)io_info->u.wbuf;
+        udata.nqueued   = 0;
 
         /* Call generic sequence operation routine */
         if ((ret_value = H5VM_opvv(dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr, mem_max_nseq,
                                    mem_curr_seq, mem_len_arr, mem_off_arr, H5D__contig_writevv_cb, &udata)) <
             0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vectorized read")
+
+        /* Write the sequences still queued */
+        if (udata.nqueued > 0 && H5F_shared_vector_write(udata.f_sh, udata.nqueued, udata.types, udata.addrs,
+                                                         udata.sizes, udata.bufs) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "vector write failed")
     } /* end else */
 
 done:
@@ -1454,6 +1943,10 @@ H5D__contig_copy(H5F_t *f_src, const H5O_storage_contig_t *storage_src, H5F_t *f
     addr_src = storage_src->addr;
     addr_dst = storage_dst->addr;
 
+    /* Write out any other dirty sieve windows, only the current one is checked below */
+    if (shared_fo && H5D__contig_flush_sieve_windows(H5F_SHARED(f_src), &shared_fo->cache.contig) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush sieve windows")
+
     /* If data sieving is enabled and the dataset is open in the file,
        set up to copy data out of the sieve buffer if deemed possible later */
     if (H5F_HAS_FEATURE(f_src, H5FD_FEAT_DATA_SIEVE) && shared_fo && shared_fo->cache.contig.sieve_buf) {
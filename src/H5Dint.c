@@ -116,9 +116,6 @@ H5FL_BLK_DEFINE(vlen_fl_buf);
 H5FL_DEFINE_STATIC(H5D_t);
 H5FL_DEFINE_STATIC(H5D_shared_t);
 
-/* Declare the external PQ free list for the sieve buffer information */
-H5FL_BLK_EXTERN(sieve_buf);
-
 /* Declare the external free list to manage the H5D_chunk_info_t struct */
 H5FL_EXTERN(H5D_chunk_info_t);
 
@@ -1932,10 +1929,8 @@ H5D_close(H5D_t *dataset)
         /* Free cached information for each kind of dataset */
         switch (dataset->shared->layout.type) {
             case H5D_CONTIGUOUS:
-                /* Free the data sieve buffer, if it's been allocated */
-                if (dataset->shared->cache.contig.sieve_buf)
-                    dataset->shared->cache.contig.sieve_buf =
-                        (unsigned char *)H5FL_BLK_FREE(sieve_buf, dataset->shared->cache.contig.sieve_buf);
+                /* Free the data sieve buffers, if they've been allocated */
+                H5D__contig_free_sieve(&dataset->shared->cache.contig);
                 break;
 
             case H5D_CHUNKED:
@@ -2126,10 +2121,8 @@ H5D_mult_refresh_close(hid_t dset_id)
         /* Free cached information for each kind of dataset */
         switch (dataset->shared->layout.type) {
             case H5D_CONTIGUOUS:
-                /* Free the data sieve buffer, if it's been allocated */
-                if (dataset->shared->cache.contig.sieve_buf)
-                    dataset->shared->cache.contig.sieve_buf =
-                        (unsigned char *)H5FL_BLK_FREE(sieve_buf, dataset->shared->cache.contig.sieve_buf);
+                /* Free the data sieve buffers, if they've been allocated */
+                H5D__contig_free_sieve(&dataset->shared->cache.contig);
                 break;
 
             case H5D_CHUNKED:
@@ -3223,6 +3216,10 @@ H5D__flush_sieve_buf(H5D_t *dataset)
         dataset->shared->cache.contig.sieve_dirty = FALSE;
     } /* end if */
 
+    /* Flush any other dirty sieve windows */
+    if (H5D__contig_flush_sieve_windows(H5F_SHARED(dataset->oloc.file), &dataset->shared->cache.contig) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to flush sieve windows")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__flush_sieve_buf() */
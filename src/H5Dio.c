@@ -53,6 +53,8 @@ static herr_t H5D__ioinfo_adjust(H5D_io_info_t *io_info, const H5D_t *dset, cons
                                  const H5S_t *mem_space, const H5D_type_info_t *type_info);
 #endif /* H5_HAVE_PARALLEL */
 static herr_t H5D__typeinfo_term(const H5D_type_info_t *type_info);
+static herr_t H5D__sort_points(const H5S_t *file_space, const H5S_t *mem_space, H5S_t **sorted_file_space,
+                               H5S_t **sorted_mem_space);
 
 /*********************/
 /* Package Variables */
@@ -151,6 +153,8 @@ H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_t
                                                   /* Note that if this variable is used, the        */
                                                   /* projected mem space must be discarded at the   */
                                                   /* end of the function to avoid a memory leak.    */
+    H5S_t *       sorted_file_space = NULL;       /* File dataspace with points in file order */
+    H5S_t *       sorted_mem_space  = NULL;       /* Memory dataspace reordered to match */
     H5D_storage_t store;                          /* union of EFL and chunk pointer in file space */
     hsize_t       nelmts;                         /* total number of elmts	*/
     hbool_t       io_op_init = FALSE;             /* Whether the I/O op has been initialized */
@@ -243,6 +247,14 @@ H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_t
         buf       = (void *)adj_buf; /* Casting away 'const' OK -QAK */
     }                                /* end if */
 
+    /* Put a point selection in the file into file order, if requested */
+    if (H5D__sort_points(file_space, mem_space, &sorted_file_space, &sorted_mem_space) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to sort point selection")
+    if (sorted_file_space) {
+        file_space = sorted_file_space;
+        mem_space  = sorted_mem_space;
+    } /* end if */
+
     /* Retrieve dataset properties */
     /* <none needed in the general case> */
 
@@ -330,6 +342,12 @@ done:
         if (H5S_close(projected_mem_space) < 0)
             HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down projected memory dataspace")
 
+    /* Discard the sorted dataspaces, if they were created */
+    if (sorted_file_space && H5S_close(sorted_file_space) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to release sorted file dataspace")
+    if (sorted_mem_space && H5S_close(sorted_mem_space) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to release sorted memory dataspace")
+
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5D__read() */
 
@@ -367,6 +385,8 @@ H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_
                                                   /* Note that if this variable is used, the        */
                                                   /* projected mem space must be discarded at the   */
                                                   /* end of the function to avoid a memory leak.    */
+    H5S_t *       sorted_file_space = NULL;       /* File dataspace with points in file order */
+    H5S_t *       sorted_mem_space  = NULL;       /* Memory dataspace reordered to match */
     H5D_storage_t store;                          /* union of EFL and chunk pointer in file space */
     hsize_t       nelmts;                         /* total number of elmts	*/
     hbool_t       io_op_init = FALSE;             /* Whether the I/O op has been initialized */
@@ -481,6 +501,14 @@ H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_
         buf       = adj_buf;
     } /* end if */
 
+    /* Put a point selection in the file into file order, if requested */
+    if (H5D__sort_points(file_space, mem_space, &sorted_file_space, &sorted_mem_space) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to sort point selection")
+    if (sorted_file_space) {
+        file_space = sorted_file_space;
+        mem_space  = sorted_mem_space;
+    } /* end if */
+
     /* Retrieve dataset properties */
     /* <none needed currently> */
 
@@ -565,6 +593,12 @@ done:
         if (H5S_close(projected_mem_space) < 0)
             HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down projected memory dataspace")
 
+    /* Discard the sorted dataspaces, if they were created */
+    if (sorted_file_space && H5S_close(sorted_file_space) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to release sorted file dataspace")
+    if (sorted_mem_space && H5S_close(sorted_mem_space) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to release sorted memory dataspace")
+
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5D__write() */
 
@@ -779,6 +813,22 @@ H5D__typeinfo_init(const H5D_t *dset, hid_t mem_type_id, hbool_t do_write, H5D_t
                 HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for type conversion")
             type_info->tconv_buf_allocated = TRUE;
         } /* end if */
+#ifdef H5_HAVE_WORKER_THREADS
+        /* Get a second buffer to convert one strip while the next is read (or
+         * the previous one is written), if the application asked for it.
+         * (Conversions which need a background buffer aren't overlapped)
+         */
+        if (!type_info->is_conv_noop && H5T_BKG_NO == type_info->need_bkg) {
+            hbool_t tconv_overlap; /* Whether to overlap I/O & conversion */
+
+            if (H5CX_get_tconv_overlap(&tconv_overlap) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't retrieve I/O & conversion overlap flag")
+            if (tconv_overlap)
+                if (NULL == (type_info->tconv_buf2 = H5FL_BLK_MALLOC(type_conv, target_size)))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL,
+                                "memory allocation failed for type conversion")
+        } /* end if */
+#endif /* H5_HAVE_WORKER_THREADS */
         if (type_info->need_bkg && NULL == (type_info->bkg_buf = (uint8_t *)bkgr_buf)) {
             size_t bkg_size; /* Desired background buffer size	*/
 
@@ -978,6 +1028,8 @@ H5D__typeinfo_term(const H5D_type_info_t *type_info)
         HDassert(type_info->tconv_buf);
         (void)H5FL_BLK_FREE(type_conv, type_info->tconv_buf);
     } /* end if */
+    if (type_info->tconv_buf2)
+        (void)H5FL_BLK_FREE(type_conv, type_info->tconv_buf2);
     if (type_info->bkg_buf_allocated) {
         HDassert(type_info->bkg_buf);
         (void)H5FL_BLK_FREE(type_conv, type_info->bkg_buf);
@@ -985,3 +1037,50 @@ H5D__typeinfo_term(const H5D_type_info_t *type_info)
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5D__typeinfo_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__sort_points
+ *
+ * Purpose:	If the dataset transfer property list asks for it, put a
+ *              point selection in the file dataspace into file order,
+ *              reordering the memory selection to match.
+ *
+ *              The dataspaces created are returned in SORTED_FILE_SPACE
+ *              and SORTED_MEM_SPACE (which the caller must close), or
+ *              set to NULL if the selections are used as they are.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__sort_points(const H5S_t *file_space, const H5S_t *mem_space, H5S_t **sorted_file_space,
+                 H5S_t **sorted_mem_space)
+{
+    hbool_t sort_points = FALSE;   /* Whether to sort point selections */
+    herr_t  ret_value   = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(file_space);
+    HDassert(mem_space);
+    HDassert(sorted_file_space);
+    HDassert(sorted_mem_space);
+
+    *sorted_file_space = NULL;
+    *sorted_mem_space  = NULL;
+
+    if (H5S_GET_SELECT_TYPE(file_space) == H5S_SEL_POINTS) {
+        /* Check if the points should be sorted */
+        if (H5CX_get_sort_points(&sort_points) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get point selection sorting flag")
+
+        if (sort_points)
+            if (H5S_select_sort_points(file_space, mem_space, sorted_file_space, sorted_mem_space) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTSORT, FAIL, "can't sort point selection")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__sort_points() */
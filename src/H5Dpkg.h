@@ -83,6 +83,9 @@
 #define H5D_BT2_SPLIT_PERC        100
 #define H5D_BT2_MERGE_PERC        40
 
+/* Number of data sieve windows kept for a contiguous dataset */
+#define H5D_SIEVE_MAX_WINDOWS 4
+
 /****************************/
 /* Package Private Typedefs */
 /****************************/
@@ -107,6 +110,7 @@ typedef struct H5D_type_info_t {
     size_t                   request_nelmts; /* Requested strip mine */
     uint8_t *                tconv_buf;      /* Datatype conv buffer */
     hbool_t                  tconv_buf_allocated; /* Whether the type conversion buffer was allocated */
+    uint8_t *                tconv_buf2; /* Second datatype conv buffer, for overlapping I/O & conversion */
     uint8_t *                bkg_buf;             /* Background buffer */
     hbool_t                  bkg_buf_allocated;   /* Whether the background buffer was allocated */
 } H5D_type_info_t;
@@ -276,11 +280,12 @@ typedef struct H5D_chunk_ud_t {
     H5D_chunk_common_ud_t common; /* Common info for B-tree user data (must be first) */
 
     /* Upward */
-    unsigned    idx_hint;         /* Index of chunk in cache, if present */
-    H5F_block_t chunk_block;      /* Offset/length of chunk in file */
-    unsigned    filter_mask;      /* Excluded filters */
-    hbool_t     new_unfilt_chunk; /* Whether the chunk just became unfiltered */
-    hsize_t     chunk_idx;        /* Chunk index for EA, FA indexing */
+    unsigned           idx_hint;         /* Index of chunk in cache, if present */
+    H5F_block_t        chunk_block;      /* Offset/length of chunk in file */
+    unsigned           filter_mask;      /* Excluded filters */
+    hbool_t            new_unfilt_chunk; /* Whether the chunk just became unfiltered */
+    hsize_t            chunk_idx;        /* Chunk index for EA, FA indexing */
+    H5T_vlen_inline_t *vl_inline;        /* Inline VL sequence data of the locked chunk, if any */
 } H5D_chunk_ud_t;
 
 /* Typedef for "generic" chunk callbacks */
@@ -423,13 +428,32 @@ typedef struct H5D_rdcc_t {
     unsigned scaled_encode_bits[H5S_MAX_RANK]; /* The number of bits needed to encode the scaled dim sizes */
 } H5D_rdcc_t;
 
+/* A data sieve window for contiguous data, other than the current one */
+typedef struct H5D_sieve_win_t {
+    unsigned char *buf;   /* Buffer holding the window's data */
+    haddr_t        loc;   /* File location (offset) of the window */
+    size_t         size;  /* Size of the window used (in bytes) */
+    hbool_t        dirty; /* Flag to indicate that the window is dirty */
+    unsigned       nhits; /* Number of hits since the window was filled */
+} H5D_sieve_win_t;
+
 /* The raw data contiguous data cache */
 typedef struct H5D_rdcdc_t {
-    unsigned char *sieve_buf;      /* Buffer to hold data sieve buffer */
-    haddr_t        sieve_loc;      /* File location (offset) of the data sieve buffer */
-    size_t         sieve_size;     /* Size of the data sieve buffer used (in bytes) */
-    size_t         sieve_buf_size; /* Size of the data sieve buffer allocated (in bytes) */
-    hbool_t        sieve_dirty;    /* Flag to indicate that the data sieve buffer is dirty */
+    struct {
+        unsigned nhits;   /* Number of sequences found in a sieve window */
+        unsigned nmisses; /* Number of sieve windows filled */
+    } stats;
+    unsigned char *sieve_buf;       /* Buffer to hold data sieve buffer */
+    haddr_t        sieve_loc;       /* File location (offset) of the data sieve buffer */
+    size_t         sieve_size;      /* Size of the data sieve buffer used (in bytes) */
+    size_t         sieve_buf_size;  /* Size of the data sieve buffer allocated (in bytes) */
+    hbool_t        sieve_dirty;     /* Flag to indicate that the data sieve buffer is dirty */
+    unsigned       sieve_nhits;     /* Number of hits since the data sieve buffer was filled */
+    size_t         sieve_fill_size; /* Amount of data to read into a new window (in bytes) */
+
+    /* Other sieve windows, for interleaved access to several parts of the data */
+    unsigned        nwin;                            /* Number of other windows in use */
+    H5D_sieve_win_t win[H5D_SIEVE_MAX_WINDOWS - 1]; /* Other windows, most recently used first */
 } H5D_rdcdc_t;
 
 /*
@@ -619,9 +643,14 @@ H5_DLL herr_t  H5D__contig_read(H5D_io_info_t *io_info, const H5D_type_info_t *t
                                 const H5S_t *file_space, const H5S_t *mem_space, H5D_chunk_map_t *fm);
 H5_DLL herr_t  H5D__contig_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_t nelmts,
                                  const H5S_t *file_space, const H5S_t *mem_space, H5D_chunk_map_t *fm);
+H5_DLL hbool_t H5D__contig_may_use_select_io(const H5D_io_info_t *io_info, hbool_t is_write);
+H5_DLL herr_t  H5D__contig_select_io(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+                                     const H5S_t *file_space, const H5S_t *mem_space, hbool_t is_write);
 H5_DLL herr_t  H5D__contig_copy(H5F_t *f_src, const H5O_storage_contig_t *storage_src, H5F_t *f_dst,
                                 H5O_storage_contig_t *storage_dst, H5T_t *src_dtype, H5O_copy_t *cpy_info);
 H5_DLL herr_t  H5D__contig_delete(H5F_t *f, const H5O_storage_t *store);
+H5_DLL herr_t  H5D__contig_flush_sieve_windows(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig);
+H5_DLL void    H5D__contig_free_sieve(H5D_rdcdc_t *dset_contig);
 
 /* Functions that operate on chunked dataset storage */
 H5_DLL htri_t  H5D__chunk_cacheable(const H5D_io_info_t *io_info, haddr_t caddr, hbool_t write_op);
@@ -737,6 +766,7 @@ H5_DLL herr_t H5D__layout_compact_dirty_test(hid_t did, hbool_t *dirty);
 H5_DLL herr_t H5D__layout_idx_type_test(hid_t did, H5D_chunk_index_t *idx_type);
 H5_DLL herr_t H5D__layout_type_test(hid_t did, H5D_layout_t *layout_type);
 H5_DLL herr_t H5D__current_cache_size_test(hid_t did, size_t *nbytes_used, int *nused);
+H5_DLL herr_t H5D__sieve_stats_test(hid_t did, unsigned *nhits, unsigned *nmisses, unsigned *nwin);
 #endif /* H5D_TESTING */
 
 #endif /*_H5Dpkg_H*/
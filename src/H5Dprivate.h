@@ -84,6 +84,10 @@
 #define H5D_XFER_FILTER_CB_NAME "filter_cb"      /* Filter callback function */
 #define H5D_XFER_CONV_CB_NAME   "type_conv_cb"   /* Type conversion callback function */
 #define H5D_XFER_XFORM_NAME     "data_transform" /* Data transform */
+#define H5D_XFER_CONV_NTHREADS_NAME "conv_nthreads" /* # of threads for datatype conversion */
+#define H5D_XFER_TCONV_OVERLAP_NAME "tconv_overlap" /* Overlap I/O with datatype conversion */
+#define H5D_XFER_SORT_POINTS_NAME   "sort_points"   /* Sort point selections into file order */
+#define H5D_XFER_BYPASS_CACHE_NAME  "bypass_cache"  /* Read around the sieve buffer & chunk cache */
 #ifdef H5_HAVE_INSTRUMENTED_LIBRARY
 /* Collective chunk instrumentation properties */
 #define H5D_XFER_COLL_CHUNK_LINK_HARD_NAME        "coll_chunk_link_hard"
@@ -27,6 +27,7 @@
 #include "H5FLprivate.h" /* Free Lists                           */
 #include "H5Iprivate.h"  /* IDs                                  */
 #include "H5MMprivate.h" /* Memory management			*/
+#include "H5VMprivate.h" /* Vector and array functions           */
 
 /****************/
 /* Local Macros */
@@ -46,6 +47,14 @@ static size_t H5D__gather_file(const H5D_io_info_t *io_info, H5S_sel_iter_t *fil
 static herr_t H5D__compound_opt_read(size_t nelmts, H5S_sel_iter_t *iter, const H5D_type_info_t *type_info,
                                      void *user_buf /*out*/);
 static herr_t H5D__compound_opt_write(size_t nelmts, const H5D_type_info_t *type_info);
+#ifdef H5_HAVE_WORKER_THREADS
+static htri_t H5D__scatgath_can_overlap(const H5D_type_info_t *type_info, hsize_t nelmts);
+static herr_t H5D__scatgath_read_overlap(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+                                         hsize_t nelmts, H5S_sel_iter_t *file_iter, H5S_sel_iter_t *mem_iter);
+static herr_t H5D__scatgath_write_overlap(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+                                          hsize_t nelmts, H5S_sel_iter_t *file_iter,
+                                          H5S_sel_iter_t *mem_iter);
+#endif /* H5_HAVE_WORKER_THREADS */
 
 /*********************/
 /* Package Variables */
@@ -277,9 +286,7 @@ H5D__scatter_mem(const void *_tscat_buf, H5S_sel_iter_t *iter, size_t nelmts, vo
     const uint8_t *tscat_buf = (const uint8_t *)_tscat_buf;
     hsize_t *      off       = NULL;    /* Pointer to sequence offsets */
     size_t *       len       = NULL;    /* Pointer to sequence lengths */
-    size_t         curr_len;            /* Length of bytes left to process in sequence */
     size_t         nseq;                /* Number of sequences generated */
-    size_t         curr_seq;            /* Current sequence being processed */
     size_t         nelem;               /* Number of elements used in sequences */
     size_t         dxpl_vec_size;       /* Vector length from API context's DXPL */
     size_t         vec_size;            /* Vector length */
@@ -313,16 +320,8 @@ H5D__scatter_mem(const void *_tscat_buf, H5S_sel_iter_t *iter, size_t nelmts, vo
         if (H5S_SELECT_ITER_GET_SEQ_LIST(iter, vec_size, nelmts, &nseq, &nelem, off, len) < 0)
             HGOTO_ERROR(H5E_INTERNAL, H5E_UNSUPPORTED, 0, "sequence length generation failed")
 
-        /* Loop, while sequences left to process */
-        for (curr_seq = 0; curr_seq < nseq; curr_seq++) {
-            /* Get the number of bytes in sequence */
-            curr_len = len[curr_seq];
-
-            H5MM_memcpy(buf + off[curr_seq], tscat_buf, curr_len);
-
-            /* Advance offset in destination buffer */
-            tscat_buf += curr_len;
-        } /* end for */
+        /* Scatter the sequences, advancing through the scatter buffer */
+        tscat_buf += H5VM_scattervv(buf, nseq, len, off, tscat_buf);
 
         /* Decrement number of elements left to process */
         nelmts -= nelem;
@@ -362,9 +361,7 @@ H5D__gather_mem(const void *_buf, H5S_sel_iter_t *iter, size_t nelmts, void *_tg
     uint8_t *      tgath_buf = (uint8_t *)_tgath_buf;
     hsize_t *      off       = NULL;   /* Pointer to sequence offsets */
     size_t *       len       = NULL;   /* Pointer to sequence lengths */
-    size_t         curr_len;           /* Length of bytes left to process in sequence */
     size_t         nseq;               /* Number of sequences generated */
-    size_t         curr_seq;           /* Current sequence being processed */
     size_t         nelem;              /* Number of elements used in sequences */
     size_t         dxpl_vec_size;      /* Vector length from API context's DXPL */
     size_t         vec_size;           /* Vector length */
@@ -398,16 +395,8 @@ H5D__gather_mem(const void *_buf, H5S_sel_iter_t *iter, size_t nelmts, void *_tg
         if (H5S_SELECT_ITER_GET_SEQ_LIST(iter, vec_size, nelmts, &nseq, &nelem, off, len) < 0)
             HGOTO_ERROR(H5E_INTERNAL, H5E_UNSUPPORTED, 0, "sequence length generation failed")
 
-        /* Loop, while sequences left to process */
-        for (curr_seq = 0; curr_seq < nseq; curr_seq++) {
-            /* Get the number of bytes in sequence */
-            curr_len = len[curr_seq];
-
-            H5MM_memcpy(tgath_buf, buf + off[curr_seq], curr_len);
-
-            /* Advance offset in gather buffer */
-            tgath_buf += curr_len;
-        } /* end for */
+        /* Gather the sequences, advancing through the gather buffer */
+        tgath_buf += H5VM_gathervv(tgath_buf, buf, nseq, len, off);
 
         /* Decrement number of elements left to process */
         nelmts -= nelem;
@@ -448,7 +437,10 @@ H5D__scatgath_read(const H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
     hbool_t         file_iter_init = FALSE; /* File selection iteration info has been initialized */
     hsize_t         smine_start;            /* Strip mine start loc	*/
     size_t          smine_nelmts;           /* Elements per strip	*/
-    herr_t          ret_value = SUCCEED;    /* Return value		*/
+#ifdef H5_HAVE_WORKER_THREADS
+    htri_t overlap; /* Whether to overlap the reads with the conversion */
+#endif
+    herr_t ret_value = SUCCEED; /* Return value		*/
 
     FUNC_ENTER_PACKAGE
 
@@ -483,6 +475,17 @@ H5D__scatgath_read(const H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize background selection information")
     bkg_iter_init = TRUE; /*file selection iteration info has been initialized */
 
+#ifdef H5_HAVE_WORKER_THREADS
+    /* Check for overlapping the reads with the datatype conversion */
+    if ((overlap = H5D__scatgath_can_overlap(type_info, nelmts)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't check for overlapping I/O & conversion")
+    if (overlap) {
+        if (H5D__scatgath_read_overlap(io_info, type_info, nelmts, file_iter, mem_iter) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "overlapped read & conversion failed")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+#endif /* H5_HAVE_WORKER_THREADS */
+
     /* Start strip mining... */
     for (smine_start = 0; smine_start < nelmts; smine_start += smine_nelmts) {
         size_t n; /* Elements operated on */
@@ -588,7 +591,10 @@ H5D__scatgath_write(const H5D_io_info_t *io_info, const H5D_type_info_t *type_in
     hbool_t         file_iter_init = FALSE; /* File selection iteration info has been initialized */
     hsize_t         smine_start;            /* Strip mine start loc	*/
     size_t          smine_nelmts;           /* Elements per strip	*/
-    herr_t          ret_value = SUCCEED;    /* Return value		*/
+#ifdef H5_HAVE_WORKER_THREADS
+    htri_t overlap; /* Whether to overlap the writes with the conversion */
+#endif
+    herr_t ret_value = SUCCEED; /* Return value		*/
 
     FUNC_ENTER_PACKAGE
 
@@ -624,6 +630,17 @@ H5D__scatgath_write(const H5D_io_info_t *io_info, const H5D_type_info_t *type_in
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize background selection information")
     bkg_iter_init = TRUE; /*file selection iteration info has been initialized */
 
+#ifdef H5_HAVE_WORKER_THREADS
+    /* Check for overlapping the writes with the datatype conversion */
+    if ((overlap = H5D__scatgath_can_overlap(type_info, nelmts)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't check for overlapping I/O & conversion")
+    if (overlap) {
+        if (H5D__scatgath_write_overlap(io_info, type_info, nelmts, file_iter, mem_iter) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "overlapped conversion & write failed")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+#endif /* H5_HAVE_WORKER_THREADS */
+
     /* Start strip mining... */
     for (smine_start = 0; smine_start < nelmts; smine_start += smine_nelmts) {
         size_t n; /* Elements operated on */
@@ -706,6 +723,215 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__scatgath_write() */
 
+#ifdef H5_HAVE_WORKER_THREADS
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__scatgath_can_overlap
+ *
+ * Purpose:	Determines whether the I/O for a selection of NELMTS
+ *		elements can be overlapped with their datatype conversion:
+ *		the application must have asked for it (which provides the
+ *		second conversion buffer), the selection must not fit in one
+ *		strip, no background buffer may be needed and the conversion
+ *		must be able to run on a worker thread.
+ *
+ * Return:	TRUE/FALSE/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5D__scatgath_can_overlap(const H5D_type_info_t *type_info, hsize_t nelmts)
+{
+    htri_t ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(type_info);
+
+    if (NULL == type_info->tconv_buf2 || nelmts <= type_info->request_nelmts)
+        HGOTO_DONE(FALSE)
+    if (H5T_BKG_NO != type_info->need_bkg ||
+        (type_info->cmpd_subset && H5T_SUBSET_FALSE != type_info->cmpd_subset->subset))
+        HGOTO_DONE(FALSE)
+
+    if ((ret_value = H5T_convert_can_overlap(type_info->tpath)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't check for overlapped conversion")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__scatgath_can_overlap() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__scatgath_read_overlap
+ *
+ * Purpose:	Perform scatter/gather read, alternating between the two
+ *		datatype conversion buffers: while one strip is converted on
+ *		a worker thread, the next strip is read from the file into
+ *		the other buffer.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__scatgath_read_overlap(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_t nelmts,
+                           H5S_sel_iter_t *file_iter, H5S_sel_iter_t *mem_iter)
+{
+    void *   buf = io_info->u.rbuf; /* Local pointer to application buffer */
+    uint8_t *tconv_buf[2];          /* Datatype conversion buffers */
+    unsigned curr = 0;              /* Index of buffer for current strip */
+    hbool_t  conv_started = FALSE;  /* Whether a conversion is in progress */
+    hsize_t  smine_start;           /* Strip mine start loc	*/
+    size_t   smine_nelmts;          /* Elements in current strip */
+    size_t   next_nelmts;           /* Elements in next strip */
+    herr_t   ret_value = SUCCEED;   /* Return value		*/
+
+    FUNC_ENTER_STATIC
+
+    tconv_buf[0] = type_info->tconv_buf;
+    tconv_buf[1] = type_info->tconv_buf2;
+
+    /* Read the first strip */
+    next_nelmts = (size_t)MIN(type_info->request_nelmts, nelmts);
+    if (H5D__gather_file(io_info, file_iter, next_nelmts, tconv_buf[curr] /*out*/) != next_nelmts)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file gather failed")
+
+    for (smine_start = 0; smine_start < nelmts; smine_start += smine_nelmts) {
+        smine_nelmts = next_nelmts;
+
+        /* Convert the current strip in the background */
+        if (H5T_convert_start(type_info->tpath, type_info->src_type_id, type_info->dst_type_id, smine_nelmts,
+                              tconv_buf[curr]) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "can't start datatype conversion")
+        conv_started = TRUE;
+
+        /* Read the next strip into the other buffer meanwhile */
+        if (smine_start + smine_nelmts < nelmts) {
+            HDassert(H5S_SELECT_ITER_NELMTS(file_iter) == (nelmts - (smine_start + smine_nelmts)));
+            next_nelmts = (size_t)MIN(type_info->request_nelmts, nelmts - (smine_start + smine_nelmts));
+            if (H5D__gather_file(io_info, file_iter, next_nelmts, tconv_buf[1 - curr] /*out*/) !=
+                next_nelmts)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file gather failed")
+        } /* end if */
+
+        conv_started = FALSE;
+        if (H5T_convert_wait() < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+
+        /* Do the data transform after the conversion (since we're using type mem_type) */
+        if (!type_info->is_xform_noop) {
+            H5Z_data_xform_t *data_transform; /* Data transform info */
+
+            /* Retrieve info from API context */
+            if (H5CX_get_data_transform(&data_transform) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get data transform info")
+
+            if (H5Z_xform_eval(data_transform, tconv_buf[curr], smine_nelmts, type_info->mem_type) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "Error performing data transform")
+        } /* end if */
+
+        /* Scatter the data into memory */
+        if (H5D__scatter_mem(tconv_buf[curr], mem_iter, smine_nelmts, buf /*out*/) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "scatter failed")
+
+        curr = 1 - curr;
+    } /* end for */
+
+done:
+    /* Don't leave a conversion running on the buffers */
+    if (conv_started && H5T_convert_wait() < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__scatgath_read_overlap() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__scatgath_write_overlap
+ *
+ * Purpose:	Perform scatter/gather write, alternating between the two
+ *		datatype conversion buffers: while one strip is written to
+ *		the file, the next strip is converted on a worker thread in
+ *		the other buffer.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__scatgath_write_overlap(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_t nelmts,
+                            H5S_sel_iter_t *file_iter, H5S_sel_iter_t *mem_iter)
+{
+    const void *      buf            = io_info->u.wbuf; /* Local pointer to application buffer */
+    H5Z_data_xform_t *data_transform = NULL;            /* Data transform info */
+    uint8_t *         tconv_buf[2];                     /* Datatype conversion buffers */
+    unsigned          curr         = 0;                 /* Index of buffer for strip being converted */
+    hbool_t           conv_started = FALSE;             /* Whether a conversion is in progress */
+    hsize_t           gath_start   = 0;                 /* Start of strip being converted */
+    size_t            gath_nelmts  = 0;                 /* Elements in strip being converted */
+    hsize_t           scat_start   = 0;                 /* Start of strip being written */
+    size_t            scat_nelmts  = 0;                 /* Elements in strip being written */
+    herr_t            ret_value    = SUCCEED;           /* Return value		*/
+
+    FUNC_ENTER_STATIC
+
+    tconv_buf[0] = type_info->tconv_buf;
+    tconv_buf[1] = type_info->tconv_buf2;
+
+    /* Retrieve info from API context */
+    if (!type_info->is_xform_noop)
+        if (H5CX_get_data_transform(&data_transform) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get data transform info")
+
+    while (scat_start < nelmts) {
+        /* Gather the next strip and convert it in the background */
+        gath_nelmts = 0;
+        if (gath_start < nelmts) {
+            gath_nelmts = (size_t)MIN(type_info->request_nelmts, nelmts - gath_start);
+            if (H5D__gather_mem(buf, mem_iter, gath_nelmts, tconv_buf[curr] /*out*/) != gath_nelmts)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "mem gather failed")
+
+            /* Do the data transform before the type conversion (since
+             * transforms must be done in the memory type). */
+            if (data_transform &&
+                H5Z_xform_eval(data_transform, tconv_buf[curr], gath_nelmts, type_info->mem_type) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "Error performing data transform")
+
+            if (H5T_convert_start(type_info->tpath, type_info->src_type_id, type_info->dst_type_id,
+                                  gath_nelmts, tconv_buf[curr]) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "can't start datatype conversion")
+            conv_started = TRUE;
+        } /* end if */
+
+        /* Write the previous strip from the other buffer meanwhile */
+        if (scat_nelmts > 0) {
+            HDassert(H5S_SELECT_ITER_NELMTS(file_iter) == (nelmts - scat_start));
+            if (H5D__scatter_file(io_info, file_iter, scat_nelmts, tconv_buf[1 - curr]) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "scatter failed")
+            scat_start += scat_nelmts;
+        } /* end if */
+
+        if (conv_started) {
+            conv_started = FALSE;
+            if (H5T_convert_wait() < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+        } /* end if */
+
+        /* The converted strip is written next time through */
+        gath_start += gath_nelmts;
+        scat_nelmts = gath_nelmts;
+        curr        = 1 - curr;
+    } /* end while */
+
+done:
+    /* Don't leave a conversion running on the buffers */
+    if (conv_started && H5T_convert_wait() < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__scatgath_write_overlap() */
+#endif /* H5_HAVE_WORKER_THREADS */
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__compound_opt_read
  *
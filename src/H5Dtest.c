@@ -295,3 +295,49 @@ H5D__current_cache_size_test(hid_t did, size_t *nbytes_used, int *nused)
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__current_cache_size_test() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5D__sieve_stats_test
+ PURPOSE
+    Retrieve the data sieve statistics for a contiguous dataset
+ USAGE
+    herr_t H5D__sieve_stats_test(did, nhits, nmisses, nwin)
+        hid_t did;              IN: Dataset to query
+        unsigned *nhits;        OUT: # of accesses satisfied from a sieve window
+        unsigned *nmisses;      OUT: # of times a sieve window was (re)filled
+        unsigned *nwin;         OUT: # of sieve windows besides the current one
+ RETURNS
+    Non-negative on success, negative on failure
+ DESCRIPTION
+    Checks how well the dataset's sieve windows are being used.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    DO NOT USE THIS FUNCTION FOR ANYTHING EXCEPT TESTING
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+herr_t
+H5D__sieve_stats_test(hid_t did, unsigned *nhits, unsigned *nmisses, unsigned *nwin)
+{
+    H5D_t *dset;                /* Pointer to dataset to query */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    if (NULL == (dset = (H5D_t *)H5VL_object_verify(did, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+    if (dset->shared->layout.type != H5D_CONTIGUOUS)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dataset is not contiguous")
+
+    if (nhits)
+        *nhits = dset->shared->cache.contig.stats.nhits;
+    if (nmisses)
+        *nmisses = dset->shared->cache.contig.stats.nmisses;
+    if (nwin)
+        *nwin = dset->shared->cache.contig.nwin;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__sieve_stats_test() */
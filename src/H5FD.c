@@ -38,6 +38,7 @@
 #include "H5Iprivate.h"  /* IDs                                      */
 #include "H5MMprivate.h" /* Memory management                        */
 #include "H5Pprivate.h"  /* Property lists                           */
+#include "H5Sprivate.h"  /* Dataspaces                               */
 
 /****************/
 /* Local Macros */
@@ -1435,6 +1436,358 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5FDwrite() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FDread_vector
+ *
+ * Purpose:     Reads COUNT pieces of data from FILE according to the data
+ *              transfer property list DXPL_ID (which may be the constant
+ *              H5P_DEFAULT).  Piece I is SIZES[I] bytes of type TYPES[I],
+ *              read from address ADDRS[I] into the buffer BUFS[I].
+ *
+ *              Drivers that provide a read_vector callback receive all of
+ *              the pieces in one request, other drivers are called once
+ *              per piece.
+ *
+ * Return:      Success:    Non-negative
+ *                          The read results are written into the BUFS
+ *                          buffers, which should be allocated by the
+ *                          caller.
+ *
+ *              Failure:    Negative
+ *                          The contents of the BUFS buffers are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FDread_vector(H5FD_t *file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                size_t sizes[], void *bufs[] /*out*/)
+{
+    hbool_t  addrs_moved = FALSE;   /* Whether the addresses were made relative */
+    uint32_t u;                     /* Local index variable */
+    herr_t   ret_value   = SUCCEED; /* Return value             */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "*#iIu*Mt*a*z**x", file, dxpl_id, count, types, addrs, sizes, bufs);
+
+    /* Check arguments */
+    if (!file)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file pointer cannot be NULL")
+    if (!file->cls)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file class pointer cannot be NULL")
+    if (count > 0 && (!types || !addrs || !sizes || !bufs))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "vector parameters can't be NULL")
+    for (u = 0; u < count; u++)
+        if (!bufs[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "result buffer parameter can't be NULL")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a data transfer property list")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Compensate for base address addition in internal routine */
+    if (file->base_addr > 0) {
+        for (u = 0; u < count; u++)
+            addrs[u] -= file->base_addr;
+        addrs_moved = TRUE;
+    } /* end if */
+
+    /* Call private function */
+    if (H5FD_read_vector(file, count, types, addrs, sizes, bufs) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "file vector read request failed")
+
+done:
+    /* Restore the caller's addresses */
+    if (addrs_moved)
+        for (u = 0; u < count; u++)
+            addrs[u] += file->base_addr;
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5FDread_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FDwrite_vector
+ *
+ * Purpose:     Writes COUNT pieces of data to FILE according to the data
+ *              transfer property list DXPL_ID (which may be the constant
+ *              H5P_DEFAULT).  Piece I is SIZES[I] bytes of type TYPES[I],
+ *              written from the buffer BUFS[I] to address ADDRS[I].
+ *
+ *              Drivers that provide a write_vector callback receive all of
+ *              the pieces in one request, other drivers are called once
+ *              per piece.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FDwrite_vector(H5FD_t *file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                 size_t sizes[], const void *bufs[])
+{
+    hbool_t  addrs_moved = FALSE;   /* Whether the addresses were made relative */
+    uint32_t u;                     /* Local index variable */
+    herr_t   ret_value   = SUCCEED; /* Return value             */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "*#iIu*Mt*a*z**x", file, dxpl_id, count, types, addrs, sizes, bufs);
+
+    /* Check arguments */
+    if (!file)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file pointer cannot be NULL")
+    if (!file->cls)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file class pointer cannot be NULL")
+    if (count > 0 && (!types || !addrs || !sizes || !bufs))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "vector parameters can't be NULL")
+    for (u = 0; u < count; u++)
+        if (!bufs[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "result buffer parameter can't be NULL")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a data transfer property list")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Compensate for base address addition in internal routine */
+    if (file->base_addr > 0) {
+        for (u = 0; u < count; u++)
+            addrs[u] -= file->base_addr;
+        addrs_moved = TRUE;
+    } /* end if */
+
+    /* Call private function */
+    if (H5FD_write_vector(file, count, types, addrs, sizes, bufs) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "file vector write request failed")
+
+done:
+    /* Restore the caller's addresses */
+    if (addrs_moved)
+        for (u = 0; u < count; u++)
+            addrs[u] += file->base_addr;
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5FDwrite_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FDread_selection
+ *
+ * Purpose:     Reads COUNT selections of data of type TYPE from FILE
+ *              according to the data transfer property list DXPL_ID
+ *              (which may be the constant H5P_DEFAULT).  Selection I
+ *              reads the elements of ELEMENT_SIZES[I] bytes selected in
+ *              the dataspace FILE_SPACE_IDS[I], whose extent is laid out
+ *              in the file from address OFFSETS[I], into the elements
+ *              selected in the dataspace MEM_SPACE_IDS[I] of the buffer
+ *              BUFS[I].
+ *
+ *              Drivers that provide a read_selection callback receive the
+ *              selections themselves, other drivers receive vector
+ *              requests for the pieces of the selections.
+ *
+ * Return:      Success:    Non-negative
+ *                          The read results are written into the BUFS
+ *                          buffers, which should be allocated by the
+ *                          caller.
+ *
+ *              Failure:    Negative
+ *                          The contents of the BUFS buffers are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FDread_selection(H5FD_t *file, H5FD_mem_t type, hid_t dxpl_id, uint32_t count, hid_t mem_space_ids[],
+                   hid_t file_space_ids[], haddr_t offsets[], size_t element_sizes[], void *bufs[] /*out*/)
+{
+    const H5S_t **spaces      = NULL;    /* Memory dataspaces, followed by file dataspaces */
+    hbool_t       addrs_moved = FALSE;   /* Whether the offsets were made relative */
+    uint32_t      u;                     /* Local index variable */
+    herr_t        ret_value   = SUCCEED; /* Return value             */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE9("e", "*#MtiIu*i*i*a*z**x", file, type, dxpl_id, count, mem_space_ids, file_space_ids, offsets,
+             element_sizes, bufs);
+
+    /* Check arguments */
+    if (!file)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file pointer cannot be NULL")
+    if (!file->cls)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file class pointer cannot be NULL")
+    if (count > 0 && (!mem_space_ids || !file_space_ids || !offsets || !element_sizes || !bufs))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "selection parameters can't be NULL")
+    if (count > 0 && NULL == (spaces = (const H5S_t **)H5MM_malloc(2 * count * sizeof(H5S_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate dataspace arrays")
+    for (u = 0; u < count; u++) {
+        if (NULL == (spaces[u] = (const H5S_t *)H5I_object_verify(mem_space_ids[u], H5I_DATASPACE)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "memory dataspace is not a dataspace")
+        if (NULL == (spaces[count + u] = (const H5S_t *)H5I_object_verify(file_space_ids[u], H5I_DATASPACE)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "file dataspace is not a dataspace")
+        if (0 == element_sizes[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "element size can't be zero")
+        if (!bufs[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "result buffer parameter can't be NULL")
+    } /* end for */
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a data transfer property list")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Compensate for base address addition in internal routine */
+    if (file->base_addr > 0) {
+        for (u = 0; u < count; u++)
+            offsets[u] -= file->base_addr;
+        addrs_moved = TRUE;
+    } /* end if */
+
+    /* Call private function */
+    if (H5FD_read_selection(file, type, count, spaces, spaces + count, offsets, element_sizes, bufs) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "file selection read request failed")
+
+done:
+    /* Restore the caller's offsets */
+    if (addrs_moved)
+        for (u = 0; u < count; u++)
+            offsets[u] += file->base_addr;
+    H5MM_xfree(spaces);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5FDread_selection() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FDwrite_selection
+ *
+ * Purpose:     Writes COUNT selections of data of type TYPE to FILE
+ *              according to the data transfer property list DXPL_ID
+ *              (which may be the constant H5P_DEFAULT).  Selection I
+ *              writes the elements selected in the dataspace
+ *              MEM_SPACE_IDS[I] of the buffer BUFS[I] to the elements of
+ *              ELEMENT_SIZES[I] bytes selected in the dataspace
+ *              FILE_SPACE_IDS[I], whose extent is laid out in the file
+ *              from address OFFSETS[I].
+ *
+ *              Drivers that provide a write_selection callback receive
+ *              the selections themselves, other drivers receive vector
+ *              requests for the pieces of the selections.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FDwrite_selection(H5FD_t *file, H5FD_mem_t type, hid_t dxpl_id, uint32_t count, hid_t mem_space_ids[],
+                    hid_t file_space_ids[], haddr_t offsets[], size_t element_sizes[], const void *bufs[])
+{
+    const H5S_t **spaces      = NULL;    /* Memory dataspaces, followed by file dataspaces */
+    hbool_t       addrs_moved = FALSE;   /* Whether the offsets were made relative */
+    uint32_t      u;                     /* Local index variable */
+    herr_t        ret_value   = SUCCEED; /* Return value             */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE9("e", "*#MtiIu*i*i*a*z**x", file, type, dxpl_id, count, mem_space_ids, file_space_ids, offsets,
+             element_sizes, bufs);
+
+    /* Check arguments */
+    if (!file)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file pointer cannot be NULL")
+    if (!file->cls)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file class pointer cannot be NULL")
+    if (count > 0 && (!mem_space_ids || !file_space_ids || !offsets || !element_sizes || !bufs))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "selection parameters can't be NULL")
+    if (count > 0 && NULL == (spaces = (const H5S_t **)H5MM_malloc(2 * count * sizeof(H5S_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate dataspace arrays")
+    for (u = 0; u < count; u++) {
+        if (NULL == (spaces[u] = (const H5S_t *)H5I_object_verify(mem_space_ids[u], H5I_DATASPACE)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "memory dataspace is not a dataspace")
+        if (NULL == (spaces[count + u] = (const H5S_t *)H5I_object_verify(file_space_ids[u], H5I_DATASPACE)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "file dataspace is not a dataspace")
+        if (0 == element_sizes[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "element size can't be zero")
+        if (!bufs[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "data buffer parameter can't be NULL")
+    } /* end for */
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a data transfer property list")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Compensate for base address addition in internal routine */
+    if (file->base_addr > 0) {
+        for (u = 0; u < count; u++)
+            offsets[u] -= file->base_addr;
+        addrs_moved = TRUE;
+    } /* end if */
+
+    /* Call private function */
+    if (H5FD_write_selection(file, type, count, spaces, spaces + count, offsets, element_sizes, bufs) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "file selection write request failed")
+
+done:
+    /* Restore the caller's offsets */
+    if (addrs_moved)
+        for (u = 0; u < count; u++)
+            offsets[u] += file->base_addr;
+    H5MM_xfree(spaces);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5FDwrite_selection() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FDget_mapping
+ *
+ * Purpose:     Points *PTR at SIZE bytes of FILE, starting at address
+ *              ADDR, in memory the driver has mapped the file into.  The
+ *              bytes can be read through *PTR until the file is closed.
+ *
+ *              *PTR is set to NULL when the driver doesn't map the file
+ *              or can't map all of the bytes asked for; the bytes must
+ *              then be read with H5FDread().
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FDget_mapping(H5FD_t *file, H5FD_mem_t type, haddr_t addr, size_t size, const void **ptr /*out*/)
+{
+    herr_t ret_value = SUCCEED; /* Return value             */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE5("e", "*#Mtaz**x", file, type, addr, size, ptr);
+
+    /* Check arguments */
+    if (!file)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file pointer cannot be NULL")
+    if (!file->cls)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file class pointer cannot be NULL")
+    if (!ptr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "result pointer parameter can't be NULL")
+
+    /* Call private function */
+    /* (Note compensating for base address addition in internal routine) */
+    if (H5FD_get_mapping(file, type, addr - file->base_addr, size, ptr) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "file mapping request failed")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5FDget_mapping() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FDflush
  *
@@ -31,6 +31,7 @@
 #include "H5Iprivate.h"  /* IDs                          */
 #include "H5MMprivate.h" /* Memory management            */
 #include "H5Pprivate.h"  /* Property lists               */
+#include "H5Sprivate.h"  /* Dataspaces                   */
 #include "H5SLprivate.h" /* Skip lists                   */
 
 /* The driver identification number, initialized at runtime */
@@ -102,6 +103,18 @@ typedef struct H5FD_core_fapl_t {
     size_t  page_size;      /* Page size for tracked writes */
 } H5FD_core_fapl_t;
 
+/* User data for the H5FD_sel_iterate() operators, copying pieces of
+ * selections between the memory image and application buffers
+ */
+typedef struct H5FD_core_select_ud_t {
+    H5FD_t *             file;    /* File to read or write */
+    H5FD_mem_t           type;    /* Type of the data */
+    hid_t                dxpl_id; /* Data transfer property list */
+    haddr_t              addr;    /* Address of the selection's extent */
+    unsigned char *      rbuf;    /* Buffer to read the selection into */
+    const unsigned char *wbuf;    /* Buffer to write the selection from */
+} H5FD_core_select_ud_t;
+
 /* Allocate memory in multiples of this size by default */
 #define H5FD_CORE_INCREMENT                8192
 #define H5FD_CORE_WRITE_TRACKING_FLAG      FALSE
@@ -130,6 +143,7 @@ typedef struct H5FD_core_fapl_t {
 static herr_t  H5FD__core_add_dirty_region(H5FD_core_t *file, haddr_t start, haddr_t end);
 static herr_t  H5FD__core_destroy_dirty_list(H5FD_core_t *file);
 static herr_t  H5FD__core_write_to_bstore(H5FD_core_t *file, haddr_t addr, size_t size);
+static herr_t  H5FD__core_extend(H5FD_core_t *file, haddr_t end);
 static herr_t  H5FD__core_term(void);
 static void *  H5FD__core_fapl_get(H5FD_t *_file);
 static H5FD_t *H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
@@ -144,44 +158,61 @@ static herr_t  H5FD__core_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, ha
                                void *buf);
 static herr_t  H5FD__core_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
                                 const void *buf);
+static herr_t  H5FD__core_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                      haddr_t addrs[], size_t sizes[], void *bufs[]);
+static herr_t  H5FD__core_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                       haddr_t addrs[], size_t sizes[], const void *bufs[]);
+static herr_t  H5FD__core_select_read_cb(hsize_t file_off, hsize_t mem_off, size_t len, void *_udata);
+static herr_t  H5FD__core_select_write_cb(hsize_t file_off, hsize_t mem_off, size_t len, void *_udata);
+static herr_t  H5FD__core_read_selection(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, uint32_t count,
+                                         hid_t mem_spaces[], hid_t file_spaces[], haddr_t offsets[],
+                                         size_t element_sizes[], void *bufs[]);
+static herr_t  H5FD__core_write_selection(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, uint32_t count,
+                                          hid_t mem_spaces[], hid_t file_spaces[], haddr_t offsets[],
+                                          size_t element_sizes[], const void *bufs[]);
 static herr_t  H5FD__core_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t  H5FD__core_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t  H5FD__core_lock(H5FD_t *_file, hbool_t rw);
 static herr_t  H5FD__core_unlock(H5FD_t *_file);
 
 static const H5FD_class_t H5FD_core_g = {
-    "core",                   /* name                 */
-    MAXADDR,                  /* maxaddr              */
-    H5F_CLOSE_WEAK,           /* fc_degree            */
-    H5FD__core_term,          /* terminate            */
-    NULL,                     /* sb_size              */
-    NULL,                     /* sb_encode            */
-    NULL,                     /* sb_decode            */
-    sizeof(H5FD_core_fapl_t), /* fapl_size            */
-    H5FD__core_fapl_get,      /* fapl_get             */
-    NULL,                     /* fapl_copy            */
-    NULL,                     /* fapl_free            */
-    0,                        /* dxpl_size            */
-    NULL,                     /* dxpl_copy            */
-    NULL,                     /* dxpl_free            */
-    H5FD__core_open,          /* open                 */
-    H5FD__core_close,         /* close                */
-    H5FD__core_cmp,           /* cmp                  */
-    H5FD__core_query,         /* query                */
-    NULL,                     /* get_type_map         */
-    NULL,                     /* alloc                */
-    NULL,                     /* free                 */
-    H5FD__core_get_eoa,       /* get_eoa              */
-    H5FD__core_set_eoa,       /* set_eoa              */
-    H5FD__core_get_eof,       /* get_eof              */
-    H5FD__core_get_handle,    /* get_handle           */
-    H5FD__core_read,          /* read                 */
-    H5FD__core_write,         /* write                */
-    H5FD__core_flush,         /* flush                */
-    H5FD__core_truncate,      /* truncate             */
-    H5FD__core_lock,          /* lock                 */
-    H5FD__core_unlock,        /* unlock               */
-    H5FD_FLMAP_DICHOTOMY      /* fl_map               */
+    "core",                     /* name                 */
+    MAXADDR,                    /* maxaddr              */
+    H5F_CLOSE_WEAK,             /* fc_degree            */
+    H5FD__core_term,            /* terminate            */
+    NULL,                       /* sb_size              */
+    NULL,                       /* sb_encode            */
+    NULL,                       /* sb_decode            */
+    sizeof(H5FD_core_fapl_t),   /* fapl_size            */
+    H5FD__core_fapl_get,        /* fapl_get             */
+    NULL,                       /* fapl_copy            */
+    NULL,                       /* fapl_free            */
+    0,                          /* dxpl_size            */
+    NULL,                       /* dxpl_copy            */
+    NULL,                       /* dxpl_free            */
+    H5FD__core_open,            /* open                 */
+    H5FD__core_close,           /* close                */
+    H5FD__core_cmp,             /* cmp                  */
+    H5FD__core_query,           /* query                */
+    NULL,                       /* get_type_map         */
+    NULL,                       /* alloc                */
+    NULL,                       /* free                 */
+    H5FD__core_get_eoa,         /* get_eoa              */
+    H5FD__core_set_eoa,         /* set_eoa              */
+    H5FD__core_get_eof,         /* get_eof              */
+    H5FD__core_get_handle,      /* get_handle           */
+    H5FD__core_read,            /* read                 */
+    H5FD__core_write,           /* write                */
+    H5FD__core_read_vector,     /* read_vector          */
+    H5FD__core_write_vector,    /* write_vector         */
+    H5FD__core_read_selection,  /* read_selection       */
+    H5FD__core_write_selection, /* write_selection      */
+    NULL,                       /* get_mapping          */
+    H5FD__core_flush,           /* flush                */
+    H5FD__core_truncate,        /* truncate             */
+    H5FD__core_lock,            /* lock                 */
+    H5FD__core_unlock,          /* unlock               */
+    H5FD_FLMAP_DICHOTOMY        /* fl_map               */
 };
 
 /* Define a free list to manage the region type */
@@ -1353,6 +1384,62 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__core_read() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_extend
+ *
+ * Purpose:     Grows the memory image of FILE to the multiple of the
+ *              increment that covers the address END, zero filling the
+ *              new space.
+ *
+ *              Careful of overflow.  Also, if the allocation fails then
+ *              the file should remain in a usable state.  Be careful of
+ *              non-Posix realloc() that doesn't understand what to do
+ *              when the first argument is null.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_extend(H5FD_core_t *file, haddr_t end)
+{
+    unsigned char *x;
+    size_t         new_eof;
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(end > file->eof);
+
+    /* Determine new size of memory buffer */
+    H5_CHECKED_ASSIGN(new_eof, size_t, file->increment * (end / file->increment), hsize_t);
+    if (end % file->increment)
+        new_eof += file->increment;
+
+    /* (Re)allocate memory for the file buffer, using callbacks if available */
+    if (file->fi_callbacks.image_realloc) {
+        if (NULL == (x = (unsigned char *)file->fi_callbacks.image_realloc(
+                         file->mem, new_eof, H5FD_FILE_IMAGE_OP_FILE_RESIZE, file->fi_callbacks.udata)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                        "unable to allocate memory block of %llu bytes with callback",
+                        (unsigned long long)new_eof)
+    } /* end if */
+    else {
+        if (NULL == (x = (unsigned char *)H5MM_realloc(file->mem, new_eof)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                        "unable to allocate memory block of %llu bytes", (unsigned long long)new_eof)
+    } /* end else */
+
+    HDmemset(x + file->eof, 0, (size_t)(new_eof - file->eof));
+    file->mem = x;
+
+    file->eof = new_eof;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_extend() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__core_write
  *
@@ -1383,40 +1470,10 @@ H5FD__core_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
     if (REGION_OVERFLOW(addr, size))
         HGOTO_ERROR(H5E_IO, H5E_OVERFLOW, FAIL, "file address overflowed")
 
-    /*
-     * Allocate more memory if necessary, careful of overflow. Also, if the
-     * allocation fails then the file should remain in a usable state.  Be
-     * careful of non-Posix realloc() that doesn't understand what to do when
-     * the first argument is null.
-     */
-    if (addr + size > file->eof) {
-        unsigned char *x;
-        size_t         new_eof;
-
-        /* Determine new size of memory buffer */
-        H5_CHECKED_ASSIGN(new_eof, size_t, file->increment * ((addr + size) / file->increment), hsize_t);
-        if ((addr + size) % file->increment)
-            new_eof += file->increment;
-
-        /* (Re)allocate memory for the file buffer, using callbacks if available */
-        if (file->fi_callbacks.image_realloc) {
-            if (NULL == (x = (unsigned char *)file->fi_callbacks.image_realloc(
-                             file->mem, new_eof, H5FD_FILE_IMAGE_OP_FILE_RESIZE, file->fi_callbacks.udata)))
-                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
-                            "unable to allocate memory block of %llu bytes with callback",
-                            (unsigned long long)new_eof)
-        } /* end if */
-        else {
-            if (NULL == (x = (unsigned char *)H5MM_realloc(file->mem, new_eof)))
-                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
-                            "unable to allocate memory block of %llu bytes", (unsigned long long)new_eof)
-        } /* end else */
-
-        HDmemset(x + file->eof, 0, (size_t)(new_eof - file->eof));
-        file->mem = x;
-
-        file->eof = new_eof;
-    } /* end if */
+    /* Allocate more memory if necessary */
+    if (addr + size > file->eof)
+        if (H5FD__core_extend(file, addr + size) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to extend memory image")
 
     /* Add the buffer region to the dirty list if using that optimization */
     if (file->dirty_list) {
@@ -1440,6 +1497,246 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__core_write() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_read_vector
+ *
+ * Purpose:     Reads COUNT pieces of data from FILE, where piece I is
+ *              SIZES[I] bytes at address ADDRS[I], into the buffers BUFS.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                       size_t sizes[], void *bufs[] /*out*/)
+{
+    uint32_t u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(_file && _file->cls);
+
+    for (u = 0; u < count; u++)
+        if (H5FD__core_read(_file, types[u], dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "memory read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_read_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_write_vector
+ *
+ * Purpose:     Writes COUNT pieces of data from the buffers BUFS to FILE,
+ *              where piece I is SIZES[I] bytes at address ADDRS[I].  The
+ *              memory image is grown once to hold all of the pieces,
+ *              rather than once for each piece written past its end.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                        size_t sizes[], const void *bufs[])
+{
+    H5FD_core_t *file      = (H5FD_core_t *)_file;
+    haddr_t      end       = 0;       /* End of the last piece in the file */
+    uint32_t     u;                   /* Local index variable */
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+
+    /* Check for overflow conditions and find where the pieces end */
+    for (u = 0; u < count; u++) {
+        if (REGION_OVERFLOW(addrs[u], sizes[u]))
+            HGOTO_ERROR(H5E_IO, H5E_OVERFLOW, FAIL, "file address overflowed")
+        end = MAX(end, addrs[u] + sizes[u]);
+    } /* end for */
+
+    /* Allocate more memory if necessary */
+    if (end > file->eof)
+        if (H5FD__core_extend(file, end) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to extend memory image")
+
+    for (u = 0; u < count; u++)
+        if (H5FD__core_write(_file, types[u], dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "memory write failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_write_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_select_read_cb
+ *
+ * Purpose:     H5FD_sel_iterate() operator for
+ *              H5FD__core_read_selection(), copying one piece of a
+ *              selection out of the memory image.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_select_read_cb(hsize_t file_off, hsize_t mem_off, size_t len, void *_udata)
+{
+    H5FD_core_select_ud_t *udata     = (H5FD_core_select_ud_t *)_udata;
+    herr_t                 ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (H5FD__core_read(udata->file, udata->type, udata->dxpl_id, udata->addr + file_off, len,
+                        udata->rbuf + mem_off) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "memory read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_select_read_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_select_write_cb
+ *
+ * Purpose:     H5FD_sel_iterate() operator for
+ *              H5FD__core_write_selection(), copying one piece of a
+ *              selection into the memory image.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_select_write_cb(hsize_t file_off, hsize_t mem_off, size_t len, void *_udata)
+{
+    H5FD_core_select_ud_t *udata     = (H5FD_core_select_ud_t *)_udata;
+    herr_t                 ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (H5FD__core_write(udata->file, udata->type, udata->dxpl_id, udata->addr + file_off, len,
+                         udata->wbuf + mem_off) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "memory write failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_select_write_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_read_selection
+ *
+ * Purpose:     Reads COUNT selections from FILE.  Selection I reads the
+ *              elements of ELEMENT_SIZES[I] bytes selected in the
+ *              dataspace FILE_SPACES[I], laid out from address
+ *              OFFSETS[I], into the elements selected in the dataspace
+ *              MEM_SPACES[I] of the buffer BUFS[I].  Each piece is copied
+ *              straight from the memory image, so the library doesn't
+ *              need to gather it through a sieve buffer first.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_read_selection(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, uint32_t count,
+                          hid_t mem_spaces[], hid_t file_spaces[], haddr_t offsets[],
+                          size_t element_sizes[], void *bufs[] /*out*/)
+{
+    H5FD_core_select_ud_t udata;               /* User data for H5FD_sel_iterate() operator */
+    uint32_t              u;                   /* Local index variable */
+    herr_t                ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(_file && _file->cls);
+
+    udata.file    = _file;
+    udata.type    = type;
+    udata.dxpl_id = dxpl_id;
+    for (u = 0; u < count; u++) {
+        const H5S_t *mem_space;  /* Memory dataspace */
+        const H5S_t *file_space; /* File dataspace */
+
+        if (NULL == (mem_space = (const H5S_t *)H5I_object_verify(mem_spaces[u], H5I_DATASPACE)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "memory dataspace is not a dataspace")
+        if (NULL == (file_space = (const H5S_t *)H5I_object_verify(file_spaces[u], H5I_DATASPACE)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "file dataspace is not a dataspace")
+
+        udata.addr = offsets[u];
+        udata.rbuf = (unsigned char *)bufs[u];
+        if (H5FD_sel_iterate(mem_space, file_space, element_sizes[u], H5FD__core_select_read_cb, &udata) <
+            0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "selection read failed")
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_read_selection() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_write_selection
+ *
+ * Purpose:     Writes COUNT selections to FILE.  Selection I writes the
+ *              elements selected in the dataspace MEM_SPACES[I] of the
+ *              buffer BUFS[I] to the elements of ELEMENT_SIZES[I] bytes
+ *              selected in the dataspace FILE_SPACES[I], laid out from
+ *              address OFFSETS[I].  The memory image is grown once for
+ *              each selection, and each piece is copied straight into it.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_write_selection(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, uint32_t count,
+                           hid_t mem_spaces[], hid_t file_spaces[], haddr_t offsets[],
+                           size_t element_sizes[], const void *bufs[])
+{
+    H5FD_core_t *         file = (H5FD_core_t *)_file;
+    H5FD_core_select_ud_t udata;               /* User data for H5FD_sel_iterate() operator */
+    uint32_t              u;                   /* Local index variable */
+    herr_t                ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+
+    udata.file    = _file;
+    udata.type    = type;
+    udata.dxpl_id = dxpl_id;
+    for (u = 0; u < count; u++) {
+        const H5S_t *mem_space;  /* Memory dataspace */
+        const H5S_t *file_space; /* File dataspace */
+        hsize_t      span;       /* Bytes from the offset to the end of the last element */
+
+        if (NULL == (mem_space = (const H5S_t *)H5I_object_verify(mem_spaces[u], H5I_DATASPACE)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "memory dataspace is not a dataspace")
+        if (NULL == (file_space = (const H5S_t *)H5I_object_verify(file_spaces[u], H5I_DATASPACE)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "file dataspace is not a dataspace")
+
+        /* Allocate more memory if necessary */
+        if (H5FD_sel_span(file_space, element_sizes[u], &span) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't get extent of file selection")
+        if (REGION_OVERFLOW(offsets[u], span))
+            HGOTO_ERROR(H5E_IO, H5E_OVERFLOW, FAIL, "file address overflowed")
+        if (offsets[u] + span > file->eof)
+            if (H5FD__core_extend(file, offsets[u] + span) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to extend memory image")
+
+        udata.addr = offsets[u];
+        udata.wbuf = (const unsigned char *)bufs[u];
+        if (H5FD_sel_iterate(mem_space, file_space, element_sizes[u], H5FD__core_select_write_cb, &udata) <
+            0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "selection write failed")
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_write_selection() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__core_flush
  *
@@ -47,6 +47,9 @@
 /* The size of the member name buffers */
 #define H5FD_FAM_MEMB_NAME_BUF_SIZE 4096
 
+/* The most pieces of a vector request passed to a member file at once */
+#define H5FD_FAM_VECTOR_SIZE 64
+
 /* The driver identification number, initialized at runtime */
 static hid_t H5FD_FAMILY_g = 0;
 
@@ -97,6 +100,10 @@ static herr_t  H5FD__family_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id,
                                  void *_buf /*out*/);
 static herr_t  H5FD__family_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size,
                                   const void *_buf);
+static herr_t  H5FD__family_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                        haddr_t addrs[], size_t sizes[], void *bufs[] /*out*/);
+static herr_t  H5FD__family_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                         haddr_t addrs[], size_t sizes[], const void *bufs[]);
 static herr_t  H5FD__family_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t  H5FD__family_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t  H5FD__family_lock(H5FD_t *_file, hbool_t rw);
@@ -131,6 +138,11 @@ static const H5FD_class_t H5FD_family_g = {
     H5FD__family_get_handle,    /* get_handle           */
     H5FD__family_read,          /* read            */
     H5FD__family_write,         /* write        */
+    H5FD__family_read_vector,   /* read_vector  */
+    H5FD__family_write_vector,  /* write_vector */
+    NULL,                       /* read_selection */
+    NULL,                       /* write_selection */
+    NULL,                       /* get_mapping     */
     H5FD__family_flush,         /* flush        */
     H5FD__family_truncate,      /* truncate        */
     H5FD__family_lock,          /* lock                 */
@@ -1200,6 +1212,162 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__family_read_vector
+ *
+ * Purpose:     Reads COUNT pieces of data from FILE, where piece I is
+ *              SIZES[I] bytes at address ADDRS[I], into the buffers BUFS.
+ *              Pieces are split at member boundaries, and runs of pieces
+ *              that fall in the same member are passed to that member as
+ *              one vector request.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__family_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                         size_t sizes[], void *bufs[] /*out*/)
+{
+    H5FD_family_t *file = (H5FD_family_t *)_file;
+    H5FD_mem_t     memb_types[H5FD_FAM_VECTOR_SIZE]; /* Pieces queued for the current member */
+    haddr_t        memb_addrs[H5FD_FAM_VECTOR_SIZE];
+    size_t         memb_sizes[H5FD_FAM_VECTOR_SIZE];
+    void *         memb_bufs[H5FD_FAM_VECTOR_SIZE];
+    uint32_t       nqueued   = 0;       /* Number of pieces queued */
+    unsigned       memb      = 0;       /* Member the queued pieces belong to */
+    uint32_t       u;                   /* Local index variable */
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    for (u = 0; u < count; u++) {
+        unsigned char *buf  = (unsigned char *)bufs[u];
+        haddr_t        addr = addrs[u];
+        size_t         size = sizes[u];
+
+        while (size > 0) {
+            unsigned m;       /* Member holding this part of the piece */
+            haddr_t  sub;     /* Address within the member */
+            hsize_t  tempreq; /* Bytes left in the member */
+            size_t   req;     /* Bytes of the piece in the member */
+
+            H5_CHECKED_ASSIGN(m, unsigned, addr / file->memb_size, hsize_t);
+            HDassert(m < file->nmembs);
+            sub     = addr % file->memb_size;
+            tempreq = file->memb_size - sub;
+            if (tempreq > SIZET_MAX)
+                tempreq = SIZET_MAX;
+            req = MIN(size, (size_t)tempreq);
+
+            /* Pass the queued pieces on when moving to another member */
+            if (nqueued > 0 && (m != memb || nqueued == H5FD_FAM_VECTOR_SIZE)) {
+                if (H5FDread_vector(file->memb[memb], dxpl_id, nqueued, memb_types, memb_addrs, memb_sizes,
+                                    memb_bufs) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "member file vector read failed")
+                nqueued = 0;
+            } /* end if */
+
+            memb                = m;
+            memb_types[nqueued] = types[u];
+            memb_addrs[nqueued] = sub;
+            memb_sizes[nqueued] = req;
+            memb_bufs[nqueued]  = buf;
+            nqueued++;
+
+            addr += req;
+            buf += req;
+            size -= req;
+        } /* end while */
+    }     /* end for */
+
+    if (nqueued > 0)
+        if (H5FDread_vector(file->memb[memb], dxpl_id, nqueued, memb_types, memb_addrs, memb_sizes,
+                            memb_bufs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "member file vector read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__family_read_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__family_write_vector
+ *
+ * Purpose:     Writes COUNT pieces of data from the buffers BUFS to FILE,
+ *              where piece I is SIZES[I] bytes at address ADDRS[I].
+ *              Pieces are split at member boundaries, and runs of pieces
+ *              that fall in the same member are passed to that member as
+ *              one vector request.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__family_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                          size_t sizes[], const void *bufs[])
+{
+    H5FD_family_t *file = (H5FD_family_t *)_file;
+    H5FD_mem_t     memb_types[H5FD_FAM_VECTOR_SIZE]; /* Pieces queued for the current member */
+    haddr_t        memb_addrs[H5FD_FAM_VECTOR_SIZE];
+    size_t         memb_sizes[H5FD_FAM_VECTOR_SIZE];
+    const void *   memb_bufs[H5FD_FAM_VECTOR_SIZE];
+    uint32_t       nqueued   = 0;       /* Number of pieces queued */
+    unsigned       memb      = 0;       /* Member the queued pieces belong to */
+    uint32_t       u;                   /* Local index variable */
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    for (u = 0; u < count; u++) {
+        const unsigned char *buf  = (const unsigned char *)bufs[u];
+        haddr_t              addr = addrs[u];
+        size_t               size = sizes[u];
+
+        while (size > 0) {
+            unsigned m;       /* Member holding this part of the piece */
+            haddr_t  sub;     /* Address within the member */
+            hsize_t  tempreq; /* Bytes left in the member */
+            size_t   req;     /* Bytes of the piece in the member */
+
+            H5_CHECKED_ASSIGN(m, unsigned, addr / file->memb_size, hsize_t);
+            HDassert(m < file->nmembs);
+            sub     = addr % file->memb_size;
+            tempreq = file->memb_size - sub;
+            if (tempreq > SIZET_MAX)
+                tempreq = SIZET_MAX;
+            req = MIN(size, (size_t)tempreq);
+
+            /* Pass the queued pieces on when moving to another member */
+            if (nqueued > 0 && (m != memb || nqueued == H5FD_FAM_VECTOR_SIZE)) {
+                if (H5FDwrite_vector(file->memb[memb], dxpl_id, nqueued, memb_types, memb_addrs, memb_sizes,
+                                     memb_bufs) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "member file vector write failed")
+                nqueued = 0;
+            } /* end if */
+
+            memb                = m;
+            memb_types[nqueued] = types[u];
+            memb_addrs[nqueued] = sub;
+            memb_sizes[nqueued] = req;
+            memb_bufs[nqueued]  = buf;
+            nqueued++;
+
+            addr += req;
+            buf += req;
+            size -= req;
+        } /* end while */
+    }     /* end for */
+
+    if (nqueued > 0)
+        if (H5FDwrite_vector(file->memb[memb], dxpl_id, nqueued, memb_types, memb_addrs, memb_sizes,
+                             memb_bufs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "member file vector write failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__family_write_vector() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__family_flush
  *
@@ -34,16 +34,48 @@
 #include "H5Eprivate.h"  /* Error handling                           */
 #include "H5Fprivate.h"  /* File access                              */
 #include "H5FDpkg.h"     /* File Drivers                             */
+#include "H5FLprivate.h" /* Free Lists                               */
 #include "H5Iprivate.h"  /* IDs                                      */
+#include "H5MMprivate.h" /* Memory management                        */
+#include "H5Sprivate.h"  /* Dataspaces                               */
+#include "H5VMprivate.h" /* Vector functions                         */
 
 /****************/
 /* Local Macros */
 /****************/
 
+/* Number of sequences fetched from a selection at a time, which is also the
+ * longest vector a selection is passed on in
+ */
+#define H5FD_SEL_SEQ_LIST_LEN 64
+
+/* Number of selections whose dataspace IDs are kept on the stack while
+ * they're handed to a driver
+ */
+#define H5FD_SEL_LOCAL_IDS 4
+
 /******************/
 /* Local Typedefs */
 /******************/
 
+/* Queue of pieces of selections, passed on to drivers without selection
+ * callbacks as vector requests
+ */
+typedef struct H5FD_sel_vector_ud_t {
+    H5FD_t *             file;     /* File to read or write */
+    H5FD_mem_t           type;     /* Type of the data */
+    hbool_t              is_write; /* Whether the pieces are written */
+    uint32_t             nqueued;  /* Number of pieces queued */
+    haddr_t              offset;   /* Address of the current selection's extent */
+    unsigned char *      rbuf;     /* Buffer for the current selection being read */
+    const unsigned char *wbuf;     /* Buffer for the current selection being written */
+    H5FD_mem_t           types[H5FD_SEL_SEQ_LIST_LEN]; /* Types of the queued pieces */
+    haddr_t              addrs[H5FD_SEL_SEQ_LIST_LEN]; /* Addresses of the queued pieces */
+    size_t               sizes[H5FD_SEL_SEQ_LIST_LEN]; /* Sizes of the queued pieces */
+    void *               rbufs[H5FD_SEL_SEQ_LIST_LEN]; /* Buffers for queued pieces being read */
+    const void *         wbufs[H5FD_SEL_SEQ_LIST_LEN]; /* Buffers for queued pieces being written */
+} H5FD_sel_vector_ud_t;
+
 /********************/
 /* Package Typedefs */
 /********************/
@@ -51,6 +83,17 @@
 /********************/
 /* Local Prototypes */
 /********************/
+static herr_t H5FD__sel_check_eoa(const H5FD_t *file, H5FD_mem_t type, uint32_t count,
+                                  const H5S_t *file_spaces[], const haddr_t offsets[],
+                                  const size_t element_sizes[]);
+static herr_t H5FD__sel_dispatch(H5FD_t *file, H5FD_mem_t type, uint32_t count, const H5S_t *mem_spaces[],
+                                 const H5S_t *file_spaces[], haddr_t offsets[], size_t element_sizes[],
+                                 void *rbufs[], const void *wbufs[]);
+static herr_t H5FD__sel_to_vector_cb(hsize_t file_off, hsize_t mem_off, size_t len, void *_udata);
+static herr_t H5FD__sel_to_vector_flush(H5FD_sel_vector_ud_t *udata);
+static herr_t H5FD__sel_to_vector(H5FD_t *file, H5FD_mem_t type, uint32_t count, const H5S_t *mem_spaces[],
+                                  const H5S_t *file_spaces[], const haddr_t offsets[],
+                                  const size_t element_sizes[], void *rbufs[], const void *wbufs[]);
 
 /*********************/
 /* Package Variables */
@@ -64,6 +107,12 @@
 /* Local Variables */
 /*******************/
 
+/* Declare a free list to manage the H5FD_sel_vector_ud_t struct */
+H5FL_DEFINE_STATIC(H5FD_sel_vector_ud_t);
+
+/* Declare extern free list to manage the H5S_sel_iter_t struct */
+H5FL_EXTERN(H5S_sel_iter_t);
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD_locate_signature
  *
@@ -243,6 +292,762 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_write() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_get_mapping
+ *
+ * Purpose:     Private version of H5FDget_mapping()
+ *
+ *              *PTR is set to NULL when the driver has no get_mapping
+ *              callback.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_get_mapping(H5FD_t *file, H5FD_mem_t type, haddr_t addr, size_t size, const void **ptr /*out*/)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(file->cls);
+    HDassert(ptr);
+
+    *ptr = NULL;
+
+    /* Most drivers don't map the file */
+    if (NULL == file->cls->get_mapping || 0 == size)
+        HGOTO_DONE(SUCCEED)
+
+    /* Same checks as reading the bytes */
+    if (!(file->access_flags & H5F_ACC_SWMR_READ)) {
+        haddr_t eoa;
+
+        if (HADDR_UNDEF == (eoa = (file->cls->get_eoa)(file, type)))
+            HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "driver get_eoa request failed")
+
+        if ((addr + file->base_addr + size) > eoa)
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu, eoa = %llu",
+                        (unsigned long long)(addr + file->base_addr), (unsigned long long)size,
+                        (unsigned long long)eoa)
+    }
+
+    /* Dispatch to driver */
+    if ((file->cls->get_mapping)(file, type, addr + file->base_addr, size, ptr) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "driver get_mapping request failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_get_mapping() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_read_vector
+ *
+ * Purpose:     Private version of H5FDread_vector()
+ *
+ *              Reads COUNT pieces of data, where piece I is SIZES[I] bytes
+ *              of type TYPES[I] at the RELATIVE address ADDRS[I], into the
+ *              buffer BUFS[I].  The pieces are handed to the driver's
+ *              read_vector callback as one request, or are read one at a
+ *              time if the driver doesn't provide one.
+ *
+ *              The ADDRS array is converted to absolute addresses for the
+ *              duration of the call and is restored before returning.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_read_vector(H5FD_t *file, uint32_t count, H5FD_mem_t types[], haddr_t addrs[], size_t sizes[],
+                 void *bufs[] /*out*/)
+{
+    hid_t    dxpl_id     = H5I_INVALID_HID; /* DXPL for operation */
+    hbool_t  addrs_moved = FALSE;           /* Whether the addresses were made absolute */
+    uint32_t u;                             /* Local index variable */
+    herr_t   ret_value   = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(file->cls);
+    HDassert(count == 0 || (types && addrs && sizes && bufs));
+
+    /* The no-op case */
+    if (0 == count)
+        HGOTO_DONE(SUCCEED)
+
+    /* Get proper DXPL for I/O */
+    dxpl_id = H5CX_get_dxpl();
+
+    /* Check each piece against the EOA, unless the file is open for SWMR
+     * read access (see H5FD_read() for why)
+     */
+    if (!(file->access_flags & H5F_ACC_SWMR_READ)) {
+        H5FD_mem_t eoa_type = H5FD_MEM_NOLIST; /* Type the EOA was retrieved for */
+        haddr_t    eoa      = HADDR_UNDEF;     /* EOA for the current type */
+
+        for (u = 0; u < count; u++) {
+            HDassert(bufs[u]);
+
+            if (types[u] != eoa_type) {
+                if (HADDR_UNDEF == (eoa = (file->cls->get_eoa)(file, types[u])))
+                    HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "driver get_eoa request failed")
+                eoa_type = types[u];
+            } /* end if */
+
+            if ((addrs[u] + file->base_addr + sizes[u]) > eoa)
+                HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL,
+                            "addr overflow, addr = %llu, size = %llu, eoa = %llu",
+                            (unsigned long long)(addrs[u] + file->base_addr), (unsigned long long)sizes[u],
+                            (unsigned long long)eoa)
+        } /* end for */
+    }     /* end if */
+
+    /* Convert to absolute addresses */
+    if (file->base_addr > 0) {
+        for (u = 0; u < count; u++)
+            addrs[u] += file->base_addr;
+        addrs_moved = TRUE;
+    } /* end if */
+
+    /* Dispatch to driver, a piece at a time if it can't take the whole vector */
+    if (file->cls->read_vector) {
+        if ((file->cls->read_vector)(file, dxpl_id, count, types, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "driver read vector request failed")
+    } /* end if */
+    else
+        for (u = 0; u < count; u++)
+            if ((file->cls->read)(file, types[u], dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "driver read request failed")
+
+done:
+    /* Restore the caller's relative addresses */
+    if (addrs_moved)
+        for (u = 0; u < count; u++)
+            addrs[u] -= file->base_addr;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_read_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_write_vector
+ *
+ * Purpose:     Private version of H5FDwrite_vector()
+ *
+ *              Writes COUNT pieces of data, where piece I is SIZES[I] bytes
+ *              of type TYPES[I] from the buffer BUFS[I], to the RELATIVE
+ *              address ADDRS[I].  The pieces are handed to the driver's
+ *              write_vector callback as one request, or are written one at
+ *              a time if the driver doesn't provide one.
+ *
+ *              The ADDRS array is converted to absolute addresses for the
+ *              duration of the call and is restored before returning.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_write_vector(H5FD_t *file, uint32_t count, H5FD_mem_t types[], haddr_t addrs[], size_t sizes[],
+                  const void *bufs[])
+{
+    hid_t      dxpl_id     = H5I_INVALID_HID; /* DXPL for operation */
+    hbool_t    addrs_moved = FALSE;           /* Whether the addresses were made absolute */
+    H5FD_mem_t eoa_type    = H5FD_MEM_NOLIST; /* Type the EOA was retrieved for */
+    haddr_t    eoa         = HADDR_UNDEF;     /* EOA for the current type */
+    uint32_t   u;                             /* Local index variable */
+    herr_t     ret_value   = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(file->cls);
+    HDassert(count == 0 || (types && addrs && sizes && bufs));
+
+    /* The no-op case */
+    if (0 == count)
+        HGOTO_DONE(SUCCEED)
+
+    /* Get proper DXPL for I/O */
+    dxpl_id = H5CX_get_dxpl();
+
+    /* Check each piece against the EOA */
+    for (u = 0; u < count; u++) {
+        HDassert(bufs[u]);
+
+        if (types[u] != eoa_type) {
+            if (HADDR_UNDEF == (eoa = (file->cls->get_eoa)(file, types[u])))
+                HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "driver get_eoa request failed")
+            eoa_type = types[u];
+        } /* end if */
+
+        if ((addrs[u] + file->base_addr + sizes[u]) > eoa)
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size=%llu, eoa=%llu",
+                        (unsigned long long)(addrs[u] + file->base_addr), (unsigned long long)sizes[u],
+                        (unsigned long long)eoa)
+    } /* end for */
+
+    /* Convert to absolute addresses */
+    if (file->base_addr > 0) {
+        for (u = 0; u < count; u++)
+            addrs[u] += file->base_addr;
+        addrs_moved = TRUE;
+    } /* end if */
+
+    /* Dispatch to driver, a piece at a time if it can't take the whole vector */
+    if (file->cls->write_vector) {
+        if ((file->cls->write_vector)(file, dxpl_id, count, types, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "driver write vector request failed")
+    } /* end if */
+    else
+        for (u = 0; u < count; u++)
+            if ((file->cls->write)(file, types[u], dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "driver write request failed")
+
+done:
+    /* Restore the caller's relative addresses */
+    if (addrs_moved)
+        for (u = 0; u < count; u++)
+            addrs[u] -= file->base_addr;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_write_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_has_selection_io
+ *
+ * Purpose:     Checks whether a file's driver takes selections through
+ *              read_selection/write_selection callbacks, rather than
+ *              having them broken into vectors by the library.
+ *
+ * Return:      TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5FD_has_selection_io(const H5FD_t *file)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(file);
+    HDassert(file->cls);
+
+    FUNC_LEAVE_NOAPI(NULL != file->cls->read_selection && NULL != file->cls->write_selection)
+} /* end H5FD_has_selection_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_read_selection
+ *
+ * Purpose:     Private version of H5FDread_selection()
+ *
+ *              Reads COUNT selections of data of type TYPE.  Selection I
+ *              reads the elements of ELEMENT_SIZES[I] bytes selected in
+ *              FILE_SPACES[I], counted from the RELATIVE address
+ *              OFFSETS[I], into the elements selected in MEM_SPACES[I] of
+ *              the buffer BUFS[I].  The selections are handed to the
+ *              driver's read_selection callback, or are broken into
+ *              vector requests if the driver doesn't provide one.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_read_selection(H5FD_t *file, H5FD_mem_t type, uint32_t count, const H5S_t *mem_spaces[],
+                    const H5S_t *file_spaces[], haddr_t offsets[], size_t element_sizes[],
+                    void *bufs[] /*out*/)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(file->cls);
+    HDassert(count == 0 || (mem_spaces && file_spaces && offsets && element_sizes && bufs));
+
+    /* The no-op case */
+    if (0 == count)
+        HGOTO_DONE(SUCCEED)
+
+    if (file->cls->read_selection) {
+        /* Check the selections against the EOA, unless the file is open for
+         * SWMR read access (see H5FD_read() for why)
+         */
+        if (!(file->access_flags & H5F_ACC_SWMR_READ))
+            if (H5FD__sel_check_eoa(file, type, count, file_spaces, offsets, element_sizes) < 0)
+                HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "selection read past end of allocated space")
+
+        if (H5FD__sel_dispatch(file, type, count, mem_spaces, file_spaces, offsets, element_sizes, bufs,
+                               NULL) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "driver read selection request failed")
+    } /* end if */
+    else if (H5FD__sel_to_vector(file, type, count, mem_spaces, file_spaces, offsets, element_sizes, bufs,
+                                 NULL) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "vector read of selection failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_read_selection() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_write_selection
+ *
+ * Purpose:     Private version of H5FDwrite_selection()
+ *
+ *              Writes COUNT selections of data of type TYPE.  Selection I
+ *              writes the elements selected in MEM_SPACES[I] of the buffer
+ *              BUFS[I] to the elements of ELEMENT_SIZES[I] bytes selected
+ *              in FILE_SPACES[I], counted from the RELATIVE address
+ *              OFFSETS[I].  The selections are handed to the driver's
+ *              write_selection callback, or are broken into vector
+ *              requests if the driver doesn't provide one.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_write_selection(H5FD_t *file, H5FD_mem_t type, uint32_t count, const H5S_t *mem_spaces[],
+                     const H5S_t *file_spaces[], haddr_t offsets[], size_t element_sizes[],
+                     const void *bufs[])
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(file->cls);
+    HDassert(count == 0 || (mem_spaces && file_spaces && offsets && element_sizes && bufs));
+
+    /* The no-op case */
+    if (0 == count)
+        HGOTO_DONE(SUCCEED)
+
+    if (file->cls->write_selection) {
+        /* Check the selections against the EOA */
+        if (H5FD__sel_check_eoa(file, type, count, file_spaces, offsets, element_sizes) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "selection write past end of allocated space")
+
+        if (H5FD__sel_dispatch(file, type, count, mem_spaces, file_spaces, offsets, element_sizes, NULL,
+                               bufs) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "driver write selection request failed")
+    } /* end if */
+    else if (H5FD__sel_to_vector(file, type, count, mem_spaces, file_spaces, offsets, element_sizes, NULL,
+                                 bufs) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "vector write of selection failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_write_selection() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_sel_iterate
+ *
+ * Purpose:     Pairs up the sequences of the elements of ELMT_SIZE bytes
+ *              selected in FILE_SPACE with those selected in MEM_SPACE,
+ *              calling OP for each piece that is contiguous in both.  OP
+ *              receives the byte offsets of the piece in the file
+ *              selection's extent and in the memory buffer, and its
+ *              length.
+ *
+ *              Drivers with read_selection/write_selection callbacks can
+ *              use this to service selections they can't hand on whole.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_sel_iterate(const H5S_t *mem_space, const H5S_t *file_space, size_t elmt_size, H5FD_sel_op_t op,
+                 void *op_data)
+{
+    H5S_sel_iter_t *file_iter      = NULL;  /* File selection iterator */
+    H5S_sel_iter_t *mem_iter       = NULL;  /* Memory selection iterator */
+    hbool_t         file_iter_init = FALSE; /* Whether the file iterator is initialized */
+    hbool_t         mem_iter_init  = FALSE; /* Whether the memory iterator is initialized */
+    hsize_t         file_off[H5FD_SEL_SEQ_LIST_LEN]; /* File sequence offsets */
+    size_t          file_len[H5FD_SEL_SEQ_LIST_LEN]; /* File sequence lengths */
+    hsize_t         mem_off[H5FD_SEL_SEQ_LIST_LEN];  /* Memory sequence offsets */
+    size_t          mem_len[H5FD_SEL_SEQ_LIST_LEN];  /* Memory sequence lengths */
+    size_t          file_nseq = 0;                   /* Number of file sequences */
+    size_t          mem_nseq  = 0;                   /* Number of memory sequences */
+    size_t          file_seq  = 0;                   /* Current file sequence */
+    size_t          mem_seq   = 0;                   /* Current memory sequence */
+    size_t          nelem;                           /* Number of elements in the sequences */
+    hsize_t         file_left;                       /* Number of file elements not yet listed */
+    herr_t          ret_value = SUCCEED;             /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(mem_space);
+    HDassert(file_space);
+    HDassert(elmt_size > 0);
+    HDassert(op);
+
+    if (H5S_GET_SELECT_NPOINTS(mem_space) != H5S_GET_SELECT_NPOINTS(file_space))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "memory and file selections have different sizes")
+
+    /* Set up the selection iterators */
+    if (NULL == (file_iter = H5FL_MALLOC(H5S_sel_iter_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate file selection iterator")
+    if (NULL == (mem_iter = H5FL_MALLOC(H5S_sel_iter_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate memory selection iterator")
+    if (H5S_select_iter_init(file_iter, file_space, elmt_size, 0) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize file selection iterator")
+    file_iter_init = TRUE;
+    if (H5S_select_iter_init(mem_iter, mem_space, elmt_size, 0) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize memory selection iterator")
+    mem_iter_init = TRUE;
+
+    /* Walk the two sequence lists together.  The iterators mustn't be asked
+     * for sequences once all their elements have been listed.
+     */
+    file_left = (hsize_t)H5S_GET_SELECT_NPOINTS(file_space);
+    for (;;) {
+        size_t len; /* Length of the current piece */
+
+        if (file_seq == file_nseq) {
+            if (0 == file_left)
+                break;
+            if (H5S_SELECT_ITER_GET_SEQ_LIST(file_iter, (size_t)H5FD_SEL_SEQ_LIST_LEN, (size_t)-1, &file_nseq,
+                                             &nelem, file_off, file_len) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_UNSUPPORTED, FAIL, "file sequence length generation failed")
+            if (0 == file_nseq)
+                HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "file selection ended early")
+            file_left -= nelem;
+            file_seq = 0;
+        } /* end if */
+        if (mem_seq == mem_nseq) {
+            if (H5S_SELECT_ITER_GET_SEQ_LIST(mem_iter, (size_t)H5FD_SEL_SEQ_LIST_LEN, (size_t)-1, &mem_nseq,
+                                             &nelem, mem_off, mem_len) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_UNSUPPORTED, FAIL, "memory sequence length generation failed")
+            if (0 == mem_nseq)
+                HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "memory selection ended early")
+            mem_seq = 0;
+        } /* end if */
+
+        /* Hand on the piece that's contiguous in both */
+        len = MIN(file_len[file_seq], mem_len[mem_seq]);
+        if ((op)(file_off[file_seq], mem_off[mem_seq], len, op_data) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTOPERATE, FAIL, "selection sequence operator failed")
+
+        /* Advance past the piece */
+        file_off[file_seq] += len;
+        if (0 == (file_len[file_seq] -= len))
+            file_seq++;
+        mem_off[mem_seq] += len;
+        if (0 == (mem_len[mem_seq] -= len))
+            mem_seq++;
+    } /* end for */
+
+done:
+    if (file_iter_init && H5S_SELECT_ITER_RELEASE(file_iter) < 0)
+        HDONE_ERROR(H5E_VFL, H5E_CANTRELEASE, FAIL, "unable to release file selection iterator")
+    if (mem_iter_init && H5S_SELECT_ITER_RELEASE(mem_iter) < 0)
+        HDONE_ERROR(H5E_VFL, H5E_CANTRELEASE, FAIL, "unable to release memory selection iterator")
+    if (file_iter)
+        file_iter = H5FL_FREE(H5S_sel_iter_t, file_iter);
+    if (mem_iter)
+        mem_iter = H5FL_FREE(H5S_sel_iter_t, mem_iter);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_sel_iterate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sel_check_eoa
+ *
+ * Purpose:     Checks that the elements of COUNT file selections,
+ *              counted from the RELATIVE addresses OFFSETS, lie below the
+ *              EOA for TYPE.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__sel_check_eoa(const H5FD_t *file, H5FD_mem_t type, uint32_t count, const H5S_t *file_spaces[],
+                    const haddr_t offsets[], const size_t element_sizes[])
+{
+    haddr_t  eoa;                 /* EOA for the type */
+    uint32_t u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (HADDR_UNDEF == (eoa = (file->cls->get_eoa)(file, type)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "driver get_eoa request failed")
+
+    for (u = 0; u < count; u++) {
+        hsize_t span; /* Bytes from the offset to the end of the last element */
+
+        if (H5FD_sel_span(file_spaces[u], element_sizes[u], &span) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't get extent of file selection")
+
+        if ((offsets[u] + file->base_addr + span) > eoa)
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu, eoa = %llu",
+                        (unsigned long long)(offsets[u] + file->base_addr), (unsigned long long)span,
+                        (unsigned long long)eoa)
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sel_check_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sel_dispatch
+ *
+ * Purpose:     Hands COUNT selections to the driver's read_selection
+ *              callback, when RBUFS is given, or its write_selection
+ *              callback, when WBUFS is given.  The dataspaces are
+ *              registered as IDs for the duration of the call, and the
+ *              OFFSETS array is converted to absolute addresses and
+ *              restored before returning.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__sel_dispatch(H5FD_t *file, H5FD_mem_t type, uint32_t count, const H5S_t *mem_spaces[],
+                   const H5S_t *file_spaces[], haddr_t offsets[], size_t element_sizes[], void *rbufs[],
+                   const void *wbufs[])
+{
+    hid_t    local_ids[2 * H5FD_SEL_LOCAL_IDS]; /* IDs for a small number of selections */
+    hid_t *  mem_ids     = NULL;                /* IDs of the memory dataspaces */
+    hid_t *  file_ids    = NULL;                /* IDs of the file dataspaces */
+    uint32_t nregistered = 0;                   /* Number of selections with IDs registered */
+    hbool_t  addrs_moved = FALSE;               /* Whether the offsets were made absolute */
+    uint32_t u;                                 /* Local index variable */
+    herr_t   ret_value   = SUCCEED;             /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(rbufs || wbufs);
+
+    /* Register IDs for the dataspaces, which the driver doesn't own */
+    if (count <= H5FD_SEL_LOCAL_IDS)
+        mem_ids = local_ids;
+    else if (NULL == (mem_ids = (hid_t *)H5MM_malloc(2 * count * sizeof(hid_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate dataspace ID arrays")
+    file_ids = mem_ids + count;
+    for (nregistered = 0; nregistered < count; nregistered++) {
+        if ((mem_ids[nregistered] = H5I_register(H5I_DATASPACE, mem_spaces[nregistered], FALSE)) < 0)
+            HGOTO_ERROR(H5E_ID, H5E_CANTREGISTER, FAIL, "unable to register memory dataspace ID")
+        if ((file_ids[nregistered] = H5I_register(H5I_DATASPACE, file_spaces[nregistered], FALSE)) < 0) {
+            H5I_remove(mem_ids[nregistered]);
+            HGOTO_ERROR(H5E_ID, H5E_CANTREGISTER, FAIL, "unable to register file dataspace ID")
+        } /* end if */
+    }     /* end for */
+
+    /* Convert to absolute addresses */
+    if (file->base_addr > 0) {
+        for (u = 0; u < count; u++)
+            offsets[u] += file->base_addr;
+        addrs_moved = TRUE;
+    } /* end if */
+
+    /* Dispatch to driver */
+    if (rbufs) {
+        if ((file->cls->read_selection)(file, type, H5CX_get_dxpl(), count, mem_ids, file_ids, offsets,
+                                        element_sizes, rbufs) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "driver read selection request failed")
+    } /* end if */
+    else if ((file->cls->write_selection)(file, type, H5CX_get_dxpl(), count, mem_ids, file_ids, offsets,
+                                          element_sizes, wbufs) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "driver write selection request failed")
+
+done:
+    /* Restore the caller's relative addresses */
+    if (addrs_moved)
+        for (u = 0; u < count; u++)
+            offsets[u] -= file->base_addr;
+
+    /* Release the IDs, without closing the dataspaces */
+    for (u = 0; u < nregistered; u++) {
+        H5I_remove(mem_ids[u]);
+        H5I_remove(file_ids[u]);
+    } /* end for */
+    if (mem_ids != local_ids)
+        H5MM_xfree(mem_ids);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sel_dispatch() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sel_to_vector_cb
+ *
+ * Purpose:     H5FD_sel_iterate() operator for H5FD__sel_to_vector().
+ *              Queues a piece of the current selection, passing the
+ *              queue on as one vector request when it's full.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__sel_to_vector_cb(hsize_t file_off, hsize_t mem_off, size_t len, void *_udata)
+{
+    H5FD_sel_vector_ud_t *udata     = (H5FD_sel_vector_ud_t *)_udata;
+    herr_t                ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Pass on the queued pieces when there's no room for another */
+    if (udata->nqueued == H5FD_SEL_SEQ_LIST_LEN && H5FD__sel_to_vector_flush(udata) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTOPERATE, FAIL, "vector request failed")
+
+    /* Queue this piece */
+    udata->types[udata->nqueued] = udata->type;
+    udata->addrs[udata->nqueued] = udata->offset + file_off;
+    udata->sizes[udata->nqueued] = len;
+    if (udata->rbuf)
+        udata->rbufs[udata->nqueued] = udata->rbuf + mem_off;
+    else
+        udata->wbufs[udata->nqueued] = udata->wbuf + mem_off;
+    udata->nqueued++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sel_to_vector_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sel_to_vector_flush
+ *
+ * Purpose:     Reads or writes the pieces queued by
+ *              H5FD__sel_to_vector_cb() as one vector request.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__sel_to_vector_flush(H5FD_sel_vector_ud_t *udata)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (udata->is_write) {
+        if (H5FD_write_vector(udata->file, udata->nqueued, udata->types, udata->addrs, udata->sizes,
+                              udata->wbufs) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "vector write failed")
+    } /* end if */
+    else if (H5FD_read_vector(udata->file, udata->nqueued, udata->types, udata->addrs, udata->sizes,
+                              udata->rbufs) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "vector read failed")
+    udata->nqueued = 0;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sel_to_vector_flush() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sel_to_vector
+ *
+ * Purpose:     Reads COUNT selections into RBUFS, or writes them from
+ *              WBUFS, for drivers without selection callbacks, by
+ *              breaking them into pieces passed on as vector requests.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__sel_to_vector(H5FD_t *file, H5FD_mem_t type, uint32_t count, const H5S_t *mem_spaces[],
+                    const H5S_t *file_spaces[], const haddr_t offsets[], const size_t element_sizes[],
+                    void *rbufs[], const void *wbufs[])
+{
+    H5FD_sel_vector_ud_t *udata = NULL;      /* Queue of pieces */
+    uint32_t              u;                 /* Local index variable */
+    herr_t                ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(rbufs || wbufs);
+
+    if (NULL == (udata = H5FL_MALLOC(H5FD_sel_vector_ud_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate vector queue")
+    udata->file     = file;
+    udata->type     = type;
+    udata->is_write = (wbufs != NULL);
+    udata->nqueued  = 0;
+
+    for (u = 0; u < count; u++) {
+        udata->offset = offsets[u];
+        udata->rbuf   = rbufs ? (unsigned char *)rbufs[u] : NULL;
+        udata->wbuf   = wbufs ? (const unsigned char *)wbufs[u] : NULL;
+
+        if (H5FD_sel_iterate(mem_spaces[u], file_spaces[u], element_sizes[u], H5FD__sel_to_vector_cb, udata) <
+            0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTOPERATE, FAIL, "can't iterate over selections")
+    } /* end for */
+
+    /* Pass on the pieces still queued */
+    if (udata->nqueued > 0 && H5FD__sel_to_vector_flush(udata) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTOPERATE, FAIL, "vector request failed")
+
+done:
+    if (udata)
+        udata = H5FL_FREE(H5FD_sel_vector_ud_t, udata);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sel_to_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_sel_span
+ *
+ * Purpose:     Computes the number of bytes from the start of the extent
+ *              of FILE_SPACE to the end of its last selected element, for
+ *              elements of ELMT_SIZE bytes, or zero if nothing is
+ *              selected.  The linear offset of the selection's upper
+ *              bound is at least that of any element selected, so it's
+ *              the one used.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_sel_span(const H5S_t *file_space, size_t elmt_size, hsize_t *span /*out*/)
+{
+    hsize_t dims[H5S_MAX_RANK];  /* Dimensions of the file space */
+    hsize_t start[H5S_MAX_RANK]; /* Lower bound of the selection */
+    hsize_t end[H5S_MAX_RANK];   /* Upper bound of the selection */
+    int     rank;                /* Rank of the file space */
+    herr_t  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(file_space);
+    HDassert(span);
+
+    if (0 == H5S_GET_SELECT_NPOINTS(file_space))
+        *span = 0;
+    else {
+        if ((rank = H5S_get_simple_extent_dims(file_space, dims, NULL)) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't get dataspace dimensions")
+        if (rank > 0) {
+            if (H5S_SELECT_BOUNDS(file_space, start, end) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't get selection bounds")
+            *span = (H5VM_array_offset((unsigned)rank, dims, end) + 1) * elmt_size;
+        } /* end if */
+        else
+            *span = elmt_size;
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_sel_span() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD_set_eoa
  *
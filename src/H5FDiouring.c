@@ -0,0 +1,1522 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: The Linux io_uring file driver.  Reads and writes are queued on
+ *          an io_uring submission ring instead of being issued as one
+ *          blocking pread()/pwrite() call each, so a batch of requests
+ *          (the pieces of a vector request, or the entries written during
+ *          a metadata cache flush or a chunk cache eviction) costs one
+ *          io_uring_enter() system call and can be in flight at once.
+ *
+ *          Writes that fit in one of the driver's staging buffers are
+ *          copied there and left queued; they're submitted when the ring
+ *          fills, when a read or a larger write has to wait anyway, or
+ *          when the file is flushed, truncated or closed.  The staging
+ *          buffers and the file descriptor are registered with the ring
+ *          when the kernel allows it, which saves the kernel from mapping
+ *          the buffers and looking up the file for every request.
+ *
+ *          The ring is driven with the raw system calls, so liburing
+ *          isn't needed.
+ */
+
+#include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
+
+#include "H5private.h"   /* Generic Functions        */
+#include "H5Eprivate.h"  /* Error handling           */
+#include "H5Fprivate.h"  /* File access              */
+#include "H5FDprivate.h" /* File drivers             */
+#include "H5FDiouring.h" /* io_uring file driver     */
+#include "H5FLprivate.h" /* Free Lists               */
+#include "H5Iprivate.h"  /* IDs                      */
+#include "H5MMprivate.h" /* Memory management        */
+#include "H5Pprivate.h"  /* Property lists           */
+
+#ifdef H5_HAVE_IOURING
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_IOURING_g = 0;
+
+/* Whether to ignore file locks when disabled (env var value) */
+static htri_t ignore_disabled_file_locks_s = FAIL;
+
+/* The most bytes moved by one request, as for a single pread()/pwrite() */
+#define H5FD_IOURING_MAX_IO ((size_t)0x7ffff000)
+
+/* The most entries the kernel allows on a ring */
+#define H5FD_IOURING_MAX_QUEUE_DEPTH 32768
+
+/* Driver-specific file access properties */
+typedef struct H5FD_iouring_fapl_t {
+    unsigned queue_depth; /* Number of requests that can be queued */
+    size_t   buf_size;    /* Size of each write staging buffer     */
+} H5FD_iouring_fapl_t;
+
+/* A request queued on the ring.  A request takes the submission queue
+ * entry and the staging buffer with the same index as its own.
+ */
+typedef struct H5FD_iouring_req_t {
+    haddr_t        addr;   /* File address of the bytes still to move */
+    size_t         size;   /* Number of bytes still to move           */
+    unsigned char *buf;    /* Buffer of the bytes still to move       */
+    hbool_t        write;  /* Whether the request is a write          */
+    hbool_t        staged; /* Whether BUF is the staging buffer       */
+    hbool_t        waited; /* Whether the caller waits for it         */
+} H5FD_iouring_req_t;
+
+/* The description of a file belonging to this driver.  The 'eoa' and 'eof'
+ * determine the amount of hdf5 address space in use and the high-water mark
+ * of the file, including writes that are still queued.
+ */
+typedef struct H5FD_iouring_t {
+    H5FD_t              pub; /* public stuff, must be first      */
+    int                 fd;  /* the filesystem file descriptor   */
+    haddr_t             eoa; /* end of allocated region          */
+    haddr_t             eof; /* end of file; current file size   */
+    H5FD_iouring_fapl_t fa;  /* file access properties           */
+    hbool_t             ignore_disabled_file_locks;
+    char                filename[H5FD_MAX_FILENAME_LEN]; /* Copy of file name from open operation */
+    dev_t               device;                          /* file device number   */
+    ino_t               inode;                           /* file i-node number   */
+
+    /* The ring */
+    int                  ring_fd;   /* io_uring file descriptor              */
+    void *               sq_ring;   /* Mapped submission ring                */
+    size_t               sq_len;    /* Size of the submission ring mapping   */
+    void *               cq_ring;   /* Mapped completion ring                */
+    size_t               cq_len;    /* Size of the completion ring mapping   */
+    struct io_uring_sqe *sqes;      /* Mapped submission queue entries       */
+    size_t               sqes_len;  /* Size of the entries mapping           */
+    unsigned *           sq_tail;   /* Submission ring tail                  */
+    unsigned *           sq_mask;   /* Submission ring index mask            */
+    unsigned *           sq_array;  /* Submission ring of entry indices      */
+    unsigned *           cq_head;   /* Completion ring head                  */
+    unsigned *           cq_tail;   /* Completion ring tail                  */
+    unsigned *           cq_mask;   /* Completion ring index mask            */
+    struct io_uring_cqe *cqes;      /* Completion queue entries              */
+    hbool_t              fixed_fd;  /* Whether FD is registered with the ring */
+    hbool_t              fixed_buf; /* Whether STAGE is registered too       */
+
+    /* The requests */
+    unsigned            nreqs;     /* Number of request slots               */
+    H5FD_iouring_req_t *reqs;      /* Request slots                         */
+    unsigned *          free_reqs; /* Stack of free request slots           */
+    unsigned            nfree;     /* Number of free request slots          */
+    unsigned            nunsent;   /* Entries on the ring not yet submitted */
+    unsigned            nwaited;   /* Requests a caller is waiting for      */
+    unsigned            nfailed;   /* Failed requests not yet reported      */
+    unsigned char *     stage;     /* Write staging buffers                 */
+
+    /* Information from properties set by 'h5repart' tool
+     *
+     * Whether to eliminate the family driver info and convert this file to
+     * a single file.
+     */
+    hbool_t fam_to_single;
+} H5FD_iouring_t;
+
+/*
+ * These macros check for overflow of various quantities.  These macros
+ * assume that HDoff_t is signed and haddr_t and size_t are unsigned.
+ *
+ * ADDR_OVERFLOW:   Checks whether a file address of type `haddr_t'
+ *                  is too large to be represented by the second argument
+ *                  of the file seek function.
+ *
+ * SIZE_OVERFLOW:   Checks whether a buffer size of type `hsize_t' is too
+ *                  large to be represented by the `size_t' type.
+ *
+ * REGION_OVERFLOW: Checks whether an address and size pair describe data
+ *                  which can be addressed entirely by the second
+ *                  argument of the file seek function.
+ */
+#define MAXADDR          (((haddr_t)1 << (8 * sizeof(HDoff_t) - 1)) - 1)
+#define ADDR_OVERFLOW(A) (HADDR_UNDEF == (A) || ((A) & ~(haddr_t)MAXADDR))
+#define SIZE_OVERFLOW(Z) ((Z) & ~(hsize_t)MAXADDR)
+#define REGION_OVERFLOW(A, Z)                                                                                \
+    (ADDR_OVERFLOW(A) || SIZE_OVERFLOW(Z) || HADDR_UNDEF == (A) + (Z) || (HDoff_t)((A) + (Z)) < (HDoff_t)(A))
+
+/* Ring index loads and stores, ordered against the kernel's side */
+#define H5FD_IOURING_LOAD(P)     __atomic_load_n((P), __ATOMIC_ACQUIRE)
+#define H5FD_IOURING_STORE(P, V) __atomic_store_n((P), (V), __ATOMIC_RELEASE)
+
+/* Prototypes */
+static herr_t  H5FD__iouring_term(void);
+static void *  H5FD__iouring_fapl_get(H5FD_t *file);
+static void *  H5FD__iouring_fapl_copy(const void *_old_fa);
+static H5FD_t *H5FD__iouring_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
+static herr_t  H5FD__iouring_close(H5FD_t *_file);
+static int     H5FD__iouring_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t  H5FD__iouring_query(const H5FD_t *_f1, unsigned long *flags);
+static haddr_t H5FD__iouring_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__iouring_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t H5FD__iouring_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__iouring_get_handle(H5FD_t *_file, hid_t fapl, void **file_handle);
+static herr_t  H5FD__iouring_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
+                                  void *buf);
+static herr_t  H5FD__iouring_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
+                                   const void *buf);
+static herr_t  H5FD__iouring_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                         haddr_t addrs[], size_t sizes[], void *bufs[] /*out*/);
+static herr_t  H5FD__iouring_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                          haddr_t addrs[], size_t sizes[], const void *bufs[]);
+static herr_t  H5FD__iouring_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t  H5FD__iouring_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t  H5FD__iouring_lock(H5FD_t *_file, hbool_t rw);
+static herr_t  H5FD__iouring_unlock(H5FD_t *_file);
+
+static herr_t H5FD__iouring_ring_init(H5FD_iouring_t *file);
+static herr_t H5FD__iouring_ring_term(H5FD_iouring_t *file);
+static void   H5FD__iouring_prep(H5FD_iouring_t *file, unsigned idx);
+static herr_t H5FD__iouring_reap(H5FD_iouring_t *file);
+static herr_t H5FD__iouring_enter(H5FD_iouring_t *file, unsigned min_complete);
+static herr_t H5FD__iouring_wait(H5FD_iouring_t *file, hbool_t all);
+static herr_t H5FD__iouring_queue(H5FD_iouring_t *file, haddr_t addr, size_t size, void *rbuf,
+                                  const void *wbuf);
+
+static const H5FD_class_t H5FD_iouring_g = {
+    "iouring",                   /* name                 */
+    MAXADDR,                     /* maxaddr              */
+    H5F_CLOSE_WEAK,              /* fc_degree            */
+    H5FD__iouring_term,          /* terminate            */
+    NULL,                        /* sb_size              */
+    NULL,                        /* sb_encode            */
+    NULL,                        /* sb_decode            */
+    sizeof(H5FD_iouring_fapl_t), /* fapl_size            */
+    H5FD__iouring_fapl_get,      /* fapl_get             */
+    H5FD__iouring_fapl_copy,     /* fapl_copy            */
+    NULL,                        /* fapl_free            */
+    0,                           /* dxpl_size            */
+    NULL,                        /* dxpl_copy            */
+    NULL,                        /* dxpl_free            */
+    H5FD__iouring_open,          /* open                 */
+    H5FD__iouring_close,         /* close                */
+    H5FD__iouring_cmp,           /* cmp                  */
+    H5FD__iouring_query,         /* query                */
+    NULL,                        /* get_type_map         */
+    NULL,                        /* alloc                */
+    NULL,                        /* free                 */
+    H5FD__iouring_get_eoa,       /* get_eoa              */
+    H5FD__iouring_set_eoa,       /* set_eoa              */
+    H5FD__iouring_get_eof,       /* get_eof              */
+    H5FD__iouring_get_handle,    /* get_handle           */
+    H5FD__iouring_read,          /* read                 */
+    H5FD__iouring_write,         /* write                */
+    H5FD__iouring_read_vector,   /* read_vector          */
+    H5FD__iouring_write_vector,  /* write_vector         */
+    NULL,                        /* read_selection       */
+    NULL,                        /* write_selection      */
+    NULL,                        /* get_mapping          */
+    H5FD__iouring_flush,         /* flush                */
+    H5FD__iouring_truncate,      /* truncate             */
+    H5FD__iouring_lock,          /* lock                 */
+    H5FD__iouring_unlock,        /* unlock               */
+    H5FD_FLMAP_DICHOTOMY         /* fl_map               */
+};
+
+/* Declare a free list to manage the H5FD_iouring_t struct */
+H5FL_DEFINE_STATIC(H5FD_iouring_t);
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__init_package
+ *
+ * Purpose:     Initializes any interface-specific data or routines.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__init_package(void)
+{
+    char * lock_env_var = NULL; /* Environment variable pointer */
+    herr_t ret_value    = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Check the use disabled file locks environment variable */
+    lock_env_var = HDgetenv("HDF5_USE_FILE_LOCKING");
+    if (lock_env_var && !HDstrcmp(lock_env_var, "BEST_EFFORT"))
+        ignore_disabled_file_locks_s = TRUE; /* Override: Ignore disabled locks */
+    else if (lock_env_var && (!HDstrcmp(lock_env_var, "TRUE") || !HDstrcmp(lock_env_var, "1")))
+        ignore_disabled_file_locks_s = FALSE; /* Override: Don't ignore disabled locks */
+    else
+        ignore_disabled_file_locks_s = FAIL; /* Environment variable not set, or not set correctly */
+
+    if (H5FD_iouring_init() < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize io_uring VFD")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FD__init_package() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_init
+ *
+ * Purpose:     Initialize this driver by registering the driver with the
+ *              library.
+ *
+ * Return:      Success:    The driver ID for the io_uring driver
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_iouring_init(void)
+{
+    hid_t ret_value = H5I_INVALID_HID; /* Return value */
+
+    FUNC_ENTER_NOAPI(H5I_INVALID_HID)
+
+    if (H5I_VFL != H5I_get_type(H5FD_IOURING_g))
+        H5FD_IOURING_g = H5FD_register(&H5FD_iouring_g, sizeof(H5FD_class_t), FALSE);
+
+    /* Set return value */
+    ret_value = H5FD_IOURING_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_init() */
+
+/*---------------------------------------------------------------------------
+ * Function:    H5FD__iouring_term
+ *
+ * Purpose:     Shut down the VFD
+ *
+ * Returns:     SUCCEED (Can't fail)
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_term(void)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Reset VFL ID */
+    H5FD_IOURING_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__iouring_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_iouring
+ *
+ * Purpose:     Modify the file access property list to use the
+ *              H5FD_IOURING driver defined in this source file.
+ *              QUEUE_DEPTH is the number of requests that can be queued
+ *              on the ring at once, and BUF_SIZE is the size of each of
+ *              the buffers that hold queued writes.  Zero selects the
+ *              default for either.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_iouring(hid_t fapl_id, unsigned queue_depth, size_t buf_size)
+{
+    H5P_genplist_t *    plist; /* Property list pointer */
+    H5FD_iouring_fapl_t fa;
+    herr_t              ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "iIuz", fapl_id, queue_depth, buf_size);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+    if (queue_depth > H5FD_IOURING_MAX_QUEUE_DEPTH)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "queue depth is too large")
+    if (buf_size > H5FD_IOURING_MAX_IO)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "staging buffer size is too large")
+
+    HDmemset(&fa, 0, sizeof(H5FD_iouring_fapl_t));
+    fa.queue_depth = queue_depth ? queue_depth : H5FD_IOURING_QUEUE_DEPTH_DEF;
+    fa.buf_size    = buf_size ? buf_size : H5FD_IOURING_BUF_SIZE_DEF;
+
+    ret_value = H5P_set_driver(plist, H5FD_IOURING, &fa);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_iouring() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_iouring
+ *
+ * Purpose:     Returns information about the io_uring file access property
+ *              list though the function arguments.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_iouring(hid_t fapl_id, unsigned *queue_depth /*out*/, size_t *buf_size /*out*/)
+{
+    H5P_genplist_t *           plist; /* Property list pointer */
+    const H5FD_iouring_fapl_t *fa;
+    herr_t                     ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ixx", fapl_id, queue_depth, buf_size);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+    if (H5FD_IOURING != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if (NULL == (fa = (const H5FD_iouring_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+    if (queue_depth)
+        *queue_depth = fa->queue_depth;
+    if (buf_size)
+        *buf_size = fa->buf_size;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_iouring() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_fapl_get
+ *
+ * Purpose:     Returns a file access property list which indicates how the
+ *              specified file is being accessed. The return list could be
+ *              used to access another file the same way.
+ *
+ * Return:      Success:    Ptr to new file access property list with all
+ *                          members copied from the file struct.
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__iouring_fapl_get(H5FD_t *_file)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    void *          ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Set return value */
+    ret_value = H5FD__iouring_fapl_copy(&(file->fa));
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_fapl_get() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_fapl_copy
+ *
+ * Purpose:     Copies the io_uring-specific file access properties.
+ *
+ * Return:      Success:    Ptr to a new property list
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__iouring_fapl_copy(const void *_old_fa)
+{
+    const H5FD_iouring_fapl_t *old_fa    = (const H5FD_iouring_fapl_t *)_old_fa;
+    H5FD_iouring_fapl_t *      new_fa    = NULL; /* New fapl info */
+    void *                     ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (NULL == (new_fa = (H5FD_iouring_fapl_t *)H5MM_malloc(sizeof(H5FD_iouring_fapl_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+
+    /* Copy the general information */
+    H5MM_memcpy(new_fa, old_fa, sizeof(H5FD_iouring_fapl_t));
+
+    /* Set return value */
+    ret_value = new_fa;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_fapl_copy() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_ring_init
+ *
+ * Purpose:     Sets up the io_uring instance of FILE: creates the ring,
+ *              maps its submission and completion queues, and sets up the
+ *              request slots and the write staging buffers.  The file
+ *              descriptor and the staging buffers are registered with the
+ *              ring when the kernel allows it; requests work without that,
+ *              just with a little more overhead per request.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_ring_init(H5FD_iouring_t *file)
+{
+    struct io_uring_params params; /* Ring set up parameters and offsets */
+    struct iovec *         iov = NULL; /* Staging buffers to register */
+    void *                 ptr;        /* Mapped memory */
+    unsigned               u;          /* Local index variable */
+    herr_t                 ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(file->fa.queue_depth > 0);
+
+    /* Create the ring */
+    HDmemset(&params, 0, sizeof(params));
+    if ((file->ring_fd = (int)syscall(__NR_io_uring_setup, file->fa.queue_depth, &params)) < 0)
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to set up io_uring")
+
+    /* Map the submission and completion rings, which share one mapping on
+     * newer kernels
+     */
+    file->sq_len = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    file->cq_len = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+        file->sq_len = file->cq_len = MAX(file->sq_len, file->cq_len);
+    if (MAP_FAILED == (ptr = mmap(NULL, file->sq_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                  file->ring_fd, (off_t)IORING_OFF_SQ_RING)))
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to map io_uring submission ring")
+    file->sq_ring = ptr;
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+        file->cq_ring = file->sq_ring;
+    else {
+        if (MAP_FAILED == (ptr = mmap(NULL, file->cq_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                      file->ring_fd, (off_t)IORING_OFF_CQ_RING)))
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to map io_uring completion ring")
+        file->cq_ring = ptr;
+    } /* end else */
+    file->sqes_len = params.sq_entries * sizeof(struct io_uring_sqe);
+    if (MAP_FAILED == (ptr = mmap(NULL, file->sqes_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                  file->ring_fd, (off_t)IORING_OFF_SQES)))
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to map io_uring submission entries")
+    file->sqes = (struct io_uring_sqe *)ptr;
+
+    file->sq_tail  = (unsigned *)((unsigned char *)file->sq_ring + params.sq_off.tail);
+    file->sq_mask  = (unsigned *)((unsigned char *)file->sq_ring + params.sq_off.ring_mask);
+    file->sq_array = (unsigned *)((unsigned char *)file->sq_ring + params.sq_off.array);
+    file->cq_head  = (unsigned *)((unsigned char *)file->cq_ring + params.cq_off.head);
+    file->cq_tail  = (unsigned *)((unsigned char *)file->cq_ring + params.cq_off.tail);
+    file->cq_mask  = (unsigned *)((unsigned char *)file->cq_ring + params.cq_off.ring_mask);
+    file->cqes     = (struct io_uring_cqe *)((unsigned char *)file->cq_ring + params.cq_off.cqes);
+
+    /* Set up the request slots, no more than fit on the rings at once */
+    file->nreqs = MIN(file->fa.queue_depth, params.sq_entries);
+    if (NULL == (file->reqs = (H5FD_iouring_req_t *)H5MM_calloc(file->nreqs * sizeof(H5FD_iouring_req_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate request slots")
+    if (NULL == (file->free_reqs = (unsigned *)H5MM_malloc(file->nreqs * sizeof(unsigned))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate request slots")
+    for (u = 0; u < file->nreqs; u++)
+        file->free_reqs[u] = file->nreqs - u - 1;
+    file->nfree = file->nreqs;
+
+    /* Set up the staging buffers, one for each request slot */
+    if (NULL == (file->stage = (unsigned char *)H5MM_malloc(file->nreqs * file->fa.buf_size)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate staging buffers")
+
+    /* Register the file descriptor and the staging buffers.  The kernel
+     * refuses the buffers when they'd take it past the locked memory limit,
+     * which is fine.
+     */
+    if (0 == syscall(__NR_io_uring_register, file->ring_fd, IORING_REGISTER_FILES, &file->fd, 1))
+        file->fixed_fd = TRUE;
+    if (NULL == (iov = (struct iovec *)H5MM_malloc(file->nreqs * sizeof(struct iovec))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate staging buffer list")
+    for (u = 0; u < file->nreqs; u++) {
+        iov[u].iov_base = file->stage + (size_t)u * file->fa.buf_size;
+        iov[u].iov_len  = file->fa.buf_size;
+    } /* end for */
+    if (0 == syscall(__NR_io_uring_register, file->ring_fd, IORING_REGISTER_BUFFERS, iov, file->nreqs))
+        file->fixed_buf = TRUE;
+
+done:
+    H5MM_xfree(iov);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_ring_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_ring_term
+ *
+ * Purpose:     Tears down the io_uring instance of FILE, which must not
+ *              have any requests in flight.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_ring_term(H5FD_iouring_t *file)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    if (file->sqes && munmap(file->sqes, file->sqes_len) < 0)
+        HSYS_DONE_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "unable to unmap io_uring submission entries")
+    if (file->cq_ring && file->cq_ring != file->sq_ring && munmap(file->cq_ring, file->cq_len) < 0)
+        HSYS_DONE_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "unable to unmap io_uring completion ring")
+    if (file->sq_ring && munmap(file->sq_ring, file->sq_len) < 0)
+        HSYS_DONE_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "unable to unmap io_uring submission ring")
+
+    /* The kernel tears a closed ring down in the background, so drop the
+     * registered file and buffers now: a registered file keeps its lock
+     * held after the driver closes its own descriptor.
+     */
+    if (file->fixed_buf &&
+        syscall(__NR_io_uring_register, file->ring_fd, IORING_UNREGISTER_BUFFERS, NULL, 0) < 0)
+        HSYS_DONE_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "unable to unregister io_uring staging buffers")
+    if (file->fixed_fd && syscall(__NR_io_uring_register, file->ring_fd, IORING_UNREGISTER_FILES, NULL, 0) < 0)
+        HSYS_DONE_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "unable to unregister file with io_uring")
+    file->fixed_buf = FALSE;
+    file->fixed_fd  = FALSE;
+
+    if (file->ring_fd >= 0 && HDclose(file->ring_fd) < 0)
+        HSYS_DONE_ERROR(H5E_VFL, H5E_CANTCLOSEOBJ, FAIL, "unable to close io_uring")
+
+    file->reqs      = (H5FD_iouring_req_t *)H5MM_xfree(file->reqs);
+    file->free_reqs = (unsigned *)H5MM_xfree(file->free_reqs);
+    file->stage     = (unsigned char *)H5MM_xfree(file->stage);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_ring_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_prep
+ *
+ * Purpose:     Fills in the submission queue entry for the request in
+ *              slot IDX of FILE and puts it on the submission ring.  The
+ *              kernel picks it up at the next io_uring_enter() call.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__iouring_prep(H5FD_iouring_t *file, unsigned idx)
+{
+    H5FD_iouring_req_t * req = &file->reqs[idx];  /* The request */
+    struct io_uring_sqe *sqe = &file->sqes[idx];  /* Its submission queue entry */
+    unsigned             tail;                    /* Submission ring tail */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDmemset(sqe, 0, sizeof(*sqe));
+    if (!req->write)
+        sqe->opcode = (uint8_t)IORING_OP_READ;
+    else if (req->staged && file->fixed_buf) {
+        sqe->opcode    = (uint8_t)IORING_OP_WRITE_FIXED;
+        sqe->buf_index = (uint16_t)idx;
+    } /* end if */
+    else
+        sqe->opcode = (uint8_t)IORING_OP_WRITE;
+    if (file->fixed_fd) {
+        sqe->flags = (uint8_t)IOSQE_FIXED_FILE;
+        sqe->fd    = 0;
+    } /* end if */
+    else
+        sqe->fd = file->fd;
+    sqe->off       = (uint64_t)req->addr;
+    sqe->addr      = (uint64_t)(uintptr_t)req->buf;
+    sqe->len       = (uint32_t)MIN(req->size, H5FD_IOURING_MAX_IO);
+    sqe->user_data = (uint64_t)idx;
+
+    /* Put the entry on the submission ring */
+    tail                                 = *file->sq_tail;
+    file->sq_array[tail & *file->sq_mask] = idx;
+    H5FD_IOURING_STORE(file->sq_tail, tail + 1);
+    file->nunsent++;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__iouring_prep() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_reap
+ *
+ * Purpose:     Handles the completions posted on the completion ring of
+ *              FILE.  A request that moved fewer bytes than asked for is
+ *              put back on the submission ring for the rest, except for a
+ *              read at the end of the file, whose rest is zero-filled.
+ *              Finished requests give their slots back.
+ *
+ *              A failed request is counted in FILE, to be reported by the
+ *              next H5FD__iouring_wait(), since nobody may be waiting for
+ *              a queued write when it fails.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_reap(H5FD_iouring_t *file)
+{
+    unsigned head;                /* Completion ring head */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    head = *file->cq_head;
+    while (head != H5FD_IOURING_LOAD(file->cq_tail)) {
+        struct io_uring_cqe *cqe = &file->cqes[head & *file->cq_mask]; /* The completion */
+        unsigned             idx = (unsigned)cqe->user_data;            /* Slot of its request */
+        H5FD_iouring_req_t * req = &file->reqs[idx];                    /* Its request */
+        int                  res = cqe->res;                            /* Its result */
+
+        head++;
+        HDassert(idx < file->nreqs);
+
+        if (-EINTR == res || -EAGAIN == res) {
+            /* Try again */
+            H5FD__iouring_prep(file, idx);
+            continue;
+        } /* end if */
+
+        if (res < 0 || (0 == res && req->write)) {
+            int myerrno = res < 0 ? -res : ENOSPC;
+
+            file->nfailed++;
+            HDONE_ERROR(H5E_IO, req->write ? H5E_WRITEERROR : H5E_READERROR, FAIL,
+                        "file %s failed: filename = '%s', errno = %d, error message = '%s', size = %llu, "
+                        "offset = %llu",
+                        req->write ? "write" : "read", file->filename, myerrno, HDstrerror(myerrno),
+                        (unsigned long long)req->size, (unsigned long long)req->addr);
+        } /* end if */
+        else if (0 == res)
+            /* end of file but not end of format address space */
+            HDmemset(req->buf, 0, req->size);
+        else {
+            req->addr += (haddr_t)res;
+            req->buf += res;
+            req->size -= (size_t)res;
+
+            if (req->size > 0) {
+                /* Move the rest */
+                H5FD__iouring_prep(file, idx);
+                continue;
+            } /* end if */
+        }     /* end else */
+
+        /* Give the slot back */
+        if (req->waited)
+            file->nwaited--;
+        req->size                      = 0;
+        file->free_reqs[file->nfree++] = idx;
+    } /* end while */
+    H5FD_IOURING_STORE(file->cq_head, head);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_reap() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_enter
+ *
+ * Purpose:     Submits the entries on the submission ring of FILE and
+ *              waits for at least MIN_COMPLETE completions to be posted.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_enter(H5FD_iouring_t *file, unsigned min_complete)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    do {
+        long ret; /* Number of entries submitted */
+
+        ret = syscall(__NR_io_uring_enter, file->ring_fd, file->nunsent, min_complete,
+                      min_complete ? IORING_ENTER_GETEVENTS : 0U, NULL, 0);
+        if (ret < 0) {
+            if (EINTR == errno)
+                continue;
+
+            /* The kernel is short of room for completions; handle the ones
+             * it has posted and try again
+             */
+            if (EAGAIN == errno || EBUSY == errno) {
+                H5FD__iouring_reap(file);
+                continue;
+            } /* end if */
+
+            HSYS_GOTO_ERROR(H5E_IO, H5E_CANTINIT, FAIL, "unable to submit io_uring requests")
+        } /* end if */
+
+        HDassert((unsigned)ret <= file->nunsent);
+        file->nunsent -= (unsigned)ret;
+        min_complete = 0;
+    } while (file->nunsent > 0);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_enter() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_wait
+ *
+ * Purpose:     Submits the queued requests of FILE and waits until the
+ *              ones a caller is waiting for are finished, or until all of
+ *              them are finished when ALL is set.  Requests that failed
+ *              since the last call are reported here.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_wait(H5FD_iouring_t *file, hbool_t all)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    while (file->nwaited > 0 || (all && file->nfree < file->nreqs)) {
+        if (H5FD__iouring_enter(file, 1) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "unable to complete requests")
+        H5FD__iouring_reap(file);
+    } /* end while */
+
+    if (file->nfailed > 0) {
+        file->nfailed = 0;
+        HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "queued file I/O failed")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_wait() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_queue
+ *
+ * Purpose:     Queues a read of SIZE bytes at address ADDR of FILE into
+ *              RBUF, or a write of SIZE bytes from WBUF to address ADDR.
+ *
+ *              A write that fits in a staging buffer is copied there and
+ *              nobody waits for it.  Otherwise the caller must wait for
+ *              the request with H5FD__iouring_wait() before touching the
+ *              buffer.
+ *
+ *              The kernel doesn't keep requests in order, so anything that
+ *              overlaps a queued write waits for all the queued requests
+ *              first.  Requests that haven't been submitted yet go in one
+ *              system call with this one.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_queue(H5FD_iouring_t *file, haddr_t addr, size_t size, void *rbuf, const void *wbuf)
+{
+    H5FD_iouring_req_t *req;                 /* The new request */
+    unsigned            idx;                 /* Slot of the new request */
+    unsigned            u;                   /* Local index variable */
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(rbuf || wbuf);
+
+    /* Check for overflow conditions */
+    if (!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if (REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu",
+                    (unsigned long long)addr, (unsigned long long)size)
+    if (0 == size)
+        HGOTO_DONE(SUCCEED)
+
+    /* Wait for everything when this overlaps a queued write */
+    if (file->nfree < file->nreqs) {
+        hbool_t overlap = FALSE; /* Whether a queued write overlaps */
+
+        for (u = 0; u < file->nreqs && !overlap; u++) {
+            const H5FD_iouring_req_t *q = &file->reqs[u];
+
+            if (q->write && q->size > 0 && addr < q->addr + q->size && q->addr < addr + size)
+                overlap = TRUE;
+        } /* end for */
+        if (overlap && H5FD__iouring_wait(file, TRUE) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "unable to complete queued requests")
+    } /* end if */
+
+    /* Make room for the request */
+    while (0 == file->nfree) {
+        if (H5FD__iouring_enter(file, 1) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "unable to complete queued requests")
+        H5FD__iouring_reap(file);
+    } /* end while */
+
+    /* Fill in the request */
+    idx        = file->free_reqs[--file->nfree];
+    req        = &file->reqs[idx];
+    req->addr  = addr;
+    req->size  = size;
+    req->write = (NULL != wbuf);
+    if (wbuf && size <= file->fa.buf_size) {
+        req->buf    = file->stage + (size_t)idx * file->fa.buf_size;
+        req->staged = TRUE;
+        req->waited = FALSE;
+        H5MM_memcpy(req->buf, wbuf, size);
+    } /* end if */
+    else {
+        H5_GCC_DIAG_OFF("cast-qual")
+        req->buf = (unsigned char *)(wbuf ? (void *)wbuf : rbuf);
+        H5_GCC_DIAG_ON("cast-qual")
+        req->staged = FALSE;
+        req->waited = TRUE;
+        file->nwaited++;
+    } /* end else */
+    H5FD__iouring_prep(file, idx);
+
+    /* Update the end of file */
+    if (wbuf && addr + size > file->eof)
+        file->eof = addr + size;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_queue() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_open
+ *
+ * Purpose:     Create and/or opens a file as an HDF5 file.
+ *
+ * Return:      Success:    A pointer to a new file data structure. The
+ *                          public fields will be initialized by the
+ *                          caller, which is always H5FD_open().
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD__iouring_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
+{
+    H5FD_iouring_t *           file = NULL; /* io_uring VFD info        */
+    int                        fd   = -1;   /* File descriptor          */
+    int                        o_flags;     /* Flags for open() call    */
+    h5_stat_t                  sb;
+    H5P_genplist_t *           plist;            /* Property list pointer */
+    const H5FD_iouring_fapl_t *fa;               /* io_uring properties */
+    H5FD_iouring_fapl_t        default_fa;       /* Default properties */
+    H5FD_t *                   ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check on file offsets */
+    HDcompile_assert(sizeof(HDoff_t) >= sizeof(size_t));
+
+    /* Check arguments */
+    if (!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name")
+    if (0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr")
+    if (ADDR_OVERFLOW(maxaddr))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, NULL, "bogus maxaddr")
+
+    /* Get the driver specific information */
+    if (NULL == (plist = (H5P_genplist_t *)H5I_object(fapl_id)))
+        HGOTO_ERROR(H5E_VFL, H5E_BADTYPE, NULL, "not a file access property list")
+    if (NULL == (fa = (const H5FD_iouring_fapl_t *)H5P_peek_driver_info(plist))) {
+        default_fa.queue_depth = H5FD_IOURING_QUEUE_DEPTH_DEF;
+        default_fa.buf_size    = H5FD_IOURING_BUF_SIZE_DEF;
+        fa                     = &default_fa;
+    } /* end if */
+
+    /* Build the open flags */
+    o_flags = (H5F_ACC_RDWR & flags) ? O_RDWR : O_RDONLY;
+    if (H5F_ACC_TRUNC & flags)
+        o_flags |= O_TRUNC;
+    if (H5F_ACC_CREAT & flags)
+        o_flags |= O_CREAT;
+    if (H5F_ACC_EXCL & flags)
+        o_flags |= O_EXCL;
+
+    /* Open the file */
+    if ((fd = HDopen(name, o_flags, H5_POSIX_CREATE_MODE_RW)) < 0) {
+        int myerrno = errno;
+        HGOTO_ERROR(
+            H5E_FILE, H5E_CANTOPENFILE, NULL,
+            "unable to open file: name = '%s', errno = %d, error message = '%s', flags = %x, o_flags = %x",
+            name, myerrno, HDstrerror(myerrno), flags, (unsigned)o_flags);
+    } /* end if */
+
+    if (HDfstat(fd, &sb) < 0)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, NULL, "unable to fstat file")
+
+    /* Create the new file struct */
+    if (NULL == (file = H5FL_CALLOC(H5FD_iouring_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct")
+
+    file->fd      = fd;
+    file->ring_fd = -1;
+    H5_CHECKED_ASSIGN(file->eof, haddr_t, sb.st_size, h5_stat_size_t);
+    file->device = sb.st_dev;
+    file->inode  = sb.st_ino;
+    H5MM_memcpy(&file->fa, fa, sizeof(H5FD_iouring_fapl_t));
+
+    /* Set up the ring */
+    if (H5FD__iouring_ring_init(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, NULL, "unable to set up io_uring")
+
+    /* Check the file locking flags in the fapl */
+    if (ignore_disabled_file_locks_s != FAIL)
+        /* The environment variable was set, so use that preferentially */
+        file->ignore_disabled_file_locks = ignore_disabled_file_locks_s;
+    else {
+        /* Use the value in the property list */
+        if (H5P_get(plist, H5F_ACS_IGNORE_DISABLED_FILE_LOCKS_NAME, &file->ignore_disabled_file_locks) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get ignore disabled file locks property")
+    }
+
+    /* Retain a copy of the name used to open the file, for possible error reporting */
+    HDstrncpy(file->filename, name, sizeof(file->filename));
+    file->filename[sizeof(file->filename) - 1] = '\0';
+
+    /* Check for non-default FAPL */
+    if (H5P_FILE_ACCESS_DEFAULT != fapl_id) {
+
+        /* This step is for h5repart tool only. If user wants to change file driver from
+         * family to one that uses single files (sec2, etc.) while using h5repart, this
+         * private property should be set so that in the later step, the library can ignore
+         * the family driver information saved in the superblock.
+         */
+        if (H5P_exist_plist(plist, H5F_ACS_FAMILY_TO_SINGLE_NAME) > 0)
+            if (H5P_get(plist, H5F_ACS_FAMILY_TO_SINGLE_NAME, &file->fam_to_single) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get property of changing family to single")
+    } /* end if */
+
+    /* Set return value */
+    ret_value = (H5FD_t *)file;
+
+done:
+    if (NULL == ret_value) {
+        if (file) {
+            H5FD__iouring_ring_term(file);
+            file = H5FL_FREE(H5FD_iouring_t, file);
+        } /* end if */
+        if (fd >= 0)
+            HDclose(fd);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_open() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_close
+ *
+ * Purpose:     Closes an HDF5 file, after finishing the queued writes.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL, file not closed.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_close(H5FD_t *_file)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(file);
+
+    /* Finish the queued writes, then tear everything down regardless */
+    if (H5FD__iouring_wait(file, TRUE) < 0)
+        HDONE_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to finish queued writes")
+    if (H5FD__iouring_ring_term(file) < 0)
+        HDONE_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "unable to tear down io_uring")
+
+    /* Close the underlying file */
+    if (HDclose(file->fd) < 0)
+        HSYS_DONE_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
+
+    /* Release the file info */
+    file = H5FL_FREE(H5FD_iouring_t, file);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_cmp
+ *
+ * Purpose:     Compares two files belonging to this driver using an
+ *              arbitrary (but consistent) ordering.
+ *
+ * Return:      Success:    A value like strcmp()
+ *              Failure:    never fails (arguments were checked by the
+ *                          caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__iouring_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_iouring_t *f1        = (const H5FD_iouring_t *)_f1;
+    const H5FD_iouring_t *f2        = (const H5FD_iouring_t *)_f2;
+    int                   ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+#ifdef H5_DEV_T_IS_SCALAR
+    if (f1->device < f2->device)
+        HGOTO_DONE(-1)
+    if (f1->device > f2->device)
+        HGOTO_DONE(1)
+#else  /* H5_DEV_T_IS_SCALAR */
+    /* If dev_t isn't a scalar value on this system, just use memcmp to
+     * determine if the values are the same or not.  The actual return value
+     * shouldn't really matter...
+     */
+    if (HDmemcmp(&(f1->device), &(f2->device), sizeof(dev_t)) < 0)
+        HGOTO_DONE(-1)
+    if (HDmemcmp(&(f1->device), &(f2->device), sizeof(dev_t)) > 0)
+        HGOTO_DONE(1)
+#endif /* H5_DEV_T_IS_SCALAR */
+    if (f1->inode < f2->inode)
+        HGOTO_DONE(-1)
+    if (f1->inode > f2->inode)
+        HGOTO_DONE(1)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_query
+ *
+ * Purpose:     Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ *              Writes can still be queued when a call returns, so the file
+ *              descriptor isn't offered as a POSIX-compatible handle and
+ *              the driver doesn't take part in SWMR.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_query(const H5FD_t *_file, unsigned long *flags /* out */)
+{
+    const H5FD_iouring_t *file = (const H5FD_iouring_t *)_file; /* io_uring VFD info */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Set the VFL feature flags that this driver supports */
+    if (flags) {
+        *flags = 0;
+        *flags |= H5FD_FEAT_AGGREGATE_METADATA;  /* OK to aggregate metadata allocations  */
+        *flags |= H5FD_FEAT_ACCUMULATE_METADATA; /* OK to accumulate metadata for faster writes */
+        *flags |= H5FD_FEAT_DATA_SIEVE; /* OK to perform data sieving for faster raw data reads & writes    */
+        *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA;    /* OK to aggregate "small" raw data allocations */
+        *flags |= H5FD_FEAT_DEFAULT_VFD_COMPATIBLE; /* VFD creates a file which can be opened with the default
+                                                       VFD      */
+
+        /* Check for flags that are set by h5repart */
+        if (file && file->fam_to_single)
+            *flags |= H5FD_FEAT_IGNORE_DRVRINFO; /* Ignore the driver info when file is opened (which
+                                                    eliminates it) */
+    }                                            /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__iouring_query() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_get_eoa
+ *
+ * Purpose:     Gets the end-of-address marker for the file. The EOA marker
+ *              is the first address past the last byte allocated in the
+ *              format address space.
+ *
+ * Return:      The end-of-address marker.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__iouring_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_iouring_t *file = (const H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eoa)
+} /* end H5FD__iouring_get_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_set_eoa
+ *
+ * Purpose:     Set the end-of-address marker for the file. This function is
+ *              called shortly after an existing HDF5 file is opened in order
+ *              to tell the driver where the end of the HDF5 data is located.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_set_eoa(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr)
+{
+    H5FD_iouring_t *file = (H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    file->eoa = addr;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__iouring_set_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_get_eof
+ *
+ * Purpose:     Returns the end-of-file marker, which counts the writes that
+ *              are still queued.
+ *
+ * Return:      End of file address, the first address past the end of the
+ *              "file", either the filesystem file or the HDF5 file.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__iouring_get_eof(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_iouring_t *file = (const H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eof)
+} /* end H5FD__iouring_get_eof() */
+
+/*-------------------------------------------------------------------------
+ * Function:       H5FD__iouring_get_handle
+ *
+ * Purpose:        Returns the file handle of io_uring file driver.
+ *
+ * Returns:        SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_get_handle(H5FD_t *_file, hid_t H5_ATTR_UNUSED fapl, void **file_handle)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    if (!file_handle)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file handle not valid")
+
+    *file_handle = &(file->fd);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_get_handle() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_read
+ *
+ * Purpose:     Reads SIZE bytes of data from FILE beginning at address ADDR
+ *              into buffer BUF according to data transfer properties in
+ *              DXPL_ID.  Writes queued before the read are submitted with
+ *              it.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffer BUF.
+ *              Failure:    FAIL, Contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+                   haddr_t addr, size_t size, void *buf /*out*/)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    if (H5FD__iouring_queue(file, addr, size, buf, NULL) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to queue read")
+    if (H5FD__iouring_wait(file, FALSE) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_write
+ *
+ * Purpose:     Writes SIZE bytes of data to FILE beginning at address ADDR
+ *              from buffer BUF according to data transfer properties in
+ *              DXPL_ID.  A write that fits in a staging buffer is left
+ *              queued, to go to the kernel with the requests after it.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+                    haddr_t addr, size_t size, const void *buf)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    if (H5FD__iouring_queue(file, addr, size, NULL, buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to queue write")
+    if (H5FD__iouring_wait(file, FALSE) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_read_vector
+ *
+ * Purpose:     Reads COUNT pieces of data from FILE, where piece I is
+ *              SIZES[I] bytes at address ADDRS[I], into the buffers BUFS.
+ *              All the pieces are queued before waiting, so they go to the
+ *              kernel in as few system calls as the ring allows.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_read_vector(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, uint32_t count,
+                          H5FD_mem_t H5_ATTR_UNUSED types[], haddr_t addrs[], size_t sizes[],
+                          void *bufs[] /*out*/)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    uint32_t        u;                   /* Local index variable */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+
+    for (u = 0; u < count; u++)
+        if (H5FD__iouring_queue(file, addrs[u], sizes[u], bufs[u], NULL) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to queue read")
+
+done:
+    /* Don't leave requests into the caller's buffers behind, even on failure */
+    if (H5FD__iouring_wait(file, FALSE) < 0)
+        HDONE_ERROR(H5E_IO, H5E_READERROR, FAIL, "file vector read failed")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_read_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_write_vector
+ *
+ * Purpose:     Writes COUNT pieces of data from the buffers BUFS to FILE,
+ *              where piece I is SIZES[I] bytes at address ADDRS[I].  All
+ *              the pieces are queued before waiting, so they go to the
+ *              kernel in as few system calls as the ring allows.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_write_vector(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, uint32_t count,
+                           H5FD_mem_t H5_ATTR_UNUSED types[], haddr_t addrs[], size_t sizes[],
+                           const void *bufs[])
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    uint32_t        u;                   /* Local index variable */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+
+    for (u = 0; u < count; u++)
+        if (H5FD__iouring_queue(file, addrs[u], sizes[u], NULL, bufs[u]) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to queue write")
+
+done:
+    /* Don't leave requests from the caller's buffers behind, even on failure */
+    if (H5FD__iouring_wait(file, FALSE) < 0)
+        HDONE_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file vector write failed")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_write_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_flush
+ *
+ * Purpose:     Finishes the writes that are still queued.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_flush(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UNUSED closing)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    if (H5FD__iouring_wait(file, TRUE) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to finish queued writes")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_flush() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_truncate
+ *
+ * Purpose:     Makes sure that the true file size is the same as the end
+ *              of the allocated region, after finishing the queued writes.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UNUSED closing)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    if (H5FD__iouring_wait(file, TRUE) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to finish queued writes")
+
+    /* Extend the file to make sure it's large enough */
+    if (!H5F_addr_eq(file->eoa, file->eof)) {
+        if (-1 == HDftruncate(file->fd, (HDoff_t)file->eoa))
+            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to extend file properly")
+
+        /* Update the eof value */
+        file->eof = file->eoa;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_truncate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_lock
+ *
+ * Purpose:     To place an advisory lock on a file.
+ *		The lock type to apply depends on the parameter "rw":
+ *			TRUE--opens for write: an exclusive lock
+ *			FALSE--opens for read: a shared lock
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_lock(H5FD_t *_file, hbool_t rw)
+{
+    H5FD_iouring_t *file = (H5FD_iouring_t *)_file; /* VFD file struct          */
+    int             lock_flags;                     /* file locking flags       */
+    herr_t          ret_value = SUCCEED;            /* Return value             */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    /* Set exclusive or shared lock based on rw status */
+    lock_flags = rw ? LOCK_EX : LOCK_SH;
+
+    /* Place a non-blocking lock on the file */
+    if (HDflock(file->fd, lock_flags | LOCK_NB) < 0) {
+        if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+            /* When errno is set to ENOSYS, the file system does not support
+             * locking, so ignore it.
+             */
+            errno = 0;
+        }
+        else
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTLOCKFILE, FAIL, "unable to lock file")
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_lock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_unlock
+ *
+ * Purpose:     To remove the existing lock on the file
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_unlock(H5FD_t *_file)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file; /* VFD file struct          */
+    herr_t          ret_value = SUCCEED;                 /* Return value             */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    if (HDflock(file->fd, LOCK_UN) < 0) {
+        if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+            /* When errno is set to ENOSYS, the file system does not support
+             * locking, so ignore it.
+             */
+            errno = 0;
+        }
+        else
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTUNLOCKFILE, FAIL, "unable to unlock file")
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_unlock() */
+
+#endif /* H5_HAVE_IOURING */
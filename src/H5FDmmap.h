@@ -0,0 +1,49 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	The public header file for the read-only memory-mapped driver.
+ */
+#ifndef H5FDmmap_H
+#define H5FDmmap_H
+
+#ifdef H5_HAVE_MMAP_VFD
+#define H5FD_MMAP (H5FD_mmap_init())
+#else
+#define H5FD_MMAP (H5I_INVALID_HID)
+#endif /* H5_HAVE_MMAP_VFD */
+
+#ifdef H5_HAVE_MMAP_VFD
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Hints about how the file will be read, passed to madvise() for the whole
+ * mapping.  H5FD_MMAP_ADVISE_RANDOM and H5FD_MMAP_ADVISE_SEQUENTIAL can't
+ * be combined.
+ */
+#define H5FD_MMAP_ADVISE_NORMAL     0x0000 /* No hint                                  */
+#define H5FD_MMAP_ADVISE_RANDOM     0x0001 /* Don't read ahead                         */
+#define H5FD_MMAP_ADVISE_SEQUENTIAL 0x0002 /* Read ahead aggressively                  */
+#define H5FD_MMAP_ADVISE_WILLNEED   0x0004 /* Start reading the whole file in at open  */
+
+H5_DLL hid_t  H5FD_mmap_init(void);
+H5_DLL herr_t H5Pset_fapl_mmap(hid_t fapl_id, unsigned advice);
+H5_DLL herr_t H5Pget_fapl_mmap(hid_t fapl_id, unsigned *advice /*out*/);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H5_HAVE_MMAP_VFD */
+
+#endif
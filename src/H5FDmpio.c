@@ -31,6 +31,7 @@
 #include "H5Iprivate.h"  /* IDs                                  */
 #include "H5MMprivate.h" /* Memory management                    */
 #include "H5Pprivate.h"  /* Property lists                       */
+#include "H5Sprivate.h"  /* Dataspaces                           */
 
 #ifdef H5_HAVE_PARALLEL
 
@@ -84,6 +85,12 @@ static herr_t   H5FD__mpio_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, h
                                 void *buf);
 static herr_t   H5FD__mpio_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size,
                                  const void *buf);
+static herr_t   H5FD__mpio_read_selection(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, uint32_t count,
+                                          hid_t mem_space_ids[], hid_t file_space_ids[], haddr_t offsets[],
+                                          size_t element_sizes[], void *bufs[]);
+static herr_t   H5FD__mpio_write_selection(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, uint32_t count,
+                                           hid_t mem_space_ids[], hid_t file_space_ids[], haddr_t offsets[],
+                                           size_t element_sizes[], const void *bufs[]);
 static herr_t   H5FD__mpio_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t   H5FD__mpio_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static int      H5FD__mpio_mpi_rank(const H5FD_t *_file);
@@ -94,42 +101,47 @@ static MPI_Comm H5FD__mpio_communicator(const H5FD_t *_file);
 static const H5FD_class_mpi_t H5FD_mpio_g = {
     {
         /* Start of superclass information */
-        "mpio",                /*name			*/
-        HADDR_MAX,             /*maxaddr		*/
-        H5F_CLOSE_SEMI,        /*fc_degree		*/
-        H5FD__mpio_term,       /*terminate             */
-        NULL,                  /*sb_size		*/
-        NULL,                  /*sb_encode		*/
-        NULL,                  /*sb_decode		*/
-        0,                     /*fapl_size		*/
-        NULL,                  /*fapl_get		*/
-        NULL,                  /*fapl_copy		*/
-        NULL,                  /*fapl_free		*/
-        0,                     /*dxpl_size		*/
-        NULL,                  /*dxpl_copy		*/
-        NULL,                  /*dxpl_free		*/
-        H5FD__mpio_open,       /*open			*/
-        H5FD__mpio_close,      /*close			*/
-        NULL,                  /*cmp			*/
-        H5FD__mpio_query,      /*query			*/
-        NULL,                  /*get_type_map		*/
-        NULL,                  /*alloc			*/
-        NULL,                  /*free			*/
-        H5FD__mpio_get_eoa,    /*get_eoa		*/
-        H5FD__mpio_set_eoa,    /*set_eoa		*/
-        H5FD__mpio_get_eof,    /*get_eof		*/
-        H5FD__mpio_get_handle, /*get_handle            */
-        H5FD__mpio_read,       /*read			*/
-        H5FD__mpio_write,      /*write			*/
-        H5FD__mpio_flush,      /*flush			*/
-        H5FD__mpio_truncate,   /*truncate		*/
-        NULL,                  /*lock                  */
-        NULL,                  /*unlock                */
-        H5FD_FLMAP_DICHOTOMY   /*fl_map                */
-    },                         /* End of superclass information */
-    H5FD__mpio_mpi_rank,       /*get_rank              */
-    H5FD__mpio_mpi_size,       /*get_size              */
-    H5FD__mpio_communicator    /*get_comm              */
+        "mpio",                     /*name			*/
+        HADDR_MAX,                  /*maxaddr		*/
+        H5F_CLOSE_SEMI,             /*fc_degree		*/
+        H5FD__mpio_term,            /*terminate             */
+        NULL,                       /*sb_size		*/
+        NULL,                       /*sb_encode		*/
+        NULL,                       /*sb_decode		*/
+        0,                          /*fapl_size		*/
+        NULL,                       /*fapl_get		*/
+        NULL,                       /*fapl_copy		*/
+        NULL,                       /*fapl_free		*/
+        0,                          /*dxpl_size		*/
+        NULL,                       /*dxpl_copy		*/
+        NULL,                       /*dxpl_free		*/
+        H5FD__mpio_open,            /*open			*/
+        H5FD__mpio_close,           /*close			*/
+        NULL,                       /*cmp			*/
+        H5FD__mpio_query,           /*query			*/
+        NULL,                       /*get_type_map		*/
+        NULL,                       /*alloc			*/
+        NULL,                       /*free			*/
+        H5FD__mpio_get_eoa,         /*get_eoa		*/
+        H5FD__mpio_set_eoa,         /*set_eoa		*/
+        H5FD__mpio_get_eof,         /*get_eof		*/
+        H5FD__mpio_get_handle,      /*get_handle            */
+        H5FD__mpio_read,            /*read			*/
+        H5FD__mpio_write,           /*write			*/
+        NULL,                       /*read_vector	*/
+        NULL,                       /*write_vector	*/
+        H5FD__mpio_read_selection,  /*read_selection */
+        H5FD__mpio_write_selection, /*write_selection */
+        NULL,                       /*get_mapping     */
+        H5FD__mpio_flush,           /*flush			*/
+        H5FD__mpio_truncate,        /*truncate		*/
+        NULL,                       /*lock                  */
+        NULL,                       /*unlock                */
+        H5FD_FLMAP_DICHOTOMY        /*fl_map                */
+    },                              /* End of superclass information */
+    H5FD__mpio_mpi_rank,            /*get_rank              */
+    H5FD__mpio_mpi_size,            /*get_size              */
+    H5FD__mpio_communicator         /*get_comm              */
 };
 
 #ifdef H5FDmpio_DEBUG
@@ -1518,6 +1530,271 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__mpio_write() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_select_io
+ *
+ * Purpose:     Reads the elements of ELMT_SIZE bytes selected in the
+ *              dataspace FILE_SPACE_ID, whose extent is laid out in FILE
+ *              from address ADDR, into the elements selected in
+ *              MEM_SPACE_ID of RBUF, or writes them from WBUF.  Both
+ *              selections are turned into MPI derived datatypes, so the
+ *              whole selection is moved by a single MPI-I/O call through
+ *              a file view, rather than a call for each contiguous piece.
+ *
+ *              The transfer is collective when the transfer properties
+ *              ask for collective I/O, otherwise it's independent.
+ *              Reading past the end of the MPI file returns zeros.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mpio_select_io(H5FD_mpio_t *file, hid_t mem_space_id, hid_t file_space_id, haddr_t addr,
+                     size_t elmt_size, void *rbuf, const void *wbuf)
+{
+    const H5S_t *mem_space;                       /* Memory dataspace */
+    const H5S_t *file_space;                      /* File dataspace */
+    MPI_Datatype file_type    = MPI_DATATYPE_NULL; /* MPI description of the selection in the file */
+    MPI_Datatype buf_type     = MPI_DATATYPE_NULL; /* MPI description of the selection in memory */
+    int          file_count;                      /* Number of file types in the selection */
+    int          buf_count;                       /* Number of buffer types in the selection */
+    hbool_t      file_derived = FALSE;            /* Whether the file type was derived */
+    hbool_t      buf_derived  = FALSE;            /* Whether the buffer type was derived */
+    hsize_t *    permute_map  = NULL;             /* Map of out-of-order points in the file selection */
+    hbool_t      is_permuted  = FALSE;            /* Whether the file selection's points were reordered */
+    hbool_t      view_set     = FALSE;            /* Whether the file view was changed */
+    hbool_t      collective;                      /* Whether to perform collective I/O */
+    MPI_Offset   mpi_off;
+    MPI_Status   mpi_stat; /* Status from I/O operation */
+    int          mpi_code; /* MPI return code */
+#if MPI_VERSION >= 3
+    MPI_Count bytes_io = 0; /* Number of bytes read or written */
+    MPI_Count type_size;    /* MPI datatype used for I/O's size */
+    MPI_Count io_size;      /* Actual number of bytes requested */
+#else
+    int bytes_io = 0; /* Number of bytes read or written */
+    int type_size;    /* MPI datatype used for I/O's size */
+    int io_size;      /* Actual number of bytes requested */
+#endif
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(rbuf || wbuf);
+
+    /* Get the dataspaces */
+    if (NULL == (mem_space = (const H5S_t *)H5I_object_verify(mem_space_id, H5I_DATASPACE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "memory dataspace is not a dataspace")
+    if (NULL == (file_space = (const H5S_t *)H5I_object_verify(file_space_id, H5I_DATASPACE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "file dataspace is not a dataspace")
+
+    /* Portably initialize MPI status variable */
+    HDmemset(&mpi_stat, 0, sizeof(MPI_Status));
+
+    if (H5FD_mpi_haddr_to_MPIOff(addr, &mpi_off) < 0)
+        HGOTO_ERROR(H5E_INTERNAL, H5E_BADRANGE, FAIL, "can't convert from haddr to MPI off")
+
+    /* Describe the selections with MPI datatypes, permuting the memory type
+     * to match the file type if the file selection's points are out of order
+     * (see H5D__inter_collective_io())
+     */
+    if (H5S_mpio_space_type(file_space, elmt_size, &file_type, &file_count, &file_derived, TRUE,
+                            &permute_map, &is_permuted) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_BADTYPE, FAIL, "couldn't create MPI file type")
+    if (H5S_mpio_space_type(mem_space, elmt_size, &buf_type, &buf_count, &buf_derived, FALSE, &permute_map,
+                            &is_permuted) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_BADTYPE, FAIL, "couldn't create MPI buffer type")
+
+    /* Check whether the application asked for collective I/O */
+    {
+        H5FD_mpio_xfer_t           xfer_mode;     /* I/O transfer mode */
+        H5FD_mpio_collective_opt_t coll_opt_mode; /* Collective or independent I/O at the MPI level */
+
+        if (H5CX_get_io_xfer_mode(&xfer_mode) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't get MPI-I/O transfer mode")
+        if (H5CX_get_mpio_coll_opt(&coll_opt_mode) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't get MPI-I/O collective_op property")
+        collective = (xfer_mode == H5FD_MPIO_COLLECTIVE && coll_opt_mode == H5FD_MPIO_COLLECTIVE_IO);
+    }
+
+    /* Set the file view to the file selection, starting at the address */
+    if (MPI_SUCCESS !=
+        (mpi_code = MPI_File_set_view(file->f, mpi_off, MPI_BYTE, file_type, H5FD_mpi_native_g, file->info)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_File_set_view failed", mpi_code)
+    view_set = TRUE;
+
+    /* Transfer the data */
+    if (rbuf) {
+        if (collective) {
+            if (MPI_SUCCESS != (mpi_code = MPI_File_read_at_all(file->f, (MPI_Offset)0, rbuf, buf_count,
+                                                                buf_type, &mpi_stat)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_File_read_at_all failed", mpi_code)
+        } /* end if */
+        else if (MPI_SUCCESS !=
+                 (mpi_code = MPI_File_read_at(file->f, (MPI_Offset)0, rbuf, buf_count, buf_type, &mpi_stat)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_File_read_at failed", mpi_code)
+    } /* end if */
+    else {
+        /* Verify that no data is written when between MPI_Barrier()s during file flush */
+        HDassert(!H5CX_get_mpi_file_flushing());
+
+        if (collective) {
+            if (MPI_SUCCESS != (mpi_code = MPI_File_write_at_all(file->f, (MPI_Offset)0, wbuf, buf_count,
+                                                                 buf_type, &mpi_stat)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_File_write_at_all failed", mpi_code)
+        } /* end if */
+        else if (MPI_SUCCESS !=
+                 (mpi_code = MPI_File_write_at(file->f, (MPI_Offset)0, wbuf, buf_count, buf_type, &mpi_stat)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_File_write_at failed", mpi_code)
+    } /* end else */
+
+    /* How many bytes were actually transferred? */
+#if MPI_VERSION >= 3
+    if (MPI_SUCCESS != (mpi_code = MPI_Get_elements_x(&mpi_stat, buf_type, &bytes_io)))
+#else
+    if (MPI_SUCCESS != (mpi_code = MPI_Get_elements(&mpi_stat, MPI_BYTE, &bytes_io)))
+#endif
+        HMPI_GOTO_ERROR(FAIL, "MPI_Get_elements failed", mpi_code)
+
+    /* Get the type's size */
+#if MPI_VERSION >= 3
+    if (MPI_SUCCESS != (mpi_code = MPI_Type_size_x(buf_type, &type_size)))
+#else
+    if (MPI_SUCCESS != (mpi_code = MPI_Type_size(buf_type, &type_size)))
+#endif
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_size failed", mpi_code)
+
+    /* Compute the actual number of bytes requested */
+    io_size = type_size * buf_count;
+
+    if (rbuf) {
+        /* Check for read failure */
+        if (bytes_io < 0 || bytes_io > io_size)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+
+        /* Part of the selection is past the end of the file.  The elements
+         * that weren't read are hard to pick out of the memory selection, so
+         * zero all of them and read the ones that exist again.  This only
+         * happens for data that was never written, so it's rare.
+         */
+        if (bytes_io < io_size) {
+            void *zero; /* Zeroed element */
+
+            if (NULL == (zero = H5MM_calloc(elmt_size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate zero element")
+            if (H5S_select_fill(zero, elmt_size, mem_space, rbuf) < 0) {
+                H5MM_xfree(zero);
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't zero past end of file")
+            } /* end if */
+            H5MM_xfree(zero);
+
+            /* Other processes may not be repeating the read, so it's independent */
+            if (MPI_SUCCESS !=
+                (mpi_code = MPI_File_read_at(file->f, (MPI_Offset)0, rbuf, buf_count, buf_type, &mpi_stat)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_File_read_at failed", mpi_code)
+        } /* end if */
+    }     /* end if */
+    else {
+        hsize_t span; /* Bytes from the address to the end of the last element */
+
+        /* Check for write failure */
+        if (bytes_io != io_size || bytes_io < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+
+        /* Keep track of the local EOF, as H5FD__mpio_write() does */
+        file->eof = HADDR_UNDEF;
+        if (H5FD_sel_span(file_space, elmt_size, &span) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get extent of file selection")
+        if (span > 0 && (addr + span) > file->local_eof)
+            file->local_eof = addr + span;
+    }     /* end else */
+
+done:
+    /* Reset the file view */
+    if (view_set && MPI_SUCCESS != (mpi_code = MPI_File_set_view(file->f, (MPI_Offset)0, MPI_BYTE, MPI_BYTE,
+                                                                   H5FD_mpi_native_g, file->info)))
+        HMPI_DONE_ERROR(FAIL, "MPI_File_set_view failed", mpi_code)
+
+    /* Free the MPI buffer and file types, if they were derived */
+    if (buf_derived && MPI_SUCCESS != (mpi_code = MPI_Type_free(&buf_type)))
+        HMPI_DONE_ERROR(FAIL, "MPI_Type_free failed", mpi_code)
+    if (file_derived && MPI_SUCCESS != (mpi_code = MPI_Type_free(&file_type)))
+        HMPI_DONE_ERROR(FAIL, "MPI_Type_free failed", mpi_code)
+    if (permute_map)
+        H5MM_xfree(permute_map);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mpio_select_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_read_selection
+ *
+ * Purpose:     Reads COUNT selections of data from FILE, each with a
+ *              single MPI-I/O call (see H5FD__mpio_select_io()).
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mpio_read_selection(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+                          uint32_t count, hid_t mem_space_ids[], hid_t file_space_ids[], haddr_t offsets[],
+                          size_t element_sizes[], void *bufs[] /*out*/)
+{
+    H5FD_mpio_t *file = (H5FD_mpio_t *)_file;
+    uint32_t     u;
+    herr_t       ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(H5FD_MPIO == file->pub.driver_id);
+
+    for (u = 0; u < count; u++)
+        if (H5FD__mpio_select_io(file, mem_space_ids[u], file_space_ids[u], offsets[u], element_sizes[u],
+                                 bufs[u], NULL) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "selection read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mpio_read_selection() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_write_selection
+ *
+ * Purpose:     Writes COUNT selections of data to FILE, each with a
+ *              single MPI-I/O call (see H5FD__mpio_select_io()).
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mpio_write_selection(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+                           uint32_t count, hid_t mem_space_ids[], hid_t file_space_ids[], haddr_t offsets[],
+                           size_t element_sizes[], const void *bufs[])
+{
+    H5FD_mpio_t *file = (H5FD_mpio_t *)_file;
+    uint32_t     u;
+    herr_t       ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(H5FD_MPIO == file->pub.driver_id);
+
+    for (u = 0; u < count; u++)
+        if (H5FD__mpio_select_io(file, mem_space_ids[u], file_space_ids[u], offsets[u], element_sizes[u],
+                                 NULL, bufs[u]) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "selection write failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mpio_write_selection() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__mpio_flush
  *
@@ -93,6 +93,11 @@ typedef struct {
     const void *driver_info; /* Driver info, for open callbacks */
 } H5FD_driver_prop_t;
 
+/* Callback for H5FD_sel_iterate(), receiving a piece of a selection that is
+ * contiguous in both the file and memory, as byte offsets
+ */
+typedef herr_t (*H5FD_sel_op_t)(hsize_t file_off, hsize_t mem_off, size_t len, void *op_data);
+
 /*****************************/
 /* Library Private Variables */
 /*****************************/
@@ -103,6 +108,7 @@ typedef struct {
 
 /* Forward declarations for prototype arguments */
 struct H5F_t;
+struct H5S_t;
 
 H5_DLL int    H5FD_term_interface(void);
 H5_DLL herr_t H5FD_locate_signature(H5FD_t *file, haddr_t *sig_addr);
@@ -131,6 +137,22 @@ H5_DLL herr_t  H5FD_set_feature_flags(H5FD_t *file, unsigned long feature_flags)
 H5_DLL herr_t  H5FD_get_fs_type_map(const H5FD_t *file, H5FD_mem_t *type_map);
 H5_DLL herr_t  H5FD_read(H5FD_t *file, H5FD_mem_t type, haddr_t addr, size_t size, void *buf /*out*/);
 H5_DLL herr_t  H5FD_write(H5FD_t *file, H5FD_mem_t type, haddr_t addr, size_t size, const void *buf);
+H5_DLL herr_t  H5FD_read_vector(H5FD_t *file, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                                size_t sizes[], void *bufs[] /*out*/);
+H5_DLL herr_t  H5FD_write_vector(H5FD_t *file, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                                 size_t sizes[], const void *bufs[]);
+H5_DLL herr_t  H5FD_read_selection(H5FD_t *file, H5FD_mem_t type, uint32_t count,
+                                   const struct H5S_t *mem_spaces[], const struct H5S_t *file_spaces[],
+                                   haddr_t offsets[], size_t element_sizes[], void *bufs[] /*out*/);
+H5_DLL herr_t  H5FD_write_selection(H5FD_t *file, H5FD_mem_t type, uint32_t count,
+                                    const struct H5S_t *mem_spaces[], const struct H5S_t *file_spaces[],
+                                    haddr_t offsets[], size_t element_sizes[], const void *bufs[]);
+H5_DLL hbool_t H5FD_has_selection_io(const H5FD_t *file);
+H5_DLL herr_t  H5FD_sel_iterate(const struct H5S_t *mem_space, const struct H5S_t *file_space,
+                                size_t elmt_size, H5FD_sel_op_t op, void *op_data);
+H5_DLL herr_t  H5FD_sel_span(const struct H5S_t *file_space, size_t elmt_size, hsize_t *span /*out*/);
+H5_DLL herr_t  H5FD_get_mapping(H5FD_t *file, H5FD_mem_t type, haddr_t addr, size_t size,
+                                const void **ptr /*out*/);
 H5_DLL herr_t  H5FD_flush(H5FD_t *file, hbool_t closing);
 H5_DLL herr_t  H5FD_truncate(H5FD_t *file, hbool_t closing);
 H5_DLL herr_t  H5FD_lock(H5FD_t *file, hbool_t rw);
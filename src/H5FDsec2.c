@@ -35,12 +35,45 @@
 #include "H5MMprivate.h" /* Memory management        */
 #include "H5Pprivate.h"  /* Property lists           */
 
+/* Adjacent pieces of a vector request are transferred with a single
+ * preadv()/pwritev() call when those are available
+ */
+#if defined(H5_HAVE_PREADWRITE) && defined(H5_HAVE_PREADV) && defined(H5_HAVE_PWRITEV)
+#define H5FD_SEC2_HAVE_PREADWRITEV
+#include <sys/uio.h>
+
+/* The most pieces passed to one preadv()/pwritev() call, well below
+ * IOV_MAX on all the systems that have those calls
+ */
+#define H5FD_SEC2_MAX_IOV 64
+#endif
+
+/* Large reads and writes are split into stripes transferred concurrently by
+ * worker threads when those are available
+ */
+#if defined(H5_HAVE_WORKER_THREADS) && defined(H5_HAVE_PREADWRITE)
+#define H5FD_SEC2_HAVE_STRIPES
+#endif
+
+/* The most threads that can transfer the stripes of one read or write */
+#define H5FD_SEC2_MAX_STRIPE_THREADS 256
+
 /* The driver identification number, initialized at runtime */
 static hid_t H5FD_SEC2_g = 0;
 
 /* Whether to ignore file locks when disabled (env var value) */
 static htri_t ignore_disabled_file_locks_s = FAIL;
 
+/* Driver-specific file access properties, which are only set through
+ * H5Pset_fapl_sec2_stripes().  An NTHREADS value of zero means the file
+ * access property list has no driver info.
+ */
+typedef struct H5FD_sec2_fapl_t {
+    unsigned nthreads;    /* # of threads transferring stripes, including the caller */
+    size_t   threshold;   /* Smallest read or write split into stripes               */
+    size_t   stripe_size; /* Size of the stripes, which are aligned on multiples of it */
+} H5FD_sec2_fapl_t;
+
 /* The description of a file belonging to this driver. The 'eoa' and 'eof'
  * determine the amount of hdf5 address space in use and the high-water mark
  * of the file (the current size of the underlying filesystem file). The
@@ -98,8 +131,26 @@ typedef struct H5FD_sec2_t {
      * a single file.
      */
     hbool_t fam_to_single;
+
+    H5FD_sec2_fapl_t fa; /* Striping properties */
+#ifdef H5FD_SEC2_HAVE_STRIPES
+    H5TS_pool_t *pool; /* Threads transferring stripes, created on first use */
+#endif                 /* H5FD_SEC2_HAVE_STRIPES */
 } H5FD_sec2_t;
 
+#ifdef H5FD_SEC2_HAVE_STRIPES
+/* Information for the tasks transferring the stripes of one read or write */
+typedef struct H5FD_sec2_stripes_t {
+    int                  fd;          /* File descriptor                        */
+    haddr_t              addr;        /* Address of the first byte transferred  */
+    size_t               size;        /* # of bytes transferred                 */
+    size_t               stripe_size; /* Size of the stripes                    */
+    size_t               first_size;  /* Size of the first stripe               */
+    unsigned char *      rbuf;        /* Buffer read into, for reads            */
+    const unsigned char *wbuf;        /* Buffer written from, for writes        */
+} H5FD_sec2_stripes_t;
+#endif /* H5FD_SEC2_HAVE_STRIPES */
+
 /*
  * These macros check for overflow of various quantities.  These macros
  * assume that HDoff_t is signed and haddr_t and size_t are unsigned.
@@ -123,6 +174,8 @@ typedef struct H5FD_sec2_t {
 
 /* Prototypes */
 static herr_t  H5FD__sec2_term(void);
+static void *  H5FD__sec2_fapl_get(H5FD_t *_file);
+static void *  H5FD__sec2_fapl_copy(const void *_old_fa);
 static H5FD_t *H5FD__sec2_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
 static herr_t  H5FD__sec2_close(H5FD_t *_file);
 static int     H5FD__sec2_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
@@ -135,43 +188,63 @@ static herr_t  H5FD__sec2_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, ha
                                void *buf);
 static herr_t  H5FD__sec2_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
                                 const void *buf);
+#ifdef H5FD_SEC2_HAVE_STRIPES
+static herr_t H5FD__sec2_stripe_task(size_t task_idx, void *_stripes);
+static herr_t H5FD__sec2_stripes(H5FD_sec2_t *file, haddr_t addr, size_t size, void *rbuf, const void *wbuf);
+#endif /* H5FD_SEC2_HAVE_STRIPES */
+static herr_t  H5FD__sec2_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                      haddr_t addrs[], size_t sizes[], void *bufs[] /*out*/);
+static herr_t  H5FD__sec2_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                       haddr_t addrs[], size_t sizes[], const void *bufs[]);
+#ifdef H5FD_SEC2_HAVE_PREADWRITEV
+static uint32_t H5FD__sec2_adjacent(uint32_t count, const haddr_t addrs[], const size_t sizes[]);
+static herr_t   H5FD__sec2_readv(H5FD_sec2_t *file, haddr_t addr, uint32_t count, const size_t sizes[],
+                                 void *bufs[] /*out*/);
+static herr_t   H5FD__sec2_writev(H5FD_sec2_t *file, haddr_t addr, uint32_t count, const size_t sizes[],
+                                  const void *bufs[]);
+#endif /* H5FD_SEC2_HAVE_PREADWRITEV */
 static herr_t  H5FD__sec2_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t  H5FD__sec2_lock(H5FD_t *_file, hbool_t rw);
 static herr_t  H5FD__sec2_unlock(H5FD_t *_file);
 
 static const H5FD_class_t H5FD_sec2_g = {
-    "sec2",                /* name                 */
-    MAXADDR,               /* maxaddr              */
-    H5F_CLOSE_WEAK,        /* fc_degree            */
-    H5FD__sec2_term,       /* terminate            */
-    NULL,                  /* sb_size              */
-    NULL,                  /* sb_encode            */
-    NULL,                  /* sb_decode            */
-    0,                     /* fapl_size            */
-    NULL,                  /* fapl_get             */
-    NULL,                  /* fapl_copy            */
-    NULL,                  /* fapl_free            */
-    0,                     /* dxpl_size            */
-    NULL,                  /* dxpl_copy            */
-    NULL,                  /* dxpl_free            */
-    H5FD__sec2_open,       /* open                 */
-    H5FD__sec2_close,      /* close                */
-    H5FD__sec2_cmp,        /* cmp                  */
-    H5FD__sec2_query,      /* query                */
-    NULL,                  /* get_type_map         */
-    NULL,                  /* alloc                */
-    NULL,                  /* free                 */
-    H5FD__sec2_get_eoa,    /* get_eoa              */
-    H5FD__sec2_set_eoa,    /* set_eoa              */
-    H5FD__sec2_get_eof,    /* get_eof              */
-    H5FD__sec2_get_handle, /* get_handle           */
-    H5FD__sec2_read,       /* read                 */
-    H5FD__sec2_write,      /* write                */
-    NULL,                  /* flush                */
-    H5FD__sec2_truncate,   /* truncate             */
-    H5FD__sec2_lock,       /* lock                 */
-    H5FD__sec2_unlock,     /* unlock               */
-    H5FD_FLMAP_DICHOTOMY   /* fl_map               */
+    "sec2",                   /* name                 */
+    MAXADDR,                  /* maxaddr              */
+    H5F_CLOSE_WEAK,           /* fc_degree            */
+    H5FD__sec2_term,          /* terminate            */
+    NULL,                     /* sb_size              */
+    NULL,                     /* sb_encode            */
+    NULL,                     /* sb_decode            */
+    sizeof(H5FD_sec2_fapl_t), /* fapl_size            */
+    H5FD__sec2_fapl_get,      /* fapl_get             */
+    H5FD__sec2_fapl_copy,     /* fapl_copy            */
+    NULL,                     /* fapl_free            */
+    0,                        /* dxpl_size            */
+    NULL,                     /* dxpl_copy            */
+    NULL,                     /* dxpl_free            */
+    H5FD__sec2_open,          /* open                 */
+    H5FD__sec2_close,         /* close                */
+    H5FD__sec2_cmp,           /* cmp                  */
+    H5FD__sec2_query,         /* query                */
+    NULL,                     /* get_type_map         */
+    NULL,                     /* alloc                */
+    NULL,                     /* free                 */
+    H5FD__sec2_get_eoa,       /* get_eoa              */
+    H5FD__sec2_set_eoa,       /* set_eoa              */
+    H5FD__sec2_get_eof,       /* get_eof              */
+    H5FD__sec2_get_handle,    /* get_handle           */
+    H5FD__sec2_read,          /* read                 */
+    H5FD__sec2_write,         /* write                */
+    H5FD__sec2_read_vector,   /* read_vector          */
+    H5FD__sec2_write_vector,  /* write_vector         */
+    NULL,                     /* read_selection       */
+    NULL,                     /* write_selection      */
+    NULL,                     /* get_mapping          */
+    NULL,                     /* flush                */
+    H5FD__sec2_truncate,      /* truncate             */
+    H5FD__sec2_lock,          /* lock                 */
+    H5FD__sec2_unlock,        /* unlock               */
+    H5FD_FLMAP_DICHOTOMY      /* fl_map               */
 };
 
 /* Declare a free list to manage the H5FD_sec2_t struct */
@@ -296,6 +369,163 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pset_fapl_sec2() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_sec2_stripes
+ *
+ * Purpose:     Modify the file access property list to use the H5FD_SEC2
+ *              driver, splitting each read or write of at least THRESHOLD
+ *              bytes into stripes of STRIPE_SIZE bytes, aligned on
+ *              multiples of STRIPE_SIZE in the file, which are transferred
+ *              concurrently by NTHREADS threads (including the calling
+ *              thread).  The transfer is complete when the read or write
+ *              returns.  Zero selects the default for THRESHOLD or
+ *              STRIPE_SIZE, and an NTHREADS of 0 (or 1) transfers
+ *              everything on the calling thread.
+ *
+ *              If the library was built without worker thread support or
+ *              the system has no pread()/pwrite(), the setting is ignored.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_sec2_stripes(hid_t fapl_id, unsigned nthreads, size_t threshold, size_t stripe_size)
+{
+    H5P_genplist_t * plist; /* Property list pointer */
+    H5FD_sec2_fapl_t fa;
+    herr_t           ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "iIuzz", fapl_id, nthreads, threshold, stripe_size);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+    if (nthreads > H5FD_SEC2_MAX_STRIPE_THREADS)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "too many threads")
+
+    HDmemset(&fa, 0, sizeof(H5FD_sec2_fapl_t));
+    fa.nthreads    = nthreads ? nthreads : 1;
+    fa.threshold   = threshold ? threshold : H5FD_SEC2_STRIPE_THRESHOLD_DEF;
+    fa.stripe_size = stripe_size ? stripe_size : H5FD_SEC2_STRIPE_SIZE_DEF;
+
+    ret_value = H5P_set_driver(plist, H5FD_SEC2, &fa);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_sec2_stripes() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_sec2_stripes
+ *
+ * Purpose:     Returns the striping properties of a file access property
+ *              list that uses the sec2 driver.  A property list set with
+ *              H5Pset_fapl_sec2() reports one thread and the default
+ *              threshold and stripe size.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_sec2_stripes(hid_t fapl_id, unsigned *nthreads /*out*/, size_t *threshold /*out*/,
+                         size_t *stripe_size /*out*/)
+{
+    H5P_genplist_t *        plist; /* Property list pointer */
+    const H5FD_sec2_fapl_t *fa;
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "ixxx", fapl_id, nthreads, threshold, stripe_size);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+    if (H5FD_SEC2 != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+
+    if (NULL != (fa = (const H5FD_sec2_fapl_t *)H5P_peek_driver_info(plist))) {
+        if (nthreads)
+            *nthreads = fa->nthreads;
+        if (threshold)
+            *threshold = fa->threshold;
+        if (stripe_size)
+            *stripe_size = fa->stripe_size;
+    } /* end if */
+    else {
+        if (nthreads)
+            *nthreads = 1;
+        if (threshold)
+            *threshold = H5FD_SEC2_STRIPE_THRESHOLD_DEF;
+        if (stripe_size)
+            *stripe_size = H5FD_SEC2_STRIPE_SIZE_DEF;
+    } /* end else */
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_sec2_stripes() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_fapl_get
+ *
+ * Purpose:     Returns a file access property list which indicates how the
+ *              specified file is being accessed. The return list could be
+ *              used to access another file the same way.
+ *
+ * Return:      Success:    Ptr to new file access property list with all
+ *                          members copied from the file struct, or NULL
+ *                          if the file was opened without striping
+ *                          properties.
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__sec2_fapl_get(H5FD_t *_file)
+{
+    H5FD_sec2_t *file      = (H5FD_sec2_t *)_file;
+    void *       ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Set return value */
+    if (file->fa.nthreads > 0)
+        ret_value = H5FD__sec2_fapl_copy(&(file->fa));
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sec2_fapl_get() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_fapl_copy
+ *
+ * Purpose:     Copies the sec2-specific file access properties.
+ *
+ * Return:      Success:    Ptr to a new property list
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__sec2_fapl_copy(const void *_old_fa)
+{
+    const H5FD_sec2_fapl_t *old_fa    = (const H5FD_sec2_fapl_t *)_old_fa;
+    H5FD_sec2_fapl_t *      new_fa    = NULL; /* New fapl info */
+    void *                  ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (NULL == (new_fa = (H5FD_sec2_fapl_t *)H5MM_malloc(sizeof(H5FD_sec2_fapl_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+
+    /* Copy the general information */
+    H5MM_memcpy(new_fa, old_fa, sizeof(H5FD_sec2_fapl_t));
+
+    /* Set return value */
+    ret_value = new_fa;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sec2_fapl_copy() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__sec2_open
  *
@@ -321,8 +551,9 @@ H5FD__sec2_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
     struct _BY_HANDLE_FILE_INFORMATION fileinfo;
 #endif
     h5_stat_t       sb;
-    H5P_genplist_t *plist;            /* Property list pointer */
-    H5FD_t *        ret_value = NULL; /* Return value */
+    H5P_genplist_t *        plist;            /* Property list pointer */
+    const H5FD_sec2_fapl_t *fa;               /* Striping properties   */
+    H5FD_t *                ret_value = NULL; /* Return value */
 
     FUNC_ENTER_STATIC
 
@@ -396,6 +627,11 @@ H5FD__sec2_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
             HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get ignore disabled file locks property")
     }
 
+    /* Get the striping properties, if there are any */
+    if (H5FD_SEC2 == H5P_peek_driver(plist) &&
+        NULL != (fa = (const H5FD_sec2_fapl_t *)H5P_peek_driver_info(plist)))
+        file->fa = *fa;
+
     /* Retain a copy of the name used to open the file, for possible error reporting */
     HDstrncpy(file->filename, name, sizeof(file->filename));
     file->filename[sizeof(file->filename) - 1] = '\0';
@@ -451,6 +687,13 @@ H5FD__sec2_close(H5FD_t *_file)
     /* Sanity check */
     HDassert(file);
 
+#ifdef H5FD_SEC2_HAVE_STRIPES
+    /* Shut down the threads transferring stripes */
+    if (file->pool && H5TS_pool_destroy(file->pool) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTRELEASE, FAIL, "unable to shut down worker threads")
+    file->pool = NULL;
+#endif /* H5FD_SEC2_HAVE_STRIPES */
+
     /* Close the underlying file */
     if (HDclose(file->fd) < 0)
         HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
@@ -714,6 +957,18 @@ H5FD__sec2_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNU
     if (REGION_OVERFLOW(addr, size))
         HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr)
 
+#ifdef H5FD_SEC2_HAVE_STRIPES
+    /* Split large reads into stripes, read concurrently */
+    if (file->fa.nthreads > 1 && size >= file->fa.threshold && size > file->fa.stripe_size) {
+        if (H5FD__sec2_stripes(file, addr, size, buf, NULL) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL,
+                        "striped file read failed: filename = '%s', addr = %llu, size = %llu",
+                        file->filename, (unsigned long long)addr, (unsigned long long)size)
+        file->op = OP_READ;
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+#endif /* H5FD_SEC2_HAVE_STRIPES */
+
 #ifndef H5_HAVE_PREADWRITE
     /* Seek to the correct location (if we don't have pread) */
     if (addr != file->pos || OP_READ != file->op)
@@ -823,6 +1078,20 @@ H5FD__sec2_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
         HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu",
                     (unsigned long long)addr, (unsigned long long)size)
 
+#ifdef H5FD_SEC2_HAVE_STRIPES
+    /* Split large writes into stripes, written concurrently */
+    if (file->fa.nthreads > 1 && size >= file->fa.threshold && size > file->fa.stripe_size) {
+        if (H5FD__sec2_stripes(file, addr, size, NULL, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL,
+                        "striped file write failed: filename = '%s', addr = %llu, size = %llu",
+                        file->filename, (unsigned long long)addr, (unsigned long long)size)
+        file->op = OP_WRITE;
+        if (file->pos > file->eof)
+            file->eof = file->pos;
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+#endif /* H5FD_SEC2_HAVE_STRIPES */
+
 #ifndef H5_HAVE_PREADWRITE
     /* Seek to the correct location (if we don't have pwrite) */
     if (addr != file->pos || OP_WRITE != file->op)
@@ -894,6 +1163,439 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__sec2_write() */
 
+#ifdef H5FD_SEC2_HAVE_STRIPES
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_stripe_task
+ *
+ * Purpose:     Transfers stripe TASK_IDX of a striped read or write.
+ *              Reading past the end of the file fills the rest of the
+ *              stripe with zeros, as H5FD__sec2_read() does.
+ *
+ * Note:        Called on a worker thread, so it only makes system calls
+ *              and doesn't push errors on the error stack.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__sec2_stripe_task(size_t task_idx, void *_stripes)
+{
+    const H5FD_sec2_stripes_t *stripes = (const H5FD_sec2_stripes_t *)_stripes; /* Striped transfer */
+    size_t                     offset;                                          /* Offset of the stripe */
+    size_t                     size;                                            /* Bytes left to transfer */
+    herr_t                     ret_value = SUCCEED;                             /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Locate the stripe.  The first one ends on a stripe boundary. */
+    if (0 == task_idx) {
+        offset = 0;
+        size   = stripes->first_size;
+    } /* end if */
+    else {
+        offset = stripes->first_size + ((task_idx - 1) * stripes->stripe_size);
+        size   = MIN(stripes->stripe_size, stripes->size - offset);
+    } /* end else */
+
+    while (size > 0) {
+        h5_posix_io_t     bytes_in;  /* # of bytes to transfer        */
+        h5_posix_io_ret_t bytes_out; /* # of bytes actually transferred */
+
+        /* Trying to transfer more bytes than the return type can handle is
+         * undefined behavior in POSIX.
+         */
+        if (size > H5_POSIX_MAX_IO_BYTES)
+            bytes_in = H5_POSIX_MAX_IO_BYTES;
+        else
+            bytes_in = (h5_posix_io_t)size;
+
+        do {
+            if (stripes->wbuf)
+                bytes_out = HDpwrite(stripes->fd, stripes->wbuf + offset, bytes_in,
+                                     (HDoff_t)(stripes->addr + offset));
+            else
+                bytes_out = HDpread(stripes->fd, stripes->rbuf + offset, bytes_in,
+                                    (HDoff_t)(stripes->addr + offset));
+        } while (-1 == bytes_out && EINTR == errno);
+
+        if (bytes_out < 0)
+            HGOTO_DONE(FAIL)
+        if (0 == bytes_out) {
+            if (stripes->wbuf)
+                HGOTO_DONE(FAIL)
+
+            /* end of file but not end of format address space */
+            HDmemset(stripes->rbuf + offset, 0, size);
+            break;
+        } /* end if */
+
+        size -= (size_t)bytes_out;
+        offset += (size_t)bytes_out;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sec2_stripe_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_stripes
+ *
+ * Purpose:     Reads SIZE bytes at address ADDR into RBUF, or writes them
+ *              from WBUF, in stripes aligned on multiples of the stripe
+ *              size in the file.  The stripes are transferred
+ *              concurrently by the threads of FILE, which are started the
+ *              first time they're needed, and are all complete when this
+ *              routine returns.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__sec2_stripes(H5FD_sec2_t *file, haddr_t addr, size_t size, void *rbuf, const void *wbuf)
+{
+    H5FD_sec2_stripes_t stripes;             /* Striped transfer */
+    size_t              nstripes;            /* # of stripes */
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file->fa.nthreads > 1);
+    HDassert(file->fa.stripe_size > 0);
+    HDassert(size > 0);
+    HDassert((NULL == rbuf) != (NULL == wbuf));
+
+    /* Start the threads */
+    if (NULL == file->pool && NULL == (file->pool = H5TS_pool_create(file->fa.nthreads)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to start worker threads")
+
+    /* Divide the transfer into stripes */
+    stripes.fd          = file->fd;
+    stripes.addr        = addr;
+    stripes.size        = size;
+    stripes.stripe_size = file->fa.stripe_size;
+    stripes.first_size  = MIN(size, stripes.stripe_size - (size_t)(addr % stripes.stripe_size));
+    stripes.rbuf        = (unsigned char *)rbuf;
+    stripes.wbuf        = (const unsigned char *)wbuf;
+    nstripes            = 1 + (size - stripes.first_size + stripes.stripe_size - 1) / stripes.stripe_size;
+
+    /* Transfer the stripes */
+    if (H5TS_pool_run(file->pool, nstripes, H5FD__sec2_stripe_task, &stripes) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_CANTOPERATE, FAIL, "unable to transfer stripes")
+
+    /* Update current position */
+    file->pos = addr + size;
+
+done:
+    if (ret_value < 0) {
+        /* Reset last file I/O information */
+        file->pos = HADDR_UNDEF;
+        file->op  = OP_UNKNOWN;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sec2_stripes() */
+#endif /* H5FD_SEC2_HAVE_STRIPES */
+
+#ifdef H5FD_SEC2_HAVE_PREADWRITEV
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_adjacent
+ *
+ * Purpose:     Counts the pieces at the start of a vector request that
+ *              follow each other in the file and can be transferred with
+ *              one preadv()/pwritev() call.
+ *
+ * Return:      The number of pieces, at least one
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint32_t
+H5FD__sec2_adjacent(uint32_t count, const haddr_t addrs[], const size_t sizes[])
+{
+    size_t   total = sizes[0]; /* Bytes in the run of pieces */
+    uint32_t n     = 1;        /* Number of pieces in the run */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(count > 0);
+
+    while (n < count && n < H5FD_SEC2_MAX_IOV && addrs[n] == addrs[n - 1] + sizes[n - 1] &&
+           total <= (size_t)H5_POSIX_MAX_IO_BYTES && sizes[n] <= (size_t)H5_POSIX_MAX_IO_BYTES - total) {
+        total += sizes[n];
+        n++;
+    } /* end while */
+
+    FUNC_LEAVE_NOAPI(n)
+} /* end H5FD__sec2_adjacent() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_readv
+ *
+ * Purpose:     Reads COUNT adjacent pieces of data from FILE, starting at
+ *              address ADDR, into the buffers BUFS with one preadv() call,
+ *              being careful of interrupted system calls, partial results
+ *              and the end of the file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__sec2_readv(H5FD_sec2_t *file, haddr_t addr, uint32_t count, const size_t sizes[], void *bufs[] /*out*/)
+{
+    struct iovec iov[H5FD_SEC2_MAX_IOV];   /* Pieces still to read */
+    HDoff_t      offset    = (HDoff_t)addr; /* Offset of the next byte to read */
+    size_t       total     = 0;             /* Total bytes to read */
+    int          first     = 0;             /* First piece still to read */
+    uint32_t     u;                         /* Local index variable */
+    herr_t       ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(count > 0 && count <= H5FD_SEC2_MAX_IOV);
+
+    for (u = 0; u < count; u++) {
+        iov[u].iov_base = bufs[u];
+        iov[u].iov_len  = sizes[u];
+        total += sizes[u];
+    } /* end for */
+
+    /* Check for overflow conditions */
+    if (!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if (REGION_OVERFLOW(addr, total))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr)
+
+    while (first < (int)count) {
+        h5_posix_io_ret_t bytes_read = -1; /* # of bytes actually read */
+
+        do {
+            bytes_read = HDpreadv(file->fd, iov + first, (int)count - first, offset);
+        } while (-1 == bytes_read && EINTR == errno);
+
+        if (-1 == bytes_read) { /* error */
+            int    myerrno = errno;
+            time_t mytime  = HDtime(NULL);
+
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL,
+                        "file vector read failed: time = %s, filename = '%s', file descriptor = %d, "
+                        "errno = %d, error message = '%s', pieces = %u, total read size = %llu, "
+                        "offset = %llu",
+                        HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), count,
+                        (unsigned long long)total, (unsigned long long)offset);
+        } /* end if */
+
+        if (0 == bytes_read) {
+            /* end of file but not end of format address space */
+            for (; first < (int)count; first++)
+                HDmemset(iov[first].iov_base, 0, iov[first].iov_len);
+            break;
+        } /* end if */
+
+        /* Skip past the pieces that were filled and trim a partial one */
+        offset += bytes_read;
+        while (first < (int)count && (size_t)bytes_read >= iov[first].iov_len) {
+            bytes_read -= (h5_posix_io_ret_t)iov[first].iov_len;
+            first++;
+        } /* end while */
+        if (bytes_read > 0) {
+            iov[first].iov_base = (char *)iov[first].iov_base + bytes_read;
+            iov[first].iov_len -= (size_t)bytes_read;
+        } /* end if */
+    }     /* end while */
+
+    /* Update current position */
+    file->pos = addr + total;
+    file->op  = OP_READ;
+
+done:
+    if (ret_value < 0) {
+        /* Reset last file I/O information */
+        file->pos = HADDR_UNDEF;
+        file->op  = OP_UNKNOWN;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sec2_readv() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_writev
+ *
+ * Purpose:     Writes COUNT adjacent pieces of data from the buffers BUFS
+ *              to FILE, starting at address ADDR, with one pwritev() call,
+ *              being careful of interrupted system calls and partial
+ *              results.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__sec2_writev(H5FD_sec2_t *file, haddr_t addr, uint32_t count, const size_t sizes[], const void *bufs[])
+{
+    struct iovec iov[H5FD_SEC2_MAX_IOV];   /* Pieces still to write */
+    HDoff_t      offset    = (HDoff_t)addr; /* Offset of the next byte to write */
+    size_t       total     = 0;             /* Total bytes to write */
+    int          first     = 0;             /* First piece still to write */
+    uint32_t     u;                         /* Local index variable */
+    herr_t       ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(count > 0 && count <= H5FD_SEC2_MAX_IOV);
+
+    for (u = 0; u < count; u++) {
+        H5_GCC_DIAG_OFF("cast-qual")
+        iov[u].iov_base = (void *)bufs[u];
+        H5_GCC_DIAG_ON("cast-qual")
+        iov[u].iov_len = sizes[u];
+        total += sizes[u];
+    } /* end for */
+
+    /* Check for overflow conditions */
+    if (!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if (REGION_OVERFLOW(addr, total))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu",
+                    (unsigned long long)addr, (unsigned long long)total)
+
+    while (first < (int)count) {
+        h5_posix_io_ret_t bytes_wrote = -1; /* # of bytes written */
+
+        do {
+            bytes_wrote = HDpwritev(file->fd, iov + first, (int)count - first, offset);
+        } while (-1 == bytes_wrote && EINTR == errno);
+
+        if (-1 == bytes_wrote) { /* error */
+            int    myerrno = errno;
+            time_t mytime  = HDtime(NULL);
+
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL,
+                        "file vector write failed: time = %s, filename = '%s', file descriptor = %d, "
+                        "errno = %d, error message = '%s', pieces = %u, total write size = %llu, "
+                        "offset = %llu",
+                        HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), count,
+                        (unsigned long long)total, (unsigned long long)offset);
+        } /* end if */
+
+        /* Skip past the pieces that were written and trim a partial one */
+        offset += bytes_wrote;
+        while (first < (int)count && (size_t)bytes_wrote >= iov[first].iov_len) {
+            bytes_wrote -= (h5_posix_io_ret_t)iov[first].iov_len;
+            first++;
+        } /* end while */
+        if (bytes_wrote > 0) {
+            iov[first].iov_base = (char *)iov[first].iov_base + bytes_wrote;
+            iov[first].iov_len -= (size_t)bytes_wrote;
+        } /* end if */
+    }     /* end while */
+
+    /* Update current position and eof */
+    file->pos = addr + total;
+    file->op  = OP_WRITE;
+    if (file->pos > file->eof)
+        file->eof = file->pos;
+
+done:
+    if (ret_value < 0) {
+        /* Reset last file I/O information */
+        file->pos = HADDR_UNDEF;
+        file->op  = OP_UNKNOWN;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sec2_writev() */
+#endif /* H5FD_SEC2_HAVE_PREADWRITEV */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_read_vector
+ *
+ * Purpose:     Reads COUNT pieces of data from FILE, where piece I is
+ *              SIZES[I] bytes at address ADDRS[I], into the buffers BUFS.
+ *              Runs of pieces that follow each other in the file are read
+ *              with a single preadv() call when it's available.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__sec2_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                       size_t sizes[], void *bufs[] /*out*/)
+{
+    uint32_t u         = 0;       /* Index of the next piece */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(_file && _file->cls);
+
+    while (u < count) {
+#ifdef H5FD_SEC2_HAVE_PREADWRITEV
+        uint32_t n = H5FD__sec2_adjacent(count - u, addrs + u, sizes + u); /* Pieces in this run */
+
+        if (n > 1) {
+            if (H5FD__sec2_readv((H5FD_sec2_t *)_file, addrs[u], n, sizes + u, bufs + u) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file vector read failed")
+            u += n;
+            continue;
+        } /* end if */
+#endif /* H5FD_SEC2_HAVE_PREADWRITEV */
+
+        if (H5FD__sec2_read(_file, types[u], dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+        u++;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sec2_read_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_write_vector
+ *
+ * Purpose:     Writes COUNT pieces of data from the buffers BUFS to FILE,
+ *              where piece I is SIZES[I] bytes at address ADDRS[I].  Runs
+ *              of pieces that follow each other in the file are written
+ *              with a single pwritev() call when it's available.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__sec2_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                        size_t sizes[], const void *bufs[])
+{
+    uint32_t u         = 0;       /* Index of the next piece */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(_file && _file->cls);
+
+    while (u < count) {
+#ifdef H5FD_SEC2_HAVE_PREADWRITEV
+        uint32_t n = H5FD__sec2_adjacent(count - u, addrs + u, sizes + u); /* Pieces in this run */
+
+        if (n > 1) {
+            if (H5FD__sec2_writev((H5FD_sec2_t *)_file, addrs[u], n, sizes + u, bufs + u) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file vector write failed")
+            u += n;
+            continue;
+        } /* end if */
+#endif /* H5FD_SEC2_HAVE_PREADWRITEV */
+
+        if (H5FD__sec2_write(_file, types[u], dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+        u++;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sec2_write_vector() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__sec2_truncate
  *
@@ -26,8 +26,18 @@
 extern "C" {
 #endif
 
+/* Default values for the smallest read or write that's split into stripes
+ * transferred concurrently, and for the size of the stripes.  Application
+ * can set these values through the function H5Pset_fapl_sec2_stripes. */
+#define H5FD_SEC2_STRIPE_THRESHOLD_DEF (64 * 1024 * 1024)
+#define H5FD_SEC2_STRIPE_SIZE_DEF      (8 * 1024 * 1024)
+
 H5_DLL hid_t  H5FD_sec2_init(void);
 H5_DLL herr_t H5Pset_fapl_sec2(hid_t fapl_id);
+H5_DLL herr_t H5Pset_fapl_sec2_stripes(hid_t fapl_id, unsigned nthreads, size_t threshold,
+                                       size_t stripe_size);
+H5_DLL herr_t H5Pget_fapl_sec2_stripes(hid_t fapl_id, unsigned *nthreads /*out*/, size_t *threshold /*out*/,
+                                       size_t *stripe_size /*out*/);
 
 #ifdef __cplusplus
 }
@@ -209,6 +209,11 @@ static const H5FD_class_t H5FD_stdio_g = {
     H5FD_stdio_get_handle, /* get_handle   */
     H5FD_stdio_read,       /* read         */
     H5FD_stdio_write,      /* write        */
+    NULL,                  /* read_vector  */
+    NULL,                  /* write_vector */
+    NULL,                  /* read_selection */
+    NULL,                  /* write_selection */
+    NULL,                  /* get_mapping     */
     H5FD_stdio_flush,      /* flush        */
     H5FD_stdio_truncate,   /* truncate     */
     H5FD_stdio_lock,       /* lock         */
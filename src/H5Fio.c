@@ -37,6 +37,7 @@
 #include "H5FDprivate.h" /* File drivers				*/
 #include "H5Iprivate.h"  /* IDs			  		*/
 #include "H5PBprivate.h" /* Page Buffer				*/
+#include "H5Sprivate.h"  /* Dataspaces				*/
 
 /****************/
 /* Local Macros */
@@ -46,6 +47,16 @@
 /* Local Typedefs */
 /******************/
 
+/* User data for the H5FD_sel_iterate() operators, moving pieces of
+ * selections through the page buffer and metadata accumulator
+ */
+typedef struct H5F_select_ud_t {
+    H5F_shared_t *       f_sh; /* Shared file info */
+    haddr_t              addr; /* Address of the selection's extent */
+    unsigned char *      rbuf; /* Buffer to read the selection into */
+    const unsigned char *wbuf; /* Buffer to write the selection from */
+} H5F_select_ud_t;
+
 /********************/
 /* Package Typedefs */
 /********************/
@@ -53,6 +64,10 @@
 /********************/
 /* Local Prototypes */
 /********************/
+static hbool_t H5F__select_direct(const H5F_shared_t *f_sh, uint32_t count, const H5S_t *file_spaces[],
+                                  const haddr_t offsets[], const size_t element_sizes[]);
+static herr_t  H5F__select_read_cb(hsize_t file_off, hsize_t mem_off, size_t len, void *_udata);
+static herr_t  H5F__select_write_cb(hsize_t file_off, hsize_t mem_off, size_t len, void *_udata);
 
 /*********************/
 /* Package Variables */
@@ -151,6 +166,58 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F_block_read() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5F_shared_get_mapping
+ *
+ * Purpose:     Points *PTR at SIZE bytes of the file at address ADDR,
+ *              when the file driver has mapped the file into memory, so
+ *              that they can be decoded without reading them into a
+ *              buffer first.
+ *
+ *              *PTR is set to NULL when the driver doesn't map the file,
+ *              or when newer bytes may be held in the page buffer or the
+ *              metadata accumulator; the bytes must then be read with
+ *              H5F_shared_block_read().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_shared_get_mapping(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size,
+                       const void **ptr /*out*/)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f_sh);
+    HDassert(ptr);
+    HDassert(H5F_addr_defined(addr));
+
+    *ptr = NULL;
+
+    /* Check for attempting I/O on 'temporary' file address */
+    if (H5F_addr_le(f_sh->tmp_addr, (addr + size)))
+        HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+
+    /* The mapping may be older than bytes held in the page buffer or the
+     * metadata accumulator
+     */
+    if (f_sh->page_buf)
+        HGOTO_DONE(SUCCEED)
+    if (f_sh->accum.size > 0 && H5F_addr_overlap(addr, size, f_sh->accum.loc, f_sh->accum.size))
+        HGOTO_DONE(SUCCEED)
+
+    /* Treat global heap as raw data */
+    if (H5FD_get_mapping(f_sh->lf, (type == H5FD_MEM_GHEAP) ? H5FD_MEM_DRAW : type, addr, size, ptr) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "can't get mapping of file")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_shared_get_mapping() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5F_shared_block_write
  *
@@ -238,6 +305,357 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F_block_write() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5F_shared_vector_read
+ *
+ * Purpose:     Reads COUNT pieces of data from a file/server/etc into
+ *              buffers.  Piece I is SIZES[I] bytes of type TYPES[I] at
+ *              address ADDRS[I], which is relative to the base address
+ *              for the file.
+ *
+ *              Raw data is passed to the file driver as one vector
+ *              request when it doesn't need to go through the page
+ *              buffer or metadata accumulator, otherwise each piece is
+ *              read on its own.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_shared_vector_read(H5F_shared_t *f_sh, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                       size_t sizes[], void *bufs[] /*out*/)
+{
+    hbool_t  direct;              /* Whether the pieces can go straight to the file driver */
+    uint32_t u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f_sh);
+    HDassert(count == 0 || (types && addrs && sizes && bufs));
+
+    /* Pages of raw data may be held in the page buffer */
+    direct = (NULL == f_sh->page_buf);
+
+    for (u = 0; u < count; u++) {
+        HDassert(bufs[u]);
+        HDassert(H5F_addr_defined(addrs[u]));
+
+        /* Check for attempting I/O on 'temporary' file address */
+        if (H5F_addr_le(f_sh->tmp_addr, (addrs[u] + sizes[u])))
+            HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+
+        /* Only raw data (including global heap) that isn't held in the
+         * metadata accumulator can go straight to the file driver
+         */
+        if ((types[u] != H5FD_MEM_DRAW && types[u] != H5FD_MEM_GHEAP) ||
+            (f_sh->accum.size > 0 && H5F_addr_overlap(addrs[u], sizes[u], f_sh->accum.loc, f_sh->accum.size)))
+            direct = FALSE;
+    } /* end for */
+
+    if (direct) {
+        for (u = 0; u < count; u++)
+            types[u] = H5FD_MEM_DRAW;
+
+        if (H5FD_read_vector(f_sh->lf, count, types, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "vector read failed")
+    } /* end if */
+    else
+        for (u = 0; u < count; u++)
+            if (H5PB_read(f_sh, (types[u] == H5FD_MEM_GHEAP) ? H5FD_MEM_DRAW : types[u], addrs[u], sizes[u],
+                          bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "read through page buffer failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_shared_vector_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_shared_vector_write
+ *
+ * Purpose:     Writes COUNT pieces of data from memory to a
+ *              file/server/etc.  Piece I is SIZES[I] bytes of type
+ *              TYPES[I] at address ADDRS[I], which is relative to the
+ *              base address for the file.
+ *
+ *              Raw data is passed to the file driver as one vector
+ *              request when it doesn't need to go through the page
+ *              buffer or metadata accumulator, otherwise each piece is
+ *              written on its own.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_shared_vector_write(H5F_shared_t *f_sh, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                        size_t sizes[], const void *bufs[])
+{
+    hbool_t  direct;              /* Whether the pieces can go straight to the file driver */
+    uint32_t u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f_sh);
+    HDassert(H5F_SHARED_INTENT(f_sh) & H5F_ACC_RDWR);
+    HDassert(count == 0 || (types && addrs && sizes && bufs));
+
+    /* SWMR writers must write out the metadata accumulator before raw data,
+     * which the page buffer and accumulator code take care of
+     */
+    direct = (NULL == f_sh->page_buf && 0 == (H5F_SHARED_INTENT(f_sh) & H5F_ACC_SWMR_WRITE));
+
+    for (u = 0; u < count; u++) {
+        HDassert(bufs[u]);
+        HDassert(H5F_addr_defined(addrs[u]));
+
+        /* Check for attempting I/O on 'temporary' file address */
+        if (H5F_addr_le(f_sh->tmp_addr, (addrs[u] + sizes[u])))
+            HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+
+        /* Only raw data (including global heap) that isn't held in the
+         * metadata accumulator can go straight to the file driver
+         */
+        if ((types[u] != H5FD_MEM_DRAW && types[u] != H5FD_MEM_GHEAP) ||
+            (f_sh->accum.size > 0 && H5F_addr_overlap(addrs[u], sizes[u], f_sh->accum.loc, f_sh->accum.size)))
+            direct = FALSE;
+    } /* end for */
+
+    if (direct) {
+        for (u = 0; u < count; u++)
+            types[u] = H5FD_MEM_DRAW;
+
+        if (H5FD_write_vector(f_sh->lf, count, types, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "vector write failed")
+    } /* end if */
+    else
+        for (u = 0; u < count; u++)
+            if (H5PB_write(f_sh, (types[u] == H5FD_MEM_GHEAP) ? H5FD_MEM_DRAW : types[u], addrs[u], sizes[u],
+                           bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "write through page buffer failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_shared_vector_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__select_direct
+ *
+ * Purpose:     Checks whether COUNT selections of raw data, laid out from
+ *              the addresses OFFSETS, can go straight to the file driver
+ *              without missing data held in the page buffer or metadata
+ *              accumulator.  The whole extent of each file dataspace is
+ *              checked against the accumulator, which is cheaper than
+ *              working out the selection's bounds.
+ *
+ * Return:      TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5F__select_direct(const H5F_shared_t *f_sh, uint32_t count, const H5S_t *file_spaces[],
+                   const haddr_t offsets[], const size_t element_sizes[])
+{
+    uint32_t u;                /* Local index variable */
+    hbool_t  ret_value = TRUE; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (f_sh->page_buf)
+        HGOTO_DONE(FALSE)
+
+    if (f_sh->accum.size > 0)
+        for (u = 0; u < count; u++)
+            if (H5F_addr_overlap(offsets[u],
+                                 (hsize_t)H5S_GET_EXTENT_NPOINTS(file_spaces[u]) * element_sizes[u],
+                                 f_sh->accum.loc, f_sh->accum.size))
+                HGOTO_DONE(FALSE)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__select_direct() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__select_read_cb
+ *
+ * Purpose:     H5FD_sel_iterate() operator for H5F_shared_select_read(),
+ *              reading one piece of a selection through the page buffer
+ *              and metadata accumulator.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__select_read_cb(hsize_t file_off, hsize_t mem_off, size_t len, void *_udata)
+{
+    H5F_select_ud_t *udata     = (H5F_select_ud_t *)_udata;
+    herr_t           ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (H5F_shared_block_read(udata->f_sh, H5FD_MEM_DRAW, udata->addr + file_off, len,
+                              udata->rbuf + mem_off) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "block read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__select_read_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__select_write_cb
+ *
+ * Purpose:     H5FD_sel_iterate() operator for H5F_shared_select_write(),
+ *              writing one piece of a selection through the page buffer
+ *              and metadata accumulator.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__select_write_cb(hsize_t file_off, hsize_t mem_off, size_t len, void *_udata)
+{
+    H5F_select_ud_t *udata     = (H5F_select_ud_t *)_udata;
+    herr_t           ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (H5F_shared_block_write(udata->f_sh, H5FD_MEM_DRAW, udata->addr + file_off, len,
+                               udata->wbuf + mem_off) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "block write failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__select_write_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_shared_select_read
+ *
+ * Purpose:     Reads COUNT selections of raw data from a file/server/etc
+ *              into buffers.  Selection I reads the elements of
+ *              ELEMENT_SIZES[I] bytes selected in FILE_SPACES[I], laid
+ *              out from the address OFFSETS[I], which is relative to the
+ *              base address for the file, into the elements selected in
+ *              MEM_SPACES[I] of the buffer BUFS[I].
+ *
+ *              The selections are passed to the file driver as they are
+ *              when they don't need to go through the page buffer or
+ *              metadata accumulator, otherwise they're read a piece at a
+ *              time.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_shared_select_read(H5F_shared_t *f_sh, H5FD_mem_t type, uint32_t count, const H5S_t *mem_spaces[],
+                       const H5S_t *file_spaces[], haddr_t offsets[], size_t element_sizes[],
+                       void *bufs[] /*out*/)
+{
+    uint32_t u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f_sh);
+    HDassert(type == H5FD_MEM_DRAW);
+    HDassert(count == 0 || (mem_spaces && file_spaces && offsets && element_sizes && bufs));
+
+    /* Check for attempting I/O on 'temporary' file address */
+    for (u = 0; u < count; u++)
+        if (H5F_addr_le(f_sh->tmp_addr, offsets[u]))
+            HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+
+    if (H5F__select_direct(f_sh, count, file_spaces, offsets, element_sizes)) {
+        if (H5FD_read_selection(f_sh->lf, type, count, mem_spaces, file_spaces, offsets, element_sizes,
+                                bufs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "selection read failed")
+    } /* end if */
+    else
+        for (u = 0; u < count; u++) {
+            H5F_select_ud_t udata; /* User data for H5FD_sel_iterate() operator */
+
+            udata.f_sh = f_sh;
+            udata.addr = offsets[u];
+            udata.rbuf = (unsigned char *)bufs[u];
+            if (H5FD_sel_iterate(mem_spaces[u], file_spaces[u], element_sizes[u], H5F__select_read_cb,
+                                 &udata) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "selection read failed")
+        } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_shared_select_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_shared_select_write
+ *
+ * Purpose:     Writes COUNT selections of raw data from memory to a
+ *              file/server/etc.  Selection I writes the elements selected
+ *              in MEM_SPACES[I] of the buffer BUFS[I] to the elements of
+ *              ELEMENT_SIZES[I] bytes selected in FILE_SPACES[I], laid
+ *              out from the address OFFSETS[I], which is relative to the
+ *              base address for the file.
+ *
+ *              The selections are passed to the file driver as they are
+ *              when they don't need to go through the page buffer or
+ *              metadata accumulator, otherwise they're written a piece at
+ *              a time.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_shared_select_write(H5F_shared_t *f_sh, H5FD_mem_t type, uint32_t count, const H5S_t *mem_spaces[],
+                        const H5S_t *file_spaces[], haddr_t offsets[], size_t element_sizes[],
+                        const void *bufs[])
+{
+    uint32_t u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f_sh);
+    HDassert(H5F_SHARED_INTENT(f_sh) & H5F_ACC_RDWR);
+    HDassert(type == H5FD_MEM_DRAW);
+    HDassert(count == 0 || (mem_spaces && file_spaces && offsets && element_sizes && bufs));
+
+    /* Check for attempting I/O on 'temporary' file address */
+    for (u = 0; u < count; u++)
+        if (H5F_addr_le(f_sh->tmp_addr, offsets[u]))
+            HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+
+    /* SWMR writers must write out the metadata accumulator before raw data */
+    if (0 == (H5F_SHARED_INTENT(f_sh) & H5F_ACC_SWMR_WRITE) &&
+        H5F__select_direct(f_sh, count, file_spaces, offsets, element_sizes)) {
+        if (H5FD_write_selection(f_sh->lf, type, count, mem_spaces, file_spaces, offsets, element_sizes,
+                                 bufs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "selection write failed")
+    } /* end if */
+    else
+        for (u = 0; u < count; u++) {
+            H5F_select_ud_t udata; /* User data for H5FD_sel_iterate() operator */
+
+            udata.f_sh = f_sh;
+            udata.addr = offsets[u];
+            udata.wbuf = (const unsigned char *)bufs[u];
+            if (H5FD_sel_iterate(mem_spaces[u], file_spaces[u], element_sizes[u], H5F__select_write_cb,
+                                 &udata) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "selection write failed")
+        } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_shared_select_write() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5F_flush_tagged_metadata
  *
@@ -824,6 +824,26 @@ H5F_shared_has_feature(const H5F_shared_t *f_sh, unsigned feature)
     FUNC_LEAVE_NOAPI((hbool_t)(f_sh->lf->feature_flags & feature))
 } /* end H5F_shared_has_feature() */
 
+/*-------------------------------------------------------------------------
+ * Function: H5F_shared_has_select_io
+ *
+ * Purpose:  Check if raw data selections can be passed to the file
+ *           driver as they are, which needs a driver with selection
+ *           callbacks and no page buffer to go through
+ *
+ * Return:   TRUE/FALSE
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5F_shared_has_select_io(const H5F_shared_t *f_sh)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f_sh);
+
+    FUNC_LEAVE_NOAPI(NULL == f_sh->page_buf && H5FD_has_selection_io(f_sh->lf))
+} /* end H5F_shared_has_select_io() */
+
 /*-------------------------------------------------------------------------
  * Function: H5F_has_feature
  *
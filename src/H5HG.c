@@ -79,6 +79,7 @@
 
 static haddr_t H5HG__create(H5F_t *f, size_t size);
 static size_t  H5HG__alloc(H5F_t *f, H5HG_heap_t *heap, size_t size, unsigned *heap_flags_ptr);
+static int     H5HG__cmp_obj(const void *_obj1, const void *_obj2);
 
 /*********************/
 /* Package Variables */
@@ -562,6 +563,107 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* H5HG_insert() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5HG_insert_multi
+ *
+ * Purpose:	Inserts NOBJS new objects into the global heap, the same as
+ *		calling H5HG_insert() for each of them, except that a
+ *		collection stays protected for as long as the following
+ *		objects fit in it.  When a new collection has to be created,
+ *		it is made large enough for several of the remaining objects,
+ *		up to H5HG_MAXSIZE bytes.
+ *
+ * Return:	Success:	Non-negative, and the heap object handles
+ *				returned through the HOBJ array.
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5HG_insert_multi(H5F_t *f, size_t nobjs, const size_t size[], const void *obj[], H5HG_t hobj[] /*out*/)
+{
+    H5HG_heap_t *heap       = NULL;
+    unsigned     heap_flags = H5AC__NO_FLAGS_SET;
+    size_t       u, v;                /* Local index variables */
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI_TAG(H5AC__GLOBALHEAP_TAG, FAIL)
+
+    /* Check args */
+    HDassert(f);
+    HDassert(0 == nobjs || (size && obj && hobj));
+
+    if (0 == (H5F_INTENT(f) & H5F_ACC_RDWR))
+        HGOTO_ERROR(H5E_HEAP, H5E_WRITEERROR, FAIL, "no write intent on file")
+
+    for (u = 0; u < nobjs; u++) {
+        size_t need = H5HG_SIZEOF_OBJHDR(f) + H5HG_ALIGN(size[u]); /*total space needed for object */
+        size_t idx;
+
+        HDassert(0 == size[u] || obj[u]);
+
+        /* Release the current collection once the object doesn't fit */
+        if (heap && heap->obj[0].size < need) {
+            if (H5AC_unprotect(f, H5AC_GHEAP, heap->addr, heap, heap_flags) < 0)
+                HGOTO_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to unprotect heap.")
+            heap       = NULL;
+            heap_flags = H5AC__NO_FLAGS_SET;
+        } /* end if */
+
+        if (NULL == heap) {
+            haddr_t addr = HADDR_UNDEF; /* Address of heap to add objects within */
+
+            /* Look for a heap in the file's CWFS that has enough space for the object */
+            if (H5F_cwfs_find_free_heap(f, need, &addr) < 0)
+                HGOTO_ERROR(H5E_HEAP, H5E_NOTFOUND, FAIL, "error trying to locate heap")
+
+            /*
+             * If we didn't find any collection with enough free space then
+             * allocate a new collection, with room for as many of the
+             * following objects as H5HG_MAXSIZE allows.
+             */
+            if (!H5F_addr_defined(addr)) {
+                size_t coll_size = need + H5HG_SIZEOF_HDR(f);
+
+                for (v = u + 1; v < nobjs; v++) {
+                    size_t next = H5HG_SIZEOF_OBJHDR(f) + H5HG_ALIGN(size[v]);
+
+                    if (coll_size + next > H5HG_MAXSIZE)
+                        break;
+                    coll_size += next;
+                } /* end for */
+
+                addr = H5HG__create(f, coll_size);
+                if (!H5F_addr_defined(addr))
+                    HGOTO_ERROR(H5E_HEAP, H5E_CANTINIT, FAIL, "unable to allocate a global heap collection")
+            } /* end if */
+
+            if (NULL == (heap = H5HG__protect(f, addr, H5AC__NO_FLAGS_SET)))
+                HGOTO_ERROR(H5E_HEAP, H5E_CANTPROTECT, FAIL, "unable to protect global heap")
+        } /* end if */
+
+        /* Split the free space to make room for the new object */
+        if (0 == (idx = H5HG__alloc(f, heap, size[u], &heap_flags)))
+            HGOTO_ERROR(H5E_HEAP, H5E_CANTALLOC, FAIL, "unable to allocate global heap object")
+
+        /* Copy data into the heap */
+        if (size[u] > 0)
+            H5MM_memcpy(heap->obj[idx].begin + H5HG_SIZEOF_OBJHDR(f), obj[u], size[u]);
+        heap_flags |= H5AC__DIRTIED_FLAG;
+
+        /* Return the heap ID */
+        hobj[u].addr = heap->addr;
+        hobj[u].idx  = idx;
+    } /* end for */
+
+done:
+    if (heap && H5AC_unprotect(f, H5AC_GHEAP, heap->addr, heap, heap_flags) < 0)
+        HDONE_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to unprotect heap.")
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* H5HG_insert_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5HG_read
  *
@@ -634,6 +736,109 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5HG_read() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5HG__cmp_obj
+ *
+ * Purpose:	Compares the collection addresses of two global heap
+ *		objects for HDqsort().
+ *
+ * Return:	An integer less than, equal to, or greater than zero
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5HG__cmp_obj(const void *_obj1, const void *_obj2)
+{
+    const H5HG_t *obj1 = (const H5HG_t *)_obj1;
+    const H5HG_t *obj2 = (const H5HG_t *)_obj2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(H5F_addr_cmp(obj1->addr, obj2->addr))
+} /* end H5HG__cmp_obj() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5HG_read_multi
+ *
+ * Purpose:	Reads NOBJS global heap objects into the caller's buffers
+ *		OBJECT, which must be exactly OBJ_SIZE bytes.  The objects
+ *		are grouped by collection, so each collection is protected
+ *		once and all of its objects are copied out in one pass.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5HG_read_multi(H5F_t *f, size_t nobjs, const H5HG_t hobj[], void *object[], const size_t obj_size[])
+{
+    H5HG_heap_t *heap      = NULL;    /* Pointer to global heap object */
+    H5HG_t *     order     = NULL;    /* Objects sorted by collection, with their position */
+    size_t       u;                   /* Local index variable */
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI_TAG(H5AC__GLOBALHEAP_TAG, FAIL)
+
+    /* Check args */
+    HDassert(f);
+    HDassert(0 == nobjs || (hobj && object && obj_size));
+
+    /*
+     * Objects written together are usually in the same collection already,
+     * and collections are created at increasing addresses, so the objects
+     * are only sorted when they aren't grouped by collection yet.  The sort
+     * keeps each object's position in the 'idx' field.
+     */
+    for (u = 1; u < nobjs; u++)
+        if (H5F_addr_lt(hobj[u].addr, hobj[u - 1].addr))
+            break;
+    if (u < nobjs) {
+        if (NULL == (order = (H5HG_t *)H5MM_malloc(nobjs * sizeof(H5HG_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        for (u = 0; u < nobjs; u++) {
+            order[u].addr = hobj[u].addr;
+            order[u].idx  = u;
+        } /* end for */
+        HDqsort(order, nobjs, sizeof(H5HG_t), H5HG__cmp_obj);
+    } /* end if */
+
+    for (u = 0; u < nobjs; u++) {
+        size_t        n   = order ? order[u].idx : u; /* Position of the object */
+        const H5HG_t *obj = &hobj[n];
+
+        /* Switch collections */
+        if (NULL == heap || !H5F_addr_eq(heap->addr, obj->addr)) {
+            if (heap) {
+                if (H5AC_unprotect(f, H5AC_GHEAP, heap->addr, heap, H5AC__NO_FLAGS_SET) < 0)
+                    HGOTO_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to release global heap")
+                heap = NULL;
+            } /* end if */
+
+            if (NULL == (heap = H5HG__protect(f, obj->addr, H5AC__READ_ONLY_FLAG)))
+                HGOTO_ERROR(H5E_HEAP, H5E_CANTPROTECT, FAIL, "unable to protect global heap")
+
+            /* Advance the heap in the CWFS list, as H5HG_read() does */
+            if (heap->obj[0].begin)
+                if (H5F_cwfs_advance_heap(f, heap, FALSE) < 0)
+                    HGOTO_ERROR(H5E_HEAP, H5E_CANTMODIFY, FAIL, "can't adjust file's CWFS")
+        } /* end if */
+
+        if (obj->idx >= heap->nused || NULL == heap->obj[obj->idx].begin)
+            HGOTO_ERROR(H5E_HEAP, H5E_BADVALUE, FAIL, "invalid global heap object index")
+        if (heap->obj[obj->idx].size != obj_size[n])
+            HGOTO_ERROR(H5E_HEAP, H5E_BADVALUE, FAIL, "global heap object size does not match")
+        if (obj_size[n] > 0)
+            H5MM_memcpy(object[n], heap->obj[obj->idx].begin + H5HG_SIZEOF_OBJHDR(f), obj_size[n]);
+    } /* end for */
+
+done:
+    if (heap && H5AC_unprotect(f, H5AC_GHEAP, heap->addr, heap, H5AC__NO_FLAGS_SET) < 0)
+        HDONE_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to release global heap")
+    H5MM_xfree(order);
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5HG_read_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5HG_link
  *
@@ -3224,6 +3224,46 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pset_scaleoffset() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_vlen_inline
+ *
+ * Purpose:	Sets the filter which stores the variable-length data of
+ *		a dataset in its chunks, H5Z_FILTER_VLEN_INLINE
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_vlen_inline(hid_t plist_id)
+{
+    H5O_pline_t     pline;
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", plist_id);
+
+    /* Check arguments */
+    if (TRUE != H5P_isa_class(plist_id, H5P_DATASET_CREATE))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset creation property list")
+
+    /* Get the plist structure */
+    if (NULL == (plist = (H5P_genplist_t *)H5I_object(plist_id)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Add the filter */
+    if (H5P_peek(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get pipeline")
+    if (H5Z_append(&pline, H5Z_FILTER_VLEN_INLINE, H5Z_FLAG_MANDATORY, (size_t)0, NULL) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to add vlen inline filter to pipeline")
+    if (H5P_poke(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to set pipeline")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_vlen_inline() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5Pset_fill_value
  *
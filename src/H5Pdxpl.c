@@ -159,6 +159,26 @@
 #define H5D_XFER_XFORM_COPY  H5P__dxfr_xform_copy
 #define H5D_XFER_XFORM_CMP   H5P__dxfr_xform_cmp
 #define H5D_XFER_XFORM_CLOSE H5P__dxfr_xform_close
+/* Definitions for datatype conversion threads property */
+#define H5D_XFER_CONV_NTHREADS_SIZE sizeof(unsigned)
+#define H5D_XFER_CONV_NTHREADS_DEF  0
+#define H5D_XFER_CONV_NTHREADS_ENC  H5P__encode_unsigned
+#define H5D_XFER_CONV_NTHREADS_DEC  H5P__decode_unsigned
+/* Definitions for overlapping I/O with datatype conversion property */
+#define H5D_XFER_TCONV_OVERLAP_SIZE sizeof(hbool_t)
+#define H5D_XFER_TCONV_OVERLAP_DEF  FALSE
+#define H5D_XFER_TCONV_OVERLAP_ENC  H5P__encode_hbool_t
+#define H5D_XFER_TCONV_OVERLAP_DEC  H5P__decode_hbool_t
+/* Definitions for sorting point selections property */
+#define H5D_XFER_SORT_POINTS_SIZE sizeof(hbool_t)
+#define H5D_XFER_SORT_POINTS_DEF  FALSE
+#define H5D_XFER_SORT_POINTS_ENC  H5P__encode_hbool_t
+#define H5D_XFER_SORT_POINTS_DEC  H5P__decode_hbool_t
+/* Definitions for bypassing caches property */
+#define H5D_XFER_BYPASS_CACHE_SIZE sizeof(hbool_t)
+#define H5D_XFER_BYPASS_CACHE_DEF  FALSE
+#define H5D_XFER_BYPASS_CACHE_ENC  H5P__encode_hbool_t
+#define H5D_XFER_BYPASS_CACHE_DEC  H5P__decode_hbool_t
 
 /******************/
 /* Local Typedefs */
@@ -263,6 +283,14 @@ static const H5Z_cb_t  H5D_def_filter_cb_g  = H5D_XFER_FILTER_CB_DEF; /* Default
 static const H5T_conv_cb_t H5D_def_conv_cb_g =
     H5D_XFER_CONV_CB_DEF; /* Default value for datatype conversion callback */
 static const void *H5D_def_xfer_xform_g = H5D_XFER_XFORM_DEF; /* Default value for data transform */
+static const unsigned H5D_def_conv_nthreads_g =
+    H5D_XFER_CONV_NTHREADS_DEF; /* Default value for # of datatype conversion threads */
+static const hbool_t H5D_def_tconv_overlap_g =
+    H5D_XFER_TCONV_OVERLAP_DEF; /* Default value for overlapping I/O with datatype conversion */
+static const hbool_t H5D_def_sort_points_g =
+    H5D_XFER_SORT_POINTS_DEF; /* Default value for sorting point selections */
+static const hbool_t H5D_def_bypass_cache_g =
+    H5D_XFER_BYPASS_CACHE_DEF; /* Default value for reading around the sieve buffer & chunk cache */
 
 /*-------------------------------------------------------------------------
  * Function:    H5P__dxfr_reg_prop
@@ -420,6 +448,30 @@ H5P__dxfr_reg_prop(H5P_genclass_t *pclass)
                            H5D_XFER_XFORM_CLOSE) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the datatype conversion threads property */
+    if (H5P__register_real(pclass, H5D_XFER_CONV_NTHREADS_NAME, H5D_XFER_CONV_NTHREADS_SIZE,
+                           &H5D_def_conv_nthreads_g, NULL, NULL, NULL, H5D_XFER_CONV_NTHREADS_ENC,
+                           H5D_XFER_CONV_NTHREADS_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the overlapping I/O with datatype conversion property */
+    if (H5P__register_real(pclass, H5D_XFER_TCONV_OVERLAP_NAME, H5D_XFER_TCONV_OVERLAP_SIZE,
+                           &H5D_def_tconv_overlap_g, NULL, NULL, NULL, H5D_XFER_TCONV_OVERLAP_ENC,
+                           H5D_XFER_TCONV_OVERLAP_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the sorting point selections property */
+    if (H5P__register_real(pclass, H5D_XFER_SORT_POINTS_NAME, H5D_XFER_SORT_POINTS_SIZE,
+                           &H5D_def_sort_points_g, NULL, NULL, NULL, H5D_XFER_SORT_POINTS_ENC,
+                           H5D_XFER_SORT_POINTS_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the bypassing caches property */
+    if (H5P__register_real(pclass, H5D_XFER_BYPASS_CACHE_NAME, H5D_XFER_BYPASS_CACHE_SIZE,
+                           &H5D_def_bypass_cache_g, NULL, NULL, NULL, H5D_XFER_BYPASS_CACHE_ENC,
+                           H5D_XFER_BYPASS_CACHE_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__dxfr_reg_prop() */
@@ -1714,6 +1766,282 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_hyper_vector_size() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_type_conv_threads
+ *
+ * Purpose:	Given a dataset transfer property list, set the number of
+ *              threads which may be used to convert the elements of a
+ *              single datatype conversion.  Only conversions between
+ *              integer, floating-point, bitfield and fixed-length string
+ *              types, whose elements can be converted independently, are
+ *              split across threads; other conversions (compound, VL,
+ *              reference, application-defined, etc.) and small conversions
+ *              are always performed by the calling thread.
+ *
+ *		The default of 0 (or 1) performs all conversions on the
+ *              calling thread.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_type_conv_threads(hid_t plist_id, unsigned nthreads)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", plist_id, nthreads);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if (H5P_set(plist, H5D_XFER_CONV_NTHREADS_NAME, &nthreads) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_type_conv_threads() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_type_conv_threads
+ *
+ * Purpose:	Reads values previously set with H5Pset_type_conv_threads().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_type_conv_threads(hid_t plist_id, unsigned *nthreads /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, nthreads);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Return values */
+    if (nthreads)
+        if (H5P_get(plist, H5D_XFER_CONV_NTHREADS_NAME, nthreads) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_type_conv_threads() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_tconv_overlap
+ *
+ * Purpose:	Given a dataset transfer property list, set whether reading
+ *              or writing through the datatype conversion buffer overlaps
+ *              the I/O for one part of the selection with the conversion
+ *              of another.  When enabled, a second conversion buffer
+ *              of the size set with H5Pset_buffer() is allocated, and
+ *              each part of the selection is converted on a worker thread
+ *              while the next part is read from the file (or the previous
+ *              part is written to it).
+ *
+ *		Only conversions which may be run on a worker thread (see
+ *              H5Pset_type_conv_threads) are overlapped, and only
+ *              selections which don't fit in the conversion buffer
+ *              benefit.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_tconv_overlap(hid_t plist_id, hbool_t overlap)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ib", plist_id, overlap);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if (H5P_set(plist, H5D_XFER_TCONV_OVERLAP_NAME, &overlap) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_tconv_overlap() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_tconv_overlap
+ *
+ * Purpose:	Reads values previously set with H5Pset_tconv_overlap().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_tconv_overlap(hid_t plist_id, hbool_t *overlap /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, overlap);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Return values */
+    if (overlap)
+        if (H5P_get(plist, H5D_XFER_TCONV_OVERLAP_NAME, overlap) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_tconv_overlap() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_sort_points
+ *
+ * Purpose:	Given a dataset transfer property list, set whether the
+ *              points of a point selection in the file are put into the
+ *              order they're stored in the file before performing I/O.
+ *              The memory selection is reordered the same way, so the
+ *              same elements are transferred, but the file is accessed
+ *              in increasing offset order, with adjacent points merged
+ *              into a single access.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_sort_points(hid_t plist_id, hbool_t sort_points)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ib", plist_id, sort_points);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if (H5P_set(plist, H5D_XFER_SORT_POINTS_NAME, &sort_points) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_sort_points() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_sort_points
+ *
+ * Purpose:	Reads values previously set with H5Pset_sort_points().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_sort_points(hid_t plist_id, hbool_t *sort_points /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, sort_points);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Return values */
+    if (sort_points)
+        if (H5P_get(plist, H5D_XFER_SORT_POINTS_NAME, sort_points) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_sort_points() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_bypass_cache
+ *
+ * Purpose:	Given a dataset transfer property list, set whether reads
+ *              of large pieces of contiguous data and of whole, unfiltered
+ *              chunks go straight from the file into the application's
+ *              buffer (or the type conversion buffer), without staging the
+ *              data in the dataset's data sieve buffer or chunk cache.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_bypass_cache(hid_t plist_id, hbool_t bypass_cache)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ib", plist_id, bypass_cache);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if (H5P_set(plist, H5D_XFER_BYPASS_CACHE_NAME, &bypass_cache) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_bypass_cache() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_bypass_cache
+ *
+ * Purpose:	Reads values previously set with H5Pset_bypass_cache().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_bypass_cache(hid_t plist_id, hbool_t *bypass_cache /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, bypass_cache);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Return values */
+    if (bypass_cache)
+        if (H5P_get(plist, H5D_XFER_BYPASS_CACHE_NAME, bypass_cache) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_bypass_cache() */
+
 /*-------------------------------------------------------------------------
  * Function:       H5P__dxfr_io_xfer_mode_enc
  *
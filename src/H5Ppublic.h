@@ -5161,6 +5161,40 @@ H5_DLL herr_t H5Pset_scaleoffset(hid_t plist_id, H5Z_SO_scale_type_t scale_type,
 H5_DLL herr_t H5Pset_szip(hid_t plist_id, unsigned options_mask, unsigned pixels_per_block);
 H5_DLL herr_t H5Pset_virtual(hid_t dcpl_id, hid_t vspace_id, const char *src_file_name,
                              const char *src_dset_name, hid_t src_space_id);
+/**
+ * \ingroup DCPL
+ *
+ * \brief Stores variable-length data in the chunks of a dataset
+ *
+ * \dcpl_id{plist_id}
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_vlen_inline() sets the inline variable-length data filter,
+ *          #H5Z_FILTER_VLEN_INLINE, in the dataset creation property list
+ *          \p plist_id.
+ *
+ *          The sequences of a variable-length datatype are normally stored
+ *          in global heap collections shared by all the objects in the
+ *          file, apart from the raw data of the dataset. With this filter,
+ *          the sequences of the elements of each chunk are stored in the
+ *          chunk itself, after the elements. They pass through the other
+ *          filters of the pipeline along with the elements, so that they
+ *          can be compressed, and they are read along with the chunk.
+ *
+ *          The filter can only be used with chunked storage, for a dataset
+ *          whose datatype is a variable-length string or a variable-length
+ *          sequence of a datatype that does not contain variable-length
+ *          data or references. A user-defined fill value is not supported,
+ *          nor is the #H5D_CHUNK_DONT_FILTER_PARTIAL_CHUNKS chunk option.
+ *
+ *          Datasets created with this filter cannot be read by versions of
+ *          the library without it.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pset_vlen_inline(hid_t plist_id);
 
 /* Dataset access property list (DAPL) routines */
 /**
@@ -5734,6 +5768,24 @@ H5_DLL herr_t H5Pset_virtual_view(hid_t dapl_id, H5D_vds_view_t view);
 H5_DLL herr_t H5Pget_btree_ratios(hid_t plist_id, double *left /*out*/, double *middle /*out*/,
                                   double *right /*out*/);
 H5_DLL size_t H5Pget_buffer(hid_t plist_id, void **tconv /*out*/, void **bkg /*out*/);
+/**
+ * \ingroup DXPL
+ *
+ * \brief Retrieves whether reads bypass the data sieve buffer and chunk cache
+ *
+ * \dxpl_id{plist_id}
+ * \param[out] bypass_cache Whether reads bypass the dataset's caches
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_bypass_cache() retrieves the setting made with
+ *          H5Pset_bypass_cache() for the dataset transfer property list
+ *          \p plist_id.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pget_bypass_cache(hid_t plist_id, hbool_t *bypass_cache /*out*/);
 /**
  *
  * \ingroup DXPL
@@ -5774,11 +5826,102 @@ H5_DLL ssize_t   H5Pget_data_transform(hid_t plist_id, char *expression /*out*/,
 H5_DLL H5Z_EDC_t H5Pget_edc_check(hid_t plist_id);
 H5_DLL herr_t    H5Pget_hyper_vector_size(hid_t fapl_id, size_t *size /*out*/);
 H5_DLL int       H5Pget_preserve(hid_t plist_id);
+/**
+ * \ingroup DXPL
+ *
+ * \brief Retrieves whether point selections are sorted into file order
+ *
+ * \dxpl_id{plist_id}
+ * \param[out] sort_points Whether point selections are sorted
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_sort_points() retrieves the setting made with
+ *          H5Pset_sort_points() for the dataset transfer property list
+ *          \p plist_id.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t    H5Pget_sort_points(hid_t plist_id, hbool_t *sort_points /*out*/);
+/**
+ * \ingroup DXPL
+ *
+ * \brief Retrieves whether I/O is overlapped with datatype conversion
+ *
+ * \dxpl_id{plist_id}
+ * \param[out] overlap Whether I/O is overlapped with conversion
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_tconv_overlap() retrieves the setting made with
+ *          H5Pset_tconv_overlap() for the dataset transfer property list
+ *          \p plist_id.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t    H5Pget_tconv_overlap(hid_t plist_id, hbool_t *overlap /*out*/);
 H5_DLL herr_t    H5Pget_type_conv_cb(hid_t dxpl_id, H5T_conv_except_func_t *op, void **operate_data);
+/**
+ * \ingroup DXPL
+ *
+ * \brief Retrieves the number of threads used for datatype conversion
+ *
+ * \dxpl_id{plist_id}
+ * \param[out] nthreads Number of threads
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_type_conv_threads() retrieves the number of threads set
+ *          with H5Pset_type_conv_threads() for the dataset transfer
+ *          property list \p plist_id.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pget_type_conv_threads(hid_t plist_id, unsigned *nthreads /*out*/);
 H5_DLL herr_t    H5Pget_vlen_mem_manager(hid_t plist_id, H5MM_allocate_t *alloc_func, void **alloc_info,
                                          H5MM_free_t *free_func, void **free_info);
 H5_DLL herr_t    H5Pset_btree_ratios(hid_t plist_id, double left, double middle, double right);
 H5_DLL herr_t    H5Pset_buffer(hid_t plist_id, size_t size, void *tconv, void *bkg);
+/**
+ * \ingroup DXPL
+ *
+ * \brief Sets whether reads bypass the data sieve buffer and chunk cache
+ *
+ * \dxpl_id{plist_id}
+ * \param[in] bypass_cache Whether reads bypass the dataset's caches
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_bypass_cache() sets whether a dataset read with the
+ *          dataset transfer property list \p plist_id reads the file
+ *          directly into the application's buffer (or, when datatype
+ *          conversion is needed, the type conversion buffer), instead of
+ *          staging the data in the dataset's data sieve buffer or chunk
+ *          cache and copying it from there.
+ *
+ *          When \p bypass_cache is TRUE, pieces of a contiguous dataset
+ *          that are at least 4 KiB long are read with their own call to
+ *          the file driver (smaller pieces are still combined in the data
+ *          sieve buffer), and chunks that have no filters, aren't already
+ *          in the chunk cache, and can be transferred in one piece (the
+ *          parts of the chunk and of the memory buffer involved are both
+ *          contiguous) are read without being loaded into the cache.  Data
+ *          that has been modified in the data sieve buffer is written to
+ *          the file first, and chunks in the chunk cache are read from the
+ *          cache, so reads always return the current data.
+ *
+ *          This saves a memory copy for large reads, and lets drivers that
+ *          require aligned buffers, such as the direct I/O driver, read
+ *          straight into a suitably aligned application buffer.  Writes
+ *          are not affected.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pset_bypass_cache(hid_t plist_id, hbool_t bypass_cache);
 /**
  * \ingroup DXPL
  *
@@ -5817,7 +5960,109 @@ H5_DLL herr_t H5Pset_edc_check(hid_t plist_id, H5Z_EDC_t check);
 H5_DLL herr_t H5Pset_filter_callback(hid_t plist_id, H5Z_filter_func_t func, void *op_data);
 H5_DLL herr_t H5Pset_hyper_vector_size(hid_t fapl_id, size_t size);
 H5_DLL herr_t H5Pset_preserve(hid_t plist_id, hbool_t status);
+/**
+ * \ingroup DXPL
+ *
+ * \brief Sets whether point selections are sorted into file order
+ *
+ * \dxpl_id{plist_id}
+ * \param[in] sort_points Whether to sort point selections
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_sort_points() sets whether a point selection (made
+ *          with H5Sselect_elements()) in the file dataspace of a dataset
+ *          read or write is put into the order the elements are stored
+ *          in the file before the I/O is performed.
+ *
+ *          Points are normally accessed in the order they were selected,
+ *          so a randomly ordered list of points turns into one small,
+ *          out-of-order file access per point.  When \p sort_points is
+ *          TRUE, the points are sorted by their position in the dataset,
+ *          and the memory selection is reordered the same way, so each
+ *          element is still transferred to (or from) the same place in
+ *          the application's buffer.  Adjacent points then become a
+ *          single file access, and the data sieve buffer is filled only
+ *          once for points that are near each other.
+ *
+ *          Sorting is stable: if the same point is selected more than
+ *          once, a write still leaves the value from the last time it
+ *          appears in the selection.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pset_sort_points(hid_t plist_id, hbool_t sort_points);
+/**
+ * \ingroup DXPL
+ *
+ * \brief Sets whether I/O is overlapped with datatype conversion
+ *
+ * \dxpl_id{plist_id}
+ * \param[in] overlap Whether to overlap I/O with conversion
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_tconv_overlap() sets whether reading or writing a
+ *          selection which must be converted, and which doesn't fit in
+ *          the datatype conversion buffer, overlaps the I/O for one part
+ *          of the selection with the conversion of another.
+ *
+ *          The library normally reads (or gathers from the application's
+ *          buffer) as many elements as fit in the conversion buffer,
+ *          converts them, then scatters them to the application's buffer
+ *          (or writes them to the file), before moving on to the next
+ *          elements.  When \p overlap is TRUE, a second conversion
+ *          buffer, of the size set with H5Pset_buffer(), is allocated and
+ *          the conversion of each part of the selection is performed on a
+ *          worker thread while the next part is read from the file, or
+ *          the previous part is written to it.
+ *
+ *          Only the conversions which H5Pset_type_conv_threads() would
+ *          split across threads (between integer, floating-point,
+ *          bitfield and fixed-length string types, without a conversion
+ *          exception callback set) are overlapped with I/O.  If the
+ *          library was built without worker thread support, the setting
+ *          is ignored.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pset_tconv_overlap(hid_t plist_id, hbool_t overlap);
 H5_DLL herr_t H5Pset_type_conv_cb(hid_t dxpl_id, H5T_conv_except_func_t op, void *operate_data);
+/**
+ * \ingroup DXPL
+ *
+ * \brief Sets the number of threads used for datatype conversion
+ *
+ * \dxpl_id{plist_id}
+ * \param[in] nthreads Number of threads, including the calling thread
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_type_conv_threads() allows the elements of a single
+ *          datatype conversion performed with the dataset transfer
+ *          property list \p plist_id to be split across \p nthreads
+ *          threads.  This can speed up reading or writing large
+ *          selections which need conversion, e.g. from double to float
+ *          or between byte orders, once the data itself is cached.
+ *
+ *          Only conversions between integer, floating-point, bitfield
+ *          and fixed-length string types, whose elements are converted
+ *          independently of each other, are split across threads.  Other
+ *          conversions (compound, variable-length, reference and
+ *          application-defined conversions), small conversions, and all
+ *          conversions when a conversion exception callback is set with
+ *          H5Pset_type_conv_cb() are performed by the calling thread.
+ *
+ *          The default value of 0 (or a value of 1) performs all
+ *          conversions on the calling thread.  If the library was built
+ *          without worker thread support, the setting is ignored.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pset_type_conv_threads(hid_t plist_id, unsigned nthreads);
 H5_DLL herr_t H5Pset_vlen_mem_manager(hid_t plist_id, H5MM_allocate_t alloc_func, void *alloc_info,
                                       H5MM_free_t free_func, void *free_info);
 #ifdef H5_HAVE_PARALLEL
@@ -99,6 +99,13 @@ typedef struct {
     hbool_t  share_selection; /* Whether span trees in dst_space can be shared with proj_space */
 } H5S_hyper_project_intersect_ud_t;
 
+/* Reference to a block in a block list, for H5S__hyper_make_spans_blocks() */
+typedef struct {
+    hsize_t        low;  /* Low bound of block in current dimension */
+    hsize_t        high; /* High bound of block in current dimension */
+    const hsize_t *blk;  /* Block's "start" & "opposite" coordinates */
+} H5S_hyper_blk_ref_t;
+
 /* Assert that H5S_MAX_RANK is <= 32 so our trick with using a 32 bit bitmap
  * (ps_clean_bitmap) works.  If H5S_MAX_RANK increases either increase the size
  * of ps_clean_bitmap or change the algorithm to use an array. */
@@ -115,6 +122,7 @@ static H5S_hyper_span_info_t *H5S__hyper_new_span_info(unsigned rank);
 static H5S_hyper_span_info_t *H5S__hyper_copy_span_helper(H5S_hyper_span_info_t *spans, unsigned rank,
                                                           unsigned op_info_i, uint64_t op_gen);
 static H5S_hyper_span_info_t *H5S__hyper_copy_span(H5S_hyper_span_info_t *spans, unsigned rank);
+static herr_t                 H5S__hyper_unshare_spans(H5S_t *space);
 static hbool_t                H5S__hyper_cmp_spans(const H5S_hyper_span_info_t *span_info1,
                                                    const H5S_hyper_span_info_t *span_info2);
 static void                   H5S__hyper_free_span_info(H5S_hyper_span_info_t *span_info);
@@ -137,6 +145,9 @@ static herr_t  H5S__hyper_add_disjoint_spans(H5S_t *space, H5S_hyper_span_info_t
 static H5S_hyper_span_info_t *H5S__hyper_make_spans(unsigned rank, const hsize_t *start,
                                                     const hsize_t *stride, const hsize_t *count,
                                                     const hsize_t *block);
+static int                   H5S__hyper_blk_ref_cmp(const void *_ref1, const void *_ref2);
+static H5S_hyper_span_info_t *H5S__hyper_make_spans_blocks(unsigned rank, unsigned dim, size_t nblocks,
+                                                           H5S_hyper_blk_ref_t *refs);
 static herr_t                 H5S__hyper_update_diminfo(H5S_t *space, H5S_seloper_t op,
                                                         const H5S_hyper_dim_t *new_hyper_diminfo);
 static herr_t                 H5S__hyper_generate_spans(H5S_t *space);
@@ -153,12 +164,20 @@ static herr_t  H5S__set_regular_hyperslab(H5S_t *space, const hsize_t start[], c
                                           const hsize_t *opt_block);
 static herr_t  H5S__fill_in_select(H5S_t *space1, H5S_seloper_t op, H5S_t *space2, H5S_t **result);
 static H5S_t * H5S__combine_select(H5S_t *space1, H5S_seloper_t op, H5S_t *space2);
+static herr_t  H5S__select_hyper_blocklist(H5S_t *space, H5S_seloper_t op, size_t num_blocks,
+                                           const hsize_t *block_list);
 static herr_t  H5S__hyper_iter_get_seq_list_gen(H5S_sel_iter_t *iter, size_t maxseq, size_t maxelem,
                                                 size_t *nseq, size_t *nelem, hsize_t *off, size_t *len);
 static herr_t  H5S__hyper_iter_get_seq_list_opt(H5S_sel_iter_t *iter, size_t maxseq, size_t maxelem,
                                                 size_t *nseq, size_t *nelem, hsize_t *off, size_t *len);
 static herr_t  H5S__hyper_iter_get_seq_list_single(H5S_sel_iter_t *iter, size_t maxseq, size_t maxelem,
                                                    size_t *nseq, size_t *nelem, hsize_t *off, size_t *len);
+static herr_t  H5S__hyper_iter_get_seq_list_cache(H5S_sel_iter_t *iter, size_t maxseq, size_t maxelem,
+                                                  size_t *nseq, size_t *nelem, hsize_t *off, size_t *len);
+static herr_t  H5S__hyper_iter_seq_cache_attach(H5S_sel_iter_t *iter);
+static void    H5S__hyper_iter_seq_cache_detach(H5S_sel_iter_t *iter);
+static void    H5S__hyper_free_seq_cache_list(H5S_hyper_seq_cache_t *cache);
+static void    H5S__hyper_adjust_seq_cache(H5S_hyper_seq_cache_t *cache, const hssize_t *offset);
 static herr_t  H5S__hyper_proj_int_build_proj(H5S_hyper_project_intersect_ud_t *udata);
 static herr_t  H5S__hyper_proj_int_iterate(const H5S_hyper_span_info_t *ss_span_info,
                                            const H5S_hyper_span_info_t *sis_span_info, hsize_t count,
@@ -280,6 +299,9 @@ H5FL_DEFINE_STATIC(H5S_hyper_span_t);
 /* Declare a free list to manage the H5S_hyper_span_info_t + hsize_t array struct */
 H5FL_BARR_DEFINE_STATIC(H5S_hyper_span_info_t, hbounds_t, H5S_MAX_RANK * 2);
 
+/* Declare a free list to manage the H5S_hyper_seq_cache_t struct */
+H5FL_DEFINE_STATIC(H5S_hyper_seq_cache_t);
+
 /* Declare extern free list to manage the H5S_sel_iter_t struct */
 H5FL_EXTERN(H5S_sel_iter_t);
 
@@ -561,15 +583,14 @@ H5S__hyper_get_op_gen(void)
 static herr_t
 H5S__hyper_iter_init(const H5S_t *space, H5S_sel_iter_t *iter)
 {
-    hsize_t *slab_size;           /* Pointer to the dataspace dimensions to use for calc. slab */
-    hsize_t  acc;                 /* Accumulator for computing cumulative sizes */
-    unsigned slab_dim;            /* Rank of the fastest changing dimension for calc. slab */
-    unsigned rank;                /* Dataspace's dimension rank */
-    unsigned u;                   /* Index variable */
-    int      i;                   /* Index variable */
-    herr_t   ret_value = SUCCEED; /* return value */
+    hsize_t *slab_size; /* Pointer to the dataspace dimensions to use for calc. slab */
+    hsize_t  acc;       /* Accumulator for computing cumulative sizes */
+    unsigned slab_dim;  /* Rank of the fastest changing dimension for calc. slab */
+    unsigned rank;      /* Dataspace's dimension rank */
+    unsigned u;         /* Index variable */
+    int      i;         /* Index variable */
 
-    FUNC_ENTER_STATIC
+    FUNC_ENTER_STATIC_NOERR
 
     /* Check args */
     HDassert(space && H5S_SEL_HYPERSLABS == H5S_GET_SELECT_TYPE(space));
@@ -708,32 +729,22 @@ H5S__hyper_iter_init(const H5S_t *space, H5S_sel_iter_t *iter)
         iter->u.hyp.diminfo_valid = TRUE;
 
         /* Initialize irregular region information also (for release) */
-        iter->u.hyp.spans = NULL;
+        iter->u.hyp.spans     = NULL;
+        iter->u.hyp.seq_cache = NULL;
     }                                 /* end if */
     else {                            /* Initialize the information needed for non-regular hyperslab I/O */
         H5S_hyper_span_info_t *spans; /* Pointer to hyperslab span info node */
 
-        /* If this iterator is created from an API call, by default we clone the
-         *  selection now, as the dataspace could be modified or go out of scope.
-         *
-         *  However, if the H5S_SEL_ITER_SHARE_WITH_DATASPACE flag is given,
-         *  the selection is shared between the selection iterator and the
-         *  dataspace.  In this case, the application _must_not_ modify or
-         *  close the dataspace that the iterator is operating on, or undefined
-         *  behavior will occur.
+        /* Share the source dataspace's span tree by incrementing the reference count on it */
+        /* (Even if this iterator is created from an API call without the
+         *  H5S_SEL_ITER_SHARE_WITH_DATASPACE flag, the dataspace can be
+         *  modified or closed afterwards: a new selection replaces the span
+         *  tree instead of changing it, and H5S__hyper_unshare_spans gives the
+         *  dataspace its own copy before the tree is modified in place)
          */
-        if ((iter->flags & H5S_SEL_ITER_API_CALL) && !(iter->flags & H5S_SEL_ITER_SHARE_WITH_DATASPACE)) {
-            /* Copy the span tree */
-            if (NULL == (iter->u.hyp.spans = H5S__hyper_copy_span(space->select.sel_info.hslab->span_lst,
-                                                                  space->extent.rank)))
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "can't copy span tree")
-        } /* end if */
-        else {
-            /* Share the source dataspace's span tree by incrementing the reference count on it */
-            HDassert(space->select.sel_info.hslab->span_lst);
-            iter->u.hyp.spans = space->select.sel_info.hslab->span_lst;
-            iter->u.hyp.spans->count++;
-        } /* end else */
+        HDassert(space->select.sel_info.hslab->span_lst);
+        iter->u.hyp.spans = space->select.sel_info.hslab->span_lst;
+        iter->u.hyp.spans->count++;
 
         /* Initialize the starting span_info's and spans */
         spans = iter->u.hyp.spans;
@@ -758,6 +769,16 @@ H5S__hyper_iter_init(const H5S_t *space, H5S_sel_iter_t *iter)
 
         /* Flag the diminfo information as not valid in the iterator */
         iter->u.hyp.diminfo_valid = FALSE;
+
+        /* The span tree's cached sequence lists are looked up when the first
+         * sequence list is retrieved, unless the iterator is only used to walk
+         * coordinates.
+         */
+        iter->u.hyp.seq_cache       = NULL;
+        iter->u.hyp.seq_idx         = 0;
+        iter->u.hyp.seq_used        = 0;
+        iter->u.hyp.seq_bias        = 0;
+        iter->u.hyp.seq_cache_tried = (hbool_t)(iter->elmt_size == 0);
     } /* end else */
 
     /* Compute the cumulative size of dataspace dimensions */
@@ -778,8 +799,7 @@ H5S__hyper_iter_init(const H5S_t *space, H5S_sel_iter_t *iter)
     /* Initialize type of selection iterator */
     iter->type = H5S_sel_iter_hyper;
 
-done:
-    FUNC_LEAVE_NOAPI(ret_value)
+    FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5S__hyper_iter_init() */
 
 /*-------------------------------------------------------------------------
@@ -804,6 +824,10 @@ H5S__hyper_iter_coords(const H5S_sel_iter_t *iter, hsize_t *coords)
     HDassert(iter);
     HDassert(coords);
 
+    /* Move off of the cached sequence list, if the iterator is using one */
+    if (iter->u.hyp.seq_cache)
+        H5S__hyper_iter_seq_cache_detach((H5S_sel_iter_t *)iter); /* Casting away const OK */
+
     /* Copy the offset of the current point */
 
     /* Check for a single "regular" hyperslab */
@@ -895,6 +919,10 @@ H5S__hyper_iter_block(const H5S_sel_iter_t *iter, hsize_t *start, hsize_t *end)
     HDassert(start);
     HDassert(end);
 
+    /* Move off of the cached sequence list, if the iterator is using one */
+    if (iter->u.hyp.seq_cache)
+        H5S__hyper_iter_seq_cache_detach((H5S_sel_iter_t *)iter); /* Casting away const OK */
+
     /* Copy the offset of the current point */
 
     /* Check for a single "regular" hyperslab */
@@ -956,7 +984,7 @@ H5S__hyper_iter_nelmts(const H5S_sel_iter_t *iter)
  EXAMPLES
  REVISION LOG
 --------------------------------------------------------------------------*/
-static H5_ATTR_PURE htri_t
+static htri_t
 H5S__hyper_iter_has_next_block(const H5S_sel_iter_t *iter)
 {
     unsigned u;                 /* Local index variable */
@@ -967,6 +995,10 @@ H5S__hyper_iter_has_next_block(const H5S_sel_iter_t *iter)
     /* Check args */
     HDassert(iter);
 
+    /* Move off of the cached sequence list, if the iterator is using one */
+    if (iter->u.hyp.seq_cache)
+        H5S__hyper_iter_seq_cache_detach((H5S_sel_iter_t *)iter); /* Casting away const OK */
+
     /* Check for a single "regular" hyperslab */
     if (iter->u.hyp.diminfo_valid) {
         const H5S_hyper_dim_t *tdiminfo; /* Temporary pointer to diminfo information */
@@ -1017,6 +1049,13 @@ H5S__hyper_iter_next(H5S_sel_iter_t *iter, size_t nelem)
 
     FUNC_ENTER_STATIC_NOERR
 
+    /* Move off of the cached sequence list, if the iterator is using one */
+    if (iter->u.hyp.seq_cache)
+        H5S__hyper_iter_seq_cache_detach(iter);
+
+    /* The iterator can't start using a cached sequence list after it's moved */
+    iter->u.hyp.seq_cache_tried = TRUE;
+
     /* Check for the special case of just one H5Sselect_hyperslab call made */
     /* (i.e. a regular hyperslab selection */
     if (iter->u.hyp.diminfo_valid) {
@@ -1226,6 +1265,13 @@ H5S__hyper_iter_next_block(H5S_sel_iter_t *iter)
 
     FUNC_ENTER_STATIC_NOERR
 
+    /* Move off of the cached sequence list, if the iterator is using one */
+    if (iter->u.hyp.seq_cache)
+        H5S__hyper_iter_seq_cache_detach(iter);
+
+    /* The iterator can't start using a cached sequence list after it's moved */
+    iter->u.hyp.seq_cache_tried = TRUE;
+
     /* Check for the special case of just one H5Sselect_hyperslab call made */
     /* (i.e. a regular hyperslab selection) */
     if (iter->u.hyp.diminfo_valid) {
@@ -2569,6 +2615,321 @@ H5S__hyper_iter_get_seq_list_single(H5S_sel_iter_t *iter, size_t maxseq, size_t
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5S__hyper_iter_get_seq_list_single() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5S__hyper_iter_seq_cache_attach
+ *
+ * Purpose:     Look up the sequence list cached on an irregular hyperslab
+ *              selection's span tree for the iterator's element size and
+ *              dataspace extent, generating and caching it if it isn't
+ *              there yet, and start the iterator using it.
+ *
+ *              The iterator is left walking the span tree if the selection
+ *              generates too many sequences to cache, or if both of the
+ *              span tree's cached sequence lists are being used by other
+ *              iterators.
+ *
+ * Note:        Must be called before the iterator has moved.
+ *
+ * Return:      Non-negative on success, negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5S__hyper_iter_seq_cache_attach(H5S_sel_iter_t *iter)
+{
+    H5S_hyper_span_info_t *spans;                 /* Span tree for the selection */
+    H5S_hyper_seq_cache_t *cache       = NULL;    /* Cached sequence list */
+    H5S_hyper_seq_cache_t *new_cache   = NULL;    /* Newly generated sequence list */
+    H5S_hyper_seq_cache_t *victim      = NULL;    /* Unused sequence list to evict */
+    H5S_hyper_seq_cache_t *victim_prev = NULL;    /* Sequence list before the one to evict */
+    H5S_hyper_seq_cache_t *prev        = NULL;    /* Previous sequence list in the span tree's list */
+    hssize_t               sel_bias    = 0;       /* Byte offset of the iterator's selection offset */
+    unsigned               nentries    = 0;       /* # of sequence lists cached on the span tree */
+    unsigned               u;                     /* Local index variable */
+    herr_t                 ret_value   = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(iter);
+    HDassert(!iter->u.hyp.diminfo_valid);
+    HDassert(iter->u.hyp.spans);
+    HDassert(iter->elmt_size > 0);
+    HDassert(NULL == iter->u.hyp.seq_cache);
+
+    /* Only look for a cached sequence list once */
+    iter->u.hyp.seq_cache_tried = TRUE;
+
+    /* Compute the byte offset of the iterator's selection offset */
+    for (u = 0; u < iter->rank; u++)
+        sel_bias += iter->sel_off[u] * (hssize_t)iter->u.hyp.slab[u];
+
+    /* Look for a sequence list generated for the same element size & extent */
+    spans = iter->u.hyp.spans;
+    for (cache = spans->seq_cache; cache; prev = cache, cache = cache->next) {
+        if (cache->elmt_size == iter->elmt_size && cache->rank == iter->rank &&
+            0 == HDmemcmp(cache->slab, iter->u.hyp.slab, iter->rank * sizeof(hsize_t)))
+            break;
+
+        /* Remember the last unused sequence list, in case one must be evicted */
+        if (0 == cache->rc) {
+            victim      = cache;
+            victim_prev = prev;
+        } /* end if */
+        nentries++;
+    } /* end for */
+
+    /* Generate the sequence list, if it's not cached yet */
+    if (NULL == cache) {
+        H5S_sel_iter_t gen_iter;   /* Copy of iterator, for generating sequences */
+        size_t         nalloc = 0; /* # of sequences allocated */
+
+        /* Make room for the new sequence list, if there's one to evict */
+        if (nentries >= H5S_HYPER_SEQ_CACHE_MAX_ENTRIES) {
+            if (NULL == victim)
+                HGOTO_DONE(SUCCEED)
+            if (victim_prev)
+                victim_prev->next = victim->next;
+            else
+                spans->seq_cache = victim->next;
+            victim->next = NULL;
+            H5S__hyper_free_seq_cache_list(victim);
+        } /* end if */
+
+        /* Allocate the new sequence list */
+        if (NULL == (new_cache = H5FL_CALLOC(H5S_hyper_seq_cache_t)))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate cached sequence list")
+        new_cache->elmt_size = iter->elmt_size;
+        new_cache->rank      = iter->rank;
+        H5MM_memcpy(new_cache->slab, iter->u.hyp.slab, iter->rank * sizeof(hsize_t));
+        new_cache->bias = -sel_bias;
+
+        /* Walk the span tree with a copy of the iterator, storing the sequences */
+        H5MM_memcpy(&gen_iter, iter, sizeof(gen_iter));
+        while (gen_iter.elmt_left > 0) {
+            size_t nseq;  /* # of sequences generated */
+            size_t nelem; /* # of elements in sequences generated */
+            size_t first; /* Index of first sequence generated */
+
+            /* Make room for more sequences */
+            if (new_cache->nseq == nalloc) {
+                hsize_t *new_off; /* Reallocated array of offsets */
+                size_t * new_len; /* Reallocated array of lengths */
+
+                /* Give up on caching selections that generate too many sequences */
+                if (nalloc >= H5S_HYPER_SEQ_CACHE_MAX_NSEQ) {
+                    new_cache->off      = (hsize_t *)H5MM_xfree(new_cache->off);
+                    new_cache->len      = (size_t *)H5MM_xfree(new_cache->len);
+                    new_cache->nseq     = 0;
+                    new_cache->too_many = TRUE;
+                    break;
+                } /* end if */
+
+                nalloc = nalloc ? nalloc * 2 : H5S_PROJECT_INTERSECT_NSEQS;
+                if (NULL == (new_off = (hsize_t *)H5MM_realloc(new_cache->off, nalloc * sizeof(hsize_t))))
+                    HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate sequence offsets")
+                new_cache->off = new_off;
+                if (NULL == (new_len = (size_t *)H5MM_realloc(new_cache->len, nalloc * sizeof(size_t))))
+                    HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate sequence lengths")
+                new_cache->len = new_len;
+            } /* end if */
+
+            /* Generate the next sequences */
+            first = new_cache->nseq;
+            if (H5S__hyper_iter_get_seq_list_gen(&gen_iter, nalloc - first, (size_t)-1, &nseq, &nelem,
+                                                 new_cache->off + first, new_cache->len + first) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "sequence length generation failed")
+            new_cache->nseq += nseq;
+
+            /* Merge the first new sequence with the last one from before, if they're adjacent */
+            if (first > 0 && nseq > 0 &&
+                new_cache->off[first - 1] + new_cache->len[first - 1] == new_cache->off[first]) {
+                new_cache->len[first - 1] += new_cache->len[first];
+                HDmemmove(new_cache->off + first, new_cache->off + first + 1, (nseq - 1) * sizeof(hsize_t));
+                HDmemmove(new_cache->len + first, new_cache->len + first + 1, (nseq - 1) * sizeof(size_t));
+                new_cache->nseq--;
+            } /* end if */
+        }     /* end while */
+
+        /* Add the new sequence list to the span tree */
+        new_cache->next  = spans->seq_cache;
+        spans->seq_cache = new_cache;
+        cache            = new_cache;
+        new_cache        = NULL;
+    } /* end if */
+
+    /* Start using the cached sequence list */
+    if (!cache->too_many) {
+        cache->rc++;
+        iter->u.hyp.seq_cache = cache;
+        iter->u.hyp.seq_idx   = 0;
+        iter->u.hyp.seq_used  = 0;
+        iter->u.hyp.seq_bias  = cache->bias + sel_bias;
+    } /* end if */
+
+done:
+    if (new_cache)
+        H5S__hyper_free_seq_cache_list(new_cache);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_iter_seq_cache_attach() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5S__hyper_iter_seq_cache_detach
+ *
+ * Purpose:     Stop an iterator from using a cached sequence list, moving
+ *              its position in the span tree to the next element that the
+ *              cached sequence list would have returned.
+ *
+ * Return:      <none>
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5S__hyper_iter_seq_cache_detach(H5S_sel_iter_t *iter)
+{
+    H5S_hyper_seq_cache_t *cache; /* Cached sequence list */
+    hsize_t                nused; /* # of elements used from the cached sequence list */
+    size_t                 u;     /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Check args */
+    HDassert(iter);
+    HDassert(iter->u.hyp.seq_cache);
+
+    /* Count the elements used from the cached sequence list */
+    cache = iter->u.hyp.seq_cache;
+    for (u = 0, nused = 0; u < iter->u.hyp.seq_idx; u++)
+        nused += cache->len[u] / iter->elmt_size;
+    nused += iter->u.hyp.seq_used / iter->elmt_size;
+
+    /* Stop using the cached sequence list */
+    HDassert(cache->rc > 0);
+    cache->rc--;
+    iter->u.hyp.seq_cache = NULL;
+
+    /* Advance the span tree position (still at the start of the selection) past those elements */
+    if (nused > 0 && iter->elmt_left > 0) {
+        H5_CHECK_OVERFLOW(nused, hsize_t, size_t);
+        H5S__hyper_iter_next(iter, (size_t)nused);
+
+        /* Reset the byte offsets for the new position */
+        for (u = 0; u < iter->rank; u++)
+            iter->u.hyp.loc_off[u] =
+                ((hsize_t)((hssize_t)iter->u.hyp.off[u] + iter->sel_off[u])) * iter->u.hyp.slab[u];
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5S__hyper_iter_seq_cache_detach() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_iter_get_seq_list_cache
+ PURPOSE
+    Create a list of offsets & lengths for a selection, from the cached
+    sequence list for the selection's span tree
+ USAGE
+    herr_t H5S__hyper_iter_get_seq_list_cache(iter,maxseq,maxelem,nseq,nelem,off,len)
+        H5S_sel_iter_t *iter;   IN/OUT: Selection iterator describing last
+                                    position of interest in selection.
+        size_t maxseq;          IN: Maximum number of sequences to generate
+        size_t maxelem;         IN: Maximum number of elements to include in the
+                                    generated sequences
+        size_t *nseq;           OUT: Actual number of sequences generated
+        size_t *nelem;          OUT: Actual number of elements in sequences generated
+        hsize_t *off;           OUT: Array of offsets
+        size_t *len;            OUT: Array of lengths
+ RETURNS
+    Non-negative on success/Negative on failure.
+ DESCRIPTION
+    Copy the sequences for the selection from the cached sequence list,
+    adjusting the offsets for the selection offset.  Start/Restart from the
+    position in the ITER parameter.  The number of sequences generated is
+    limited by the MAXSEQ parameter and the number of sequences actually
+    generated is stored in the NSEQ parameter.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static herr_t
+H5S__hyper_iter_get_seq_list_cache(H5S_sel_iter_t *iter, size_t maxseq, size_t maxelem, size_t *nseq,
+                                   size_t *nelem, hsize_t *off, size_t *len)
+{
+    const H5S_hyper_seq_cache_t *cache;         /* Cached sequence list */
+    hsize_t                      bias;          /* Byte adjustment to cached offsets */
+    size_t                       elem_size;     /* Size of each element iterating over */
+    size_t                       seq_idx;       /* Index of current cached sequence */
+    size_t                       seq_used;      /* # of bytes used from current cached sequence */
+    size_t                       io_left;       /* Initial number of elements to process */
+    size_t                       io_elmts_left; /* Number of elements left to process */
+    size_t                       curr_seq = 0;  /* Number of sequence/offsets stored in the arrays */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Check args */
+    HDassert(iter);
+    HDassert(iter->u.hyp.seq_cache);
+    HDassert(maxseq > 0);
+    HDassert(maxelem > 0);
+    HDassert(nseq);
+    HDassert(nelem);
+    HDassert(off);
+    HDassert(len);
+
+    /* Set up local variables */
+    cache     = iter->u.hyp.seq_cache;
+    bias      = (hsize_t)iter->u.hyp.seq_bias;
+    elem_size = iter->elmt_size;
+    seq_idx   = iter->u.hyp.seq_idx;
+    seq_used  = iter->u.hyp.seq_used;
+
+    /* Set the amount of elements to perform I/O on, etc. */
+    H5_CHECK_OVERFLOW(iter->elmt_left, hsize_t, size_t);
+    io_elmts_left = io_left = MIN(maxelem, (size_t)iter->elmt_left);
+
+    /* Copy sequences until the element or sequence limit is reached */
+    while (io_elmts_left > 0 && curr_seq < maxseq) {
+        size_t seq_elmts; /* # of elements left in the cached sequence */
+        size_t use_elmts; /* # of elements to use from the cached sequence */
+
+        HDassert(seq_idx < cache->nseq);
+
+        /* Compute the elements to use from the current sequence */
+        seq_elmts = (cache->len[seq_idx] - seq_used) / elem_size;
+        use_elmts = MIN(seq_elmts, io_elmts_left);
+
+        /* Add the sequence */
+        off[curr_seq] = cache->off[seq_idx] + seq_used + bias;
+        len[curr_seq] = use_elmts * elem_size;
+        curr_seq++;
+
+        /* Advance to the next cached sequence, if this one is used up */
+        if (use_elmts == seq_elmts) {
+            seq_idx++;
+            seq_used = 0;
+        } /* end if */
+        else
+            seq_used += use_elmts * elem_size;
+
+        io_elmts_left -= use_elmts;
+    } /* end while */
+
+    /* Save the position in the cached sequence list */
+    iter->u.hyp.seq_idx  = seq_idx;
+    iter->u.hyp.seq_used = seq_used;
+
+    /* Decrement number of elements left in iterator */
+    iter->elmt_left -= (io_left - io_elmts_left);
+
+    /* Set the number of sequences generated and elements used */
+    *nseq  = curr_seq;
+    *nelem = io_left - io_elmts_left;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5S__hyper_iter_get_seq_list_cache() */
+
 /*--------------------------------------------------------------------------
  NAME
     H5S__hyper_iter_get_seq_list
@@ -2605,7 +2966,7 @@ H5S__hyper_iter_get_seq_list(H5S_sel_iter_t *iter, size_t maxseq, size_t maxelem
 {
     herr_t ret_value = FAIL; /* return value */
 
-    FUNC_ENTER_STATIC_NOERR
+    FUNC_ENTER_STATIC
 
     /* Check args */
     HDassert(iter);
@@ -2705,7 +3066,7 @@ H5S__hyper_iter_get_seq_list(H5S_sel_iter_t *iter, size_t maxseq, size_t maxelem
 
             /* Check for using up all the sequences/elements */
             if (0 == iter->elmt_left || 0 == maxelem || 0 == maxseq)
-                return (SUCCEED);
+                HGOTO_DONE(SUCCEED);
         } /* end if */
         else {
             /* Reset the number of sequences generated and elements used */
@@ -2729,10 +3090,21 @@ H5S__hyper_iter_get_seq_list(H5S_sel_iter_t *iter, size_t maxseq, size_t maxelem
             /* Use optimized call to generate sequence list */
             ret_value = H5S__hyper_iter_get_seq_list_opt(iter, maxseq, maxelem, nseq, nelem, off, len);
     } /* end if */
-    else
-        /* Call the general sequence generator routine */
-        ret_value = H5S__hyper_iter_get_seq_list_gen(iter, maxseq, maxelem, nseq, nelem, off, len);
+    else {
+        /* Look for a sequence list cached on the span tree, on first use */
+        if (!iter->u.hyp.seq_cache_tried)
+            if (H5S__hyper_iter_seq_cache_attach(iter) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't look up cached sequence list")
+
+        if (iter->u.hyp.seq_cache)
+            /* Copy the sequences from the cached sequence list */
+            ret_value = H5S__hyper_iter_get_seq_list_cache(iter, maxseq, maxelem, nseq, nelem, off, len);
+        else
+            /* Call the general sequence generator routine */
+            ret_value = H5S__hyper_iter_get_seq_list_gen(iter, maxseq, maxelem, nseq, nelem, off, len);
+    } /* end else */
 
+done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5S__hyper_iter_get_seq_list() */
 
@@ -2761,6 +3133,12 @@ H5S__hyper_iter_release(H5S_sel_iter_t *iter)
     /* Check args */
     HDassert(iter);
 
+    /* Stop using the span tree's cached sequence list */
+    if (iter->u.hyp.seq_cache != NULL) {
+        HDassert(iter->u.hyp.seq_cache->rc > 0);
+        iter->u.hyp.seq_cache->rc--;
+    } /* end if */
+
     /* Free the copy of the hyperslab selection span tree */
     if (iter->u.hyp.spans != NULL)
         H5S__hyper_free_span_info(iter->u.hyp.spans);
@@ -2994,6 +3372,57 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5S__hyper_copy_span() */
 
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_unshare_spans
+ PURPOSE
+    Make certain a dataspace's span tree isn't shared, before changing it
+ USAGE
+    herr_t H5S__hyper_unshare_spans(space)
+        H5S_t *space;           IN/OUT: Dataspace with span tree to modify
+ RETURNS
+    Non-negative on success, negative on failure
+ DESCRIPTION
+    Copies of a hyperslab selection (and selection iterators) share the
+    span tree of the selection they were made from, by incrementing its
+    reference count.  Before the few operations that modify a span tree in
+    place, the dataspace being modified gets its own copy of the tree if
+    anything else still refers to it.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static herr_t
+H5S__hyper_unshare_spans(H5S_t *space)
+{
+    H5S_hyper_span_info_t *spans;               /* Span tree for the selection */
+    herr_t                 ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(space);
+    HDassert(space->select.sel_info.hslab);
+    HDassert(space->select.sel_info.hslab->span_lst);
+
+    /* Copy the span tree, if it's shared */
+    spans = space->select.sel_info.hslab->span_lst;
+    if (spans->count > 1) {
+        H5S_hyper_span_info_t *new_spans; /* Private copy of the span tree */
+
+        if (NULL == (new_spans = H5S__hyper_copy_span(spans, space->extent.rank)))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "can't copy hyperslab span tree")
+
+        /* Drop this dataspace's reference to the shared span tree */
+        H5S__hyper_free_span_info(spans);
+        space->select.sel_info.hslab->span_lst = new_spans;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_unshare_spans() */
+
 /*--------------------------------------------------------------------------
  NAME
     H5S__hyper_cmp_spans
@@ -3137,6 +3566,10 @@ H5S__hyper_free_span_info(H5S_hyper_span_info_t *span_info)
             span = next_span;
         } /* end while */
 
+        /* Free any sequence lists generated from this span tree */
+        if (span_info->seq_cache)
+            H5S__hyper_free_seq_cache_list(span_info->seq_cache);
+
         /* Free this span info */
         span_info = (H5S_hyper_span_info_t *)H5FL_ARR_FREE(hbounds_t, span_info);
     } /* end if */
@@ -3144,6 +3577,37 @@ H5S__hyper_free_span_info(H5S_hyper_span_info_t *span_info)
     FUNC_LEAVE_NOAPI_VOID
 } /* end H5S__hyper_free_span_info() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5S__hyper_free_seq_cache_list
+ *
+ * Purpose:     Free a list of sequence lists cached on a span tree
+ *
+ * Return:      <none>
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5S__hyper_free_seq_cache_list(H5S_hyper_seq_cache_t *cache)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    while (cache) {
+        H5S_hyper_seq_cache_t *next = cache->next; /* Next sequence list */
+
+        /* Sanity check */
+        HDassert(0 == cache->rc);
+
+        /* Free the sequence list */
+        H5MM_xfree(cache->off);
+        H5MM_xfree(cache->len);
+        cache = H5FL_FREE(H5S_hyper_seq_cache_t, cache);
+
+        cache = next;
+    } /* end while */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5S__hyper_free_seq_cache_list() */
+
 /*--------------------------------------------------------------------------
  NAME
     H5S__hyper_free_span
@@ -3197,17 +3661,21 @@ H5S__hyper_free_span(H5S_hyper_span_t *span)
     Copies all the hyperslab selection information from the source
     dataspace to the destination dataspace.
 
-    If the SHARE_SELECTION flag is set, then the selection can be shared
-    between the source and destination dataspaces.  (This should only occur in
-    situations where the destination dataspace will immediately change to a new
-    selection)
+    The span tree of an irregular selection is always shared between the
+    source and destination dataspaces, by incrementing its reference count.
+    Span trees are treated as read-only once they are attached to a
+    dataspace: operations which change the selection build a new tree, and
+    the few which modify a tree in place make a private copy first if it is
+    shared (see H5S__hyper_unshare_spans).  The SHARE_SELECTION flag is
+    therefore only a hint that the destination dataspace will immediately
+    change to a new selection.
  GLOBAL VARIABLES
  COMMENTS, BUGS, ASSUMPTIONS
  EXAMPLES
  REVISION LOG
 --------------------------------------------------------------------------*/
 static herr_t
-H5S__hyper_copy(H5S_t *dst, const H5S_t *src, hbool_t share_selection)
+H5S__hyper_copy(H5S_t *dst, const H5S_t *src, hbool_t H5_ATTR_UNUSED share_selection)
 {
     H5S_hyper_sel_t *      dst_hslab;           /* Pointer to destination hyperslab info */
     const H5S_hyper_sel_t *src_hslab;           /* Pointer to source hyperslab info */
@@ -3235,15 +3703,10 @@ H5S__hyper_copy(H5S_t *dst, const H5S_t *src, hbool_t share_selection)
     /* Check if there is hyperslab span information to copy */
     /* (Regular hyperslab information is copied with the selection structure) */
     if (src->select.sel_info.hslab->span_lst != NULL) {
-        if (share_selection) {
-            /* Share the source's span tree by incrementing the reference count on it */
-            dst->select.sel_info.hslab->span_lst = src->select.sel_info.hslab->span_lst;
-            dst->select.sel_info.hslab->span_lst->count++;
-        } /* end if */
-        else
-            /* Copy the hyperslab span information */
-            dst->select.sel_info.hslab->span_lst =
-                H5S__hyper_copy_span(src->select.sel_info.hslab->span_lst, src->extent.rank);
+        /* Share the source's span tree by incrementing the reference count on it */
+        /* (Whether or not the selection is to be shared, it's copied on write) */
+        dst->select.sel_info.hslab->span_lst = src->select.sel_info.hslab->span_lst;
+        dst->select.sel_info.hslab->span_lst->count++;
     } /* end if */
     else
         dst->select.sel_info.hslab->span_lst = NULL;
@@ -4368,14 +4831,10 @@ H5S__hyper_deserialize(H5S_t **space, const uint8_t **p)
             HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSET, FAIL, "can't change selection")
     } /* end if */
     else {
-        const hsize_t *stride;            /* Hyperslab stride information */
-        const hsize_t *count;             /* Hyperslab count information */
-        hsize_t        end[H5S_MAX_RANK]; /* Hyperslab end information */
-        hsize_t *      tstart;            /* Temporary hyperslab pointers */
-        hsize_t *      tend;              /* Temporary hyperslab pointers */
-        hsize_t *      tblock;            /* Temporary hyperslab pointers */
-        size_t         num_elem;          /* Number of elements in selection */
-        unsigned       v;                 /* Local counting variable */
+        hsize_t *block_list = NULL; /* List of blocks in selection */
+        hsize_t *tblock;            /* Temporary hyperslab pointer */
+        size_t   num_elem;          /* Number of elements in selection */
+        size_t   v;                 /* Local counting variable */
 
         /* Decode the number of blocks */
         switch (enc_size) {
@@ -4396,49 +4855,42 @@ H5S__hyper_deserialize(H5S_t **space, const uint8_t **p)
                 break;
         } /* end switch */
 
-        /* Set the count & stride for all blocks */
-        stride = count = H5S_hyper_ones_g;
-
-        /* Retrieve the coordinates from the buffer */
-        for (u = 0; u < num_elem; u++) {
-            /* Decode the starting and ending points */
-            switch (enc_size) {
-                case H5S_SELECT_INFO_ENC_SIZE_2:
-                    for (tstart = start, v = 0; v < rank; v++, tstart++)
-                        UINT16DECODE(pp, *tstart);
-                    for (tend = end, v = 0; v < rank; v++, tend++)
-                        UINT16DECODE(pp, *tend);
-                    break;
+        /* Allocate space for the list of blocks */
+        if (num_elem > ((size_t)-1 / (2 * rank * sizeof(hsize_t))))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "too many blocks in hyperslab selection")
+        if (num_elem > 0 &&
+            NULL == (block_list = (hsize_t *)H5MM_malloc(num_elem * 2 * rank * sizeof(hsize_t))))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate hyperslab block list")
 
-                case H5S_SELECT_INFO_ENC_SIZE_4:
-                    for (tstart = start, v = 0; v < rank; v++, tstart++)
-                        UINT32DECODE(pp, *tstart);
-                    for (tend = end, v = 0; v < rank; v++, tend++)
-                        UINT32DECODE(pp, *tend);
-                    break;
+        /* Retrieve the starting and ending points of the blocks from the buffer */
+        tblock = block_list;
+        switch (enc_size) {
+            case H5S_SELECT_INFO_ENC_SIZE_2:
+                for (v = 0; v < num_elem * 2 * rank; v++, tblock++)
+                    UINT16DECODE(pp, *tblock);
+                break;
 
-                case H5S_SELECT_INFO_ENC_SIZE_8:
-                    for (tstart = start, v = 0; v < rank; v++, tstart++)
-                        UINT64DECODE(pp, *tstart);
-                    for (tend = end, v = 0; v < rank; v++, tend++)
-                        UINT64DECODE(pp, *tend);
-                    break;
+            case H5S_SELECT_INFO_ENC_SIZE_4:
+                for (v = 0; v < num_elem * 2 * rank; v++, tblock++)
+                    UINT32DECODE(pp, *tblock);
+                break;
 
-                default:
-                    HGOTO_ERROR(H5E_DATASPACE, H5E_UNSUPPORTED, FAIL,
-                                "unknown offset info size for hyperslab")
-                    break;
-            } /* end switch */
+            case H5S_SELECT_INFO_ENC_SIZE_8:
+                for (v = 0; v < num_elem * 2 * rank; v++, tblock++)
+                    UINT64DECODE(pp, *tblock);
+                break;
 
-            /* Change the ending points into blocks */
-            for (tblock = block, tstart = start, tend = end, v = 0; v < rank; v++, tstart++, tend++, tblock++)
-                *tblock = (*tend - *tstart) + 1;
+            default:
+                H5MM_xfree(block_list);
+                HGOTO_ERROR(H5E_DATASPACE, H5E_UNSUPPORTED, FAIL, "unknown offset info size for hyperslab")
+                break;
+        } /* end switch */
 
-            /* Select or add the hyperslab to the current selection */
-            if ((ret_value = H5S_select_hyperslab(tmp_space, (u == 0 ? H5S_SELECT_SET : H5S_SELECT_OR), start,
-                                                  stride, count, block)) < 0)
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSET, FAIL, "can't change selection")
-        } /* end for */
+        /* Select the union of the blocks, building the span tree in one pass */
+        ret_value = H5S__select_hyper_blocklist(tmp_space, H5S_SELECT_SET, num_elem, block_list);
+        H5MM_xfree(block_list);
+        if (ret_value < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSET, FAIL, "can't change selection")
     }     /* end else */
 
     /* Update decoding pointer */
@@ -6142,6 +6594,16 @@ H5S_hyper_add_span_element(H5S_t *space, unsigned rank, const hsize_t *coords)
     else {
         int first_dim_modified = -1; /* Index of first dimension modified */
 
+        /* Make certain the span tree isn't shared before changing it */
+        if (H5S__hyper_unshare_spans(space) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "can't unshare hyperslab span tree")
+
+        /* Drop any sequence lists generated from the span tree before changing it */
+        if (space->select.sel_info.hslab->span_lst->seq_cache) {
+            H5S__hyper_free_seq_cache_list(space->select.sel_info.hslab->span_lst->seq_cache);
+            space->select.sel_info.hslab->span_lst->seq_cache = NULL;
+        } /* end if */
+
         /* Add the element to the current set of spans */
         if (H5S__hyper_add_span_element_helper(space->select.sel_info.hslab->span_lst, rank, coords,
                                                &first_dim_modified) < 0)
@@ -6446,13 +6908,45 @@ H5S__hyper_adjust_u_helper(H5S_hyper_span_info_t *spans, unsigned rank, const hs
     FUNC_LEAVE_NOAPI_VOID
 } /* end H5S__hyper_adjust_u_helper() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5S__hyper_adjust_seq_cache
+ *
+ * Purpose:     Shift the sequence lists cached on a span tree to match the
+ *              span tree's coordinates having an offset subtracted from
+ *              them, so the sequence lists remain usable after the
+ *              selection is moved.
+ *
+ * Return:      <none>
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5S__hyper_adjust_seq_cache(H5S_hyper_seq_cache_t *cache, const hssize_t *offset)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(offset);
+
+    while (cache) {
+        unsigned u; /* Local index variable */
+
+        for (u = 0; u < cache->rank; u++)
+            cache->bias -= offset[u] * (hssize_t)cache->slab[u];
+
+        cache = cache->next;
+    } /* end while */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5S__hyper_adjust_seq_cache() */
+
 /*--------------------------------------------------------------------------
  NAME
     H5S__hyper_adjust_u
  PURPOSE
     Adjust a hyperslab selection by subtracting an offset
  USAGE
-    void H5S__hyper_adjust_u(space,offset)
+    herr_t H5S__hyper_adjust_u(space,offset)
         H5S_t *space;           IN/OUT: Pointer to dataspace to adjust
         const hsize_t *offset; IN: Offset to subtract
  RETURNS
@@ -6467,10 +6961,11 @@ H5S__hyper_adjust_u_helper(H5S_hyper_span_info_t *spans, unsigned rank, const hs
 static herr_t
 H5S__hyper_adjust_u(H5S_t *space, const hsize_t *offset)
 {
-    hbool_t  non_zero_offset = FALSE; /* Whether any offset is non-zero */
-    unsigned u;                       /* Local index variable */
+    hbool_t  non_zero_offset = FALSE;   /* Whether any offset is non-zero */
+    unsigned u;                         /* Local index variable */
+    herr_t   ret_value       = SUCCEED; /* Return value */
 
-    FUNC_ENTER_STATIC_NOERR
+    FUNC_ENTER_STATIC
 
     /* Sanity check */
     HDassert(space);
@@ -6503,6 +6998,10 @@ H5S__hyper_adjust_u(H5S_t *space, const hsize_t *offset)
         if (space->select.sel_info.hslab->span_lst) {
             uint64_t op_gen; /* Operation generation value */
 
+            /* Make certain the span tree isn't shared before adjusting it */
+            if (H5S__hyper_unshare_spans(space) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "can't unshare hyperslab span tree")
+
             /* Acquire an operation generation value for this operation */
             op_gen = H5S__hyper_get_op_gen();
 
@@ -6511,10 +7010,20 @@ H5S__hyper_adjust_u(H5S_t *space, const hsize_t *offset)
              * simultaneous operations */
             H5S__hyper_adjust_u_helper(space->select.sel_info.hslab->span_lst, space->extent.rank, offset, 0,
                                        op_gen);
+
+            /* Shift the sequence lists generated from the span tree */
+            if (space->select.sel_info.hslab->span_lst->seq_cache) {
+                hssize_t soffset[H5S_MAX_RANK]; /* Signed version of offset */
+
+                for (u = 0; u < space->extent.rank; u++)
+                    soffset[u] = (hssize_t)offset[u];
+                H5S__hyper_adjust_seq_cache(space->select.sel_info.hslab->span_lst->seq_cache, soffset);
+            } /* end if */
         } /* end if */
     }     /* end if */
 
-    FUNC_LEAVE_NOAPI(SUCCEED)
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5S__hyper_adjust_u() */
 
 /*-------------------------------------------------------------------------
@@ -7009,10 +7518,11 @@ H5S__hyper_adjust_s_helper(H5S_hyper_span_info_t *spans, unsigned rank, const hs
 static herr_t
 H5S__hyper_adjust_s(H5S_t *space, const hssize_t *offset)
 {
-    hbool_t  non_zero_offset = FALSE; /* Whether any offset is non-zero */
-    unsigned u;                       /* Local index variable */
+    hbool_t  non_zero_offset = FALSE;   /* Whether any offset is non-zero */
+    unsigned u;                         /* Local index variable */
+    herr_t   ret_value       = SUCCEED; /* Return value */
 
-    FUNC_ENTER_STATIC_NOERR
+    FUNC_ENTER_STATIC
 
     /* Sanity checks */
     HDassert(space);
@@ -7048,6 +7558,10 @@ H5S__hyper_adjust_s(H5S_t *space, const hssize_t *offset)
         if (space->select.sel_info.hslab->span_lst) {
             uint64_t op_gen; /* Operation generation value */
 
+            /* Make certain the span tree isn't shared before adjusting it */
+            if (H5S__hyper_unshare_spans(space) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "can't unshare hyperslab span tree")
+
             /* Acquire an operation generation value for this operation */
             op_gen = H5S__hyper_get_op_gen();
 
@@ -7056,10 +7570,15 @@ H5S__hyper_adjust_s(H5S_t *space, const hssize_t *offset)
              * simultaneous operations */
             H5S__hyper_adjust_s_helper(space->select.sel_info.hslab->span_lst, space->extent.rank, offset, 0,
                                        op_gen);
+
+            /* Shift the sequence lists generated from the span tree */
+            if (space->select.sel_info.hslab->span_lst->seq_cache)
+                H5S__hyper_adjust_seq_cache(space->select.sel_info.hslab->span_lst->seq_cache, offset);
         } /* end if */
     }
 
-    FUNC_LEAVE_NOAPI(SUCCEED)
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5S__hyper_adjust_s() */
 
 /*--------------------------------------------------------------------------
@@ -8647,6 +9166,180 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5S__hyper_make_spans() */
 
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_blk_ref_cmp
+ PURPOSE
+    Compare two block references, for sorting
+ USAGE
+    int H5S__hyper_blk_ref_cmp(_ref1, _ref2)
+        const void *_ref1;      IN: First block reference
+        const void *_ref2;      IN: Second block reference
+ RETURNS
+    <0, 0 or >0, as the first block starts before, at or after the second
+ DESCRIPTION
+    Orders block references by their low bound in the current dimension,
+    then by their high bound.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static int
+H5S__hyper_blk_ref_cmp(const void *_ref1, const void *_ref2)
+{
+    const H5S_hyper_blk_ref_t *ref1      = (const H5S_hyper_blk_ref_t *)_ref1;
+    const H5S_hyper_blk_ref_t *ref2      = (const H5S_hyper_blk_ref_t *)_ref2;
+    int                        ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (ref1->low != ref2->low)
+        HGOTO_DONE(ref1->low < ref2->low ? -1 : 1)
+    if (ref1->high != ref2->high)
+        HGOTO_DONE(ref1->high < ref2->high ? -1 : 1)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_blk_ref_cmp() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_make_spans_blocks
+ PURPOSE
+    Create a span tree for the union of a list of blocks
+ USAGE
+    H5S_hyper_span_info_t *H5S__hyper_make_spans_blocks(rank, dim, nblocks, refs)
+        unsigned rank;              IN: # of dimensions of the space
+        unsigned dim;               IN: Dimension to build spans for
+        size_t nblocks;             IN: # of blocks referenced
+        H5S_hyper_blk_ref_t *refs;  IN/OUT: References to the blocks
+ RETURNS
+    Pointer to new span tree on success, NULL on failure
+ DESCRIPTION
+    Generates the span tree for dimensions DIM and below, for the union of
+    the blocks referenced, which may overlap and may be in any order.
+
+    The blocks are sorted by their bounds in DIM and swept in order, with
+    the blocks covering each interval in DIM made into the down span tree
+    for that interval.  Adjacent intervals with the same down spans are
+    merged (and down spans shared) as the spans are appended.  This avoids
+    the repeated merging of span trees from adding one block at a time.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    The low & high fields in the references are overwritten, and the
+    references are re-ordered.
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static H5S_hyper_span_info_t *
+H5S__hyper_make_spans_blocks(unsigned rank, unsigned dim, size_t nblocks, H5S_hyper_blk_ref_t *refs)
+{
+    H5S_hyper_blk_ref_t *  active     = NULL; /* Blocks covering the current interval */
+    H5S_hyper_blk_ref_t *  down_refs  = NULL; /* Copy of active blocks, for building down spans */
+    H5S_hyper_span_info_t *down_spans = NULL; /* Down spans for the current interval */
+    H5S_hyper_span_info_t *spans      = NULL; /* Span tree for this dimension */
+    size_t                 u;                 /* Local index variable */
+    H5S_hyper_span_info_t *ret_value = NULL;  /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(dim < rank);
+    HDassert(nblocks > 0);
+    HDassert(refs);
+
+    /* Set up and sort the block bounds for this dimension */
+    for (u = 0; u < nblocks; u++) {
+        refs[u].low  = refs[u].blk[dim];
+        refs[u].high = refs[u].blk[rank + dim];
+    } /* end for */
+    HDqsort(refs, nblocks, sizeof(H5S_hyper_blk_ref_t), H5S__hyper_blk_ref_cmp);
+
+    if (dim == (rank - 1)) {
+        hsize_t low  = refs[0].low;  /* Low bound of current span */
+        hsize_t high = refs[0].high; /* High bound of current span */
+
+        /* Coalesce overlapping and adjacent blocks into spans */
+        for (u = 1; u < nblocks; u++) {
+            if (refs[u].low <= (high + 1)) {
+                if (refs[u].high > high)
+                    high = refs[u].high;
+            } /* end if */
+            else {
+                if (H5S__hyper_append_span(&spans, 1, low, high, NULL) < 0)
+                    HGOTO_ERROR(H5E_DATASPACE, H5E_CANTAPPEND, NULL, "can't allocate hyperslab span")
+                low  = refs[u].low;
+                high = refs[u].high;
+            } /* end else */
+        }     /* end for */
+        if (H5S__hyper_append_span(&spans, 1, low, high, NULL) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTAPPEND, NULL, "can't allocate hyperslab span")
+    } /* end if */
+    else {
+        hsize_t pos     = refs[0].low; /* Start of current interval */
+        size_t  nactive = 0;           /* # of blocks covering the current interval */
+
+        if (NULL == (active = (H5S_hyper_blk_ref_t *)H5MM_malloc(nblocks * sizeof(H5S_hyper_blk_ref_t))))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, NULL, "can't allocate block references")
+        if (NULL == (down_refs = (H5S_hyper_blk_ref_t *)H5MM_malloc(nblocks * sizeof(H5S_hyper_blk_ref_t))))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, NULL, "can't allocate block references")
+
+        /* Sweep across the intervals in this dimension between the block bounds */
+        u = 0;
+        while (u < nblocks || nactive > 0) {
+            hsize_t end; /* End of current interval */
+            size_t  v, w;
+
+            /* Skip forward to the next block, when there's a gap */
+            if (nactive == 0)
+                pos = refs[u].low;
+
+            /* Add the blocks starting at this interval */
+            while (u < nblocks && refs[u].low == pos)
+                active[nactive++] = refs[u++];
+
+            /* The interval ends before the next block starts or an active block ends */
+            end = (u < nblocks) ? (refs[u].low - 1) : active[0].high;
+            for (v = 0; v < nactive; v++)
+                if (active[v].high < end)
+                    end = active[v].high;
+
+            /* Build the down spans for the blocks covering this interval */
+            H5MM_memcpy(down_refs, active, nactive * sizeof(H5S_hyper_blk_ref_t));
+            if (NULL == (down_spans = H5S__hyper_make_spans_blocks(rank, dim + 1, nactive, down_refs)))
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, NULL, "can't create hyperslab spans")
+
+            /* Append the interval, merging it with the previous one if possible */
+            if (H5S__hyper_append_span(&spans, rank - dim, pos, end, down_spans) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTAPPEND, NULL, "can't allocate hyperslab span")
+            H5S__hyper_free_span_info(down_spans);
+            down_spans = NULL;
+
+            /* Retire the blocks ending at this interval */
+            for (v = w = 0; v < nactive; v++)
+                if (active[v].high != end)
+                    active[w++] = active[v];
+            nactive = w;
+
+            pos = end + 1;
+        } /* end while */
+    }     /* end else */
+
+    /* Set return value */
+    ret_value = spans;
+
+done:
+    if (down_spans)
+        H5S__hyper_free_span_info(down_spans);
+    if (!ret_value && spans)
+        H5S__hyper_free_span_info(spans);
+    H5MM_xfree(active);
+    H5MM_xfree(down_refs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_make_spans_blocks() */
+
 /*--------------------------------------------------------------------------
  NAME
     H5S__hyper_update_diminfo
@@ -9232,12 +9925,14 @@ H5S__fill_in_new_space(H5S_t *space1, H5S_seloper_t op, H5S_hyper_span_info_t *s
             case H5S_SELECT_OR:
             case H5S_SELECT_XOR:
                 /* Add the new disjoint spans to the space */
-                /* Copy of space1's spans to *result, and another copy of space2's spans */
-                if (is_result_new)
-                    (*result)->select.sel_info.hslab->span_lst =
-                        H5S__hyper_copy_span(space1->select.sel_info.hslab->span_lst, space1->extent.rank);
+                /* Share space1's spans with *result, and space2's spans with the merge */
+                if (is_result_new) {
+                    (*result)->select.sel_info.hslab->span_lst = space1->select.sel_info.hslab->span_lst;
+                    (*result)->select.sel_info.hslab->span_lst->count++;
+                } /* end if */
                 if (!can_own_span2) {
-                    b_not_a = H5S__hyper_copy_span(space2_span_lst, space1->extent.rank);
+                    b_not_a = space2_span_lst;
+                    b_not_a->count++;
                     if (H5S__hyper_add_disjoint_spans(*result, b_not_a) < 0)
                         HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't append hyperslabs")
 
@@ -9261,10 +9956,11 @@ H5S__fill_in_new_space(H5S_t *space1, H5S_seloper_t op, H5S_hyper_span_info_t *s
                 HGOTO_DONE(SUCCEED);
 
             case H5S_SELECT_NOTB:
-                /* Copy space1's spans to *result */
-                if (is_result_new)
-                    (*result)->select.sel_info.hslab->span_lst =
-                        H5S__hyper_copy_span(space1->select.sel_info.hslab->span_lst, space1->extent.rank);
+                /* Share space1's spans with *result */
+                if (is_result_new) {
+                    (*result)->select.sel_info.hslab->span_lst = space1->select.sel_info.hslab->span_lst;
+                    (*result)->select.sel_info.hslab->span_lst->count++;
+                } /* end if */
 
                 /* Indicate that the spans changed */
                 *updated_spans = TRUE;
@@ -9279,10 +9975,11 @@ H5S__fill_in_new_space(H5S_t *space1, H5S_seloper_t op, H5S_hyper_span_info_t *s
                     space1->select.sel_info.hslab->span_lst = NULL;
                 } /* end if */
 
-                /* Copy space2's spans to *result */
-                if (!can_own_span2)
-                    (*result)->select.sel_info.hslab->span_lst =
-                        H5S__hyper_copy_span(space2_span_lst, space1->extent.rank);
+                /* Share space2's spans with *result */
+                if (!can_own_span2) {
+                    (*result)->select.sel_info.hslab->span_lst = space2_span_lst;
+                    space2_span_lst->count++;
+                } /* end if */
                 else {
                     (*result)->select.sel_info.hslab->span_lst = space2_span_lst;
                     *span2_owned                               = TRUE;
@@ -9344,9 +10041,10 @@ H5S__fill_in_new_space(H5S_t *space1, H5S_seloper_t op, H5S_hyper_span_info_t *s
             HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCLIP, FAIL, "can't clip hyperslab information")
         switch (op) {
             case H5S_SELECT_OR:
-                if (is_result_new)
-                    (*result)->select.sel_info.hslab->span_lst =
-                        H5S__hyper_copy_span(space1->select.sel_info.hslab->span_lst, space1->extent.rank);
+                if (is_result_new) {
+                    (*result)->select.sel_info.hslab->span_lst = space1->select.sel_info.hslab->span_lst;
+                    (*result)->select.sel_info.hslab->span_lst->count++;
+                } /* end if */
                 break;
 
             case H5S_SELECT_AND:
@@ -10266,6 +10964,234 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Sselect_hyperslab() */
 
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__select_hyper_blocklist
+ PURPOSE
+    Combine a list of blocks with the current selection
+ USAGE
+    herr_t H5S__select_hyper_blocklist(space, op, num_blocks, block_list)
+        H5S_t *space;               IN/OUT: Dataspace to modify selection of
+        H5S_seloper_t op;           IN: Operation to perform on current selection
+        size_t num_blocks;          IN: Number of blocks in list
+        const hsize_t *block_list;  IN: List of blocks
+ RETURNS
+    Non-negative on success/Negative on failure
+ DESCRIPTION
+    Combines the union of a list of blocks with the current selection for
+    a dataspace, as if the blocks were combined into a selection with
+    H5S_SELECT_OR one at a time and that selection was combined with the
+    current one.  The list of blocks has the same layout as the list from
+    H5Sget_select_hyper_blocklist(): the "start" coordinate of each block,
+    immediately followed by its "opposite" corner coordinate.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    The span tree for the blocks is built in a single sorted pass, see
+    H5S__hyper_make_spans_blocks().
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static herr_t
+H5S__select_hyper_blocklist(H5S_t *space, H5S_seloper_t op, size_t num_blocks, const hsize_t *block_list)
+{
+    H5S_hyper_blk_ref_t *  refs      = NULL;    /* References to the blocks */
+    H5S_hyper_span_info_t *new_spans = NULL;    /* Span tree for the blocks */
+    unsigned               rank;                /* Rank of the dataspace */
+    size_t                 u;                   /* Local index variable */
+    unsigned               v;                   /* Local index variable */
+    herr_t                 ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(space);
+    HDassert(num_blocks == 0 || block_list);
+    HDassert(op > H5S_SELECT_NOOP && op < H5S_SELECT_INVALID);
+
+    rank = space->extent.rank;
+
+    /* Check the blocks */
+    for (u = 0; u < num_blocks; u++)
+        for (v = 0; v < rank; v++) {
+            const hsize_t *blk = block_list + (u * 2 * rank);
+
+            if (blk[v] > blk[rank + v])
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "block's start is after its end")
+            if (blk[rank + v] == H5S_UNLIMITED)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "block can't be unlimited")
+        } /* end for */
+
+    /* Handle an empty list like an empty hyperslab */
+    if (num_blocks == 0) {
+        if (op == H5S_SELECT_SET || op == H5S_SELECT_AND || op == H5S_SELECT_NOTA)
+            if (H5S_select_none(space) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't convert selection")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Fixup operation for non-hyperslab selections */
+    switch (H5S_GET_SELECT_TYPE(space)) {
+        case H5S_SEL_NONE: /* No elements selected in dataspace */
+            if (op == H5S_SELECT_AND || op == H5S_SELECT_NOTB)
+                HGOTO_DONE(SUCCEED) /* Selection stays "none" */
+            op = H5S_SELECT_SET;
+            break;
+
+        case H5S_SEL_ALL: /* All elements selected in dataspace */
+            if (op == H5S_SELECT_OR)
+                HGOTO_DONE(SUCCEED) /* Selection stays "all" */
+            if (op == H5S_SELECT_NOTA) {
+                if (H5S_select_none(space) < 0)
+                    HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't convert selection")
+                HGOTO_DONE(SUCCEED)
+            } /* end if */
+            if (op == H5S_SELECT_AND)
+                op = H5S_SELECT_SET;
+            else if (op != H5S_SELECT_SET)
+                /* Convert current "all" selection to "real" hyperslab selection */
+                if (H5S_select_hyperslab(space, H5S_SELECT_SET, H5S_hyper_zeros_g, H5S_hyper_ones_g,
+                                         H5S_hyper_ones_g, space->extent.size) < 0)
+                    HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't convert selection")
+            break;
+
+        case H5S_SEL_HYPERSLABS:
+            if (op != H5S_SELECT_SET && space->select.sel_info.hslab->unlim_dim >= 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_UNSUPPORTED, FAIL,
+                            "unsupported operation on unlimited selection")
+            break;
+
+        case H5S_SEL_POINTS: /* Can't combine hyperslab operations and point selections currently */
+            if (op == H5S_SELECT_SET)
+                break;
+            HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
+
+        case H5S_SEL_ERROR:
+        case H5S_SEL_N:
+        default:
+            HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
+    } /* end switch */
+
+    /* Build the span tree for the blocks */
+    if (NULL == (refs = (H5S_hyper_blk_ref_t *)H5MM_malloc(num_blocks * sizeof(H5S_hyper_blk_ref_t))))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate block references")
+    for (u = 0; u < num_blocks; u++)
+        refs[u].blk = block_list + (u * 2 * rank);
+    if (NULL == (new_spans = H5S__hyper_make_spans_blocks(rank, 0, num_blocks, refs)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't create hyperslab information")
+
+    if (op == H5S_SELECT_SET) {
+        /* Remove current selection */
+        if (H5S_SELECT_RELEASE(space) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTDELETE, FAIL, "can't release selection")
+
+        /* Allocate space for the hyperslab selection information (note this sets
+         * diminfo_valid to FALSE, diminfo arrays to 0, and span list to NULL) */
+        if (NULL == (space->select.sel_info.hslab = H5FL_CALLOC(H5S_hyper_sel_t)))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate hyperslab info")
+
+        /* Set selection type */
+        space->select.type = H5S_sel_hyper;
+
+        /* Set unlim_dim */
+        space->select.sel_info.hslab->unlim_dim = -1;
+
+        /* Set span tree */
+        space->select.sel_info.hslab->span_lst = new_spans;
+        new_spans                              = NULL;
+
+        /* Set the number of elements in current selection */
+        space->select.num_elem = H5S__hyper_spans_nelem(space->select.sel_info.hslab->span_lst);
+
+        /* Attempt to build "optimized" start/stride/count/block information
+         * from resulting hyperslab span tree.
+         */
+        H5S__hyper_rebuild(space);
+    } /* end if */
+    else {
+        hbool_t new_spans_owned = FALSE;
+        hbool_t updated_spans   = FALSE;
+
+        /* Check if there's no hyperslab span information currently */
+        if (NULL == space->select.sel_info.hslab->span_lst)
+            if (H5S__hyper_generate_spans(space) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_UNINITIALIZED, FAIL, "dataspace does not have span tree")
+
+        /* Combine the new spans with the current selection */
+        if (H5S__fill_in_new_space(space, op, new_spans, TRUE, &new_spans_owned, &updated_spans, &space) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't combine the blocks with the selection")
+
+        /* The optimized start/stride/count/block information is unknown now */
+        if (updated_spans)
+            space->select.sel_info.hslab->diminfo_valid = H5S_DIMINFO_VALID_NO;
+
+        /* Indicate that the new_spans are owned, there's no need to free */
+        if (new_spans_owned)
+            new_spans = NULL;
+    } /* end else */
+
+done:
+    if (new_spans)
+        H5S__hyper_free_span_info(new_spans);
+    H5MM_xfree(refs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__select_hyper_blocklist() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5Sselect_hyper_blocklist
+ PURPOSE
+    Combine a list of blocks with the current selection
+ USAGE
+    herr_t H5Sselect_hyper_blocklist(space_id, op, num_blocks, block_list)
+        hid_t space_id;             IN: Dataspace ID of selection to modify
+        H5S_seloper_t op;           IN: Operation to perform on current selection
+        size_t num_blocks;          IN: Number of blocks in list
+        const hsize_t *block_list;  IN: List of blocks
+ RETURNS
+    Non-negative on success/Negative on failure
+ DESCRIPTION
+    Combines the union of a list of blocks with the current selection for
+    a dataspace.  The blocks may overlap and may be listed in any order.
+    The list of blocks has the same layout as the list from
+    H5Sget_select_hyper_blocklist().
+
+    This is much faster than selecting a large number of blocks with one
+    call to H5Sselect_hyperslab() for each one.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+herr_t
+H5Sselect_hyper_blocklist(hid_t space_id, H5S_seloper_t op, size_t num_blocks, const hsize_t *block_list)
+{
+    H5S_t *space;               /* Dataspace to modify selection of */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "iSsz*h", space_id, op, num_blocks, block_list);
+
+    /* Check args */
+    if (NULL == (space = (H5S_t *)H5I_object_verify(space_id, H5I_DATASPACE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataspace")
+    if (H5S_SCALAR == H5S_GET_EXTENT_TYPE(space))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "hyperslab doesn't support H5S_SCALAR space")
+    if (H5S_NULL == H5S_GET_EXTENT_TYPE(space))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "hyperslab doesn't support H5S_NULL space")
+    if (num_blocks > 0 && block_list == NULL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "block list not specified")
+    if (!(op > H5S_SELECT_NOOP && op < H5S_SELECT_INVALID) || op == H5S_SELECT_APPEND ||
+        op == H5S_SELECT_PREPEND)
+        HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
+
+    if (H5S__select_hyper_blocklist(space, op, num_blocks, block_list) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to set hyperslab selection")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Sselect_hyper_blocklist() */
+
 /*--------------------------------------------------------------------------
  NAME
     H5S_combine_hyperslab
@@ -10406,9 +11332,11 @@ H5S_combine_hyperslab(const H5S_t *old_space, H5S_seloper_t op, const hsize_t st
                     if (NULL == (new_spans = H5S__hyper_make_spans(old_space->extent.rank, start, stride,
                                                                    count, block)))
                         HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't create hyperslab information")
-                    if (NULL != old_space->select.sel_info.hslab->span_lst)
-                        (*new_space)->select.sel_info.hslab->span_lst = H5S__hyper_copy_span(
-                            old_space->select.sel_info.hslab->span_lst, old_space->extent.rank);
+                    if (NULL != old_space->select.sel_info.hslab->span_lst) {
+                        (*new_space)->select.sel_info.hslab->span_lst =
+                            old_space->select.sel_info.hslab->span_lst;
+                        (*new_space)->select.sel_info.hslab->span_lst->count++;
+                    } /* end if */
                     if (H5S__hyper_add_disjoint_spans(*new_space, new_spans) < 0)
                         HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't append hyperslabs")
 
@@ -10432,9 +11360,9 @@ H5S_combine_hyperslab(const H5S_t *old_space, H5S_seloper_t op, const hsize_t st
 
                 case H5S_SELECT_NOTB:
                     if (NULL != old_space->select.sel_info.hslab->span_lst) {
-                        if (NULL == ((*new_space)->select.sel_info.hslab->span_lst = H5S__hyper_copy_span(
-                                         old_space->select.sel_info.hslab->span_lst, old_space->extent.rank)))
-                            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy dataspace")
+                        (*new_space)->select.sel_info.hslab->span_lst =
+                            old_space->select.sel_info.hslab->span_lst;
+                        (*new_space)->select.sel_info.hslab->span_lst->count++;
                     } /* end if */
                     else {
                         if (H5S_select_none((*new_space)) < 0)
@@ -73,6 +73,10 @@
 /* Length of stack-allocated sequences for "project intersect" routines */
 #define H5S_PROJECT_INTERSECT_NSEQS 256
 
+/* Limits on the sequence lists cached for irregular hyperslab selections */
+#define H5S_HYPER_SEQ_CACHE_MAX_NSEQ    (64 * 1024) /* Max. # of sequences in a cached list */
+#define H5S_HYPER_SEQ_CACHE_MAX_ENTRIES 2           /* Max. # of cached lists per span tree */
+
 /* Internal flags for initializing selection iterators */
 #define H5S_SEL_ITER_API_CALL 0x1000 /* Selection iterator created from API call */
 
@@ -191,12 +195,40 @@ struct H5S_hyper_span_info_t {
     /* Currently the maximum number of simultaneous operations is 2 */
     H5S_hyper_op_info_t op_info[2];
 
+    /* Sequence lists generated from this span tree (only used on the top node of a tree) */
+    struct H5S_hyper_seq_cache_t *seq_cache;
+
     struct H5S_hyper_span_t *head; /* Pointer to the first span of list of spans in the current dimension */
     struct H5S_hyper_span_t *tail; /* Pointer to the last span of list of spans in the current dimension */
     hsize_t                  bounds[]; /* Array for storing low & high bounds */
                                        /* (NOTE: This uses the C99 "flexible array member" feature) */
 };
 
+/* Sequence list generated from an irregular hyperslab span tree (typedef'd in H5Sprivate.h)
+ *
+ * The offsets and lengths (in bytes) that the span tree produces for a given
+ * element size and dataspace extent are stored here the first time a
+ * selection iterator walks the tree, so that repeated I/O on the same
+ * selection doesn't need to walk the span tree again.  The offsets stored are
+ * independent of the selection offset, which is applied through 'bias'.
+ */
+struct H5S_hyper_seq_cache_t {
+    struct H5S_hyper_seq_cache_t *next; /* Next cached sequence list for the span tree */
+    unsigned                      rc;   /* # of selection iterators using this sequence list */
+
+    /* Key for the sequence list */
+    size_t   elmt_size;          /* Size of the elements the sequences were generated for */
+    unsigned rank;               /* Rank of the span tree */
+    hsize_t  slab[H5S_MAX_RANK]; /* Cumulative size of each dimension in bytes */
+
+    /* Sequence list */
+    hbool_t  too_many; /* Whether the span tree generates too many sequences to cache */
+    hssize_t bias;     /* Byte adjustment to the offsets for a zero selection offset */
+    size_t   nseq;     /* # of sequences */
+    hsize_t *off;      /* Array of sequence offsets */
+    size_t * len;      /* Array of sequence lengths */
+};
+
 /* Enum for diminfo_valid field in H5S_hyper_sel_t */
 typedef enum {
     H5S_DIMINFO_VALID_IMPOSSIBLE, /* 0: diminfo is not valid and can never be valid with the current selection
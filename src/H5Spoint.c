@@ -48,12 +48,21 @@
 /* (Makes it easier to understand the alloc / free calls) */
 typedef hsize_t hcoords_t;
 
+/* Point being sorted by H5S_select_sort_points() */
+typedef struct {
+    hsize_t        loc; /* Offset of the point in the dataspace, in elements */
+    size_t         idx; /* Position of the point in the selection */
+    const hsize_t *pnt; /* Coordinates of the point */
+} H5S_point_sort_t;
+
 /********************/
 /* Local Prototypes */
 /********************/
 static herr_t          H5S__point_add(H5S_t *space, H5S_seloper_t op, size_t num_elem, const hsize_t *coord);
 static H5S_pnt_list_t *H5S__copy_pnt_list(const H5S_pnt_list_t *src, unsigned rank);
 static void            H5S__free_pnt_list(H5S_pnt_list_t *pnt_lst);
+static int             H5S__point_sort_cmp(const void *_pnt1, const void *_pnt2);
+static H5S_t *         H5S__point_sort_new_space(const H5S_t *space, size_t num_elem, const hsize_t *coord);
 
 /* Selection callbacks */
 static herr_t   H5S__point_copy(H5S_t *dst, const H5S_t *src, hbool_t share_selection);
@@ -157,6 +166,9 @@ H5FL_BARR_DEFINE_STATIC(H5S_pnt_node_t, hcoords_t, H5S_MAX_RANK);
 /* Declare a free list to manage the H5S_pnt_list_t struct */
 H5FL_DEFINE_STATIC(H5S_pnt_list_t);
 
+/* Declare extern free list to manage the H5S_sel_iter_t struct */
+H5FL_EXTERN(H5S_sel_iter_t);
+
 /*-------------------------------------------------------------------------
  * Function:    H5S__point_iter_init
  *
@@ -2418,3 +2430,197 @@ H5Sselect_elements(hid_t spaceid, H5S_seloper_t op, size_t num_elem, const hsize
 done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Sselect_elements() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5S__point_sort_cmp
+ *
+ * Purpose:     Compare two points being sorted by H5S_select_sort_points(),
+ *              by their offset in the dataspace, then by their position
+ *              in the selection (so the sort is stable).
+ *
+ * Return:      -1, 0, 1 like strcmp()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5S__point_sort_cmp(const void *_pnt1, const void *_pnt2)
+{
+    const H5S_point_sort_t *pnt1 = (const H5S_point_sort_t *)_pnt1;
+    const H5S_point_sort_t *pnt2 = (const H5S_point_sort_t *)_pnt2;
+
+    if (pnt1->loc < pnt2->loc)
+        return -1;
+    if (pnt1->loc > pnt2->loc)
+        return 1;
+    if (pnt1->idx < pnt2->idx)
+        return -1;
+    if (pnt1->idx > pnt2->idx)
+        return 1;
+    return 0;
+} /* end H5S__point_sort_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5S__point_sort_new_space
+ *
+ * Purpose:     Create a dataspace with the same extent & selection offset
+ *              as SPACE, selecting the NUM_ELEM points in COORD.
+ *
+ * Return:      Success:    Pointer to the new dataspace
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5S_t *
+H5S__point_sort_new_space(const H5S_t *space, size_t num_elem, const hsize_t *coord)
+{
+    H5S_t *new_space = NULL; /* New dataspace */
+    H5S_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Create a dataspace with the same extent */
+    if (NULL == (new_space = H5S_create(H5S_SIMPLE)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCREATE, NULL, "unable to create dataspace")
+    if (H5S_extent_copy(new_space, space) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, NULL, "can't copy extent")
+
+    /* Select the points, keeping the selection offset */
+    if (H5S_select_elements(new_space, H5S_SELECT_SET, num_elem, coord) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, NULL, "can't select points")
+    H5MM_memcpy(new_space->select.offset, space->select.offset, sizeof(hssize_t) * space->extent.rank);
+    new_space->select.offset_changed = space->select.offset_changed;
+
+    /* Set the return value */
+    ret_value = new_space;
+
+done:
+    if (NULL == ret_value && new_space)
+        if (H5S_close(new_space) < 0)
+            HDONE_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, NULL, "unable to release dataspace")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__point_sort_new_space() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5S_select_sort_points
+ *
+ * Purpose:     Put the points in a file dataspace's point selection into
+ *              the order they're stored in the file, reordering the memory
+ *              dataspace's selection the same way so the same elements are
+ *              still transferred between them.
+ *
+ *              The new dataspaces are returned in SORTED_FILE_SPACE and
+ *              SORTED_MEM_SPACE, which the caller must close.  If the
+ *              points are already in order, the dataspaces are set to
+ *              NULL instead.
+ *
+ *              Duplicate points are kept (in their original relative
+ *              order), so a point written several times ends up with the
+ *              last value for it.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5S_select_sort_points(const H5S_t *file_space, const H5S_t *mem_space, H5S_t **sorted_file_space,
+                       H5S_t **sorted_mem_space)
+{
+    H5S_point_sort_t *pnts       = NULL;   /* Points to sort */
+    hsize_t *         mem_coords = NULL;   /* Coordinates of the memory selection's elements */
+    hsize_t *         coords     = NULL;   /* Coordinates of the sorted selection */
+    H5S_sel_iter_t *  mem_iter   = NULL;   /* Memory selection iterator */
+    hbool_t           iter_init  = FALSE;  /* Whether the memory iterator has been initialized */
+    hbool_t           in_order   = TRUE;   /* Whether the points are already in order */
+    H5S_pnt_node_t *  node;                /* Point node */
+    size_t            num_elem;            /* # of points */
+    unsigned          rank, mem_rank;      /* Dataspace ranks */
+    size_t            u;                   /* Local index variable */
+    herr_t            ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Check args */
+    HDassert(file_space);
+    HDassert(H5S_GET_SELECT_TYPE(file_space) == H5S_SEL_POINTS);
+    HDassert(mem_space);
+    HDassert(sorted_file_space);
+    HDassert(sorted_mem_space);
+
+    *sorted_file_space = NULL;
+    *sorted_mem_space  = NULL;
+
+    H5_CHECKED_ASSIGN(num_elem, size_t, file_space->select.num_elem, hsize_t);
+    rank     = file_space->extent.rank;
+    mem_rank = mem_space->extent.rank;
+    if (num_elem < 2 || 0 == mem_rank)
+        HGOTO_DONE(SUCCEED)
+
+    /* Compute the offset of each point in the file dataspace */
+    if (NULL == (pnts = (H5S_point_sort_t *)H5MM_malloc(num_elem * sizeof(H5S_point_sort_t))))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate points to sort")
+    for (node = file_space->select.sel_info.pnt_lst->head, u = 0; node; node = node->next, u++) {
+        HDassert(u < num_elem);
+        pnts[u].loc = H5VM_array_offset(rank, file_space->extent.size, node->pnt);
+        pnts[u].idx = u;
+        pnts[u].pnt = node->pnt;
+        if (u > 0 && pnts[u].loc < pnts[u - 1].loc)
+            in_order = FALSE;
+    } /* end for */
+    HDassert(u == num_elem);
+
+    /* Nothing to do if the points are already in order */
+    if (in_order)
+        HGOTO_DONE(SUCCEED)
+
+    /* Sort the points */
+    HDqsort(pnts, num_elem, sizeof(H5S_point_sort_t), H5S__point_sort_cmp);
+
+    /* Retrieve the coordinates of each element of the memory selection, in order */
+    if (NULL == (mem_coords = (hsize_t *)H5MM_malloc(num_elem * mem_rank * sizeof(hsize_t))))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate memory coordinates")
+    if (NULL == (mem_iter = H5FL_MALLOC(H5S_sel_iter_t)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate memory selection iterator")
+    if (H5S_select_iter_init(mem_iter, mem_space, (size_t)1, 0) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to initialize memory selection iterator")
+    iter_init = TRUE;
+    for (u = 0; u < num_elem; u++) {
+        if (H5S_SELECT_ITER_COORDS(mem_iter, &mem_coords[u * mem_rank]) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "unable to get memory selection coordinates")
+        if (u + 1 < num_elem && H5S_SELECT_ITER_NEXT(mem_iter, (size_t)1) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTNEXT, FAIL, "unable to move memory selection iterator")
+    } /* end for */
+
+    /* Build the sorted file selection */
+    if (NULL == (coords = (hsize_t *)H5MM_malloc(num_elem * MAX(rank, mem_rank) * sizeof(hsize_t))))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate sorted coordinates")
+    for (u = 0; u < num_elem; u++)
+        H5MM_memcpy(&coords[u * rank], pnts[u].pnt, rank * sizeof(hsize_t));
+    if (NULL == (*sorted_file_space = H5S__point_sort_new_space(file_space, num_elem, coords)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCREATE, FAIL, "can't create sorted file dataspace")
+
+    /* Build the memory selection in the same order */
+    for (u = 0; u < num_elem; u++)
+        H5MM_memcpy(&coords[u * mem_rank], &mem_coords[pnts[u].idx * mem_rank], mem_rank * sizeof(hsize_t));
+    if (NULL == (*sorted_mem_space = H5S__point_sort_new_space(mem_space, num_elem, coords)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCREATE, FAIL, "can't create sorted memory dataspace")
+
+done:
+    if (iter_init && H5S_SELECT_ITER_RELEASE(mem_iter) < 0)
+        HDONE_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "unable to release selection iterator")
+    if (mem_iter)
+        mem_iter = H5FL_FREE(H5S_sel_iter_t, mem_iter);
+    H5MM_xfree(pnts);
+    H5MM_xfree(mem_coords);
+    H5MM_xfree(coords);
+    if (ret_value < 0) {
+        if (*sorted_file_space && H5S_close(*sorted_file_space) < 0)
+            HDONE_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "unable to release dataspace")
+        if (*sorted_mem_space && H5S_close(*sorted_mem_space) < 0)
+            HDONE_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "unable to release dataspace")
+        *sorted_file_space = NULL;
+        *sorted_mem_space  = NULL;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S_select_sort_points() */
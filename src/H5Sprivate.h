@@ -36,6 +36,7 @@ typedef struct H5S_pnt_node_t        H5S_pnt_node_t;
 typedef struct H5S_pnt_list_t        H5S_pnt_list_t;
 typedef struct H5S_hyper_span_t      H5S_hyper_span_t;
 typedef struct H5S_hyper_span_info_t H5S_hyper_span_info_t;
+typedef struct H5S_hyper_seq_cache_t H5S_hyper_seq_cache_t;
 
 /* Information about one dimension in a hyperslab selection */
 typedef struct H5S_hyper_dim_t {
@@ -74,6 +75,13 @@ typedef struct {
     hsize_t loc_off[H5S_MAX_RANK]; /* Byte offset in buffer, for each dimension's current offset */
     H5S_hyper_span_info_t *spans;  /* Pointer to copy of the span tree */
     H5S_hyper_span_t *     span[H5S_MAX_RANK]; /* Array of pointers to span nodes */
+
+    /* Cached sequence list fields (irregular hyperslab selections only) */
+    H5S_hyper_seq_cache_t *seq_cache;       /* Sequence list cached on the span tree, if in use */
+    size_t                 seq_idx;         /* Index of the current sequence in the cache */
+    size_t                 seq_used;        /* # of bytes already used from the current sequence */
+    hssize_t               seq_bias;        /* Byte adjustment to the cached offsets for this iterator */
+    hbool_t                seq_cache_tried; /* Whether the sequence list cache has been looked up */
 } H5S_hyper_iter_t;
 
 /* "All" selection iteration container */
@@ -272,6 +280,8 @@ H5_DLL herr_t H5S_select_none(H5S_t *space);
 
 /* Operations on point selections */
 H5_DLL herr_t H5S_select_elements(H5S_t *space, H5S_seloper_t op, size_t num_elem, const hsize_t *coord);
+H5_DLL herr_t H5S_select_sort_points(const H5S_t *file_space, const H5S_t *mem_space,
+                                     H5S_t **sorted_file_space, H5S_t **sorted_mem_space);
 
 /* Operations on hyperslab selections */
 H5_DLL herr_t  H5S_select_hyperslab(H5S_t *space, H5S_seloper_t op, const hsize_t start[],
@@ -1075,6 +1075,45 @@ H5_DLL herr_t H5Sselect_copy(hid_t dst_id, hid_t src_id);
  *
  */
 H5_DLL herr_t H5Sselect_elements(hid_t space_id, H5S_seloper_t op, size_t num_elem, const hsize_t *coord);
+/**
+ * \ingroup H5S
+ *
+ * \brief Selects a list of hyperslab blocks to combine with the current
+ *        selection
+ *
+ * \space_id
+ * \param[in] op         Operation to perform on current selection
+ * \param[in] num_blocks Number of blocks in \p block_list
+ * \param[in] block_list List of blocks to select
+ *
+ * \return \herr_t
+ *
+ * \details H5Sselect_hyper_blocklist() combines the union of the
+ *          \p num_blocks blocks in \p block_list with the current
+ *          selection for the dataspace specified by \p space_id, using the
+ *          operator \p op, as described for H5Sselect_hyperslab().
+ *
+ *          The list of blocks has the same layout as the list returned by
+ *          H5Sget_select_hyper_blocklist():\n
+ *              \<"start" coordinate\>, immediately followed by\n
+ *              \<"opposite" corner coordinate\>, followed by\n
+ *              the next "start" and "opposite" coordinates, etc.\n
+ *          Each coordinate has the same number of elements as the rank of
+ *          the dataspace.  The blocks may overlap and may be listed in any
+ *          order.
+ *
+ *          The selection is the same as selecting each block in turn with
+ *          H5Sselect_hyperslab() and #H5S_SELECT_OR, then combining the
+ *          result with the current selection.  For large numbers of blocks
+ *          this is much faster, as the selection is built in a single
+ *          sorted pass over the list, instead of merging each block into
+ *          the selection separately.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Sselect_hyper_blocklist(hid_t space_id, H5S_seloper_t op, size_t num_blocks,
+                                        const hsize_t *block_list);
 /**
  * \ingroup H5S
  *
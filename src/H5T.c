@@ -49,6 +49,14 @@
 
 #define H5T_ENCODE_VERSION 0
 
+#ifdef H5_HAVE_WORKER_THREADS
+/* Minimum # of bytes in a conversion buffer to split it across threads */
+#define H5T_CONV_PAR_MIN_SIZE (256 * 1024)
+
+/* Minimum # of bytes converted by each thread */
+#define H5T_CONV_PAR_MIN_TASK_SIZE (64 * 1024)
+#endif /* H5_HAVE_WORKER_THREADS */
+
 /*
  * Type initialization macros
  *
@@ -149,6 +157,64 @@
         H5T_INIT_TYPE_DOUBLE_COMMON(H5T_ORDER_BE)                                                            \
     }
 
+/* Define the code templates for IEEE half precision floats for the "GUTS" in the H5T_INIT_TYPE macro */
+#define H5T_INIT_TYPE_HALF_COMMON(ENDIANNESS)                                                                \
+    {                                                                                                        \
+        H5T_INIT_TYPE_NUM_COMMON(ENDIANNESS)                                                                 \
+        dt->shared->u.atomic.u.f.sign  = 15;                                                                 \
+        dt->shared->u.atomic.u.f.epos  = 10;                                                                 \
+        dt->shared->u.atomic.u.f.esize = 5;                                                                  \
+        dt->shared->u.atomic.u.f.ebias = 0x0f;                                                               \
+        dt->shared->u.atomic.u.f.mpos  = 0;                                                                  \
+        dt->shared->u.atomic.u.f.msize = 10;                                                                 \
+        dt->shared->u.atomic.u.f.norm  = H5T_NORM_IMPLIED;                                                   \
+        dt->shared->u.atomic.u.f.pad   = H5T_PAD_ZERO;                                                       \
+    }
+
+#define H5T_INIT_TYPE_HALFLE_CORE                                                                            \
+    {                                                                                                        \
+        H5T_INIT_TYPE_HALF_COMMON(H5T_ORDER_LE)                                                              \
+    }
+
+#define H5T_INIT_TYPE_HALFBE_CORE                                                                            \
+    {                                                                                                        \
+        H5T_INIT_TYPE_HALF_COMMON(H5T_ORDER_BE)                                                              \
+    }
+
+#define H5T_INIT_TYPE_HALFNATIVE_CORE                                                                        \
+    {                                                                                                        \
+        H5T_INIT_TYPE_HALF_COMMON(H5T_native_order_g)                                                        \
+    }
+
+/* Define the code templates for bfloat16 floats for the "GUTS" in the H5T_INIT_TYPE macro */
+#define H5T_INIT_TYPE_BFLOAT16_COMMON(ENDIANNESS)                                                            \
+    {                                                                                                        \
+        H5T_INIT_TYPE_NUM_COMMON(ENDIANNESS)                                                                 \
+        dt->shared->u.atomic.u.f.sign  = 15;                                                                 \
+        dt->shared->u.atomic.u.f.epos  = 7;                                                                  \
+        dt->shared->u.atomic.u.f.esize = 8;                                                                  \
+        dt->shared->u.atomic.u.f.ebias = 0x7f;                                                               \
+        dt->shared->u.atomic.u.f.mpos  = 0;                                                                  \
+        dt->shared->u.atomic.u.f.msize = 7;                                                                  \
+        dt->shared->u.atomic.u.f.norm  = H5T_NORM_IMPLIED;                                                   \
+        dt->shared->u.atomic.u.f.pad   = H5T_PAD_ZERO;                                                       \
+    }
+
+#define H5T_INIT_TYPE_BFLOAT16LE_CORE                                                                        \
+    {                                                                                                        \
+        H5T_INIT_TYPE_BFLOAT16_COMMON(H5T_ORDER_LE)                                                          \
+    }
+
+#define H5T_INIT_TYPE_BFLOAT16BE_CORE                                                                        \
+    {                                                                                                        \
+        H5T_INIT_TYPE_BFLOAT16_COMMON(H5T_ORDER_BE)                                                          \
+    }
+
+#define H5T_INIT_TYPE_BFLOAT16NATIVE_CORE                                                                    \
+    {                                                                                                        \
+        H5T_INIT_TYPE_BFLOAT16_COMMON(H5T_native_order_g)                                                    \
+    }
+
 /* Define the code templates for VAX float for the "GUTS" in the H5T_INIT_TYPE macro */
 #define H5T_INIT_TYPE_FLOATVAX_CORE                                                                          \
     {                                                                                                        \
@@ -338,6 +404,22 @@
 /* Typedef for recursive const-correct datatype copying routines */
 typedef H5T_t *(*H5T_copy_func_t)(H5T_t *old_dt);
 
+#ifdef H5_HAVE_WORKER_THREADS
+/* Info for splitting a conversion across worker threads */
+typedef struct H5T_conv_par_t {
+    H5T_path_t *tpath;      /* Conversion path */
+    hid_t       src_id;     /* Source datatype ID */
+    hid_t       dst_id;     /* Destination datatype ID */
+    size_t      nelmts;     /* # of elements to convert */
+    size_t      ntasks;     /* # of tasks the elements are split into */
+    size_t      buf_stride; /* Buffer stride (0 for packed elements) */
+    size_t      src_size;   /* Size of source datatype */
+    size_t      dst_size;   /* Size of destination datatype */
+    uint8_t *   buf;        /* Conversion buffer */
+    uint8_t *   scratch;    /* Scratch buffer, when the element size changes */
+} H5T_conv_par_t;
+#endif /* H5_HAVE_WORKER_THREADS */
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -356,6 +438,17 @@ static H5T_t *     H5T__copy_transient(H5T_t *old_dt);
 static H5T_t *     H5T__copy_all(H5T_t *old_dt);
 static herr_t      H5T__complete_copy(H5T_t *new_dt, const H5T_t *old_dt, H5T_shared_t *reopened_fo,
                                       hbool_t set_memory_type, H5T_copy_func_t copyfn);
+#ifdef H5_HAVE_WORKER_THREADS
+static hbool_t H5T__conv_par_safe(const H5T_path_t *tpath);
+static htri_t  H5T__conv_par_allowed(const H5T_path_t *tpath);
+static herr_t  H5T__conv_par_ntasks(const H5T_path_t *tpath, size_t nelmts, size_t *ntasks);
+static void    H5T__conv_par_range(const H5T_conv_par_t *par, size_t task_idx, size_t *start, size_t *n);
+static herr_t  H5T__conv_par_inplace_task(size_t task_idx, void *_par);
+static herr_t  H5T__conv_par_scratch_task(size_t task_idx, void *_par);
+static herr_t  H5T__conv_par_copyback_task(size_t task_idx, void *_par);
+static herr_t  H5T__conv_par(H5T_path_t *tpath, hid_t src_id, hid_t dst_id, size_t ntasks, size_t nelmts,
+                             size_t buf_stride, void *buf);
+#endif /* H5_HAVE_WORKER_THREADS */
 
 /*****************************/
 /* Library Private Variables */
@@ -382,6 +475,11 @@ hid_t H5T_IEEE_F32BE_g = FAIL;
 hid_t H5T_IEEE_F32LE_g = FAIL;
 hid_t H5T_IEEE_F64BE_g = FAIL;
 hid_t H5T_IEEE_F64LE_g = FAIL;
+hid_t H5T_IEEE_F16BE_g = FAIL;
+hid_t H5T_IEEE_F16LE_g = FAIL;
+
+hid_t H5T_FLOAT_BFLOAT16BE_g = FAIL;
+hid_t H5T_FLOAT_BFLOAT16LE_g = FAIL;
 
 hid_t H5T_VAX_F32_g = FAIL;
 hid_t H5T_VAX_F64_g = FAIL;
@@ -449,6 +547,9 @@ hid_t H5T_NATIVE_HSSIZE_g = FAIL;
 hid_t H5T_NATIVE_HERR_g   = FAIL;
 hid_t H5T_NATIVE_HBOOL_g  = FAIL;
 
+hid_t H5T_NATIVE_FLOAT16_g  = FAIL;
+hid_t H5T_NATIVE_BFLOAT16_g = FAIL;
+
 hid_t H5T_NATIVE_INT8_g        = FAIL;
 hid_t H5T_NATIVE_UINT8_g       = FAIL;
 hid_t H5T_NATIVE_INT_LEAST8_g  = FAIL;
@@ -593,6 +694,12 @@ static struct {
     int          nsoft;  /*number of soft conversions defined    */
     size_t       asoft;  /*number of soft conversions allocated  */
     H5T_soft_t * soft;   /*unsorted array of soft conversions    */
+#ifdef H5_HAVE_WORKER_THREADS
+    H5TS_pool_t *  conv_pool;  /*worker threads for conversions       */
+    H5TS_pool_t *  async_pool; /*worker thread for overlapped conv.   */
+    H5T_conv_par_t async_par;  /*overlapped conversion in progress    */
+    hbool_t        async_busy; /*whether async_par is in progress     */
+#endif                         /* H5_HAVE_WORKER_THREADS */
 } H5T_g;
 
 /* Declare the free list for H5T_path_t's */
@@ -775,6 +882,8 @@ H5T__init_package(void)
 #if H5_SIZEOF_LONG_DOUBLE != 0
     H5T_t *native_ldouble = NULL; /* Datatype structure for native long double */
 #endif
+    H5T_t *native_half     = NULL; /* Datatype structure for native-order IEEE half precision float */
+    H5T_t *native_bfloat16 = NULL; /* Datatype structure for native-order bfloat16 float */
     H5T_t * std_u8le  = NULL; /* Datatype structure for unsigned 8-bit little-endian integer */
     H5T_t * std_u8be  = NULL; /* Datatype structure for unsigned 8-bit big-endian integer */
     H5T_t * std_u16le = NULL; /* Datatype structure for unsigned 16-bit little-endian integer */
@@ -897,6 +1006,31 @@ H5T__init_package(void)
     /* IEEE 8-byte big-endian float */
     H5T_INIT_TYPE(DOUBLEBE, H5T_IEEE_F64BE_g, COPY, native_double, SET, 8)
 
+    /* IEEE 2-byte little-endian float */
+    H5T_INIT_TYPE(HALFLE, H5T_IEEE_F16LE_g, COPY, native_double, SET, 2)
+
+    /* IEEE 2-byte big-endian float */
+    H5T_INIT_TYPE(HALFBE, H5T_IEEE_F16BE_g, COPY, native_double, SET, 2)
+
+    /* IEEE 2-byte float in native byte order (no C type) */
+    H5T_INIT_TYPE(HALFNATIVE, H5T_NATIVE_FLOAT16_g, COPY, native_double, SET, 2)
+    native_half = dt; /* Keep type for later */
+
+    /*------------------------------------------------------------
+     * bfloat16 Types
+     *------------------------------------------------------------
+     */
+
+    /* 2-byte little-endian bfloat16 */
+    H5T_INIT_TYPE(BFLOAT16LE, H5T_FLOAT_BFLOAT16LE_g, COPY, native_double, SET, 2)
+
+    /* 2-byte big-endian bfloat16 */
+    H5T_INIT_TYPE(BFLOAT16BE, H5T_FLOAT_BFLOAT16BE_g, COPY, native_double, SET, 2)
+
+    /* 2-byte bfloat16 in native byte order (no C type) */
+    H5T_INIT_TYPE(BFLOAT16NATIVE, H5T_NATIVE_BFLOAT16_g, COPY, native_double, SET, 2)
+    native_bfloat16 = dt; /* Keep type for later */
+
     /*------------------------------------------------------------
      * VAX Types
      *------------------------------------------------------------
@@ -1126,6 +1260,18 @@ H5T__init_package(void)
     status |=
         H5T__register_int(H5T_PERS_HARD, "ldbl_dbl", native_ldouble, native_double, H5T__conv_ldouble_double);
 #endif /* H5_SIZEOF_LONG_DOUBLE != 0 */
+    status |= H5T__register_int(H5T_PERS_HARD, "half_flt", native_half, native_float, H5T__conv_half_float);
+    status |= H5T__register_int(H5T_PERS_HARD, "half_dbl", native_half, native_double, H5T__conv_half_double);
+    status |= H5T__register_int(H5T_PERS_HARD, "flt_half", native_float, native_half, H5T__conv_float_half);
+    status |= H5T__register_int(H5T_PERS_HARD, "dbl_half", native_double, native_half, H5T__conv_double_half);
+    status |=
+        H5T__register_int(H5T_PERS_HARD, "bf16_flt", native_bfloat16, native_float, H5T__conv_bfloat16_float);
+    status |= H5T__register_int(H5T_PERS_HARD, "bf16_dbl", native_bfloat16, native_double,
+                                H5T__conv_bfloat16_double);
+    status |=
+        H5T__register_int(H5T_PERS_HARD, "flt_bf16", native_float, native_bfloat16, H5T__conv_float_bfloat16);
+    status |= H5T__register_int(H5T_PERS_HARD, "dbl_bf16", native_double, native_bfloat16,
+                                H5T__conv_double_bfloat16);
 
     /* from long long */
     status |=
@@ -1544,6 +1690,21 @@ H5T_top_term_package(void)
     FUNC_ENTER_NOAPI_NOINIT_NOERR
 
     if (H5T_top_package_initialize_s) {
+#ifdef H5_HAVE_WORKER_THREADS
+        /* Shut down the conversion worker threads */
+        if (H5T_g.conv_pool) {
+            if (H5TS_pool_destroy(H5T_g.conv_pool) < 0)
+                H5E_clear_stack(NULL); /*ignore the error*/
+            H5T_g.conv_pool = NULL;
+        } /* end if */
+        if (H5T_g.async_pool) {
+            HDassert(!H5T_g.async_busy);
+            if (H5TS_pool_destroy(H5T_g.async_pool) < 0)
+                H5E_clear_stack(NULL); /*ignore the error*/
+            H5T_g.async_pool = NULL;
+        } /* end if */
+#endif /* H5_HAVE_WORKER_THREADS */
+
         /* Unregister all conversion functions */
         if (H5T_g.path) {
             int i, nprint = 0;
@@ -1624,6 +1785,11 @@ H5T_top_term_package(void)
             H5T_IEEE_F32LE_g = FAIL;
             H5T_IEEE_F64BE_g = FAIL;
             H5T_IEEE_F64LE_g = FAIL;
+            H5T_IEEE_F16BE_g = FAIL;
+            H5T_IEEE_F16LE_g = FAIL;
+
+            H5T_FLOAT_BFLOAT16BE_g = FAIL;
+            H5T_FLOAT_BFLOAT16LE_g = FAIL;
 
             H5T_STD_I8BE_g        = FAIL;
             H5T_STD_I8LE_g        = FAIL;
@@ -1688,6 +1854,9 @@ H5T_top_term_package(void)
             H5T_NATIVE_HERR_g   = FAIL;
             H5T_NATIVE_HBOOL_g  = FAIL;
 
+            H5T_NATIVE_FLOAT16_g  = FAIL;
+            H5T_NATIVE_BFLOAT16_g = FAIL;
+
             H5T_NATIVE_INT8_g        = FAIL;
             H5T_NATIVE_UINT8_g       = FAIL;
             H5T_NATIVE_INT_LEAST8_g  = FAIL;
@@ -5496,6 +5665,9 @@ H5T_convert(H5T_path_t *tpath, hid_t src_id, hid_t dst_id, size_t nelmts, size_t
 {
 #ifdef H5T_DEBUG
     H5_timer_t timer; /* Timer for conversion */
+#endif
+#ifdef H5_HAVE_WORKER_THREADS
+    size_t conv_ntasks = 1; /* # of tasks to split the conversion into */
 #endif
     herr_t ret_value = SUCCEED; /* Return value */
 
@@ -5509,9 +5681,22 @@ H5T_convert(H5T_path_t *tpath, hid_t src_id, hid_t dst_id, size_t nelmts, size_t
     } /* end if */
 #endif
 
+#ifdef H5_HAVE_WORKER_THREADS
+    /* Check whether to split the conversion across worker threads */
+    if (H5T__conv_par_ntasks(tpath, nelmts, &conv_ntasks) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't determine # of conversion threads")
+#endif /* H5_HAVE_WORKER_THREADS */
+
     /* Call the appropriate conversion callback */
     tpath->cdata.command = H5T_CONV_CONV;
-    if (tpath->conv.is_app) {
+#ifdef H5_HAVE_WORKER_THREADS
+    if (conv_ntasks > 1) {
+        if (H5T__conv_par(tpath, src_id, dst_id, conv_ntasks, nelmts, buf_stride, buf) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+    } /* end if */
+    else
+#endif /* H5_HAVE_WORKER_THREADS */
+        if (tpath->conv.is_app) {
         if ((tpath->conv.u.app_func)(src_id, dst_id, &(tpath->cdata), nelmts, buf_stride, bkg_stride, buf,
                                      bkg, H5CX_get_dxpl()) < 0)
             HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
@@ -5537,6 +5722,482 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T_convert() */
 
+#ifdef H5_HAVE_WORKER_THREADS
+
+/*-------------------------------------------------------------------------
+ * Function:  H5T__conv_par_safe
+ *
+ * Purpose:   Determines whether the elements converted by a conversion
+ *            path are independent of each other and the conversion
+ *            function is safe to call concurrently on disjoint parts of
+ *            a buffer.
+ *
+ *            This is true for the library's hard conversions between
+ *            native types, and for its soft conversions between
+ *            integer, floating-point, bitfield and fixed-length string
+ *            types.  It is not true for application conversion functions
+ *            (whose thread-safety is unknown), nor for conversions which
+ *            need a background buffer, recurse into other conversion
+ *            paths, or access files (compound, enum, array, VL and
+ *            reference conversions).
+ *
+ * Return:    TRUE/FALSE (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5T__conv_par_safe(const H5T_path_t *tpath)
+{
+    H5T_lib_conv_t func;
+    hbool_t        ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(tpath);
+
+    if (tpath->conv.is_app || tpath->is_noop || H5T_BKG_NO != tpath->cdata.need_bkg)
+        HGOTO_DONE(FALSE)
+
+    func = tpath->conv.u.lib_func;
+    if (tpath->is_hard || H5T__conv_i_i == func || H5T__conv_i_f == func || H5T__conv_f_f == func ||
+        H5T__conv_f_i == func || H5T__conv_s_s == func || H5T__conv_b_b == func ||
+        H5T__conv_order == func || H5T__conv_order_opt == func)
+        ret_value = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_par_safe() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5T__conv_par_allowed
+ *
+ * Purpose:   Determines whether a conversion along a path may be run on
+ *            a worker thread in the current API context: the conversion
+ *            must be safe to run concurrently, and no conversion
+ *            exception callback (application code) may be set.
+ *
+ * Return:    TRUE/FALSE/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5T__conv_par_allowed(const H5T_path_t *tpath)
+{
+    H5T_conv_cb_t cb_struct;        /* Conversion exception callback */
+    htri_t        ret_value = TRUE; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(tpath);
+
+    if (!H5T__conv_par_safe(tpath))
+        HGOTO_DONE(FALSE)
+#ifdef H5T_DEBUG
+    /* Statistics gathered by the conversion functions aren't thread-safe */
+    if (H5DEBUG(T))
+        HGOTO_DONE(FALSE)
+#endif
+
+    /* Exception callbacks are application code which must not be called
+     * from worker threads.  (This also caches the callback in the API
+     * context before the conversion functions look it up from the worker
+     * threads.)
+     */
+    if (H5CX_get_dt_conv_cb(&cb_struct) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "unable to get conversion exception callback")
+    if (cb_struct.func)
+        HGOTO_DONE(FALSE)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_par_allowed() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5T__conv_par_ntasks
+ *
+ * Purpose:   Determines how many tasks (each run on its own thread) a
+ *            conversion of NELMTS elements should be split into, from
+ *            the # of conversion threads in the API context and the
+ *            amount of data to convert.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__conv_par_ntasks(const H5T_path_t *tpath, size_t nelmts, size_t *ntasks)
+{
+    unsigned nthreads;            /* # of conversion threads */
+    size_t   elmt_size;           /* Largest element size */
+    htri_t   allowed;             /* Whether the conversion may run on worker threads */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(tpath);
+    HDassert(ntasks);
+
+    *ntasks = 1;
+
+    if (!H5T__conv_par_safe(tpath))
+        HGOTO_DONE(SUCCEED)
+
+    /* Quick check for enough data to be worth splitting up */
+    elmt_size = MAX(tpath->src->shared->size, tpath->dst->shared->size);
+    if (nelmts < 2 || (nelmts * elmt_size) < H5T_CONV_PAR_MIN_SIZE)
+        HGOTO_DONE(SUCCEED)
+
+    if (H5CX_get_conv_nthreads(&nthreads) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "unable to get # of conversion threads")
+    if (nthreads < 2)
+        HGOTO_DONE(SUCCEED)
+
+    if ((allowed = H5T__conv_par_allowed(tpath)) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't check for concurrent conversion")
+    if (!allowed)
+        HGOTO_DONE(SUCCEED)
+
+    *ntasks = MIN((size_t)nthreads, (nelmts * elmt_size) / H5T_CONV_PAR_MIN_TASK_SIZE);
+    *ntasks = MIN(*ntasks, nelmts);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_par_ntasks() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5T__conv_par_range
+ *
+ * Purpose:   Computes the range of elements converted by a task.
+ *
+ * Return:    void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T__conv_par_range(const H5T_conv_par_t *par, size_t task_idx, size_t *start, size_t *n)
+{
+    size_t per_task = par->nelmts / par->ntasks; /* Elements per task */
+    size_t extra    = par->nelmts % par->ntasks; /* Leftover elements, spread over the first tasks */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    *start = (task_idx * per_task) + MIN(task_idx, extra);
+    *n     = per_task + (task_idx < extra ? 1 : 0);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__conv_par_range() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5T__conv_par_inplace_task
+ *
+ * Purpose:   Worker thread task which converts a range of elements in
+ *            place, when each element's source and destination occupy
+ *            the same bytes of the buffer.
+ *
+ * Note:      Called on a worker thread.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__conv_par_inplace_task(size_t task_idx, void *_par)
+{
+    H5T_conv_par_t *par = (H5T_conv_par_t *)_par; /* Conversion info */
+    size_t          start, n;                     /* Range of elements to convert */
+    size_t          elmt_stride;                  /* Distance between elements */
+    herr_t          ret_value = SUCCEED;          /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    H5T__conv_par_range(par, task_idx, &start, &n);
+    elmt_stride = par->buf_stride ? par->buf_stride : par->src_size;
+
+#ifdef H5_HAVE_THREADSAFE
+    /* Worker threads need their own API context */
+    if (H5CX_push() < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTSET, FAIL, "can't set API context")
+#endif /* H5_HAVE_THREADSAFE */
+
+    if ((par->tpath->conv.u.lib_func)(par->src_id, par->dst_id, &(par->tpath->cdata), n, par->buf_stride,
+                                      (size_t)0, par->buf + (start * elmt_stride), NULL) < 0)
+        HDONE_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+
+#ifdef H5_HAVE_THREADSAFE
+    (void)H5CX_pop(FALSE);
+
+done:
+#endif /* H5_HAVE_THREADSAFE */
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_par_inplace_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5T__conv_par_scratch_task
+ *
+ * Purpose:   Worker thread task which copies a range of packed source
+ *            elements into the scratch buffer and converts them there,
+ *            for conversions which change the element size (where
+ *            converting in place would overwrite source elements of
+ *            other tasks).
+ *
+ * Note:      Called on a worker thread.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__conv_par_scratch_task(size_t task_idx, void *_par)
+{
+    H5T_conv_par_t *par = (H5T_conv_par_t *)_par; /* Conversion info */
+    size_t          start, n;                     /* Range of elements to convert */
+    uint8_t *       scratch;                      /* Part of scratch buffer for this task */
+    herr_t          ret_value = SUCCEED;          /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    H5T__conv_par_range(par, task_idx, &start, &n);
+    scratch = par->scratch + (start * MAX(par->src_size, par->dst_size));
+    H5MM_memcpy(scratch, par->buf + (start * par->src_size), n * par->src_size);
+
+#ifdef H5_HAVE_THREADSAFE
+    /* Worker threads need their own API context */
+    if (H5CX_push() < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTSET, FAIL, "can't set API context")
+#endif /* H5_HAVE_THREADSAFE */
+
+    if ((par->tpath->conv.u.lib_func)(par->src_id, par->dst_id, &(par->tpath->cdata), n, (size_t)0,
+                                      (size_t)0, scratch, NULL) < 0)
+        HDONE_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+
+#ifdef H5_HAVE_THREADSAFE
+    (void)H5CX_pop(FALSE);
+
+done:
+#endif /* H5_HAVE_THREADSAFE */
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_par_scratch_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5T__conv_par_copyback_task
+ *
+ * Purpose:   Worker thread task which copies a range of converted
+ *            elements from the scratch buffer back to the conversion
+ *            buffer, once all the source elements have been consumed.
+ *
+ * Note:      Called on a worker thread.
+ *
+ * Return:    Non-negative (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__conv_par_copyback_task(size_t task_idx, void *_par)
+{
+    H5T_conv_par_t *par = (H5T_conv_par_t *)_par; /* Conversion info */
+    size_t          start, n;                     /* Range of converted elements */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    H5T__conv_par_range(par, task_idx, &start, &n);
+    H5MM_memcpy(par->buf + (start * par->dst_size),
+                par->scratch + (start * MAX(par->src_size, par->dst_size)), n * par->dst_size);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5T__conv_par_copyback_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5T__conv_par
+ *
+ * Purpose:   Splits a conversion of NELMTS elements into NTASKS tasks of
+ *            contiguous element ranges, which are converted concurrently
+ *            by the conversion worker threads.
+ *
+ *            When the source and destination of each element occupy the
+ *            same bytes (same size, or a non-zero buffer stride), each
+ *            range is converted in place.  Otherwise each range is
+ *            converted in a scratch buffer and copied back after all
+ *            ranges have been converted.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__conv_par(H5T_path_t *tpath, hid_t src_id, hid_t dst_id, size_t ntasks, size_t nelmts,
+              size_t buf_stride, void *buf)
+{
+    H5T_conv_par_t par;                 /* Conversion info for tasks */
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(tpath);
+    HDassert(ntasks > 1);
+    HDassert(nelmts >= ntasks);
+    HDassert(buf);
+
+    par.scratch = NULL;
+
+    /* (Re)start the worker threads, if there aren't enough */
+    if (H5T_g.conv_pool && H5TS_pool_get_nthreads(H5T_g.conv_pool) < ntasks) {
+        if (H5TS_pool_destroy(H5T_g.conv_pool) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTRELEASE, FAIL, "can't shut down conversion threads")
+        H5T_g.conv_pool = NULL;
+    } /* end if */
+    if (NULL == H5T_g.conv_pool)
+        if (NULL == (H5T_g.conv_pool = H5TS_pool_create((unsigned)ntasks)))
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "can't start conversion threads")
+
+    /* Set up info for tasks */
+    par.tpath      = tpath;
+    par.src_id     = src_id;
+    par.dst_id     = dst_id;
+    par.nelmts     = nelmts;
+    par.ntasks     = ntasks;
+    par.buf_stride = buf_stride;
+    par.src_size   = tpath->src->shared->size;
+    par.dst_size   = tpath->dst->shared->size;
+    par.buf        = (uint8_t *)buf;
+
+    if (buf_stride || par.src_size == par.dst_size) {
+        if (H5TS_pool_run(H5T_g.conv_pool, ntasks, H5T__conv_par_inplace_task, &par) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+    } /* end if */
+    else {
+        if (NULL == (par.scratch = (uint8_t *)H5MM_malloc(nelmts * MAX(par.src_size, par.dst_size))))
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTALLOC, FAIL, "memory allocation failed for conversion")
+        if (H5TS_pool_run(H5T_g.conv_pool, ntasks, H5T__conv_par_scratch_task, &par) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+        if (H5TS_pool_run(H5T_g.conv_pool, ntasks, H5T__conv_par_copyback_task, &par) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCOPY, FAIL, "can't copy converted elements")
+    } /* end else */
+
+done:
+    par.scratch = (uint8_t *)H5MM_xfree(par.scratch);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_par() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5T_convert_can_overlap
+ *
+ * Purpose:   Determines whether a conversion along TPATH can be run on a
+ *            worker thread with H5T_convert_start(), overlapping with
+ *            other work on the calling thread.
+ *
+ * Return:    TRUE/FALSE/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5T_convert_can_overlap(const H5T_path_t *tpath)
+{
+    htri_t ret_value = FAIL; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(tpath);
+
+    /* Only one overlapped conversion can be in progress */
+    if (H5T_g.async_busy)
+        HGOTO_DONE(FALSE)
+
+    if ((ret_value = H5T__conv_par_allowed(tpath)) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't check for concurrent conversion")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_convert_can_overlap() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5T_convert_start
+ *
+ * Purpose:   Starts converting NELMTS packed elements in BUF along
+ *            TPATH on a worker thread and returns without waiting for
+ *            the conversion to complete.  The caller must not touch BUF
+ *            until H5T_convert_wait() has been called.
+ *
+ *            H5T_convert_can_overlap() must have returned TRUE for the
+ *            path in the current API context.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T_convert_start(H5T_path_t *tpath, hid_t src_id, hid_t dst_id, size_t nelmts, void *buf)
+{
+    H5T_conv_par_t *par       = &H5T_g.async_par; /* Conversion info for task */
+    herr_t          ret_value = SUCCEED;          /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(tpath);
+    HDassert(buf);
+    HDassert(!H5T_g.async_busy);
+
+    /* Start the worker thread, the first time through */
+    if (NULL == H5T_g.async_pool)
+        if (NULL == (H5T_g.async_pool = H5TS_pool_create(2)))
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "can't start conversion thread")
+
+    /* Set up info for the task, which converts all the elements in place */
+    par->tpath      = tpath;
+    par->src_id     = src_id;
+    par->dst_id     = dst_id;
+    par->nelmts     = nelmts;
+    par->ntasks     = 1;
+    par->buf_stride = 0;
+    par->src_size   = tpath->src->shared->size;
+    par->dst_size   = tpath->dst->shared->size;
+    par->buf        = (uint8_t *)buf;
+    par->scratch    = NULL;
+
+    tpath->cdata.command = H5T_CONV_CONV;
+    if (H5TS_pool_start(H5T_g.async_pool, (size_t)1, H5T__conv_par_inplace_task, par) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "can't start datatype conversion")
+    H5T_g.async_busy = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_convert_start() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5T_convert_wait
+ *
+ * Purpose:   Waits for the conversion started with H5T_convert_start()
+ *            to complete.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T_convert_wait(void)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(H5T_g.async_busy);
+
+    H5T_g.async_busy = FALSE;
+    if (H5TS_pool_wait(H5T_g.async_pool) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_convert_wait() */
+#endif /* H5_HAVE_WORKER_THREADS */
+
 /*-------------------------------------------------------------------------
  * Function:  H5T_oloc
  *
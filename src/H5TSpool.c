@@ -0,0 +1,411 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	This file contains a small pool of internal worker threads,
+ *		which the library uses to split a single operation (e.g. a
+ *		datatype conversion over a large buffer) into independent
+ *		tasks that are run concurrently.
+ *
+ *		The thread which calls H5TS_pool_run() also executes tasks,
+ *		so a pool created for 'n' threads starts 'n - 1' workers.
+ *		Only one batch of tasks may be run on a pool at a time.
+ *		A batch can also be started with H5TS_pool_start() and
+ *		retired later with H5TS_pool_wait(), letting the calling
+ *		thread do unrelated work while the workers execute it.
+ *
+ * Note:	Worker threads never enter the library through the API and
+ *		are not registered with the thread-safety framework, so the
+ *		task callbacks must only perform operations that are safe to
+ *		execute concurrently (no metadata cache, no ID registration,
+ *		no file I/O, etc.).
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"   /* Generic Functions                        */
+#include "H5Eprivate.h"  /* Error handling                           */
+#include "H5MMprivate.h" /* Memory management                        */
+
+#ifdef H5_HAVE_WORKER_THREADS
+
+/****************/
+/* Local Macros */
+/****************/
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/* Pool of worker threads */
+struct H5TS_pool_t {
+    pthread_mutex_t mutex;     /* Protects all the fields below */
+    pthread_cond_t  work_cond; /* Signaled when a new batch is posted or the pool shuts down */
+    pthread_cond_t  done_cond; /* Signaled when the last task of a batch completes */
+    unsigned        nthreads;  /* # of threads executing tasks, including the caller */
+    unsigned        nworkers;  /* # of worker threads started */
+    pthread_t *     workers;   /* Worker thread handles */
+    hbool_t         shutdown;  /* Whether the workers should exit */
+
+    /* Current batch of tasks */
+    H5TS_pool_task_t task;      /* Task callback (NULL when idle) */
+    void *           udata;     /* User data for task callback */
+    size_t           ntasks;    /* # of tasks in batch */
+    size_t           next_task; /* Index of next task to hand out */
+    size_t           ndone;     /* # of tasks completed */
+    hbool_t          failed;    /* Whether any task failed */
+};
+
+/********************/
+/* Local Prototypes */
+/********************/
+static void *H5TS__pool_worker(void *_pool);
+static void  H5TS__pool_exec(H5TS_pool_t *pool);
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS__pool_exec
+ *
+ * RETURNS
+ *    None
+ *
+ * DESCRIPTION
+ *    Executes tasks from the current batch until none remain.  Must be
+ *    called with the pool's mutex held, which is released while each task
+ *    executes.
+ *
+ *--------------------------------------------------------------------------
+ */
+static void
+H5TS__pool_exec(H5TS_pool_t *pool)
+{
+    FUNC_ENTER_STATIC_NAMECHECK_ONLY
+
+    while (pool->task && pool->next_task < pool->ntasks) {
+        H5TS_pool_task_t task     = pool->task;
+        void *           udata    = pool->udata;
+        size_t           task_idx = pool->next_task++;
+        herr_t           status;
+
+        HDpthread_mutex_unlock(&pool->mutex);
+        status = (task)(task_idx, udata);
+        HDpthread_mutex_lock(&pool->mutex);
+
+        if (status < 0)
+            pool->failed = TRUE;
+        if (++pool->ndone == pool->ntasks)
+            HDpthread_cond_signal(&pool->done_cond);
+    } /* end while */
+
+    FUNC_LEAVE_NOAPI_VOID_NAMECHECK_ONLY
+} /* H5TS__pool_exec() */
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS__pool_worker
+ *
+ * RETURNS
+ *    NULL
+ *
+ * DESCRIPTION
+ *    Main routine for a worker thread: waits for batches of tasks to be
+ *    posted and executes them, until the pool is shut down.
+ *
+ *--------------------------------------------------------------------------
+ */
+static void *
+H5TS__pool_worker(void *_pool)
+{
+    H5TS_pool_t *pool = (H5TS_pool_t *)_pool;
+
+    FUNC_ENTER_STATIC_NAMECHECK_ONLY
+
+    HDpthread_mutex_lock(&pool->mutex);
+    while (!pool->shutdown) {
+        if (pool->task && pool->next_task < pool->ntasks)
+            H5TS__pool_exec(pool);
+        else
+            HDpthread_cond_wait(&pool->work_cond, &pool->mutex);
+    } /* end while */
+    HDpthread_mutex_unlock(&pool->mutex);
+
+    FUNC_LEAVE_NOAPI_NAMECHECK_ONLY(NULL)
+} /* H5TS__pool_worker() */
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_pool_create
+ *
+ * RETURNS
+ *    Pointer to new pool on success / NULL on failure
+ *
+ * DESCRIPTION
+ *    Creates a pool that executes tasks on NTHREADS threads, one of which
+ *    is the thread calling H5TS_pool_run().
+ *
+ *--------------------------------------------------------------------------
+ */
+H5TS_pool_t *
+H5TS_pool_create(unsigned nthreads)
+{
+    H5TS_pool_t *pool       = NULL;
+    hbool_t      mutex_init = FALSE, work_cond_init = FALSE, done_cond_init = FALSE;
+    H5TS_pool_t *ret_value  = NULL;
+
+    FUNC_ENTER_NOAPI(NULL)
+
+    HDassert(nthreads > 0);
+
+    if (NULL == (pool = (H5TS_pool_t *)H5MM_calloc(sizeof(H5TS_pool_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for worker thread pool")
+    if (nthreads > 1 &&
+        NULL == (pool->workers = (pthread_t *)H5MM_malloc((nthreads - 1) * sizeof(pthread_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for worker threads")
+
+    if (HDpthread_mutex_init(&pool->mutex, NULL))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, NULL, "can't initialize worker thread pool mutex")
+    mutex_init = TRUE;
+    if (HDpthread_cond_init(&pool->work_cond, NULL))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, NULL, "can't initialize worker thread pool condition")
+    work_cond_init = TRUE;
+    if (HDpthread_cond_init(&pool->done_cond, NULL))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, NULL, "can't initialize worker thread pool condition")
+    done_cond_init = TRUE;
+
+    /* Start the worker threads */
+    pool->nthreads = nthreads;
+    for (pool->nworkers = 0; pool->nworkers < nthreads - 1; pool->nworkers++)
+        if (HDpthread_create(&pool->workers[pool->nworkers], NULL, H5TS__pool_worker, pool))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTCREATE, NULL, "can't create worker thread")
+
+    /* Set return value */
+    ret_value = pool;
+
+done:
+    if (NULL == ret_value && pool) {
+        if (pool->nworkers > 0) {
+            if (H5TS_pool_destroy(pool) < 0)
+                HDONE_ERROR(H5E_RESOURCE, H5E_CANTRELEASE, NULL, "can't shut down worker thread pool")
+        } /* end if */
+        else {
+            if (done_cond_init)
+                HDpthread_cond_destroy(&pool->done_cond);
+            if (work_cond_init)
+                HDpthread_cond_destroy(&pool->work_cond);
+            if (mutex_init)
+                HDpthread_mutex_destroy(&pool->mutex);
+            H5MM_xfree(pool->workers);
+            H5MM_xfree(pool);
+        } /* end else */
+    }     /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5TS_pool_create() */
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_pool_get_nthreads
+ *
+ * RETURNS
+ *    # of threads which execute tasks, including the calling thread
+ *
+ *--------------------------------------------------------------------------
+ */
+unsigned
+H5TS_pool_get_nthreads(const H5TS_pool_t *pool)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(pool);
+
+    FUNC_LEAVE_NOAPI(pool->nthreads)
+} /* H5TS_pool_get_nthreads() */
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_pool_run
+ *
+ * RETURNS
+ *    Non-negative on success / Negative on failure
+ *
+ * DESCRIPTION
+ *    Executes TASK for each task index in [0, NTASKS) on the threads of
+ *    POOL (including the calling thread) and waits for all of them to
+ *    complete.  Fails if any of the tasks failed.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_pool_run(H5TS_pool_t *pool, size_t ntasks, H5TS_pool_task_t task, void *udata)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(pool);
+    HDassert(task);
+
+    if (ntasks == 0)
+        HGOTO_DONE(SUCCEED)
+
+    if (H5TS_pool_start(pool, ntasks, task, udata) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTOPERATE, FAIL, "can't start worker thread tasks")
+    if (H5TS_pool_wait(pool) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTOPERATE, FAIL, "worker thread task failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5TS_pool_run() */
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_pool_start
+ *
+ * RETURNS
+ *    Non-negative on success / Negative on failure
+ *
+ * DESCRIPTION
+ *    Posts a batch of NTASKS tasks to the worker threads of POOL and
+ *    returns without waiting for them, so the calling thread can do other
+ *    work while they execute.  The batch must be retired with
+ *    H5TS_pool_wait() before another batch is started.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_pool_start(H5TS_pool_t *pool, size_t ntasks, H5TS_pool_task_t task, void *udata)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(pool);
+    HDassert(task);
+    HDassert(ntasks > 0);
+
+    HDpthread_mutex_lock(&pool->mutex);
+    HDassert(NULL == pool->task);
+    pool->task      = task;
+    pool->udata     = udata;
+    pool->ntasks    = ntasks;
+    pool->next_task = 0;
+    pool->ndone     = 0;
+    pool->failed    = FALSE;
+    HDpthread_cond_broadcast(&pool->work_cond);
+    HDpthread_mutex_unlock(&pool->mutex);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5TS_pool_start() */
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_pool_wait
+ *
+ * RETURNS
+ *    Non-negative on success / Negative on failure
+ *
+ * DESCRIPTION
+ *    Retires the batch of tasks posted with H5TS_pool_start(), executing
+ *    any tasks which haven't been picked up by a worker thread yet and
+ *    waiting for the rest to complete.  Fails if any of the tasks failed.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_pool_wait(H5TS_pool_t *pool)
+{
+    hbool_t failed;
+    herr_t  ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(pool);
+
+    /* Help with the tasks, then wait for the workers to finish theirs */
+    HDpthread_mutex_lock(&pool->mutex);
+    HDassert(pool->task);
+    H5TS__pool_exec(pool);
+    while (pool->ndone < pool->ntasks)
+        HDpthread_cond_wait(&pool->done_cond, &pool->mutex);
+
+    /* Retire the batch */
+    failed      = pool->failed;
+    pool->task  = NULL;
+    pool->udata = NULL;
+    HDpthread_mutex_unlock(&pool->mutex);
+
+    if (failed)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTOPERATE, FAIL, "worker thread task failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5TS_pool_wait() */
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_pool_destroy
+ *
+ * RETURNS
+ *    Non-negative on success / Negative on failure
+ *
+ * DESCRIPTION
+ *    Shuts down the worker threads of POOL and releases it.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_pool_destroy(H5TS_pool_t *pool)
+{
+    unsigned u;
+    herr_t   ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(pool);
+    HDassert(NULL == pool->task);
+
+    /* Wake the workers and wait for them to exit */
+    HDpthread_mutex_lock(&pool->mutex);
+    pool->shutdown = TRUE;
+    HDpthread_cond_broadcast(&pool->work_cond);
+    HDpthread_mutex_unlock(&pool->mutex);
+    for (u = 0; u < pool->nworkers; u++)
+        if (HDpthread_join(pool->workers[u], NULL))
+            HDONE_ERROR(H5E_RESOURCE, H5E_CANTRELEASE, FAIL, "can't join worker thread")
+
+    HDpthread_cond_destroy(&pool->done_cond);
+    HDpthread_cond_destroy(&pool->work_cond);
+    HDpthread_mutex_destroy(&pool->mutex);
+    H5MM_xfree(pool->workers);
+    H5MM_xfree(pool);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5TS_pool_destroy() */
+
+#endif /* H5_HAVE_WORKER_THREADS */
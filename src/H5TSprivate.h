@@ -137,4 +137,26 @@ H5_DLL H5TS_thread_t H5TS_create_thread(void *(*func)(void *), H5TS_attr_t *attr
 
 #endif /* H5_HAVE_THREADSAFE */
 
+#ifdef H5_HAVE_WORKER_THREADS
+
+/* Pool of internal worker threads, used to split a single operation
+ * into independent tasks which are run concurrently.  These threads never
+ * enter the library through the API, so they are independent of the
+ * thread-safety framework above.
+ */
+typedef struct H5TS_pool_t H5TS_pool_t;
+
+/* Task callback for a pool of worker threads */
+typedef herr_t (*H5TS_pool_task_t)(size_t task_idx, void *udata);
+
+/* Worker thread pool routines */
+H5_DLL H5TS_pool_t *H5TS_pool_create(unsigned nthreads);
+H5_DLL unsigned     H5TS_pool_get_nthreads(const H5TS_pool_t *pool);
+H5_DLL herr_t       H5TS_pool_run(H5TS_pool_t *pool, size_t ntasks, H5TS_pool_task_t task, void *udata);
+H5_DLL herr_t       H5TS_pool_start(H5TS_pool_t *pool, size_t ntasks, H5TS_pool_task_t task, void *udata);
+H5_DLL herr_t       H5TS_pool_wait(H5TS_pool_t *pool);
+H5_DLL herr_t       H5TS_pool_destroy(H5TS_pool_t *pool);
+
+#endif /* H5_HAVE_WORKER_THREADS */
+
 #endif /* H5TSprivate_H_ */
@@ -22,7 +22,6 @@
 #include "H5Eprivate.h"  /*error handling			  */
 #include "H5MMprivate.h" /* Memory management			*/
 #include "H5Tpkg.h"      /*data-type functions			  */
-#include "H5WBprivate.h" /* Wrapped Buffers                      */
 
 /*-------------------------------------------------------------------------
  * Function:    H5T__bit_copy
@@ -168,9 +167,9 @@ H5T__bit_copy(uint8_t *dst, size_t dst_offset, const uint8_t *src, size_t src_of
 herr_t
 H5T__bit_shift(uint8_t *buf, ssize_t shift_dist, size_t offset, size_t size)
 {
-    uint8_t tmp_buf[512];        /* Temporary buffer */
-    H5WB_t *wb        = NULL;    /* Wrapped buffer for temporary buffer */
-    herr_t  ret_value = SUCCEED; /* Return value */
+    uint8_t  tmp_buf[512];        /* Temporary buffer */
+    uint8_t *big_buf   = NULL;    /* Dynamically allocated buffer, if needed */
+    herr_t   ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
 
@@ -187,13 +186,14 @@ H5T__bit_shift(uint8_t *buf, ssize_t shift_dist, size_t offset, size_t size)
             size_t   buf_size = (size / 8) + 1; /* Size of shift buffer needed */
             uint8_t *shift_buf;                 /* Pointer to shift buffer */
 
-            /* Wrap the local buffer for serialized header info */
-            if (NULL == (wb = H5WB_wrap(tmp_buf, sizeof(tmp_buf))))
-                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "can't wrap buffer")
-
-            /* Get a pointer to a buffer that's large enough  */
-            if (NULL == (shift_buf = (uint8_t *)H5WB_actual(wb, buf_size)))
-                HGOTO_ERROR(H5E_DATATYPE, H5E_NOSPACE, FAIL, "can't get actual buffer")
+            /* Use the local buffer when it's large enough.  This routine may be
+             * called from datatype conversion worker threads, so avoid the
+             * (unsynchronized) free lists behind wrapped buffers.
+             */
+            if (buf_size <= sizeof(tmp_buf))
+                shift_buf = tmp_buf;
+            else if (NULL == (shift_buf = big_buf = (uint8_t *)H5MM_malloc(buf_size)))
+                HGOTO_ERROR(H5E_DATATYPE, H5E_NOSPACE, FAIL, "can't allocate shift buffer")
 
             /* Shift vector by making copies */
             if (shift_dist > 0) { /* left shift */
@@ -216,8 +216,7 @@ H5T__bit_shift(uint8_t *buf, ssize_t shift_dist, size_t offset, size_t size)
 
 done:
     /* Release resources */
-    if (wb && H5WB_unwrap(wb) < 0)
-        HDONE_ERROR(H5E_DATATYPE, H5E_CLOSEERROR, FAIL, "can't close wrapped buffer")
+    H5MM_xfree(big_buf);
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T__bit_shift() */
@@ -34,6 +34,10 @@
 #include "H5Pprivate.h"  /* Property lists            */
 #include "H5Tpkg.h"      /* Datatypes                */
 
+#ifdef __F16C__
+#include <immintrin.h> /* F16C half precision conversion instructions */
+#endif
+
 /****************/
 /* Local Macros */
 /****************/
@@ -538,6 +542,147 @@
         H5T_CONV(H5T_CONV_Ff, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N)                                         \
     }
 
+/* The main part of the hardware conversion functions for 16-bit floating-point
+ * types (IEEE half precision and bfloat16).  There's no C type for these, so
+ * they are stored in a uint16_t in native byte order and moved in and out of
+ * the buffer with memcpy, which also takes care of alignment.  The element
+ * conversion is done by H5T__<STYPE>_to_<DTYPE>(), which sets its 'overflow'
+ * argument to 1 (-1) when a finite value is too large (small) to represent.
+ */
+#define H5T_CONV_F16(STYPE, DTYPE, ST, DT)                                                                   \
+    {                                                                                                        \
+        herr_t ret_value = SUCCEED; /* Return value         */                                               \
+                                                                                                             \
+        FUNC_ENTER_PACKAGE                                                                                   \
+                                                                                                             \
+        {                                                                                                    \
+            size_t        elmtno;             /*element number        */                                     \
+            uint8_t *     src, *dst;          /*source & destination elements */                             \
+            H5T_t *       st, *dt;            /*datatype descriptors        */                               \
+            ssize_t       s_stride, d_stride; /*src and dst strides        */                                \
+            H5T_conv_cb_t cb_struct;          /*conversion callback structure */                             \
+                                                                                                             \
+            switch (cdata->command) {                                                                        \
+                case H5T_CONV_INIT:                                                                          \
+                    /* Sanity check */                                                                       \
+                    cdata->need_bkg = H5T_BKG_NO;                                                            \
+                    if (NULL == (st = (H5T_t *)H5I_object(src_id)) ||                                        \
+                        NULL == (dt = (H5T_t *)H5I_object(dst_id)))                                          \
+                        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL,                                        \
+                                    "unable to dereference datatype object ID")                              \
+                    if (st->shared->size != sizeof(ST) || dt->shared->size != sizeof(DT))                    \
+                        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "disagreement about datatype size")    \
+                    break;                                                                                   \
+                                                                                                             \
+                case H5T_CONV_FREE:                                                                          \
+                    break;                                                                                   \
+                                                                                                             \
+                case H5T_CONV_CONV:                                                                          \
+                    /* Initialize source & destination strides */                                            \
+                    if (buf_stride) {                                                                        \
+                        HDassert(buf_stride >= sizeof(ST));                                                  \
+                        HDassert(buf_stride >= sizeof(DT));                                                  \
+                        s_stride = d_stride = (ssize_t)buf_stride;                                           \
+                    }                                                                                        \
+                    else {                                                                                   \
+                        s_stride = sizeof(ST);                                                               \
+                        d_stride = sizeof(DT);                                                               \
+                    }                                                                                        \
+                                                                                                             \
+                    /* Get conversion exception callback property */                                         \
+                    if (H5CX_get_dt_conv_cb(&cb_struct) < 0)                                                 \
+                        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL,                                         \
+                                    "unable to get conversion exception callback")                           \
+                                                                                                             \
+                    /* Walk the buffer backwards when the destination elements */                            \
+                    /* are larger, so no source element is overwritten before */                             \
+                    /* it's converted */                                                                     \
+                    if (d_stride > s_stride) {                                                               \
+                        src      = (uint8_t *)buf + (nelmts - 1) * (size_t)s_stride;                         \
+                        dst      = (uint8_t *)buf + (nelmts - 1) * (size_t)d_stride;                         \
+                        s_stride = -s_stride;                                                                \
+                        d_stride = -d_stride;                                                                \
+                    }                                                                                        \
+                    else                                                                                     \
+                        src = dst = (uint8_t *)buf;                                                          \
+                                                                                                             \
+                    for (elmtno = 0; elmtno < nelmts; elmtno++) {                                            \
+                        ST  s_val;        /*source value */                                                  \
+                        DT  d_val;        /*destination value */                                             \
+                        int overflow = 0; /*direction of overflow, if any */                                 \
+                                                                                                             \
+                        /* No C type to align to, so always move through a local */                          \
+                        H5MM_memcpy(&s_val, src, sizeof(ST));                                                \
+                        d_val = H5_GLUE4(H5T__, STYPE, _to_, DTYPE)(s_val, &overflow);                       \
+                        if (overflow && cb_struct.func) {                                                    \
+                            H5T_conv_ret_t except_ret =                                                      \
+                                (cb_struct.func)(overflow > 0 ? H5T_CONV_EXCEPT_RANGE_HI                     \
+                                                              : H5T_CONV_EXCEPT_RANGE_LOW,                   \
+                                                 src_id, dst_id, src, dst, cb_struct.user_data);             \
+                            if (except_ret == H5T_CONV_ABORT)                                                \
+                                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL,                             \
+                                            "can't handle conversion exception")                             \
+                            else if (except_ret == H5T_CONV_UNHANDLED)                                       \
+                                H5MM_memcpy(dst, &d_val, sizeof(DT));                                        \
+                            /* if(except_ret==H5T_CONV_HANDLED): user handled it */                          \
+                        }                                                                                    \
+                        else                                                                                 \
+                            H5MM_memcpy(dst, &d_val, sizeof(DT));                                            \
+                                                                                                             \
+                        src += s_stride;                                                                     \
+                        dst += d_stride;                                                                     \
+                    } /* end for */                                                                          \
+                    break;                                                                                   \
+                                                                                                             \
+                default:                                                                                     \
+                    HGOTO_ERROR(H5E_DATATYPE, H5E_UNSUPPORTED, FAIL, "unknown conversion command");          \
+            }                                                                                                \
+        }                                                                                                    \
+                                                                                                             \
+done:                                                                                                        \
+        FUNC_LEAVE_NOAPI(ret_value)                                                                          \
+    }
+
+/* The loop of the native-arithmetic fast path of H5T__conv_f_f() (see
+ * H5T__conv_f_f_native()).  Each value is moved into a native variable, byte
+ * swapping as needed, converted by the compiler and moved back out.  When
+ * narrowing, values outside the range of the destination become infinity, as
+ * for the hard conversions.
+ */
+#define H5T_CONV_F_F_NATIVE_LOOP(ST, DT, CORE)                                                               \
+    {                                                                                                        \
+        ST s_val;                                                                                            \
+        DT d_val;                                                                                            \
+                                                                                                             \
+        for (elmtno = 0; elmtno < nelmts; elmtno++) {                                                        \
+            H5T__conv_f_f_move((uint8_t *)&s_val, s, sizeof(ST), s_swap);                                    \
+            CORE(ST, DT, s_val, d_val)                                                                       \
+            if (d_pad)                                                                                       \
+                H5T__conv_f_f_clear_pad((uint8_t *)&d_val, sizeof(DT), dst_prec);                            \
+            H5T__conv_f_f_move(d, (const uint8_t *)&d_val, sizeof(DT), d_swap);                              \
+            s += s_stride;                                                                                   \
+            d += d_stride;                                                                                   \
+        }                                                                                                    \
+    }
+
+/* Widening (or same size) and narrowing element conversions for H5T_CONV_F_F_NATIVE_LOOP */
+#define H5T_CONV_F_F_NATIVE_WIDEN(ST, DT, S, D) (D) = (DT)(S);
+#define H5T_CONV_F_F_NATIVE_NARROW(ST, DT, S, D, D_MAX, D_POS_INF, D_NEG_INF)                                \
+    {                                                                                                        \
+        if ((S) > (ST)(D_MAX))                                                                               \
+            (D) = (DT)(D_POS_INF);                                                                           \
+        else if ((S) < -(ST)(D_MAX))                                                                         \
+            (D) = (DT)(D_NEG_INF);                                                                           \
+        else                                                                                                 \
+            (D) = (DT)(S);                                                                                   \
+    }
+#define H5T_CONV_F_F_NATIVE_TO_FLOAT(ST, DT, S, D)                                                           \
+    H5T_CONV_F_F_NATIVE_NARROW(ST, DT, S, D, FLT_MAX, H5T_NATIVE_FLOAT_POS_INF_g,                            \
+                               H5T_NATIVE_FLOAT_NEG_INF_g)
+#define H5T_CONV_F_F_NATIVE_TO_DOUBLE(ST, DT, S, D)                                                          \
+    H5T_CONV_F_F_NATIVE_NARROW(ST, DT, S, D, DBL_MAX, H5T_NATIVE_DOUBLE_POS_INF_g,                           \
+                               H5T_NATIVE_DOUBLE_NEG_INF_g)
+
 #define H5T_HI_LO_BIT_SET(TYP, V, LO, HI)                                                                    \
     {                                                                                                        \
         unsigned      count;                                                                                 \
@@ -1032,6 +1177,11 @@ done:
 /* Minimum size of variable-length conversion buffer */
 #define H5T_VLEN_MIN_CONF_BUF_SIZE 4096
 
+/* Largest number of variable-length sequences, and number of bytes of their
+ * data, read or written together by H5T__conv_vlen() */
+#define H5T_VLEN_BATCH_NELMTS 4096
+#define H5T_VLEN_BATCH_SIZE   (1024 * 1024)
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -1053,6 +1203,39 @@ typedef struct H5T_enum_struct_t {
     int *    src2dst; /*map from src to dst index         */
 } H5T_enum_struct_t;
 
+/* Native floating-point types a soft floating-point conversion can go through */
+typedef enum H5T_conv_f_native_t {
+    H5T_CONV_F_NONE = 0, /*not laid out like a native type    */
+    H5T_CONV_F_FLOAT,    /*laid out like a native float       */
+    H5T_CONV_F_DOUBLE,   /*laid out like a native double      */
+    H5T_CONV_F_LDOUBLE   /*laid out like a native long double */
+} H5T_conv_f_native_t;
+
+/* Conversion data for H5T__conv_f_f() */
+typedef struct H5T_conv_f_f_t {
+    H5T_conv_f_native_t src_native; /*native type matching the source layout      */
+    H5T_conv_f_native_t dst_native; /*native type matching the destination layout */
+} H5T_conv_f_f_t;
+
+/* Variable-length sequences read or written together by H5T__conv_vlen() */
+typedef struct H5T_vlen_batch_t {
+    size_t       nalloc;    /*number of entries in each array          */
+    size_t       nelmts;    /*number of elements in the batch (reads)  */
+    size_t       next;      /*next element to convert (reads)          */
+    size_t       nseq;      /*number of sequences to read or write     */
+    hbool_t *    is_nil;    /*whether each element is "nil" (reads)    */
+    size_t *     seq_len;   /*number of base elements in each sequence */
+    size_t *     off;       /*offset of each sequence's staged data    */
+    size_t *     len;       /*size of each sequence in bytes (reads)   */
+    void **      vl;        /*VL information of each sequence          */
+    void **      bg;        /*background of each sequence (writes)     */
+    void **      buf;       /*buffer of each sequence (reads)          */
+    const void **cbuf;      /*buffer of each sequence (writes)         */
+    uint8_t *    data;      /*staging buffer for the sequences' data   */
+    size_t       data_size; /*size of staging buffer                  */
+    size_t       data_used; /*bytes used in staging buffer             */
+} H5T_vlen_batch_t;
+
 /* Conversion data for the hardware conversion functions */
 typedef struct H5T_conv_hw_t {
     size_t s_aligned; /*number source elements aligned     */
@@ -1068,6 +1251,17 @@ typedef struct H5T_conv_hw_t {
 /********************/
 
 static herr_t H5T__reverse_order(uint8_t *rev, uint8_t *s, size_t size, H5T_order_t order);
+static H5T_conv_f_native_t H5T__conv_f_native(const H5T_t *dt);
+static void H5T__conv_f_f_native(const H5T_t *src_p, const H5T_t *dst_p, const H5T_conv_f_f_t *priv,
+                                 size_t nelmts, size_t buf_stride, void *buf);
+static herr_t H5T__conv_vlen_batch_init(H5T_vlen_batch_t *batch, size_t nalloc);
+static void   H5T__conv_vlen_batch_free(H5T_vlen_batch_t *batch);
+static herr_t H5T__conv_vlen_batch_stage(H5T_vlen_batch_t *batch, size_t nbytes, size_t *off);
+static herr_t H5T__conv_vlen_batch_read(const H5T_t *src, H5T_vlen_batch_t *batch, uint8_t *s,
+                                        ssize_t s_stride, size_t nelmts, size_t src_base_size);
+static herr_t H5T__conv_vlen_batch_add(const H5T_t *dst, H5T_vlen_batch_t *batch, void *d, void *b,
+                                       void *buf, size_t seq_len, size_t dst_base_size, hbool_t copy);
+static herr_t H5T__conv_vlen_batch_write(const H5T_t *dst, H5T_vlen_batch_t *batch, size_t dst_base_size);
 
 /*********************/
 /* Public Variables */
@@ -3075,6 +3269,276 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T__conv_enum_numeric() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vlen_batch_init
+ *
+ * Purpose:     Allocates the arrays of a batch of up to NALLOC VL
+ *              sequences for H5T__conv_vlen(), along with an initial
+ *              staging buffer for their data.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__conv_vlen_batch_init(H5T_vlen_batch_t *batch, size_t nalloc)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(batch);
+    HDassert(nalloc > 0);
+
+    HDmemset(batch, 0, sizeof(*batch));
+    if (NULL == (batch->is_nil = (hbool_t *)H5MM_malloc(nalloc * sizeof(hbool_t))) ||
+        NULL == (batch->seq_len = (size_t *)H5MM_malloc(nalloc * sizeof(size_t))) ||
+        NULL == (batch->off = (size_t *)H5MM_malloc(nalloc * sizeof(size_t))) ||
+        NULL == (batch->len = (size_t *)H5MM_malloc(nalloc * sizeof(size_t))) ||
+        NULL == (batch->vl = (void **)H5MM_malloc(nalloc * sizeof(void *))) ||
+        NULL == (batch->bg = (void **)H5MM_malloc(nalloc * sizeof(void *))) ||
+        NULL == (batch->buf = (void **)H5MM_malloc(nalloc * sizeof(void *))) ||
+        NULL == (batch->cbuf = (const void **)H5MM_malloc(nalloc * sizeof(void *))) ||
+        NULL == (batch->data = (uint8_t *)H5MM_malloc(H5T_VLEN_MIN_CONF_BUF_SIZE)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for VL batch")
+    batch->nalloc    = nalloc;
+    batch->data_size = H5T_VLEN_MIN_CONF_BUF_SIZE;
+
+done:
+    if (ret_value < 0)
+        H5T__conv_vlen_batch_free(batch);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_vlen_batch_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vlen_batch_free
+ *
+ * Purpose:     Releases the arrays and staging buffer of a batch of VL
+ *              sequences.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T__conv_vlen_batch_free(H5T_vlen_batch_t *batch)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(batch);
+
+    H5MM_xfree(batch->is_nil);
+    H5MM_xfree(batch->seq_len);
+    H5MM_xfree(batch->off);
+    H5MM_xfree(batch->len);
+    H5MM_xfree(batch->vl);
+    H5MM_xfree(batch->bg);
+    H5MM_xfree(batch->buf);
+    H5MM_xfree((void *)batch->cbuf); /* Casting away 'const' OK */
+    H5MM_xfree(batch->data);
+    HDmemset(batch, 0, sizeof(*batch));
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__conv_vlen_batch_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vlen_batch_stage
+ *
+ * Purpose:     Reserves NBYTES bytes at the end of the staging buffer of
+ *              a batch, growing the buffer if needed.  The offset of the
+ *              bytes is returned since growing the buffer moves it.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__conv_vlen_batch_stage(H5T_vlen_batch_t *batch, size_t nbytes, size_t *off)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(batch);
+    HDassert(off);
+
+    if (batch->data_used + nbytes > batch->data_size) {
+        size_t   new_size = MAX(2 * batch->data_size, batch->data_used + nbytes);
+        uint8_t *new_data;
+
+        if (NULL == (new_data = (uint8_t *)H5MM_realloc(batch->data, new_size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for VL batch")
+        batch->data      = new_data;
+        batch->data_size = new_size;
+    } /* end if */
+
+    *off = batch->data_used;
+    batch->data_used += nbytes;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_vlen_batch_stage() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vlen_batch_read
+ *
+ * Purpose:     Reads the sequences of up to NELMTS source elements at S
+ *              (and every S_STRIDE bytes after) into a batch, with one
+ *              call to the 'readv' callback of the source's VL class.
+ *              The batch ends early once its data would exceed
+ *              H5T_VLEN_BATCH_SIZE bytes.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__conv_vlen_batch_read(const H5T_t *src, H5T_vlen_batch_t *batch, uint8_t *s, ssize_t s_stride,
+                          size_t nelmts, size_t src_base_size)
+{
+    H5VL_object_t *file = src->shared->u.vlen.file; /* File holding the sequences */
+    size_t         u, v;                             /* Local index variables */
+    herr_t         ret_value = SUCCEED;              /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(src->shared->u.vlen.cls->readv);
+    HDassert(batch);
+
+    batch->nelmts = batch->next = batch->nseq = batch->data_used = 0;
+    for (u = 0; u < nelmts && u < batch->nalloc; u++, s += s_stride) {
+        hbool_t is_nil;      /* Whether sequence is "nil" */
+        size_t  seq_len = 0; /* The number of elements in the sequence */
+
+        if ((*(src->shared->u.vlen.cls->isnull))(file, s, &is_nil) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't check if VL data is 'nil'")
+        if (!is_nil) {
+            size_t nbytes; /* Size of the sequence in bytes */
+
+            if ((*(src->shared->u.vlen.cls->getlen))(file, s, &seq_len) < 0)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "bad sequence length")
+            nbytes = seq_len * src_base_size;
+
+            /* Leave the sequence for the next batch if this one is full */
+            if (u > 0 && batch->data_used + nbytes > H5T_VLEN_BATCH_SIZE)
+                break;
+
+            if (H5T__conv_vlen_batch_stage(batch, nbytes, &batch->off[u]) < 0)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTALLOC, FAIL, "can't stage VL data")
+            batch->vl[batch->nseq]  = s;
+            batch->len[batch->nseq] = nbytes;
+            batch->nseq++;
+        } /* end if */
+        batch->is_nil[u]  = is_nil;
+        batch->seq_len[u] = seq_len;
+        batch->nelmts++;
+    } /* end for */
+
+    /* Point at the staged data, now that the staging buffer won't move */
+    for (u = 0, v = 0; u < batch->nelmts; u++)
+        if (!batch->is_nil[u])
+            batch->buf[v++] = batch->data + batch->off[u];
+
+    /* Read all the sequences */
+    if (batch->nseq > 0)
+        if ((*(src->shared->u.vlen.cls->readv))(file, batch->nseq, batch->vl, batch->buf, batch->len) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_READERROR, FAIL, "can't read VL data")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_vlen_batch_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vlen_batch_add
+ *
+ * Purpose:     Adds a sequence of SEQ_LEN elements to be written to the
+ *              destination element at D, replacing the old sequence in the
+ *              background element at B (if not NULL).  The sequence's data
+ *              at BUF is copied to the staging buffer when COPY is set,
+ *              otherwise it must stay valid until the batch is written.
+ *              The batch is written when it gets full.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__conv_vlen_batch_add(const H5T_t *dst, H5T_vlen_batch_t *batch, void *d, void *b, void *buf,
+                         size_t seq_len, size_t dst_base_size, hbool_t copy)
+{
+    size_t n         = batch->nseq; /* Index of the new sequence */
+    herr_t ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(batch);
+    HDassert(n < batch->nalloc);
+
+    batch->vl[n]      = d;
+    batch->bg[n]      = b;
+    batch->seq_len[n] = seq_len;
+    if (copy) {
+        size_t nbytes = seq_len * dst_base_size; /* Size of the sequence in bytes */
+
+        if (H5T__conv_vlen_batch_stage(batch, nbytes, &batch->off[n]) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTALLOC, FAIL, "can't stage VL data")
+        if (nbytes > 0)
+            H5MM_memcpy(batch->data + batch->off[n], buf, nbytes);
+    } /* end if */
+    else {
+        batch->off[n]  = SIZE_MAX;
+        batch->cbuf[n] = buf;
+    } /* end else */
+    batch->nseq++;
+
+    if (batch->nseq == batch->nalloc || batch->data_used >= H5T_VLEN_BATCH_SIZE)
+        if (H5T__conv_vlen_batch_write(dst, batch, dst_base_size) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "can't write VL data")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_vlen_batch_add() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vlen_batch_write
+ *
+ * Purpose:     Writes the sequences added to a batch with one call to the
+ *              'writev' callback of the destination's VL class, and empties
+ *              the batch.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__conv_vlen_batch_write(const H5T_t *dst, H5T_vlen_batch_t *batch, size_t dst_base_size)
+{
+    size_t u;                   /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(dst->shared->u.vlen.cls->writev);
+    HDassert(batch);
+
+    if (batch->nseq > 0) {
+        /* Point at the staged data, now that the staging buffer won't move */
+        for (u = 0; u < batch->nseq; u++)
+            if (SIZE_MAX != batch->off[u])
+                batch->cbuf[u] = batch->data + batch->off[u];
+
+        if ((*(dst->shared->u.vlen.cls->writev))(dst->shared->u.vlen.file, batch->nseq, batch->vl,
+                                                  batch->cbuf, batch->bg, batch->seq_len, dst_base_size) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "can't write VL data")
+    } /* end if */
+
+    batch->nseq = batch->data_used = 0;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_vlen_batch_write() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5T__conv_vlen
  *
@@ -3124,6 +3588,9 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, si
     void *                tmp_buf       = NULL;         /*temporary background buffer          */
     size_t                tmp_buf_size  = 0;            /*size of temporary bkg buffer         */
     hbool_t               nested        = FALSE;        /*flag of nested VL case             */
+    H5T_vlen_batch_t      rbatch, wbatch;               /*batches of sequences to read & write */
+    H5T_vlen_batch_t *    read_batch  = NULL;           /*batch of sequences to read, if any   */
+    H5T_vlen_batch_t *    write_batch = NULL;           /*batch of sequences to write, if any  */
     size_t                elmtno;                       /*element number counter         */
     herr_t                ret_value = SUCCEED;          /* Return value */
 
@@ -3247,6 +3714,23 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, si
             if (write_to_file && parent_is_vlen && bkg != NULL)
                 nested = TRUE;
 
+            /* Read and write the sequences in the file in batches, when the
+             * VL classes support it and there is more than one element.  The
+             * nested case isn't batched, since it reads the old sequence of
+             * each element before writing the new one. */
+            if (nelmts > 1) {
+                if (src->shared->u.vlen.cls->readv) {
+                    if (H5T__conv_vlen_batch_init(&rbatch, MIN(nelmts, H5T_VLEN_BATCH_NELMTS)) < 0)
+                        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "can't initialize VL read batch")
+                    read_batch = &rbatch;
+                } /* end if */
+                if (dst->shared->u.vlen.cls->writev && !nested) {
+                    if (H5T__conv_vlen_batch_init(&wbatch, MIN(nelmts, H5T_VLEN_BATCH_NELMTS)) < 0)
+                        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "can't initialize VL write batch")
+                    write_batch = &wbatch;
+                } /* end if */
+            }     /* end if */
+
             /* The outer loop of the type conversion macro, controlling which */
             /* direction the buffer is walked */
             while (nelmts > 0) {
@@ -3289,21 +3773,33 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, si
                 } /* end else */
 
                 for (elmtno = 0; elmtno < safe; elmtno++) {
-                    hbool_t is_nil; /* Whether sequence is "nil" */
-
+                    hbool_t is_nil;      /* Whether sequence is "nil" */
+                    size_t  seq_len = 0; /* The number of elements in the current sequence */
+
+                    /* Read the next batch of sequences, when reading them in batches */
+                    if (read_batch) {
+                        if (read_batch->next == read_batch->nelmts)
+                            if (H5T__conv_vlen_batch_read(src, read_batch, s, s_stride, safe - elmtno,
+                                                          src_base_size) < 0)
+                                HGOTO_ERROR(H5E_DATATYPE, H5E_READERROR, FAIL, "can't read VL data")
+                        is_nil  = read_batch->is_nil[read_batch->next];
+                        seq_len = read_batch->seq_len[read_batch->next];
+                    } /* end if */
                     /* Check for "nil" source sequence */
-                    if ((*(src->shared->u.vlen.cls->isnull))(src->shared->u.vlen.file, s, &is_nil) < 0)
+                    else if ((*(src->shared->u.vlen.cls->isnull))(src->shared->u.vlen.file, s, &is_nil) < 0)
                         HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't check if VL data is 'nil'")
-                    else if (is_nil) {
+
+                    if (is_nil) {
                         /* Write "nil" sequence to destination location */
                         if ((*(dst->shared->u.vlen.cls->setnull))(dst->shared->u.vlen.file, d, b) < 0)
                             HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "can't set VL data to 'nil'")
-                    } /* end else-if */
+                    } /* end if */
                     else {
-                        size_t seq_len; /* The number of elements in the current sequence */
+                        void *seq_buf; /* Buffer holding the current sequence */
 
                         /* Get length of element sequences */
-                        if ((*(src->shared->u.vlen.cls->getlen))(src->shared->u.vlen.file, s, &seq_len) < 0)
+                        if (!read_batch &&
+                            (*(src->shared->u.vlen.cls->getlen))(src->shared->u.vlen.file, s, &seq_len) < 0)
                             HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "bad sequence length")
 
                         /* If we are reading from memory and there is no conversion, just get the pointer to
@@ -3312,7 +3808,11 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, si
                             /* Get direct pointer to sequence */
                             if (NULL == (conv_buf = (*(src->shared->u.vlen.cls->getptr))(s)))
                                 HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid source pointer")
+                            seq_buf = conv_buf;
                         } /* end if */
+                        /* Without a conversion, sequences read in a batch are used in place */
+                        else if (read_batch && noop_conv)
+                            seq_buf = read_batch->data + read_batch->off[read_batch->next];
                         else {
                             size_t src_size, dst_size; /*source & destination total size in bytes*/
 
@@ -3339,9 +3839,16 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, si
                             } /* end else-if */
 
                             /* Read in VL sequence */
-                            if ((*(src->shared->u.vlen.cls->read))(src->shared->u.vlen.file, s, conv_buf,
-                                                                   src_size) < 0)
+                            if (read_batch) {
+                                if (src_size > 0)
+                                    H5MM_memcpy(conv_buf,
+                                                read_batch->data + read_batch->off[read_batch->next],
+                                                src_size);
+                            } /* end if */
+                            else if ((*(src->shared->u.vlen.cls->read))(src->shared->u.vlen.file, s,
+                                                                        conv_buf, src_size) < 0)
                                 HGOTO_ERROR(H5E_DATATYPE, H5E_READERROR, FAIL, "can't read VL data")
+                            seq_buf = conv_buf;
                         } /* end else */
 
                         if (!noop_conv) {
@@ -3397,9 +3904,16 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, si
                                 HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "datatype conversion failed")
                         } /* end if */
 
-                        /* Write sequence to destination location */
-                        if ((*(dst->shared->u.vlen.cls->write))(dst->shared->u.vlen.file, &vl_alloc_info, d,
-                                                                conv_buf, b, seq_len, dst_base_size) < 0)
+                        /* Write sequence to destination location, or add it to the
+                         * batch to write, copying it unless it's the application's */
+                        if (write_batch) {
+                            if (H5T__conv_vlen_batch_add(dst, write_batch, d, b, seq_buf, seq_len,
+                                                         dst_base_size, !(write_to_file && noop_conv)) < 0)
+                                HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "can't write VL data")
+                        } /* end if */
+                        else if ((*(dst->shared->u.vlen.cls->write))(dst->shared->u.vlen.file,
+                                                                     &vl_alloc_info, d, seq_buf, b, seq_len,
+                                                                     dst_base_size) < 0)
                             HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "can't write VL data")
 
                         if (!noop_conv) {
@@ -3424,11 +3938,17 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, si
                     }             /* end else */
 
                     /* Advance pointers */
+                    if (read_batch)
+                        read_batch->next++;
                     s += s_stride;
                     d += d_stride;
                     b += b_stride;
                 } /* end for */
 
+                /* Write the rest of the batch before the next pass over the buffer */
+                if (write_batch && H5T__conv_vlen_batch_write(dst, write_batch, dst_base_size) < 0)
+                    HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "can't write VL data")
+
                 /* Decrement number of elements left to convert */
                 nelmts -= safe;
             } /* end while */
@@ -3454,6 +3974,11 @@ done:
     /* Release the background buffer, if we have one */
     if (tmp_buf)
         tmp_buf = H5FL_BLK_FREE(vlen_seq, tmp_buf);
+    /* Release the batches of sequences */
+    if (read_batch)
+        H5T__conv_vlen_batch_free(read_batch);
+    if (write_batch)
+        H5T__conv_vlen_batch_free(write_batch);
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T__conv_vlen() */
@@ -4255,12 +4780,210 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T__conv_i_i() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_f_f_move
+ *
+ * Purpose:     Copies one floating-point value of SIZE bytes from SRC to
+ *              DST, reversing the order of the bytes if SWAP is set.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_INLINE void
+H5T__conv_f_f_move(uint8_t *dst, const uint8_t *src, size_t size, hbool_t swap)
+{
+    size_t u; /* Local index variable */
+
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if (swap)
+        for (u = 0; u < size; u++)
+            dst[u] = src[(size - 1) - u];
+    else
+        H5MM_memcpy(dst, src, size);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__conv_f_f_move() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_f_f_clear_pad
+ *
+ * Purpose:     Zeroes the bits above the first PREC bits of the SIZE-byte
+ *              native value at VAL.  The compiler leaves the padding of
+ *              types like the x87 long double undefined, while the soft
+ *              conversion always zero-pads.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_INLINE void
+H5T__conv_f_f_clear_pad(uint8_t *val, size_t size, size_t prec)
+{
+    size_t u; /* Local index variable */
+
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Walk the bytes in order of significance */
+    for (u = prec / 8; u < size; u++) {
+        size_t  idx  = (H5T_ORDER_BE == H5T_native_order_g) ? (size - 1) - u : u;
+        uint8_t keep = (uint8_t)(u == prec / 8 ? (1 << (prec % 8)) - 1 : 0);
+
+        val[idx] &= keep;
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__conv_f_f_clear_pad() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_f_native
+ *
+ * Purpose:     Determines whether a floating-point datatype has the same
+ *              bit layout as the native float, double or long double,
+ *              ignoring byte order.  Only little- and big-endian types can
+ *              match.
+ *
+ * Return:      The matching native type, or H5T_CONV_F_NONE
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5T_conv_f_native_t
+H5T__conv_f_native(const H5T_t *dt)
+{
+    const hid_t               native_id[] = {H5T_NATIVE_FLOAT_g, H5T_NATIVE_DOUBLE_g, H5T_NATIVE_LDOUBLE_g};
+    const H5T_conv_f_native_t native[]    = {H5T_CONV_F_FLOAT, H5T_CONV_F_DOUBLE, H5T_CONV_F_LDOUBLE};
+    const H5T_atomic_t *      a           = &dt->shared->u.atomic;
+    unsigned                  u;                           /* Local index variable */
+    H5T_conv_f_native_t       ret_value = H5T_CONV_F_NONE; /* Return value         */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (H5T_ORDER_LE != a->order && H5T_ORDER_BE != a->order)
+        HGOTO_DONE(H5T_CONV_F_NONE)
+
+    for (u = 0; u < NELMTS(native_id); u++) {
+        const H5T_t *       nt;
+        const H5T_atomic_t *na;
+
+        if (NULL == (nt = (const H5T_t *)H5I_object(native_id[u])))
+            continue;
+        na = &nt->shared->u.atomic;
+        if (nt->shared->size == dt->shared->size && na->prec == a->prec && na->offset == a->offset &&
+            na->lsb_pad == a->lsb_pad && na->msb_pad == a->msb_pad && na->u.f.sign == a->u.f.sign &&
+            na->u.f.epos == a->u.f.epos && na->u.f.esize == a->u.f.esize && na->u.f.ebias == a->u.f.ebias &&
+            na->u.f.mpos == a->u.f.mpos && na->u.f.msize == a->u.f.msize && na->u.f.norm == a->u.f.norm &&
+            na->u.f.pad == a->u.f.pad)
+            HGOTO_DONE(native[u])
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_f_native() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_f_f_native
+ *
+ * Purpose:     Fast path of H5T__conv_f_f() for a source and destination
+ *              which both have the layout of a native floating-point type
+ *              (e.g. H5T_IEEE_F64BE to H5T_IEEE_F32LE).  The values go
+ *              through native arithmetic instead of the bit-by-bit
+ *              algorithm, so rounding, overflow and NaNs are handled the
+ *              way the hard conversions handle them.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T__conv_f_f_native(const H5T_t *src_p, const H5T_t *dst_p, const H5T_conv_f_f_t *priv, size_t nelmts,
+                     size_t buf_stride, void *buf)
+{
+    uint8_t *s, *d;              /*source & destination pointers     */
+    ssize_t  s_stride, d_stride; /*source & destination strides      */
+    size_t   s_size, d_size;     /*source & destination type sizes   */
+    size_t   dst_prec;           /*destination precision             */
+    hbool_t  d_pad;              /*destination has padding bits?     */
+    hbool_t  s_swap, d_swap;     /*source/destination byte-swapped?  */
+    size_t   elmtno;             /*element number                    */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    s_size   = src_p->shared->size;
+    d_size   = dst_p->shared->size;
+    dst_prec = dst_p->shared->u.atomic.prec;
+    d_pad    = (hbool_t)(dst_prec < 8 * d_size);
+    s_swap   = (hbool_t)(H5T_native_order_g != src_p->shared->u.atomic.order);
+    d_swap   = (hbool_t)(H5T_native_order_g != dst_p->shared->u.atomic.order);
+
+    /*
+     * Each value is read completely before its destination is written, so
+     * walking the buffer backward when the destination is larger than the
+     * source is all that is needed to handle the overlap.
+     */
+    H5_CHECK_OVERFLOW(buf_stride, size_t, ssize_t);
+    if (buf_stride) {
+        s = d    = (uint8_t *)buf;
+        s_stride = d_stride = (ssize_t)buf_stride;
+    }
+    else if (d_size <= s_size) {
+        s = d    = (uint8_t *)buf;
+        s_stride = (ssize_t)s_size;
+        d_stride = (ssize_t)d_size;
+    }
+    else {
+        s        = (uint8_t *)buf + (nelmts - 1) * s_size;
+        d        = (uint8_t *)buf + (nelmts - 1) * d_size;
+        s_stride = -(ssize_t)s_size;
+        d_stride = -(ssize_t)d_size;
+    }
+
+    switch (priv->dst_native) {
+        case H5T_CONV_F_FLOAT:
+            if (H5T_CONV_F_FLOAT == priv->src_native)
+                H5T_CONV_F_F_NATIVE_LOOP(float, float, H5T_CONV_F_F_NATIVE_WIDEN)
+            else if (H5T_CONV_F_DOUBLE == priv->src_native)
+                H5T_CONV_F_F_NATIVE_LOOP(double, float, H5T_CONV_F_F_NATIVE_TO_FLOAT)
+            else
+                H5T_CONV_F_F_NATIVE_LOOP(long double, float, H5T_CONV_F_F_NATIVE_TO_FLOAT)
+            break;
+
+        case H5T_CONV_F_DOUBLE:
+            if (H5T_CONV_F_FLOAT == priv->src_native)
+                H5T_CONV_F_F_NATIVE_LOOP(float, double, H5T_CONV_F_F_NATIVE_WIDEN)
+            else if (H5T_CONV_F_DOUBLE == priv->src_native)
+                H5T_CONV_F_F_NATIVE_LOOP(double, double, H5T_CONV_F_F_NATIVE_WIDEN)
+            else
+                H5T_CONV_F_F_NATIVE_LOOP(long double, double, H5T_CONV_F_F_NATIVE_TO_DOUBLE)
+            break;
+
+        case H5T_CONV_F_LDOUBLE:
+            if (H5T_CONV_F_FLOAT == priv->src_native)
+                H5T_CONV_F_F_NATIVE_LOOP(float, long double, H5T_CONV_F_F_NATIVE_WIDEN)
+            else if (H5T_CONV_F_DOUBLE == priv->src_native)
+                H5T_CONV_F_F_NATIVE_LOOP(double, long double, H5T_CONV_F_F_NATIVE_WIDEN)
+            else
+                H5T_CONV_F_F_NATIVE_LOOP(long double, long double, H5T_CONV_F_F_NATIVE_WIDEN)
+            break;
+
+        case H5T_CONV_F_NONE:
+        default:
+            HDassert(0 && "unexpected native type");
+            break;
+    } /* end switch */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__conv_f_f_native() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5T__conv_f_f
  *
  * Purpose:    Convert one floating point type to another.  This is a catch
- *        all for floating point conversions and is probably not
- *        particularly fast!
+ *        all for floating point conversions.  When both types have the
+ *        layout of a native float, double or long double the values go
+ *        through native arithmetic, otherwise they are converted bit by bit.
  *
  * Return:    Non-negative on success/Negative on failure
  *
@@ -4291,20 +5014,21 @@ H5T__conv_f_f(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, siz
     uint8_t      tmp1, tmp2;           /*temp variables for swapping bytes*/
 
     /* Conversion-related variables */
-    int64_t        expo;                        /*exponent            */
-    hssize_t       expo_max;                    /*maximum possible dst exponent    */
-    size_t         msize = 0;                   /*useful size of mantissa in src*/
-    size_t         mpos;                        /*offset to useful mant is src    */
-    uint64_t       sign;                        /*source sign bit value         */
-    size_t         mrsh;                        /*amount to right shift mantissa*/
-    hbool_t        carry = FALSE;               /*carry after rounding mantissa    */
-    size_t         i;                           /*miscellaneous counters    */
-    size_t         implied;                     /*destination implied bits    */
-    hbool_t        denormalized = FALSE;        /*is either source or destination denormalized?*/
-    H5T_conv_cb_t  cb_struct    = {NULL, NULL}; /*conversion callback structure */
-    H5T_conv_ret_t except_ret;                  /*return of callback function   */
-    hbool_t        reverse;                     /*if reverse the order of destination        */
-    herr_t         ret_value = SUCCEED;         /*return value                 */
+    int64_t         expo;                        /*exponent            */
+    hssize_t        expo_max;                    /*maximum possible dst exponent    */
+    size_t          msize = 0;                   /*useful size of mantissa in src*/
+    size_t          mpos;                        /*offset to useful mant is src    */
+    uint64_t        sign;                        /*source sign bit value         */
+    size_t          mrsh;                        /*amount to right shift mantissa*/
+    hbool_t         carry = FALSE;               /*carry after rounding mantissa    */
+    size_t          i;                           /*miscellaneous counters    */
+    size_t          implied;                     /*destination implied bits    */
+    hbool_t         denormalized = FALSE;        /*is either source or destination denormalized?*/
+    H5T_conv_cb_t   cb_struct    = {NULL, NULL}; /*conversion callback structure */
+    H5T_conv_ret_t  except_ret;                  /*return of callback function   */
+    hbool_t         reverse;                     /*if reverse the order of destination        */
+    H5T_conv_f_f_t *priv      = NULL;            /*private conversion data      */
+    herr_t          ret_value = SUCCEED;         /*return value                 */
 
     FUNC_ENTER_PACKAGE
 
@@ -4323,10 +5047,18 @@ H5T__conv_f_f(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, siz
                 HGOTO_ERROR(H5E_DATATYPE, H5E_UNSUPPORTED, FAIL, "destination size is too large")
             if (8 * sizeof(expo) - 1 < src.u.f.esize || 8 * sizeof(expo) - 1 < dst.u.f.esize)
                 HGOTO_ERROR(H5E_DATATYPE, H5E_UNSUPPORTED, FAIL, "exponent field is too large")
-            cdata->need_bkg = H5T_BKG_NO;
+
+            /* Check whether both sides can go through native arithmetic */
+            if (NULL == (priv = (H5T_conv_f_f_t *)H5MM_malloc(sizeof(H5T_conv_f_f_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+            priv->src_native = H5T__conv_f_native(src_p);
+            priv->dst_native = H5T__conv_f_native(dst_p);
+            cdata->priv      = priv;
+            cdata->need_bkg  = H5T_BKG_NO;
             break;
 
         case H5T_CONV_FREE:
+            cdata->priv = H5MM_xfree(cdata->priv);
             break;
 
         case H5T_CONV_CONV:
@@ -4377,6 +5109,19 @@ H5T__conv_f_f(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, siz
             if (H5CX_get_dt_conv_cb(&cb_struct) < 0)
                 HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "unable to get conversion exception callback")
 
+            /*
+             * Standard layouts on both sides go through native arithmetic.
+             * The generic algorithm below is kept for other layouts and for
+             * when an exception callback is set, since the callback sees
+             * every special value of the source.
+             */
+            priv = (H5T_conv_f_f_t *)cdata->priv;
+            if (priv && H5T_CONV_F_NONE != priv->src_native && H5T_CONV_F_NONE != priv->dst_native &&
+                NULL == cb_struct.func) {
+                H5T__conv_f_f_native(src_p, dst_p, priv, nelmts, buf_stride, buf);
+                break;
+            }
+
             /* Allocate space for order-reversed source buffer */
             src_rev = (uint8_t *)H5MM_calloc(src_p->shared->size);
 
@@ -7104,6 +7849,421 @@ H5T__conv_ldouble_double(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t
 }
 #endif /* H5_SIZEOF_LONG_DOUBLE != 0 */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5T__f16_to_double
+ *
+ * Purpose:     Convert a 16-bit IEEE-style floating-point value with EBITS
+ *              exponent bits and MBITS mantissa bits (IEEE half precision
+ *              or bfloat16) to a native double.  Every such value is
+ *              exactly representable as a double.
+ *
+ * Return:      The converted value
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_INLINE double
+H5T__f16_to_double(uint16_t val, unsigned ebits, unsigned mbits)
+{
+    uint64_t bits = (uint64_t)(val & 0x8000) << 48;      /* Bits of the double */
+    uint64_t mant = val & ((1u << mbits) - 1);           /* Mantissa */
+    int      exp  = (val >> mbits) & ((1 << ebits) - 1); /* Biased exponent */
+    int      bias = (1 << (ebits - 1)) - 1;              /* Exponent bias */
+    double   ret_value = 0.0;                            /* Return value */
+
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if (exp == (1 << ebits) - 1)
+        /* Infinity or NaN */
+        bits |= ((uint64_t)0x7ff << 52) | (mant << (52 - mbits));
+    else if (exp == 0) {
+        /* Zero or denormalized: normalize, since doubles have plenty of range */
+        if (mant) {
+            exp = 1;
+            while (!(mant & ((uint64_t)1 << mbits))) {
+                mant <<= 1;
+                exp--;
+            } /* end while */
+            mant &= ((uint64_t)1 << mbits) - 1;
+            bits |= ((uint64_t)(exp - bias + 1023) << 52) | (mant << (52 - mbits));
+        } /* end if */
+    }     /* end if */
+    else
+        bits |= ((uint64_t)(exp - bias + 1023) << 52) | (mant << (52 - mbits));
+
+    H5MM_memcpy(&ret_value, &bits, sizeof(ret_value));
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__f16_to_double() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__double_to_f16
+ *
+ * Purpose:     Convert a native double to a 16-bit IEEE-style
+ *              floating-point value with EBITS exponent bits and MBITS
+ *              mantissa bits, rounding to the nearest value (ties to
+ *              even).  Rounding straight from the double avoids the
+ *              double rounding of going through a float.
+ *
+ *              OVERFLOW is set to 1 (-1) when a finite value is too large
+ *              (small) to represent and is converted to +Inf (-Inf), or
+ *              to 0 otherwise.
+ *
+ * Return:      The converted value
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_INLINE uint16_t
+H5T__double_to_f16(double val, unsigned ebits, unsigned mbits, int *overflow)
+{
+    uint64_t bits;                          /* Bits of the double */
+    uint64_t mant;                          /* Mantissa */
+    uint64_t rem, halfway;                  /* Bits shifted out & half an ulp */
+    uint16_t sign;                          /* Sign bit */
+    int      exp;                           /* Exponent, rebiased */
+    int      bias = (1 << (ebits - 1)) - 1; /* Exponent bias */
+    int      emax = (1 << ebits) - 1;       /* Infinity / NaN exponent */
+    unsigned shift;                         /* # of mantissa bits to drop */
+    uint16_t ret_value = 0;                 /* Return value */
+
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    H5MM_memcpy(&bits, &val, sizeof(bits));
+    sign      = (uint16_t)((bits >> 48) & 0x8000);
+    exp       = (int)((bits >> 52) & 0x7ff);
+    mant      = bits & (((uint64_t)1 << 52) - 1);
+    *overflow = 0;
+
+    /* Infinity or NaN (kept quiet, with as much of the payload as fits) */
+    if (exp == 0x7ff) {
+        ret_value = (uint16_t)(emax << mbits);
+        if (mant)
+            ret_value |= (uint16_t)((1u << (mbits - 1)) | (mant >> (52 - mbits)));
+        HGOTO_DONE((uint16_t)(sign | ret_value))
+    } /* end if */
+
+    /* Zero, or a denormalized double, which is far too small to represent */
+    if (exp == 0)
+        HGOTO_DONE(sign)
+
+    exp = exp - 1023 + bias;
+    if (exp >= emax) {
+        *overflow = sign ? -1 : 1;
+        HGOTO_DONE((uint16_t)(sign | (emax << mbits)))
+    } /* end if */
+
+    if (exp <= 0) {
+        /* Denormalized result: make the implied bit explicit & shift it in */
+        mant |= (uint64_t)1 << 52;
+        shift = (unsigned)(52 - (int)mbits + 1 - exp);
+        if (shift > 53)
+            HGOTO_DONE(sign)
+    } /* end if */
+    else
+        shift = 52 - mbits;
+
+    /* Truncate, then round to nearest even.  Rounding up may carry into the
+     * exponent, which yields the correct encoding (up to infinity).
+     */
+    rem       = mant & (((uint64_t)1 << shift) - 1);
+    halfway   = (uint64_t)1 << (shift - 1);
+    ret_value = (uint16_t)(mant >> shift);
+    if (exp > 0)
+        ret_value = (uint16_t)(ret_value | (exp << mbits));
+    if (rem > halfway || (rem == halfway && (ret_value & 1)))
+        ret_value++;
+    if (((ret_value >> mbits) & emax) == emax)
+        *overflow = sign ? -1 : 1;
+    ret_value = (uint16_t)(sign | ret_value);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__double_to_f16() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__half_to_float, H5T__half_to_double,
+ *              H5T__float_to_half, H5T__double_to_half,
+ *              H5T__bfloat16_to_float, H5T__bfloat16_to_double,
+ *              H5T__float_to_bfloat16, H5T__double_to_bfloat16
+ *
+ * Purpose:     Element conversions for the 16-bit floating-point hardware
+ *              conversion functions (see H5T_CONV_F16).  Conversions
+ *              between half precision and float use the F16C instructions
+ *              when the compiler targets them.
+ *
+ * Return:      The converted value
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_INLINE float
+H5T__half_to_float(uint16_t val, int *overflow)
+{
+    float ret_value = 0.0f; /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    *overflow = 0;
+#ifdef __F16C__
+    ret_value = _cvtsh_ss(val);
+#else
+    ret_value = (float)H5T__f16_to_double(val, 5, 10);
+#endif
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__half_to_float() */
+
+static H5_INLINE double
+H5T__half_to_double(uint16_t val, int *overflow)
+{
+    double ret_value = 0.0; /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Every half precision value is exactly representable as a float */
+    ret_value = (double)H5T__half_to_float(val, overflow);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__half_to_double() */
+
+static H5_INLINE uint16_t
+H5T__float_to_half(float val, int *overflow)
+{
+    uint16_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+#ifdef __F16C__
+    {
+        uint32_t bits; /* Bits of the float */
+
+        /* Round to nearest even, flagging finite values which became infinite */
+        ret_value = (uint16_t)_cvtss_sh(val, 0);
+        H5MM_memcpy(&bits, &val, sizeof(bits));
+        if ((ret_value & 0x7fff) == 0x7c00 && (bits & 0x7f800000) != 0x7f800000)
+            *overflow = (ret_value & 0x8000) ? -1 : 1;
+        else
+            *overflow = 0;
+    }
+#else
+    /* Every float is exactly representable as a double */
+    ret_value = H5T__double_to_f16((double)val, 5, 10, overflow);
+#endif
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__float_to_half() */
+
+static H5_INLINE uint16_t
+H5T__double_to_half(double val, int *overflow)
+{
+    uint16_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    ret_value = H5T__double_to_f16(val, 5, 10, overflow);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__double_to_half() */
+
+static H5_INLINE float
+H5T__bfloat16_to_float(uint16_t val, int *overflow)
+{
+    uint32_t bits = (uint32_t)val << 16; /* bfloat16 is the top half of a float */
+    float    ret_value = 0.0f;           /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    *overflow = 0;
+    H5MM_memcpy(&ret_value, &bits, sizeof(ret_value));
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__bfloat16_to_float() */
+
+static H5_INLINE double
+H5T__bfloat16_to_double(uint16_t val, int *overflow)
+{
+    double ret_value = 0.0; /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    ret_value = (double)H5T__bfloat16_to_float(val, overflow);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__bfloat16_to_double() */
+
+static H5_INLINE uint16_t
+H5T__float_to_bfloat16(float val, int *overflow)
+{
+    uint32_t bits;      /* Bits of the float */
+    uint16_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    *overflow = 0;
+    H5MM_memcpy(&bits, &val, sizeof(bits));
+
+    /* Keep NaNs quiet, otherwise round to nearest even by adding just under
+     * half an ulp, plus the lowest kept bit
+     */
+    if ((bits & 0x7f800000) == 0x7f800000 && (bits & 0x007fffff))
+        ret_value = (uint16_t)((bits >> 16) | 0x0040);
+    else {
+        ret_value = (uint16_t)((bits + 0x7fff + ((bits >> 16) & 1)) >> 16);
+        if ((ret_value & 0x7f80) == 0x7f80 && (bits & 0x7f800000) != 0x7f800000)
+            *overflow = (ret_value & 0x8000) ? -1 : 1;
+    } /* end else */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__float_to_bfloat16() */
+
+static H5_INLINE uint16_t
+H5T__double_to_bfloat16(double val, int *overflow)
+{
+    uint16_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    ret_value = H5T__double_to_f16(val, 8, 7, overflow);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__double_to_bfloat16() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_half_float
+ *
+ * Purpose:     Convert IEEE half precision (in native byte order) to native `float'.
+ *              This is exact.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__conv_half_float(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, size_t buf_stride,
+                     size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg)
+{
+    H5T_CONV_F16(half, float, uint16_t, float);
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_half_double
+ *
+ * Purpose:     Convert IEEE half precision (in native byte order) to native `double'.
+ *              This is exact.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__conv_half_double(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, size_t buf_stride,
+                      size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg)
+{
+    H5T_CONV_F16(half, double, uint16_t, double);
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_float_half
+ *
+ * Purpose:     Convert native `float' to IEEE half precision (in native byte order),
+ *              rounding to nearest even.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__conv_float_half(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, size_t buf_stride,
+                     size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg)
+{
+    H5T_CONV_F16(float, half, float, uint16_t);
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_double_half
+ *
+ * Purpose:     Convert native `double' to IEEE half precision (in native byte order),
+ *              rounding to nearest even.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__conv_double_half(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, size_t buf_stride,
+                      size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg)
+{
+    H5T_CONV_F16(double, half, double, uint16_t);
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_bfloat16_float
+ *
+ * Purpose:     Convert bfloat16 (in native byte order) to native `float'.
+ *              This is exact.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__conv_bfloat16_float(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, size_t buf_stride,
+                         size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg)
+{
+    H5T_CONV_F16(bfloat16, float, uint16_t, float);
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_bfloat16_double
+ *
+ * Purpose:     Convert bfloat16 (in native byte order) to native `double'.
+ *              This is exact.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__conv_bfloat16_double(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, size_t buf_stride,
+                          size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg)
+{
+    H5T_CONV_F16(bfloat16, double, uint16_t, double);
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_float_bfloat16
+ *
+ * Purpose:     Convert native `float' to bfloat16 (in native byte order),
+ *              rounding to nearest even.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__conv_float_bfloat16(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, size_t buf_stride,
+                         size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg)
+{
+    H5T_CONV_F16(float, bfloat16, float, uint16_t);
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_double_bfloat16
+ *
+ * Purpose:     Convert native `double' to bfloat16 (in native byte order),
+ *              rounding to nearest even.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__conv_double_bfloat16(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, size_t buf_stride,
+                          size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg)
+{
+    H5T_CONV_F16(double, bfloat16, double, uint16_t);
+}
+
 /*-------------------------------------------------------------------------
  * Function:    H5T__conv_schar_float
  *
@@ -288,6 +288,10 @@ typedef herr_t (*H5T_vlen_read_func_t)(H5VL_object_t *file, void *_vl, void *buf
 typedef herr_t (*H5T_vlen_write_func_t)(H5VL_object_t *file, const H5T_vlen_alloc_info_t *vl_alloc_info,
                                         void *_vl, void *buf, void *_bg, size_t seq_len, size_t base_size);
 typedef herr_t (*H5T_vlen_delete_func_t)(H5VL_object_t *file, const void *_vl);
+typedef herr_t (*H5T_vlen_readv_func_t)(H5VL_object_t *file, size_t count, void *_vl[], void *buf[],
+                                        const size_t len[]);
+typedef herr_t (*H5T_vlen_writev_func_t)(H5VL_object_t *file, size_t count, void *_vl[], const void *buf[],
+                                         void *_bg[], const size_t seq_len[], size_t base_size);
 
 /* VL datatype callbacks */
 typedef struct H5T_vlen_class_t {
@@ -298,6 +302,8 @@ typedef struct H5T_vlen_class_t {
     H5T_vlen_read_func_t    read;    /* Function to read VL sequence into buffer */
     H5T_vlen_write_func_t   write;   /* Function to write VL sequence from buffer */
     H5T_vlen_delete_func_t  del;     /* Function to delete VL sequence */
+    H5T_vlen_readv_func_t   readv;   /* Function to read several VL sequences into buffers (optional) */
+    H5T_vlen_writev_func_t  writev;  /* Function to write several VL sequences from buffers (optional) */
 } H5T_vlen_class_t;
 
 /* A VL datatype */
@@ -724,6 +730,22 @@ H5_DLL herr_t H5T__conv_ldouble_float(hid_t src_id, hid_t dst_id, H5T_cdata_t *c
                                       size_t buf_stride, size_t bkg_stride, void *buf, void *bkg);
 H5_DLL herr_t H5T__conv_ldouble_double(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                                        size_t buf_stride, size_t bkg_stride, void *buf, void *bkg);
+H5_DLL herr_t H5T__conv_half_float(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
+                                   size_t buf_stride, size_t bkg_stride, void *buf, void *bkg);
+H5_DLL herr_t H5T__conv_half_double(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
+                                    size_t buf_stride, size_t bkg_stride, void *buf, void *bkg);
+H5_DLL herr_t H5T__conv_float_half(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
+                                   size_t buf_stride, size_t bkg_stride, void *buf, void *bkg);
+H5_DLL herr_t H5T__conv_double_half(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
+                                    size_t buf_stride, size_t bkg_stride, void *buf, void *bkg);
+H5_DLL herr_t H5T__conv_bfloat16_float(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
+                                       size_t buf_stride, size_t bkg_stride, void *buf, void *bkg);
+H5_DLL herr_t H5T__conv_bfloat16_double(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
+                                        size_t buf_stride, size_t bkg_stride, void *buf, void *bkg);
+H5_DLL herr_t H5T__conv_float_bfloat16(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
+                                       size_t buf_stride, size_t bkg_stride, void *buf, void *bkg);
+H5_DLL herr_t H5T__conv_double_bfloat16(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
+                                        size_t buf_stride, size_t bkg_stride, void *buf, void *bkg);
 H5_DLL herr_t H5T__conv_schar_float(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                                     size_t buf_stride, size_t bkg_stride, void *buf, void *bkg);
 H5_DLL herr_t H5T__conv_schar_double(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
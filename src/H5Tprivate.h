@@ -76,6 +76,18 @@ typedef struct {
     void *          free_info;  /* Free information */
 } H5T_vlen_alloc_info_t;
 
+/* Sequence data of the variable-length elements in a chunk, for datasets
+ * that store the sequences inline in their chunks instead of in the global
+ * heap.  Each element's disk VL information holds the sequence's offset in
+ * BUF in place of a heap address.
+ */
+typedef struct H5T_vlen_inline_t {
+    uint8_t *buf;    /* Sequence data */
+    size_t   size;   /* Bytes of sequence data used */
+    size_t   alloc;  /* Bytes allocated for BUF */
+    size_t   packed; /* Bytes used after the sequence data was last packed */
+} H5T_vlen_inline_t;
+
 /* Structure for conversion callback property */
 typedef struct H5T_conv_cb_t {
     H5T_conv_except_func_t func;
@@ -133,9 +145,15 @@ H5_DLL H5T_bkg_t   H5T_path_bkg(const H5T_path_t *p);
 H5_DLL H5T_subset_info_t *H5T_path_compound_subset(const H5T_path_t *p);
 H5_DLL herr_t H5T_convert(H5T_path_t *tpath, hid_t src_id, hid_t dst_id, size_t nelmts, size_t buf_stride,
                           size_t bkg_stride, void *buf, void *bkg);
+#ifdef H5_HAVE_WORKER_THREADS
+H5_DLL htri_t H5T_convert_can_overlap(const H5T_path_t *tpath);
+H5_DLL herr_t H5T_convert_start(H5T_path_t *tpath, hid_t src_id, hid_t dst_id, size_t nelmts, void *buf);
+H5_DLL herr_t H5T_convert_wait(void);
+#endif /* H5_HAVE_WORKER_THREADS */
 H5_DLL herr_t H5T_reclaim(hid_t type_id, struct H5S_t *space, void *buf);
 H5_DLL herr_t H5T_reclaim_cb(void *elem, const H5T_t *dt, unsigned ndim, const hsize_t *point, void *op_data);
 H5_DLL herr_t H5T_vlen_reclaim_elmt(void *elem, H5T_t *dt);
+H5_DLL herr_t H5T_vlen_inline_pack(const H5T_t *dt, void *elmts, size_t nelmts, H5T_vlen_inline_t *vl_inline);
 H5_DLL htri_t H5T_set_loc(H5T_t *dt, H5VL_object_t *file, H5T_loc_t loc);
 H5_DLL htri_t H5T_is_sensible(const H5T_t *dt);
 H5_DLL uint32_t H5T_hash(H5F_t *file, const H5T_t *dt);
@@ -301,6 +301,35 @@ H5_DLLVAR hid_t H5T_IEEE_F32BE_g;
 H5_DLLVAR hid_t H5T_IEEE_F32LE_g;
 H5_DLLVAR hid_t H5T_IEEE_F64BE_g;
 H5_DLLVAR hid_t H5T_IEEE_F64LE_g;
+/**
+ * \ingroup PDTIEEE
+ * 16-bit big-endian IEEE floating-point numbers (half precision)
+ */
+#define H5T_IEEE_F16BE (H5OPEN H5T_IEEE_F16BE_g)
+/**
+ * \ingroup PDTIEEE
+ * 16-bit little-endian IEEE floating-point numbers (half precision)
+ */
+#define H5T_IEEE_F16LE (H5OPEN H5T_IEEE_F16LE_g)
+H5_DLLVAR hid_t H5T_IEEE_F16BE_g;
+H5_DLLVAR hid_t H5T_IEEE_F16LE_g;
+
+/*
+ * The bfloat16 ("brain floating-point") types: the upper 16 bits of an IEEE
+ * 32-bit float, i.e. 1 sign bit, 8 exponent bits and 7 mantissa bits.
+ */
+/**
+ * \ingroup PDTIEEE
+ * 16-bit big-endian bfloat16 floating-point numbers
+ */
+#define H5T_FLOAT_BFLOAT16BE (H5OPEN H5T_FLOAT_BFLOAT16BE_g)
+/**
+ * \ingroup PDTIEEE
+ * 16-bit little-endian bfloat16 floating-point numbers
+ */
+#define H5T_FLOAT_BFLOAT16LE (H5OPEN H5T_FLOAT_BFLOAT16LE_g)
+H5_DLLVAR hid_t H5T_FLOAT_BFLOAT16BE_g;
+H5_DLLVAR hid_t H5T_FLOAT_BFLOAT16LE_g;
 
 /*
  * These are "standard" types.  For instance, signed (2's complement) and
@@ -886,6 +915,18 @@ H5_DLLVAR hid_t H5T_VAX_F64_g;
  * HDF5 Boolean type based on native types
  */
 #define H5T_NATIVE_HBOOL (H5OPEN H5T_NATIVE_HBOOL_g)
+/**
+ * \ingroup PDTNAT
+ * 16-bit IEEE half precision floating-point numbers in native byte order.
+ * C has no standard type for these; values are stored in a \Code{uint16_t}.
+ */
+#define H5T_NATIVE_FLOAT16 (H5OPEN H5T_NATIVE_FLOAT16_g)
+/**
+ * \ingroup PDTNAT
+ * 16-bit bfloat16 floating-point numbers in native byte order.
+ * C has no standard type for these; values are stored in a \Code{uint16_t}.
+ */
+#define H5T_NATIVE_BFLOAT16 (H5OPEN H5T_NATIVE_BFLOAT16_g)
 H5_DLLVAR hid_t H5T_NATIVE_SCHAR_g;
 H5_DLLVAR hid_t H5T_NATIVE_UCHAR_g;
 H5_DLLVAR hid_t H5T_NATIVE_SHORT_g;
@@ -911,6 +952,8 @@ H5_DLLVAR hid_t H5T_NATIVE_HSIZE_g;
 H5_DLLVAR hid_t H5T_NATIVE_HSSIZE_g;
 H5_DLLVAR hid_t H5T_NATIVE_HERR_g;
 H5_DLLVAR hid_t H5T_NATIVE_HBOOL_g;
+H5_DLLVAR hid_t H5T_NATIVE_FLOAT16_g;
+H5_DLLVAR hid_t H5T_NATIVE_BFLOAT16_g;
 
 /* C9x integer types */
 /**
@@ -30,6 +30,7 @@
 #include "H5CXprivate.h" /* API Contexts         */
 #include "H5Eprivate.h"  /* Error handling       */
 #include "H5Fpkg.h"      /* File                 */
+#include "H5HGprivate.h" /* Global Heaps         */
 #include "H5Iprivate.h"  /* IDs                  */
 #include "H5MMprivate.h" /* Memory management    */
 #include "H5Tpkg.h"      /* Datatypes            */
@@ -39,6 +40,9 @@
 /* Local Macros */
 /****************/
 
+/* Size of the offset in the disk VL information of inline sequences */
+#define H5T_VLEN_INLINE_OFF_SIZE(F) H5F_SIZEOF_ADDR((const H5F_t *)H5VL_object_data(F))
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -77,6 +81,16 @@ static herr_t H5T__vlen_disk_read(H5VL_object_t *file, void *_vl, void *_buf, si
 static herr_t H5T__vlen_disk_write(H5VL_object_t *file, const H5T_vlen_alloc_info_t *vl_alloc_info, void *_vl,
                                    void *_buf, void *_bg, size_t seq_len, size_t base_size);
 static herr_t H5T__vlen_disk_delete(H5VL_object_t *file, const void *_vl);
+static herr_t H5T__vlen_disk_readv(H5VL_object_t *file, size_t count, void *_vl[], void *buf[],
+                                   const size_t len[]);
+static herr_t H5T__vlen_disk_writev(H5VL_object_t *file, size_t count, void *_vl[], const void *buf[],
+                                    void *_bg[], const size_t seq_len[], size_t base_size);
+
+/* Inline VL sequence helpers */
+static herr_t H5T__vlen_inline_read(const H5T_vlen_inline_t *vl_inline, size_t off_size, const void *_vl,
+                                    void *buf, size_t len);
+static herr_t H5T__vlen_inline_write(H5T_vlen_inline_t *vl_inline, size_t off_size, void *_vl,
+                                     const void *buf, size_t seq_len, size_t base_size);
 
 /*********************/
 /* Public Variables */
@@ -102,7 +116,9 @@ static const H5T_vlen_class_t H5T_vlen_mem_seq_g = {
     H5T__vlen_mem_seq_setnull, /* 'setnull' */
     H5T__vlen_mem_seq_read,    /* 'read' */
     H5T__vlen_mem_seq_write,   /* 'write' */
-    NULL                       /* 'delete' */
+    NULL,                      /* 'delete' */
+    NULL,                      /* 'readv' */
+    NULL                       /* 'writev' */
 };
 
 /* Class for VL strings in memory */
@@ -113,7 +129,9 @@ static const H5T_vlen_class_t H5T_vlen_mem_str_g = {
     H5T__vlen_mem_str_setnull, /* 'setnull' */
     H5T__vlen_mem_str_read,    /* 'read' */
     H5T__vlen_mem_str_write,   /* 'write' */
-    NULL                       /* 'delete' */
+    NULL,                      /* 'delete' */
+    NULL,                      /* 'readv' */
+    NULL                       /* 'writev' */
 };
 
 /* Class for both VL strings and sequences in file */
@@ -124,7 +142,9 @@ static const H5T_vlen_class_t H5T_vlen_disk_g = {
     H5T__vlen_disk_setnull, /* 'setnull' */
     H5T__vlen_disk_read,    /* 'read' */
     H5T__vlen_disk_write,   /* 'write' */
-    H5T__vlen_disk_delete   /* 'delete' */
+    H5T__vlen_disk_delete,  /* 'delete' */
+    H5T__vlen_disk_readv,   /* 'readv' */
+    H5T__vlen_disk_writev   /* 'writev' */
 };
 
 /*-------------------------------------------------------------------------
@@ -854,8 +874,16 @@ H5T__vlen_disk_isnull(const H5VL_object_t *file, void *_vl, hbool_t *isnull)
     /* Skip the sequence's length */
     vl += 4;
 
+    if (H5CX_get_vlen_inline()) {
+        unsigned present; /* Whether the sequence is present */
+
+        /* Check the sequence's "present" flag, after its offset */
+        vl += H5T_VLEN_INLINE_OFF_SIZE(file);
+        UINT32DECODE(vl, present);
+        *isnull = (0 == present);
+    } /* end if */
     /* Check if blob ID is "nil" */
-    if (H5VL_blob_specific(file, vl, H5VL_BLOB_ISNULL, isnull) < 0)
+    else if (H5VL_blob_specific(file, vl, H5VL_BLOB_ISNULL, isnull) < 0)
         HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "unable to check if a blob ID is 'nil'")
 
 done:
@@ -886,6 +914,16 @@ H5T__vlen_disk_setnull(H5VL_object_t *file, void *_vl, void *bg)
     HDassert(file);
     HDassert(vl);
 
+    /* Inline sequences have no heap objects to free */
+    if (H5CX_get_vlen_inline()) {
+        /* Set the length, offset and "present" flag of the sequence */
+        UINT32ENCODE(vl, 0);
+        H5F_addr_encode_len(H5T_VLEN_INLINE_OFF_SIZE(file), &vl, (haddr_t)0);
+        UINT32ENCODE(vl, 0);
+
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     /* Free heap object for old data */
     if (bg != NULL)
         /* Delete sequence in destination location */
@@ -918,8 +956,9 @@ done:
 static herr_t
 H5T__vlen_disk_read(H5VL_object_t *file, void *_vl, void *buf, size_t len)
 {
-    const uint8_t *vl        = (const uint8_t *)_vl; /* Pointer to the user's hvl_t information */
-    herr_t         ret_value = SUCCEED;              /* Return value */
+    const uint8_t *    vl = (const uint8_t *)_vl; /* Pointer to the user's hvl_t information */
+    H5T_vlen_inline_t *vl_inline;                 /* Inline sequence data */
+    herr_t             ret_value = SUCCEED;       /* Return value */
 
     FUNC_ENTER_STATIC
 
@@ -928,6 +967,13 @@ H5T__vlen_disk_read(H5VL_object_t *file, void *_vl, void *buf, size_t len)
     HDassert(vl);
     HDassert(buf);
 
+    /* Copy inline sequence */
+    if (NULL != (vl_inline = H5CX_get_vlen_inline())) {
+        if (H5T__vlen_inline_read(vl_inline, H5T_VLEN_INLINE_OFF_SIZE(file), vl, buf, len) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_READERROR, FAIL, "unable to read inline sequence")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     /* Skip the length of the sequence */
     vl += 4;
 
@@ -955,9 +1001,10 @@ static herr_t
 H5T__vlen_disk_write(H5VL_object_t *file, const H5T_vlen_alloc_info_t H5_ATTR_UNUSED *vl_alloc_info,
                      void *_vl, void *buf, void *_bg, size_t seq_len, size_t base_size)
 {
-    uint8_t *      vl        = (uint8_t *)_vl;       /* Pointer to the user's hvl_t information */
-    const uint8_t *bg        = (const uint8_t *)_bg; /* Pointer to the old data hvl_t */
-    herr_t         ret_value = SUCCEED;              /* Return value */
+    uint8_t *          vl = (uint8_t *)_vl;       /* Pointer to the user's hvl_t information */
+    const uint8_t *    bg = (const uint8_t *)_bg; /* Pointer to the old data hvl_t */
+    H5T_vlen_inline_t *vl_inline;                 /* Inline sequence data */
+    herr_t             ret_value = SUCCEED;       /* Return value */
 
     FUNC_ENTER_STATIC
 
@@ -966,6 +1013,14 @@ H5T__vlen_disk_write(H5VL_object_t *file, const H5T_vlen_alloc_info_t H5_ATTR_UN
     HDassert(seq_len == 0 || buf);
     HDassert(file);
 
+    /* Append inline sequence, leaving the old one for the chunk to drop */
+    if (NULL != (vl_inline = H5CX_get_vlen_inline())) {
+        if (H5T__vlen_inline_write(vl_inline, H5T_VLEN_INLINE_OFF_SIZE(file), vl, buf, seq_len, base_size) <
+            0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "unable to write inline sequence")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     /* Free heap object for old data, if non-NULL */
     if (bg != NULL)
         if (H5T__vlen_disk_delete(file, bg) < 0)
@@ -982,6 +1037,156 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T__vlen_disk_write() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5T__vlen_disk_readv
+ *
+ * Purpose:	Reads COUNT disk based VL elements into buffers.  For files
+ *		in the native VOL connector the global heap objects are read
+ *		together, so each heap collection is only visited once.
+ *		Other connectors read the blobs one at a time.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__vlen_disk_readv(H5VL_object_t *file, size_t count, void *_vl[], void *buf[], const size_t len[])
+{
+    H5T_vlen_inline_t *vl_inline;           /* Inline sequence data */
+    H5HG_t *           hobjs     = NULL;    /* Global heap IDs of the sequences */
+    size_t             u;                   /* Local index variable */
+    herr_t             ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check parameters */
+    HDassert(file);
+    HDassert(0 == count || (_vl && buf && len));
+
+    if (NULL != (vl_inline = H5CX_get_vlen_inline())) {
+        size_t off_size = H5T_VLEN_INLINE_OFF_SIZE(file); /* Size of sequence offsets */
+
+        /* Copy the inline sequences */
+        for (u = 0; u < count; u++)
+            if (H5T__vlen_inline_read(vl_inline, off_size, _vl[u], buf[u], len[u]) < 0)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_READERROR, FAIL, "unable to read inline sequence")
+    } /* end if */
+    else if (H5_VOL_NATIVE == file->connector->cls->value) {
+        H5F_t *f = (H5F_t *)H5VL_object_data(file); /* File pointer */
+
+        if (NULL == (hobjs = (H5HG_t *)H5MM_malloc(count * sizeof(H5HG_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for heap IDs")
+
+        /* Get the heap information, skipping the length of each sequence */
+        for (u = 0; u < count; u++) {
+            const uint8_t *vl = (const uint8_t *)_vl[u] + 4;
+
+            H5F_addr_decode(f, &vl, &hobjs[u].addr);
+            UINT32DECODE(vl, hobjs[u].idx);
+        } /* end for */
+
+        /* Read the VL information from disk */
+        if (H5HG_read_multi(f, count, hobjs, buf, len) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_READERROR, FAIL, "unable to read VL information")
+    } /* end if */
+    else
+        for (u = 0; u < count; u++)
+            if (H5T__vlen_disk_read(file, _vl[u], buf[u], len[u]) < 0)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_READERROR, FAIL, "can't read VL data")
+
+done:
+    H5MM_xfree(hobjs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__vlen_disk_readv() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__vlen_disk_writev
+ *
+ * Purpose:	Writes COUNT disk based VL elements from buffers, deleting
+ *		the heap objects of the old data in _BG (whose entries may
+ *		be NULL).  For files in the native VOL connector all the new
+ *		global heap objects are inserted in one operation.  Other
+ *		connectors store the blobs one at a time.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__vlen_disk_writev(H5VL_object_t *file, size_t count, void *_vl[], const void *buf[], void *_bg[],
+                      const size_t seq_len[], size_t base_size)
+{
+    H5T_vlen_inline_t *vl_inline;           /* Inline sequence data */
+    H5HG_t *           hobjs     = NULL;    /* Global heap IDs of the new sequences */
+    size_t *           sizes     = NULL;    /* Sizes of the new sequences in bytes */
+    size_t             u;                   /* Local index variable */
+    herr_t             ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check parameters */
+    HDassert(file);
+    HDassert(0 == count || (_vl && buf && seq_len));
+
+    /* Append the inline sequences */
+    if (NULL != (vl_inline = H5CX_get_vlen_inline())) {
+        size_t off_size = H5T_VLEN_INLINE_OFF_SIZE(file); /* Size of sequence offsets */
+
+        for (u = 0; u < count; u++)
+            if (H5T__vlen_inline_write(vl_inline, off_size, _vl[u], buf[u], seq_len[u], base_size) < 0)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "unable to write inline sequence")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Free heap objects for old data */
+    if (_bg)
+        for (u = 0; u < count; u++)
+            if (_bg[u] && H5T__vlen_disk_delete(file, _bg[u]) < 0)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTREMOVE, FAIL, "unable to remove background heap object")
+
+    if (H5_VOL_NATIVE == file->connector->cls->value) {
+        H5F_t *f = (H5F_t *)H5VL_object_data(file); /* File pointer */
+
+        if (NULL == (hobjs = (H5HG_t *)H5MM_malloc(count * sizeof(H5HG_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for heap IDs")
+        if (NULL == (sizes = (size_t *)H5MM_malloc(count * sizeof(size_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for sizes")
+        for (u = 0; u < count; u++)
+            sizes[u] = seq_len[u] * base_size;
+
+        /* Write the VL information to disk (allocates space also) */
+        if (H5HG_insert_multi(f, count, sizes, buf, hobjs) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "unable to write VL information")
+
+        /* Encode the length of each sequence and its heap information */
+        for (u = 0; u < count; u++) {
+            uint8_t *vl = (uint8_t *)_vl[u];
+
+            UINT32ENCODE(vl, seq_len[u]);
+            H5F_addr_encode(f, &vl, hobjs[u].addr);
+            UINT32ENCODE(vl, hobjs[u].idx);
+        } /* end for */
+    }     /* end if */
+    else
+        for (u = 0; u < count; u++) {
+            uint8_t *vl = (uint8_t *)_vl[u];
+
+            /* Set the length of the sequence */
+            UINT32ENCODE(vl, seq_len[u]);
+
+            /* Store blob */
+            if (H5VL_blob_put(file, buf[u], (seq_len[u] * base_size), vl, NULL) < 0)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTSET, FAIL, "unable to put blob")
+        } /* end for */
+
+done:
+    H5MM_xfree(hobjs);
+    H5MM_xfree(sizes);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__vlen_disk_writev() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5T__vlen_disk_delete
  *
@@ -1005,8 +1210,8 @@ H5T__vlen_disk_delete(H5VL_object_t *file, const void *_vl)
     /* Check parameters */
     HDassert(file);
 
-    /* Free heap object for old data */
-    if (vl != NULL) {
+    /* Free heap object for old data (inline sequences are dropped with the chunk) */
+    if (vl != NULL && NULL == H5CX_get_vlen_inline()) {
         size_t seq_len; /* VL sequence's length */
 
         /* Get length of sequence */
@@ -1022,6 +1227,190 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T__vlen_disk_delete() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5T__vlen_inline_read
+ *
+ * Purpose:	Copies LEN bytes of an inline sequence into a buffer.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__vlen_inline_read(const H5T_vlen_inline_t *vl_inline, size_t off_size, const void *_vl, void *buf,
+                      size_t len)
+{
+    const uint8_t *vl = (const uint8_t *)_vl; /* Pointer to the disk VL information */
+    haddr_t        off;                       /* Offset of the sequence */
+    herr_t         ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check parameters */
+    HDassert(vl_inline);
+    HDassert(vl);
+    HDassert(len == 0 || buf);
+
+    /* Skip the length of the sequence and get its offset */
+    vl += 4;
+    H5F_addr_decode_len(off_size, &vl, &off);
+
+    /* Make sure the sequence is in the chunk */
+    if (!H5F_addr_defined(off) || off > vl_inline->size || len > vl_inline->size - off)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_BADRANGE, FAIL, "inline sequence is outside the chunk")
+
+    H5MM_memcpy(buf, vl_inline->buf + off, len);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__vlen_inline_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__vlen_inline_write
+ *
+ * Purpose:	Appends a sequence to the inline sequence data and sets the
+ *		disk VL information to point at it.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__vlen_inline_write(H5T_vlen_inline_t *vl_inline, size_t off_size, void *_vl, const void *buf,
+                       size_t seq_len, size_t base_size)
+{
+    uint8_t *vl        = (uint8_t *)_vl;      /* Pointer to the disk VL information */
+    size_t   nbytes    = seq_len * base_size; /* Size of the sequence in bytes */
+    herr_t   ret_value = SUCCEED;             /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check parameters */
+    HDassert(vl_inline);
+    HDassert(vl);
+    HDassert(seq_len == 0 || buf);
+
+    /* Make room for the sequence */
+    if (vl_inline->size + nbytes > vl_inline->alloc) {
+        size_t   new_alloc = MAX3(vl_inline->alloc * 2, vl_inline->size + nbytes, (size_t)256);
+        uint8_t *new_buf;
+
+        if (NULL == (new_buf = (uint8_t *)H5MM_realloc(vl_inline->buf, new_alloc)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for inline sequences")
+        vl_inline->buf   = new_buf;
+        vl_inline->alloc = new_alloc;
+    } /* end if */
+
+    /* Append the sequence */
+    if (nbytes > 0)
+        H5MM_memcpy(vl_inline->buf + vl_inline->size, buf, nbytes);
+
+    /* Set the length, offset and "present" flag of the sequence */
+    UINT32ENCODE(vl, seq_len);
+    H5F_addr_encode_len(off_size, &vl, (haddr_t)vl_inline->size);
+    UINT32ENCODE(vl, 1);
+
+    vl_inline->size += nbytes;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__vlen_inline_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_vlen_inline_pack
+ *
+ * Purpose:	Drops the sequences that are no longer used by any of the
+ *		NELMTS disk VL elements in ELMTS (for datatype DT) from the
+ *		inline sequence data, updating the elements' offsets.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T_vlen_inline_pack(const H5T_t *dt, void *elmts, size_t nelmts, H5T_vlen_inline_t *vl_inline)
+{
+    size_t   off_size;            /* Size of sequence offsets */
+    size_t   base_size;           /* Size of the sequences' base datatype */
+    size_t   live    = 0;         /* Bytes of sequence data in use */
+    uint8_t *new_buf = NULL;      /* Packed sequence data */
+    size_t   new_size;            /* Bytes of packed sequence data */
+    size_t   u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Check parameters */
+    HDassert(dt);
+    HDassert(H5T_VLEN == dt->shared->type);
+    HDassert(H5T_LOC_DISK == dt->shared->u.vlen.loc);
+    HDassert(elmts || 0 == nelmts);
+    HDassert(vl_inline);
+
+    off_size  = dt->shared->size - 8;
+    base_size = dt->shared->parent->shared->size;
+
+    /* Add up the sizes of the sequences in use */
+    for (u = 0; u < nelmts; u++) {
+        const uint8_t *vl = (const uint8_t *)elmts + (u * dt->shared->size);
+        size_t         seq_len;
+        unsigned       present;
+
+        UINT32DECODE(vl, seq_len);
+        vl += off_size;
+        UINT32DECODE(vl, present);
+        if (present)
+            live += seq_len * base_size;
+    } /* end for */
+
+    /* Copy the sequences in use, unless there's nothing to drop */
+    if (live < vl_inline->size) {
+        if (live > 0 && NULL == (new_buf = (uint8_t *)H5MM_malloc(live)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for inline sequences")
+
+        new_size = 0;
+        for (u = 0; u < nelmts; u++) {
+            uint8_t *      vl = (uint8_t *)elmts + (u * dt->shared->size);
+            const uint8_t *p  = vl;
+            size_t         seq_len;
+            haddr_t        off;
+            unsigned       present;
+
+            UINT32DECODE(p, seq_len);
+            H5F_addr_decode_len(off_size, &p, &off);
+            UINT32DECODE(p, present);
+            if (present) {
+                size_t nbytes = seq_len * base_size;
+
+                if (!H5F_addr_defined(off) || off > vl_inline->size || nbytes > vl_inline->size - off)
+                    HGOTO_ERROR(H5E_DATATYPE, H5E_BADRANGE, FAIL, "inline sequence is outside the chunk")
+                if (nbytes > 0)
+                    H5MM_memcpy(new_buf + new_size, vl_inline->buf + off, nbytes);
+
+                /* Point the element at the sequence's new location */
+                vl += 4;
+                H5F_addr_encode_len(off_size, &vl, (haddr_t)new_size);
+
+                new_size += nbytes;
+            } /* end if */
+        }     /* end for */
+        HDassert(new_size == live);
+
+        /* Swap in the packed sequence data */
+        H5MM_xfree(vl_inline->buf);
+        vl_inline->buf   = new_buf;
+        vl_inline->size  = live;
+        vl_inline->alloc = live;
+        new_buf          = NULL;
+    } /* end if */
+    vl_inline->packed = vl_inline->size;
+
+done:
+    H5MM_xfree(new_buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_vlen_inline_pack() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5T__vlen_reclaim
  *
@@ -31,6 +31,95 @@ typedef struct H5VM_memcpy_ud_t {
 /* Local macros */
 #define H5VM_HYPER_NDIMS H5O_LAYOUT_NDIMS
 
+/*
+ * Copy NELMTS elements of SIZE bytes from SRC to DST, advancing the pointers
+ * by SRC_STRIDE and DST_STRIDE bytes after each element.  SIZE is a constant
+ * in all the uses below, so the compiler reduces each memcpy() to a single
+ * (possibly vector) load and store instead of a call.
+ */
+#define H5VM_COPY_RUN_LOOP(DST, DST_STRIDE, SRC, SRC_STRIDE, NELMTS, SIZE)                                   \
+    do {                                                                                                     \
+        hsize_t _run_u;                                                                                      \
+                                                                                                             \
+        for (_run_u = (NELMTS); _run_u > 0; _run_u--) {                                                      \
+            HDmemcpy(DST, SRC, SIZE);                                                                        \
+            (DST) += (DST_STRIDE);                                                                           \
+            (SRC) += (SRC_STRIDE);                                                                           \
+        }                                                                                                    \
+    } while (0)
+
+/* Pick the copy loop for a run of strided elements by element size */
+#define H5VM_COPY_RUN(DST, DST_STRIDE, SRC, SRC_STRIDE, NELMTS, ELMT_SIZE)                                   \
+    do {                                                                                                     \
+        switch (ELMT_SIZE) {                                                                                 \
+            case 1:                                                                                          \
+                H5VM_COPY_RUN_LOOP(DST, DST_STRIDE, SRC, SRC_STRIDE, NELMTS, 1);                             \
+                break;                                                                                       \
+            case 2:                                                                                          \
+                H5VM_COPY_RUN_LOOP(DST, DST_STRIDE, SRC, SRC_STRIDE, NELMTS, 2);                             \
+                break;                                                                                       \
+            case 4:                                                                                          \
+                H5VM_COPY_RUN_LOOP(DST, DST_STRIDE, SRC, SRC_STRIDE, NELMTS, 4);                             \
+                break;                                                                                       \
+            case 8:                                                                                          \
+                H5VM_COPY_RUN_LOOP(DST, DST_STRIDE, SRC, SRC_STRIDE, NELMTS, 8);                             \
+                break;                                                                                       \
+            case 16:                                                                                         \
+                H5VM_COPY_RUN_LOOP(DST, DST_STRIDE, SRC, SRC_STRIDE, NELMTS, 16);                            \
+                break;                                                                                       \
+            default:                                                                                         \
+                H5VM_COPY_RUN_LOOP(DST, DST_STRIDE, SRC, SRC_STRIDE, NELMTS, ELMT_SIZE);                     \
+                break;                                                                                       \
+        } /* end switch */                                                                                   \
+    } while (0)
+
+/*
+ * Copy one sequence of LEN bytes from SRC to DST.  Short sequences of the
+ * common element sizes are copied with a fixed size memcpy(), avoiding the
+ * call overhead that dominates when a selection has many small sequences.
+ */
+#define H5VM_COPY_SEQ(DST, SRC, LEN)                                                                         \
+    do {                                                                                                     \
+        switch (LEN) {                                                                                       \
+            case 1:                                                                                          \
+                HDmemcpy(DST, SRC, 1);                                                                       \
+                break;                                                                                       \
+            case 2:                                                                                          \
+                HDmemcpy(DST, SRC, 2);                                                                       \
+                break;                                                                                       \
+            case 4:                                                                                          \
+                HDmemcpy(DST, SRC, 4);                                                                       \
+                break;                                                                                       \
+            case 8:                                                                                          \
+                HDmemcpy(DST, SRC, 8);                                                                       \
+                break;                                                                                       \
+            case 16:                                                                                         \
+                HDmemcpy(DST, SRC, 16);                                                                      \
+                break;                                                                                       \
+            default:                                                                                         \
+                H5MM_memcpy(DST, SRC, LEN);                                                                  \
+                break;                                                                                       \
+        } /* end switch */                                                                                   \
+    } while (0)
+
+/* Gather the sequences [CURR, END) of SIZE bytes each from SRC into DST */
+#define H5VM_GATHER_LOOP(DST, SRC, OFF_ARR, CURR, END, SIZE)                                                 \
+    do {                                                                                                     \
+        for (; (CURR) < (END); (CURR)++) {                                                                   \
+            HDmemcpy(DST, (SRC) + (OFF_ARR)[CURR], SIZE);                                                    \
+            (DST) += (SIZE);                                                                                 \
+        }                                                                                                    \
+    } while (0)
+
+/* Scatter the sequences [CURR, END) of SIZE bytes each from SRC into DST */
+#define H5VM_SCATTER_LOOP(DST, OFF_ARR, SRC, CURR, END, SIZE)                                                \
+    do {                                                                                                     \
+        for (; (CURR) < (END); (CURR)++) {                                                                   \
+            HDmemcpy((DST) + (OFF_ARR)[CURR], SRC, SIZE);                                                    \
+            (SRC) += (SIZE);                                                                                 \
+        }                                                                                                    \
+    } while (0)
+
 /* Local prototypes */
 static void H5VM__stride_optimize1(unsigned *np /*in,out*/, hsize_t *elmt_size /*in,out*/,
                                    const hsize_t *size, hsize_t *stride1);
@@ -647,7 +736,9 @@ H5VM_stride_fill(unsigned n, hsize_t elmt_size, const hsize_t *size, const hsize
  *		DST and SRC while copying bytes from SRC to DST.  This
  *		function minimizes the number of calls to memcpy() by
  *		combining various strides, but it will never touch memory
- *		outside the hyperslab defined by the strides.
+ *		outside the hyperslab defined by the strides.  Elements of
+ *		1, 2, 4, 8 or 16 bytes are copied along the fastest changing
+ *		dimension with a loop specialized for that size.
  *
  * Note:	If the src_stride is all zero and elmt_size is one, then it's
  *		probably more efficient to use H5VM_stride_fill() instead.
@@ -678,14 +769,14 @@ H5VM_stride_copy(unsigned n, hsize_t elmt_size, const hsize_t *size, const hsize
     if (n) {
         H5VM_vector_cpy(n, idx, size);
         nelmts = H5VM_vector_reduce_product(n, size);
-        for (i = 0; i < nelmts; i++) {
+        H5_CHECK_OVERFLOW(elmt_size, hsize_t, size_t);
+        for (i = 0; i < nelmts; i += size[n - 1]) {
 
-            /* Copy an element */
-            H5_CHECK_OVERFLOW(elmt_size, hsize_t, size_t);
-            H5MM_memcpy(dst, src, (size_t)elmt_size); /*lint !e671 The elmt_size will be OK */
+            /* Copy a run of elements along the fastest changing dimension */
+            H5VM_COPY_RUN(dst, dst_stride[n - 1], src, src_stride[n - 1], size[n - 1], (size_t)elmt_size);
 
             /* Decrement indices and advance pointers */
-            for (j = (int)(n - 1), carry = TRUE; j >= 0 && carry; --j) {
+            for (j = (int)(n - 2), carry = TRUE; j >= 0 && carry; --j) {
                 src += src_stride[j];
                 dst += dst_stride[j];
 
@@ -713,7 +804,9 @@ H5VM_stride_copy(unsigned n, hsize_t elmt_size, const hsize_t *size, const hsize
  *		DST and SRC while copying bytes from SRC to DST.  This
  *		function minimizes the number of calls to memcpy() by
  *		combining various strides, but it will never touch memory
- *		outside the hyperslab defined by the strides.
+ *		outside the hyperslab defined by the strides.  Elements of
+ *		1, 2, 4, 8 or 16 bytes are copied along the fastest changing
+ *		dimension with a loop specialized for that size.
  *
  * Note:	If the src_stride is all zero and elmt_size is one, then it's
  *		probably more efficient to use H5VM_stride_fill() instead.
@@ -744,14 +837,14 @@ H5VM_stride_copy_s(unsigned n, hsize_t elmt_size, const hsize_t *size, const hss
     if (n) {
         H5VM_vector_cpy(n, idx, size);
         nelmts = H5VM_vector_reduce_product(n, size);
-        for (i = 0; i < nelmts; i++) {
+        H5_CHECK_OVERFLOW(elmt_size, hsize_t, size_t);
+        for (i = 0; i < nelmts; i += size[n - 1]) {
 
-            /* Copy an element */
-            H5_CHECK_OVERFLOW(elmt_size, hsize_t, size_t);
-            H5MM_memcpy(dst, src, (size_t)elmt_size); /*lint !e671 The elmt_size will be OK */
+            /* Copy a run of elements along the fastest changing dimension */
+            H5VM_COPY_RUN(dst, dst_stride[n - 1], src, src_stride[n - 1], size[n - 1], (size_t)elmt_size);
 
             /* Decrement indices and advance pointers */
-            for (j = (int)(n - 1), carry = TRUE; j >= 0 && carry; --j) {
+            for (j = (int)(n - 2), carry = TRUE; j >= 0 && carry; --j) {
                 src += src_stride[j];
                 dst += dst_stride[j];
 
@@ -1536,7 +1629,7 @@ src_smaller:
         acc_len = 0;
         do {
             /* Copy data */
-            H5MM_memcpy(dst, src, tmp_src_len);
+            H5VM_COPY_SEQ(dst, src, tmp_src_len);
 
             /* Accumulate number of bytes copied */
             acc_len += tmp_src_len;
@@ -1579,7 +1672,7 @@ dst_smaller:
         acc_len = 0;
         do {
             /* Copy data */
-            H5MM_memcpy(dst, src, tmp_dst_len);
+            H5VM_COPY_SEQ(dst, src, tmp_dst_len);
 
             /* Accumulate number of bytes copied */
             acc_len += tmp_dst_len;
@@ -1622,7 +1715,7 @@ equal:
         acc_len = 0;
         do {
             /* Copy data */
-            H5MM_memcpy(dst, src, tmp_dst_len);
+            H5VM_COPY_SEQ(dst, src, tmp_dst_len);
 
             /* Accumulate number of bytes copied */
             acc_len += tmp_dst_len;
@@ -1665,3 +1758,141 @@ finished:
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5VM_memcpyvv() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5VM_gathervv
+ *
+ * Purpose:	Copies NSEQ sequences from the buffer SRC, sequence U being
+ *		LEN_ARR[U] bytes long and starting OFF_ARR[U] bytes into SRC,
+ *		to consecutive locations in the buffer DST.
+ *
+ *		A strided selection of small elements produces many short
+ *		sequences of the same length, so runs of equal length
+ *		sequences are copied with a loop specialized for that length
+ *		when it is 1, 2, 4, 8 or 16 bytes, instead of calling
+ *		memcpy() for each sequence.
+ *
+ * Return:	Number of bytes copied into DST (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5VM_gathervv(void *_dst, const void *_src, size_t nseq, const size_t len_arr[], const hsize_t off_arr[])
+{
+    unsigned char *      dst       = (unsigned char *)_dst;       /* Destination buffer pointer */
+    const unsigned char *src       = (const unsigned char *)_src; /* Source buffer pointer */
+    size_t               curr_seq  = 0;                           /* Current sequence */
+    size_t               ret_value = 0;                           /* Number of bytes copied */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(dst || nseq == 0);
+    HDassert(src || nseq == 0);
+    HDassert(len_arr || nseq == 0);
+    HDassert(off_arr || nseq == 0);
+
+    while (curr_seq < nseq) {
+        size_t seq_len = len_arr[curr_seq]; /* Length of sequences in this run */
+        size_t end_seq;                     /* End of the run of equal length sequences */
+
+        /* Find the end of the run of sequences with the same length */
+        for (end_seq = curr_seq + 1; end_seq < nseq && len_arr[end_seq] == seq_len; end_seq++)
+            ;
+        ret_value += (end_seq - curr_seq) * seq_len;
+
+        /* Copy the run */
+        switch (seq_len) {
+            case 1:
+                H5VM_GATHER_LOOP(dst, src, off_arr, curr_seq, end_seq, 1);
+                break;
+            case 2:
+                H5VM_GATHER_LOOP(dst, src, off_arr, curr_seq, end_seq, 2);
+                break;
+            case 4:
+                H5VM_GATHER_LOOP(dst, src, off_arr, curr_seq, end_seq, 4);
+                break;
+            case 8:
+                H5VM_GATHER_LOOP(dst, src, off_arr, curr_seq, end_seq, 8);
+                break;
+            case 16:
+                H5VM_GATHER_LOOP(dst, src, off_arr, curr_seq, end_seq, 16);
+                break;
+            default:
+                for (; curr_seq < end_seq; curr_seq++) {
+                    H5MM_memcpy(dst, src + off_arr[curr_seq], seq_len);
+                    dst += seq_len;
+                } /* end for */
+                break;
+        } /* end switch */
+    }     /* end while */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VM_gathervv() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5VM_scattervv
+ *
+ * Purpose:	The inverse of H5VM_gathervv(): copies consecutive bytes from
+ *		the buffer SRC into NSEQ sequences in the buffer DST, sequence
+ *		U being LEN_ARR[U] bytes long and starting OFF_ARR[U] bytes
+ *		into DST.  Runs of short, equal length sequences are handled
+ *		as in H5VM_gathervv().
+ *
+ * Return:	Number of bytes copied from SRC (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5VM_scattervv(void *_dst, size_t nseq, const size_t len_arr[], const hsize_t off_arr[], const void *_src)
+{
+    unsigned char *      dst       = (unsigned char *)_dst;       /* Destination buffer pointer */
+    const unsigned char *src       = (const unsigned char *)_src; /* Source buffer pointer */
+    size_t               curr_seq  = 0;                           /* Current sequence */
+    size_t               ret_value = 0;                           /* Number of bytes copied */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(dst || nseq == 0);
+    HDassert(src || nseq == 0);
+    HDassert(len_arr || nseq == 0);
+    HDassert(off_arr || nseq == 0);
+
+    while (curr_seq < nseq) {
+        size_t seq_len = len_arr[curr_seq]; /* Length of sequences in this run */
+        size_t end_seq;                     /* End of the run of equal length sequences */
+
+        /* Find the end of the run of sequences with the same length */
+        for (end_seq = curr_seq + 1; end_seq < nseq && len_arr[end_seq] == seq_len; end_seq++)
+            ;
+        ret_value += (end_seq - curr_seq) * seq_len;
+
+        /* Copy the run */
+        switch (seq_len) {
+            case 1:
+                H5VM_SCATTER_LOOP(dst, off_arr, src, curr_seq, end_seq, 1);
+                break;
+            case 2:
+                H5VM_SCATTER_LOOP(dst, off_arr, src, curr_seq, end_seq, 2);
+                break;
+            case 4:
+                H5VM_SCATTER_LOOP(dst, off_arr, src, curr_seq, end_seq, 4);
+                break;
+            case 8:
+                H5VM_SCATTER_LOOP(dst, off_arr, src, curr_seq, end_seq, 8);
+                break;
+            case 16:
+                H5VM_SCATTER_LOOP(dst, off_arr, src, curr_seq, end_seq, 16);
+                break;
+            default:
+                for (; curr_seq < end_seq; curr_seq++) {
+                    H5MM_memcpy(dst + off_arr[curr_seq], src, seq_len);
+                    src += seq_len;
+                } /* end for */
+                break;
+        } /* end switch */
+    }     /* end while */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VM_scattervv() */
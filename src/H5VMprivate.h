@@ -121,6 +121,10 @@ H5_DLL ssize_t H5VM_opvv(size_t dst_max_nseq, size_t *dst_curr_seq, size_t dst_l
 H5_DLL ssize_t H5VM_memcpyvv(void *_dst, size_t dst_max_nseq, size_t *dst_curr_seq, size_t dst_len_arr[],
                              hsize_t dst_off_arr[], const void *_src, size_t src_max_nseq,
                              size_t *src_curr_seq, size_t src_len_arr[], hsize_t src_off_arr[]);
+H5_DLL size_t  H5VM_gathervv(void *_dst, const void *_src, size_t nseq, const size_t len_arr[],
+                              const hsize_t off_arr[]);
+H5_DLL size_t  H5VM_scattervv(void *_dst, size_t nseq, const size_t len_arr[], const hsize_t off_arr[],
+                               const void *_src);
 
 /*-------------------------------------------------------------------------
  * Function:    H5VM_vector_reduce_product
@@ -97,6 +97,8 @@ H5Z__init_package(void)
         HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to register nbit filter")
     if (H5Z_register(H5Z_SCALEOFFSET) < 0)
         HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to register scaleoffset filter")
+    if (H5Z_register(H5Z_VLEN_INLINE) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to register vlen inline filter")
 
         /* External filters */
 #ifdef H5_HAVE_FILTER_DEFLATE
@@ -1030,9 +1032,12 @@ H5Z_ignore_filters(hid_t dcpl_id, const H5T_t *type, const H5S_t *space)
     space_class = H5S_GET_EXTENT_TYPE(space);
     type_class  = H5T_get_class(type, FALSE);
 
-    /* These conditions are not suitable for filters */
-    bad_for_filters = (H5S_NULL == space_class || H5S_SCALAR == space_class || H5T_VLEN == type_class ||
-                       (H5T_STRING == type_class && TRUE == H5T_is_variable_str(type)));
+    /* These conditions are not suitable for filters (variable-length data
+     * is, when the chunks hold the sequences) */
+    bad_for_filters =
+        (H5S_NULL == space_class || H5S_SCALAR == space_class ||
+         ((H5T_VLEN == type_class || (H5T_STRING == type_class && TRUE == H5T_is_variable_str(type))) &&
+          H5Z_filter_in_pline(&pline, H5Z_FILTER_VLEN_INLINE) <= 0));
 
     /* When these conditions occur, if there are required filters in pline,
        then report a failure, otherwise, set flag that they can be ignored */
@@ -37,6 +37,9 @@ H5_DLLVAR H5Z_class2_t H5Z_NBIT[1];
 /* Scale/offset filter */
 H5_DLLVAR H5Z_class2_t H5Z_SCALEOFFSET[1];
 
+/* Inline variable-length data filter */
+H5_DLLVAR const H5Z_class2_t H5Z_VLEN_INLINE[1];
+
 /********************/
 /* External filters */
 /********************/
@@ -65,6 +65,10 @@ typedef int H5Z_filter_t;
  * scale+offset compression
  */
 #define H5Z_FILTER_SCALEOFFSET 6
+/**
+ * variable-length data stored in the chunks
+ */
+#define H5Z_FILTER_VLEN_INLINE 7
 /**
  * filter ids below this value are reserved for library use
  */
@@ -0,0 +1,149 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	The inline variable-length data "filter".
+ *
+ *		The sequences of a dataset's variable-length elements are
+ *		stored in each chunk, after the elements, instead of in the
+ *		global heap.  The chunked storage code packs the sequences
+ *		into the chunk before the chunk is passed through the I/O
+ *		pipeline, and unpacks them after, so the filter function
+ *		itself leaves the data alone.  Being in the pipeline marks
+ *		the dataset's chunks as holding their sequences, and makes
+ *		the chunk index record the size of each chunk.
+ */
+
+#include "H5Zmodule.h" /* This source code file is part of the H5Z module */
+
+#include "H5private.h"   /* Generic Functions			*/
+#include "H5Dprivate.h"  /* Datasets				*/
+#include "H5Eprivate.h"  /* Error handling		  	*/
+#include "H5Iprivate.h"  /* IDs			  		*/
+#include "H5Oprivate.h"  /* Object headers		  	*/
+#include "H5Pprivate.h"  /* Property lists                       */
+#include "H5Tprivate.h"  /* Datatypes         			*/
+#include "H5Zpkg.h"      /* Data filters				*/
+
+/* Local function prototypes */
+static htri_t H5Z__can_apply_vlen_inline(hid_t dcpl_id, hid_t type_id, hid_t space_id);
+static size_t H5Z__filter_vlen_inline(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
+                                      size_t nbytes, size_t *buf_size, void **buf);
+
+/* This message derives from H5Z */
+const H5Z_class2_t H5Z_VLEN_INLINE[1] = {{
+    H5Z_CLASS_T_VERS,           /* H5Z_class_t version */
+    H5Z_FILTER_VLEN_INLINE,     /* Filter id number		*/
+    1,                          /* encoder_present flag (set to true) */
+    1,                          /* decoder_present flag (set to true) */
+    "vlen_inline",              /* Filter name for debugging	*/
+    H5Z__can_apply_vlen_inline, /* The "can apply" callback     */
+    NULL,                       /* The "set local" callback     */
+    H5Z__filter_vlen_inline,    /* The actual filter function	*/
+}};
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__can_apply_vlen_inline
+ *
+ * Purpose:	Check the parameters for the inline variable-length data
+ *		filter for validity.  The datatype must be a variable-length
+ *		string or sequence of data without variable-length parts or
+ *		references, which need the global heap.  A user-defined fill
+ *		value would need the global heap too, and partial edge
+ *		chunks must not skip the filter.
+ *
+ * Return:	Success: Non-negative (TRUE/FALSE)
+ *		Failure: Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5Z__can_apply_vlen_inline(hid_t dcpl_id, hid_t type_id, hid_t H5_ATTR_UNUSED space_id)
+{
+    H5P_genplist_t * dcpl_plist;       /* Property list pointer */
+    const H5T_t *    type;             /* Datatype */
+    H5T_t *          base = NULL;      /* Base datatype of the sequences */
+    H5O_fill_t       fill;             /* Fill value information */
+    H5D_fill_value_t fill_status;      /* Fill value status */
+    H5O_layout_t     layout;           /* Storage layout */
+    htri_t           status;           /* Status from checking the base datatype */
+    htri_t           ret_value = TRUE; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Get the plist structure */
+    if (NULL == (dcpl_plist = H5P_object_verify(dcpl_id, H5P_DATASET_CREATE)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Get datatype */
+    if (NULL == (type = (const H5T_t *)H5I_object_verify(type_id, H5I_DATATYPE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
+
+    /* Check for a variable-length string or sequence */
+    if (H5T_VLEN != H5T_get_class(type, TRUE))
+        HGOTO_DONE(FALSE)
+
+    /* Check the base datatype */
+    if (NULL == (base = H5T_get_super(type)))
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, FAIL, "can't get base datatype")
+    if ((status = H5T_detect_class(base, H5T_VLEN, FALSE)) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, FAIL, "can't check base datatype")
+    if (status)
+        HGOTO_DONE(FALSE)
+    if ((status = H5T_detect_class(base, H5T_REFERENCE, FALSE)) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, FAIL, "can't check base datatype")
+    if (status)
+        HGOTO_DONE(FALSE)
+
+    /* Check for a user-defined fill value */
+    if (H5P_peek(dcpl_plist, H5D_CRT_FILL_VALUE_NAME, &fill) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, FAIL, "can't get fill value")
+    if (H5P_is_fill_value_defined(&fill, &fill_status) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, FAIL, "can't tell if fill value defined")
+    if (H5D_FILL_VALUE_USER_DEFINED == fill_status)
+        HGOTO_DONE(FALSE)
+
+    /* Check for partial edge chunks skipping the filters */
+    if (H5P_peek(dcpl_plist, H5D_CRT_LAYOUT_NAME, &layout) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, FAIL, "can't get layout")
+    if (H5D_CHUNKED == layout.type &&
+        (layout.u.chunk.flags & H5O_LAYOUT_CHUNK_DONT_FILTER_PARTIAL_BOUND_CHUNKS))
+        HGOTO_DONE(FALSE)
+
+done:
+    if (base && H5T_close_real(base) < 0)
+        HDONE_ERROR(H5E_PLINE, H5E_CANTRELEASE, FAIL, "can't close base datatype")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__can_apply_vlen_inline() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__filter_vlen_inline
+ *
+ * Purpose:	Implement the inline variable-length data "filter", which
+ *		passes the chunk through unchanged.  (The sequences are
+ *		packed into the chunk and unpacked from it in H5Dchunk.c)
+ *
+ * Return:	Success: Size of buffer filtered
+ *		Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__filter_vlen_inline(unsigned H5_ATTR_UNUSED flags, size_t H5_ATTR_UNUSED cd_nelmts,
+                        const unsigned H5_ATTR_UNUSED cd_values[], size_t nbytes,
+                        size_t H5_ATTR_UNUSED *buf_size, void H5_ATTR_UNUSED **buf)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(nbytes)
+} /* end H5Z__filter_vlen_inline() */
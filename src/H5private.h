@@ -41,6 +41,11 @@
 #endif /* H5_HAVE_WIN32_API */
 #endif /* H5_HAVE_THREADSAFE */
 
+/* include the pthread header for the library's internal worker threads */
+#if defined(H5_HAVE_WORKER_THREADS) && !defined(H5_HAVE_THREADSAFE)
+#include <pthread.h>
+#endif /* defined(H5_HAVE_WORKER_THREADS) && !defined(H5_HAVE_THREADSAFE) */
+
 /*
  * Include ANSI-C header files.
  */
@@ -1242,6 +1247,9 @@ typedef off_t       h5_stat_size_t;
 #ifndef HDpread
 #define HDpread(F, B, C, O) pread(F, B, C, O)
 #endif /* HDpread */
+#ifndef HDpreadv
+#define HDpreadv(F, V, C, O) preadv(F, V, C, O)
+#endif /* HDpreadv */
 #ifndef HDprintf
 #define HDprintf printf
 #endif /* HDprintf */
@@ -1254,6 +1262,12 @@ typedef off_t       h5_stat_size_t;
 #ifndef HDpthread_attr_setscope
 #define HDpthread_attr_setscope(A, S) pthread_attr_setscope(A, S)
 #endif /* HDpthread_attr_setscope */
+#ifndef HDpthread_cond_broadcast
+#define HDpthread_cond_broadcast(C) pthread_cond_broadcast(C)
+#endif /* HDpthread_cond_broadcast */
+#ifndef HDpthread_cond_destroy
+#define HDpthread_cond_destroy(C) pthread_cond_destroy(C)
+#endif /* HDpthread_cond_destroy */
 #ifndef HDpthread_cond_init
 #define HDpthread_cond_init(C, A) pthread_cond_init(C, A)
 #endif /* HDpthread_cond_init */
@@ -1278,6 +1292,9 @@ typedef off_t       h5_stat_size_t;
 #ifndef HDpthread_key_create
 #define HDpthread_key_create(K, D) pthread_key_create(K, D)
 #endif /* HDpthread_key_create */
+#ifndef HDpthread_mutex_destroy
+#define HDpthread_mutex_destroy(M) pthread_mutex_destroy(M)
+#endif /* HDpthread_mutex_destroy */
 #ifndef HDpthread_mutex_init
 #define HDpthread_mutex_init(M, A) pthread_mutex_init(M, A)
 #endif /* HDpthread_mutex_init */
@@ -1308,6 +1325,9 @@ typedef off_t       h5_stat_size_t;
 #ifndef HDpwrite
 #define HDpwrite(F, B, C, O) pwrite(F, B, C, O)
 #endif /* HDpwrite */
+#ifndef HDpwritev
+#define HDpwritev(F, V, C, O) pwritev(F, V, C, O)
+#endif /* HDpwritev */
 #ifndef HDqsort
 #define HDqsort(M, N, Z, F) qsort(M, N, Z, F)
 #endif /* HDqsort*/
@@ -83,6 +83,11 @@ const char *FILENAME[] = {"dataset",             /* 0 */
                           "power2up",            /* 24 */
                           "version_bounds",      /* 25 */
                           "alloc_0sized",        /* 26 */
+                          "vlen_inline",         /* 27 */
+                          "tconv_overlap",       /* 28 */
+                          "sort_points",         /* 29 */
+                          "sieve_windows",       /* 30 */
+                          "bypass_cache",        /* 31 */
                           NULL};
 
 #define OHMIN_FILENAME_A "ohdr_min_a"
@@ -13104,6 +13109,942 @@ error:
     return FAIL;
 } /* end test_power2up() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_vlen_inline
+ *
+ * Purpose:     Tests datasets that store their variable-length strings in
+ *              their chunks, through the chunk cache and around it.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define VLEN_INLINE_DIM    100
+#define VLEN_INLINE_CHUNK  16
+#define VLEN_INLINE_STRLEN 64
+static herr_t
+vlen_inline_check(hid_t did, hid_t tid, char expected[][VLEN_INLINE_STRLEN])
+{
+    char *   rdata[VLEN_INLINE_DIM]; /* Strings read */
+    hid_t    sid = -1;               /* Dataspace ID */
+    unsigned u;                      /* Local index variable */
+
+    if (H5Dread(did, tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata) < 0)
+        TEST_ERROR
+    for (u = 0; u < VLEN_INLINE_DIM; u++)
+        if (expected[u][0] == '\0' ? rdata[u] != NULL : (!rdata[u] || HDstrcmp(rdata[u], expected[u]))) {
+            HDprintf("    element %u: '%s' read, '%s' expected\n", u, rdata[u] ? rdata[u] : "(NULL)",
+                     expected[u]);
+            TEST_ERROR
+        } /* end if */
+
+    if ((sid = H5Dget_space(did)) < 0)
+        TEST_ERROR
+    if (H5Treclaim(tid, sid, H5P_DEFAULT, rdata) < 0)
+        TEST_ERROR
+    if (H5Sclose(sid) < 0)
+        TEST_ERROR
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY { H5Sclose(sid); }
+    H5E_END_TRY;
+    return FAIL;
+} /* end vlen_inline_check() */
+
+static herr_t
+test_vlen_inline(hid_t fapl)
+{
+    char     filename[FILENAME_BUF_SIZE];
+    hid_t    fid      = -1;                                 /* File ID */
+    hid_t    dcpl     = -1;                                 /* Dataset creation property list */
+    hid_t    dapl     = -1;                                 /* Dataset access property list */
+    hid_t    sid      = -1;                                 /* Dataspace ID */
+    hid_t    msid     = -1;                                 /* Memory dataspace ID */
+    hid_t    tid      = -1;                                 /* Datatype ID */
+    hid_t    did      = -1;                                 /* Dataset ID */
+    hid_t    did2     = -1;                                 /* Dataset ID */
+    hsize_t  dims[1]  = {VLEN_INLINE_DIM};                  /* Dataset dimensions */
+    hsize_t  chunk[1] = {VLEN_INLINE_CHUNK};                /* Chunk dimensions */
+    hsize_t  start[1], count[1];                            /* Hyperslab selection */
+    char     expected[VLEN_INLINE_DIM][VLEN_INLINE_STRLEN]; /* Expected strings ("" for NULL) */
+    char *   wdata[VLEN_INLINE_DIM];                        /* Strings written */
+    int      pass;                                          /* Pass through chunk cache or not */
+    unsigned u;                                             /* Local index variable */
+
+    TESTING("variable-length data stored in chunks");
+
+    h5_fixname(FILENAME[27], fapl, filename, sizeof filename);
+
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if ((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((tid = H5Tcopy(H5T_C_S1)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tset_size(tid, H5T_VARIABLE) < 0)
+        FAIL_STACK_ERROR
+
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk(dcpl, 1, chunk) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_vlen_inline(dcpl) < 0)
+        FAIL_STACK_ERROR
+#ifdef H5_HAVE_FILTER_DEFLATE
+    if (H5Pset_deflate(dcpl, 6) < 0)
+        FAIL_STACK_ERROR
+#endif /* H5_HAVE_FILTER_DEFLATE */
+
+    /* The sequences must not need the global heap */
+    H5E_BEGIN_TRY { did = H5Dcreate2(fid, "int", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT); }
+    H5E_END_TRY;
+    if (did >= 0)
+        TEST_ERROR
+
+    /* Write through the chunk cache, then with the chunk cache disabled */
+    if ((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        FAIL_STACK_ERROR
+    for (pass = 0; pass < 2; pass++) {
+        const char *name = pass ? "uncached" : "cached";
+
+        if (pass && H5Pset_chunk_cache(dapl, 0, 0, H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+            FAIL_STACK_ERROR
+        if ((did = H5Dcreate2(fid, name, tid, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+            FAIL_STACK_ERROR
+
+        /* Unwritten elements are NULL */
+        HDmemset(expected, 0, sizeof(expected));
+        if (vlen_inline_check(did, tid, expected) < 0)
+            TEST_ERROR
+
+        /* Write all the strings, some repeated to compress */
+        for (u = 0; u < VLEN_INLINE_DIM; u++) {
+            if (u % 9 == 5)
+                expected[u][0] = '\0';
+            else
+                HDsnprintf(expected[u], VLEN_INLINE_STRLEN, "string %u %.*s", u, (int)(u % 23),
+                           "abcabcabcabcabcabcabcabc");
+            wdata[u] = expected[u][0] ? expected[u] : NULL;
+        } /* end for */
+        if (H5Dwrite(did, tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata) < 0)
+            FAIL_STACK_ERROR
+        if (vlen_inline_check(did, tid, expected) < 0)
+            TEST_ERROR
+
+        /* Overwrite strings across a chunk boundary, several times */
+        start[0] = 10;
+        count[0] = 20;
+        if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            FAIL_STACK_ERROR
+        if ((msid = H5Screate_simple(1, count, NULL)) < 0)
+            FAIL_STACK_ERROR
+        for (u = 0; u < 50; u++) {
+            unsigned v;
+
+            for (v = 0; v < count[0]; v++) {
+                HDsnprintf(expected[start[0] + v], VLEN_INLINE_STRLEN, "new %u-%u", u, v);
+                wdata[v] = expected[start[0] + v];
+            } /* end for */
+            if (H5Dwrite(did, tid, msid, sid, H5P_DEFAULT, wdata) < 0)
+                FAIL_STACK_ERROR
+        } /* end for */
+        if (H5Sclose(msid) < 0)
+            FAIL_STACK_ERROR
+        if (H5Sselect_all(sid) < 0)
+            FAIL_STACK_ERROR
+        if (vlen_inline_check(did, tid, expected) < 0)
+            TEST_ERROR
+
+        /* Copy the dataset while chunks may still be in its cache */
+        if (H5Ocopy(fid, name, fid, pass ? "uncached_copy" : "cached_copy", H5P_DEFAULT, H5P_DEFAULT) < 0)
+            FAIL_STACK_ERROR
+
+        if (H5Dclose(did) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Read everything back from the file */
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if ((did = H5Dopen2(fid, "cached", H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if ((did2 = H5Dopen2(fid, "uncached_copy", dapl)) < 0)
+        FAIL_STACK_ERROR
+    if (vlen_inline_check(did, tid, expected) < 0)
+        TEST_ERROR
+    if (vlen_inline_check(did2, tid, expected) < 0)
+        TEST_ERROR
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dclose(did2) < 0)
+        FAIL_STACK_ERROR
+    if ((did = H5Dopen2(fid, "cached_copy", H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if (vlen_inline_check(did, tid, expected) < 0)
+        TEST_ERROR
+
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tclose(tid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dapl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(did);
+        H5Dclose(did2);
+        H5Tclose(tid);
+        H5Sclose(msid);
+        H5Sclose(sid);
+        H5Pclose(dcpl);
+        H5Pclose(dapl);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    return FAIL;
+} /* end test_vlen_inline() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_tconv_overlap
+ *
+ * Purpose:     Tests that overlapping I/O with datatype conversion, with
+ *              H5Pset_tconv_overlap, gives the same results as the
+ *              normal strip-mined I/O, for contiguous and chunked
+ *              datasets, selections which don't divide evenly into
+ *              strips, conversions which change the element size, and
+ *              data transforms.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *-------------------------------------------------------------------------
+ */
+#define TCONV_OVERLAP_NELMTS 10000
+static herr_t
+test_tconv_overlap(hid_t fapl)
+{
+    char    filename[FILENAME_BUF_SIZE];
+    hid_t   fid   = H5I_INVALID_HID;
+    hid_t   sid   = H5I_INVALID_HID;
+    hid_t   dcpl  = H5I_INVALID_HID;
+    hid_t   dxpl  = H5I_INVALID_HID;
+    hid_t   did   = H5I_INVALID_HID;
+    hsize_t dims  = TCONV_OVERLAP_NELMTS;
+    hsize_t chunk = TCONV_OVERLAP_NELMTS / 4;
+    hsize_t start = 3, stride = 3, count = (TCONV_OVERLAP_NELMTS - 3) / 3;
+    hbool_t overlap;
+    int *   wbuf  = NULL;
+    double *rbuf  = NULL;
+    double *rbuf2 = NULL;
+    int     i, j;
+
+    TESTING("overlapping I/O with datatype conversion");
+
+    h5_fixname(FILENAME[28], fapl, filename, sizeof filename);
+
+    if (NULL == (wbuf = (int *)HDmalloc(TCONV_OVERLAP_NELMTS * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (rbuf = (double *)HDmalloc(TCONV_OVERLAP_NELMTS * sizeof(double))))
+        TEST_ERROR
+    if (NULL == (rbuf2 = (double *)HDmalloc(TCONV_OVERLAP_NELMTS * sizeof(double))))
+        TEST_ERROR
+    for (i = 0; i < TCONV_OVERLAP_NELMTS; i++)
+        wbuf[i] = (i * 7) - 1000;
+
+    /* Check the property */
+    if ((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        TEST_ERROR
+    if (H5Pget_tconv_overlap(dxpl, &overlap) < 0)
+        TEST_ERROR
+    if (overlap)
+        TEST_ERROR
+    if (H5Pset_tconv_overlap(dxpl, TRUE) < 0)
+        TEST_ERROR
+    if (H5Pget_tconv_overlap(dxpl, &overlap) < 0)
+        TEST_ERROR
+    if (!overlap)
+        TEST_ERROR
+
+    /* Use a conversion buffer for 1000 doubles, which doesn't divide the
+     * selections evenly */
+    if (H5Pset_buffer(dxpl, (size_t)1000 * sizeof(double), NULL, NULL) < 0)
+        TEST_ERROR
+
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR
+    if ((sid = H5Screate_simple(1, &dims, NULL)) < 0)
+        TEST_ERROR
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if (H5Pset_chunk(dcpl, 1, &chunk) < 0)
+        TEST_ERROR
+
+    /* Contiguous (j == 0) and chunked (j == 1) datasets */
+    for (j = 0; j < 2; j++) {
+        if ((did = H5Dcreate2(fid, j ? "chunked" : "contig", H5T_STD_I32BE, sid, H5P_DEFAULT,
+                              j ? dcpl : H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            TEST_ERROR
+
+        /* Write with overlapping, then read back with & without it */
+        if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, wbuf) < 0)
+            TEST_ERROR
+        if (H5Dread(did, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, dxpl, rbuf) < 0)
+            TEST_ERROR
+        if (H5Dread(did, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf2) < 0)
+            TEST_ERROR
+        for (i = 0; i < TCONV_OVERLAP_NELMTS; i++)
+            if (rbuf[i] != (double)wbuf[i] || rbuf2[i] != (double)wbuf[i]) {
+                H5_FAILED();
+                HDprintf("    element %d: expected %d, read %f and %f\n", i, wbuf[i], rbuf[i], rbuf2[i]);
+                goto error;
+            } /* end if */
+
+        /* Overwrite every third element, through a data transform */
+        if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, &start, &stride, &count, NULL) < 0)
+            TEST_ERROR
+        if (H5Pset_data_transform(dxpl, "x+1") < 0)
+            TEST_ERROR
+        if (H5Dwrite(did, H5T_NATIVE_INT, sid, sid, dxpl, wbuf) < 0)
+            TEST_ERROR
+        for (i = 3; i < (int)(start + stride * count); i += 3)
+            wbuf[i]++;
+
+        /* Read the selection back through the transform */
+        HDmemset(rbuf, 0, TCONV_OVERLAP_NELMTS * sizeof(double));
+        if (H5Dread(did, H5T_NATIVE_DOUBLE, sid, sid, dxpl, rbuf) < 0)
+            TEST_ERROR
+        if (H5Pset_data_transform(dxpl, "x") < 0)
+            TEST_ERROR
+        for (i = 0; i < TCONV_OVERLAP_NELMTS; i++) {
+            double expected = (i >= 3 && (i % 3) == 0 && i < (int)(start + stride * count))
+                                  ? (double)wbuf[i] + 1.0
+                                  : 0.0;
+
+            if (rbuf[i] != expected) {
+                H5_FAILED();
+                HDprintf("    element %d: expected %f, read %f\n", i, expected, rbuf[i]);
+                goto error;
+            } /* end if */
+        }     /* end for */
+
+        /* Check the whole dataset without overlapping */
+        if (H5Sselect_all(sid) < 0)
+            TEST_ERROR
+        if (H5Dread(did, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf2) < 0)
+            TEST_ERROR
+        for (i = 0; i < TCONV_OVERLAP_NELMTS; i++)
+            if (rbuf2[i] != (double)wbuf[i]) {
+                H5_FAILED();
+                HDprintf("    element %d: expected %d, read %f\n", i, wbuf[i], rbuf2[i]);
+                goto error;
+            } /* end if */
+
+        if (H5Dclose(did) < 0)
+            TEST_ERROR
+    } /* end for */
+
+    if (H5Pclose(dcpl) < 0)
+        TEST_ERROR
+    if (H5Pclose(dxpl) < 0)
+        TEST_ERROR
+    if (H5Sclose(sid) < 0)
+        TEST_ERROR
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR
+    HDfree(wbuf);
+    HDfree(rbuf);
+    HDfree(rbuf2);
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(did);
+        H5Pclose(dcpl);
+        H5Pclose(dxpl);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    HDfree(wbuf);
+    HDfree(rbuf);
+    HDfree(rbuf2);
+    return FAIL;
+} /* end test_tconv_overlap() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_sort_points
+ *
+ * Purpose:     Tests that I/O on point selections which aren't in file
+ *              order, including duplicate points, gives the same results
+ *              with and without H5Pset_sort_points, for contiguous and
+ *              chunked datasets.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *-------------------------------------------------------------------------
+ */
+#define SORT_POINTS_DIM0    50
+#define SORT_POINTS_DIM1    40
+#define SORT_POINTS_NPOINTS 1000
+static herr_t
+test_sort_points(hid_t fapl)
+{
+    char     filename[FILENAME_BUF_SIZE];
+    hid_t    fid       = H5I_INVALID_HID;
+    hid_t    fsid      = H5I_INVALID_HID;
+    hid_t    msid      = H5I_INVALID_HID;
+    hid_t    dcpl      = H5I_INVALID_HID;
+    hid_t    dxpl      = H5I_INVALID_HID;
+    hid_t    did       = H5I_INVALID_HID;
+    hsize_t  dims[2]   = {SORT_POINTS_DIM0, SORT_POINTS_DIM1};
+    hsize_t  chunk[2]  = {7, 9};
+    hsize_t  mdims     = 2 * SORT_POINTS_NPOINTS;
+    hsize_t  mstart    = 1, mstride = 2, mcount = SORT_POINTS_NPOINTS;
+    hsize_t *coords    = NULL;
+    int *    wbuf      = NULL;
+    int *    rbuf      = NULL;
+    int *    expected  = NULL;
+    unsigned seed      = 12345;
+    hbool_t  sort_points;
+    int      i, j, k;
+
+    TESTING("I/O on sorted point selections");
+
+    h5_fixname(FILENAME[29], fapl, filename, sizeof filename);
+
+    if (NULL == (coords = (hsize_t *)HDmalloc(2 * SORT_POINTS_NPOINTS * sizeof(hsize_t))))
+        TEST_ERROR
+    if (NULL == (wbuf = (int *)HDmalloc(2 * SORT_POINTS_NPOINTS * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (rbuf = (int *)HDmalloc(2 * SORT_POINTS_NPOINTS * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (expected = (int *)HDmalloc(SORT_POINTS_DIM0 * SORT_POINTS_DIM1 * sizeof(int))))
+        TEST_ERROR
+
+    /* Pick points in a repeatable pseudo-random order, with duplicates */
+    for (i = 0; i < SORT_POINTS_NPOINTS; i++) {
+        seed                = seed * 1103515245 + 12345;
+        coords[2 * i]       = (seed >> 8) % SORT_POINTS_DIM0;
+        seed                = seed * 1103515245 + 12345;
+        coords[(2 * i) + 1] = (seed >> 8) % SORT_POINTS_DIM1;
+        wbuf[2 * i]         = -1;
+        wbuf[(2 * i) + 1]   = i + 1;
+    } /* end for */
+
+    /* Check the property */
+    if ((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        TEST_ERROR
+    if (H5Pget_sort_points(dxpl, &sort_points) < 0)
+        TEST_ERROR
+    if (sort_points)
+        TEST_ERROR
+    if (H5Pset_sort_points(dxpl, TRUE) < 0)
+        TEST_ERROR
+    if (H5Pget_sort_points(dxpl, &sort_points) < 0)
+        TEST_ERROR
+    if (!sort_points)
+        TEST_ERROR
+
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR
+    if ((fsid = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR
+    if (H5Sselect_elements(fsid, H5S_SELECT_SET, (size_t)SORT_POINTS_NPOINTS, coords) < 0)
+        TEST_ERROR
+
+    /* Use every other element of the memory buffer */
+    if ((msid = H5Screate_simple(1, &mdims, NULL)) < 0)
+        TEST_ERROR
+    if (H5Sselect_hyperslab(msid, H5S_SELECT_SET, &mstart, &mstride, &mcount, NULL) < 0)
+        TEST_ERROR
+
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if (H5Pset_chunk(dcpl, 2, chunk) < 0)
+        TEST_ERROR
+
+    /* Contiguous (j == 0) and chunked (j == 1) datasets, written without
+     * (k == 0) and with (k == 1) sorting */
+    for (j = 0; j < 2; j++)
+        for (k = 0; k < 2; k++) {
+            char name[32];
+
+            HDsnprintf(name, sizeof(name), "%s_%d", j ? "chunked" : "contig", k);
+            if ((did = H5Dcreate2(fid, name, H5T_NATIVE_INT, fsid, H5P_DEFAULT, j ? dcpl : H5P_DEFAULT,
+                                  H5P_DEFAULT)) < 0)
+                TEST_ERROR
+            if (H5Dwrite(did, H5T_NATIVE_INT, msid, fsid, k ? dxpl : H5P_DEFAULT, wbuf) < 0)
+                TEST_ERROR
+
+            /* The last write to a duplicated point must win */
+            for (i = 0; i < SORT_POINTS_NPOINTS; i++)
+                expected[(coords[2 * i] * SORT_POINTS_DIM1) + coords[(2 * i) + 1]] = i + 1;
+
+            /* Read the points back with sorting, into the same memory layout */
+            HDmemset(rbuf, 0, 2 * SORT_POINTS_NPOINTS * sizeof(int));
+            if (H5Dread(did, H5T_NATIVE_INT, msid, fsid, dxpl, rbuf) < 0)
+                TEST_ERROR
+            for (i = 0; i < SORT_POINTS_NPOINTS; i++) {
+                int exp_val = expected[(coords[2 * i] * SORT_POINTS_DIM1) + coords[(2 * i) + 1]];
+
+                if (rbuf[2 * i] != 0 || rbuf[(2 * i) + 1] != exp_val) {
+                    H5_FAILED();
+                    HDprintf("    %s point %d: expected %d, read %d\n", name, i, exp_val,
+                             rbuf[(2 * i) + 1]);
+                    goto error;
+                } /* end if */
+            }     /* end for */
+
+            /* Check the whole dataset without sorting */
+            if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, expected) < 0)
+                TEST_ERROR
+            for (i = 0; i < SORT_POINTS_NPOINTS; i++) {
+                int val = expected[(coords[2 * i] * SORT_POINTS_DIM1) + coords[(2 * i) + 1]];
+
+                if (val != rbuf[(2 * i) + 1]) {
+                    H5_FAILED();
+                    HDprintf("    %s point %d: expected %d, read %d\n", name, i, rbuf[(2 * i) + 1], val);
+                    goto error;
+                } /* end if */
+            }     /* end for */
+
+            if (H5Dclose(did) < 0)
+                TEST_ERROR
+        } /* end for */
+
+    if (H5Pclose(dcpl) < 0)
+        TEST_ERROR
+    if (H5Pclose(dxpl) < 0)
+        TEST_ERROR
+    if (H5Sclose(msid) < 0)
+        TEST_ERROR
+    if (H5Sclose(fsid) < 0)
+        TEST_ERROR
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR
+    HDfree(coords);
+    HDfree(wbuf);
+    HDfree(rbuf);
+    HDfree(expected);
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(did);
+        H5Pclose(dcpl);
+        H5Pclose(dxpl);
+        H5Sclose(msid);
+        H5Sclose(fsid);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    HDfree(coords);
+    HDfree(wbuf);
+    HDfree(rbuf);
+    HDfree(expected);
+    return FAIL;
+} /* end test_sort_points() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_sieve_windows
+ *
+ * Purpose:     Tests interleaved accesses to separate regions of a
+ *              contiguous dataset, which are served from several data
+ *              sieve windows, including a large write that overlaps a
+ *              dirty window.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *-------------------------------------------------------------------------
+ */
+#define SIEVE_WIN_DIM      8192
+#define SIEVE_WIN_NREGIONS 3
+#define SIEVE_WIN_NACCESS  100
+#define SIEVE_WIN_BIG      2000
+static herr_t
+test_sieve_windows(hid_t fapl)
+{
+    char     filename[FILENAME_BUF_SIZE];
+    hid_t    my_fapl = H5I_INVALID_HID;
+    hid_t    fid     = H5I_INVALID_HID;
+    hid_t    fsid    = H5I_INVALID_HID;
+    hid_t    msid    = H5I_INVALID_HID;
+    hid_t    did     = H5I_INVALID_HID;
+    hsize_t  dims    = SIEVE_WIN_DIM;
+    hsize_t  one     = 1;
+    hsize_t  start, count;
+    int *    expected = NULL;
+    int *    rbuf     = NULL;
+    int      val;
+    unsigned nhits, nmisses, nwin;
+    unsigned u, v;
+
+    TESTING("interleaved I/O with several data sieve windows");
+
+    h5_fixname(FILENAME[30], fapl, filename, sizeof filename);
+
+    if (NULL == (expected = (int *)HDmalloc(SIEVE_WIN_DIM * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (rbuf = (int *)HDmalloc(SIEVE_WIN_DIM * sizeof(int))))
+        TEST_ERROR
+    for (u = 0; u < SIEVE_WIN_DIM; u++)
+        expected[u] = (int)u;
+
+    /* Use a small sieve buffer, so the regions can't share a window */
+    if ((my_fapl = H5Pcopy(fapl)) < 0)
+        TEST_ERROR
+    if (H5Pset_sieve_buf_size(my_fapl, (size_t)1024) < 0)
+        TEST_ERROR
+
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, my_fapl)) < 0)
+        TEST_ERROR
+    if ((fsid = H5Screate_simple(1, &dims, NULL)) < 0)
+        TEST_ERROR
+    if ((msid = H5Screate_simple(1, &one, NULL)) < 0)
+        TEST_ERROR
+    if ((did = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, fsid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, expected) < 0)
+        TEST_ERROR
+
+    /* Read single elements from each region in turn */
+    for (u = 0; u < SIEVE_WIN_NACCESS; u++)
+        for (v = 0; v < SIEVE_WIN_NREGIONS; v++) {
+            start = (v * (SIEVE_WIN_DIM / SIEVE_WIN_NREGIONS)) + u;
+            if (H5Sselect_hyperslab(fsid, H5S_SELECT_SET, &start, NULL, &one, NULL) < 0)
+                TEST_ERROR
+            if (H5Dread(did, H5T_NATIVE_INT, msid, fsid, H5P_DEFAULT, &val) < 0)
+                TEST_ERROR
+            if (val != expected[start]) {
+                H5_FAILED();
+                HDprintf("    element %lu: expected %d, read %d\n", (unsigned long)start, expected[start],
+                         val);
+                goto error;
+            } /* end if */
+        }     /* end for */
+
+    /* With a single sieve buffer every read would miss.  (The statistics are
+     * only checked when the file driver uses the sieve buffer at all.) */
+    if (H5D__sieve_stats_test(did, &nhits, &nmisses, &nwin) < 0)
+        TEST_ERROR
+    if (nmisses > 0) {
+        if (nmisses > 2 * SIEVE_WIN_NREGIONS || nhits < (SIEVE_WIN_NACCESS - 2) * SIEVE_WIN_NREGIONS)
+            FAIL_PUTS_ERROR("sieve windows not reused")
+        if (nwin != SIEVE_WIN_NREGIONS - 1)
+            FAIL_PUTS_ERROR("wrong number of sieve windows")
+    } /* end if */
+
+    /* Write single elements to each region in turn, leaving dirty windows */
+    for (u = 0; u < SIEVE_WIN_NACCESS; u++)
+        for (v = 0; v < SIEVE_WIN_NREGIONS; v++) {
+            start           = (v * (SIEVE_WIN_DIM / SIEVE_WIN_NREGIONS)) + u;
+            expected[start] = -(int)start;
+            if (H5Sselect_hyperslab(fsid, H5S_SELECT_SET, &start, NULL, &one, NULL) < 0)
+                TEST_ERROR
+            if (H5Dwrite(did, H5T_NATIVE_INT, msid, fsid, H5P_DEFAULT, &expected[start]) < 0)
+                TEST_ERROR
+        } /* end for */
+
+    /* Overwrite the start of the dataset (and the first region's window)
+     * with a write too large for the sieve buffer */
+    start = SIEVE_WIN_NACCESS / 2;
+    count = SIEVE_WIN_BIG;
+    for (u = 0; u < SIEVE_WIN_BIG; u++)
+        expected[start + u] = (int)(SIEVE_WIN_DIM + u);
+    if (H5Sselect_hyperslab(fsid, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0)
+        TEST_ERROR
+    if (H5Sclose(msid) < 0)
+        TEST_ERROR
+    if ((msid = H5Screate_simple(1, &count, NULL)) < 0)
+        TEST_ERROR
+    if (H5Dwrite(did, H5T_NATIVE_INT, msid, fsid, H5P_DEFAULT, &expected[start]) < 0)
+        TEST_ERROR
+
+    /* Check the whole dataset, while it's still open and after re-opening it */
+    for (v = 0; v < 2; v++) {
+        if (v) {
+            if (H5Dclose(did) < 0)
+                TEST_ERROR
+            if (H5Fclose(fid) < 0)
+                TEST_ERROR
+            if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, my_fapl)) < 0)
+                TEST_ERROR
+            if ((did = H5Dopen2(fid, "dset", H5P_DEFAULT)) < 0)
+                TEST_ERROR
+        } /* end if */
+
+        HDmemset(rbuf, 0, SIEVE_WIN_DIM * sizeof(int));
+        if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            TEST_ERROR
+        for (u = 0; u < SIEVE_WIN_DIM; u++)
+            if (rbuf[u] != expected[u]) {
+                H5_FAILED();
+                HDprintf("    %s element %u: expected %d, read %d\n", v ? "re-opened" : "open", u,
+                         expected[u], rbuf[u]);
+                goto error;
+            } /* end if */
+    }         /* end for */
+
+    if (H5Dclose(did) < 0)
+        TEST_ERROR
+    if (H5Sclose(msid) < 0)
+        TEST_ERROR
+    if (H5Sclose(fsid) < 0)
+        TEST_ERROR
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR
+    if (H5Pclose(my_fapl) < 0)
+        TEST_ERROR
+
+    HDfree(expected);
+    HDfree(rbuf);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(did);
+        H5Sclose(msid);
+        H5Sclose(fsid);
+        H5Fclose(fid);
+        H5Pclose(my_fapl);
+    }
+    H5E_END_TRY;
+    HDfree(expected);
+    HDfree(rbuf);
+
+    return FAIL;
+} /* end test_sieve_windows() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_bypass_cache
+ *
+ * Purpose:     Tests reading contiguous and chunked datasets with
+ *              H5Pset_bypass_cache, including data that is still only in
+ *              the data sieve buffer or the chunk cache.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *-------------------------------------------------------------------------
+ */
+#define BYPASS_CACHE_DIM   64
+#define BYPASS_CACHE_CHUNK 16
+static herr_t
+test_bypass_cache(hid_t fapl)
+{
+    char         filename[FILENAME_BUF_SIZE];
+    const char * dset_names[3] = {"contig", "chunked", "filtered"};
+    hid_t        fid           = H5I_INVALID_HID;
+    hid_t        sid           = H5I_INVALID_HID;
+    hid_t        msid          = H5I_INVALID_HID;
+    hid_t        dcpl          = H5I_INVALID_HID;
+    hid_t        dxpl          = H5I_INVALID_HID;
+    hid_t        did           = H5I_INVALID_HID;
+    hsize_t      dims[2]       = {BYPASS_CACHE_DIM, BYPASS_CACHE_DIM};
+    hsize_t      chunk[2]      = {BYPASS_CACHE_CHUNK, BYPASS_CACHE_DIM};
+    hsize_t      start[2]      = {3, 5};
+    hsize_t      count[2]      = {2, 40};
+    hsize_t      col_start[2]  = {0, 7};
+    hsize_t      col_count[2]  = {BYPASS_CACHE_DIM, 1};
+    int *        wbuf          = NULL;
+    int *        rbuf          = NULL;
+    long long *  lbuf          = NULL;
+    int          val;
+    int          nused;
+    size_t       rdcc_nbytes;
+    hbool_t      cache_chunks;
+    hbool_t      bypass_cache;
+    unsigned     u, v;
+
+    TESTING("reading around the data sieve buffer and chunk cache");
+
+    h5_fixname(FILENAME[31], fapl, filename, sizeof filename);
+
+    if (NULL == (wbuf = (int *)HDmalloc(BYPASS_CACHE_DIM * BYPASS_CACHE_DIM * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (rbuf = (int *)HDmalloc(BYPASS_CACHE_DIM * BYPASS_CACHE_DIM * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (lbuf = (long long *)HDmalloc(BYPASS_CACHE_DIM * BYPASS_CACHE_DIM * sizeof(long long))))
+        TEST_ERROR
+
+    /* Check the property */
+    if ((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        TEST_ERROR
+    if (H5Pget_bypass_cache(dxpl, &bypass_cache) < 0)
+        TEST_ERROR
+    if (bypass_cache)
+        TEST_ERROR
+    if (H5Pset_bypass_cache(dxpl, TRUE) < 0)
+        TEST_ERROR
+    if (H5Pget_bypass_cache(dxpl, &bypass_cache) < 0)
+        TEST_ERROR
+    if (!bypass_cache)
+        TEST_ERROR
+
+    /* Check whether the chunk cache can hold a chunk at all */
+    if (H5Pget_cache(fapl, NULL, NULL, &rdcc_nbytes, NULL) < 0)
+        TEST_ERROR
+    cache_chunks = rdcc_nbytes >= (BYPASS_CACHE_CHUNK * BYPASS_CACHE_DIM * sizeof(int));
+
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR
+    if ((sid = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR
+    if ((msid = H5Screate_simple(2, col_count, NULL)) < 0)
+        TEST_ERROR
+
+    /* Contiguous (u == 0), chunked (u == 1) and filtered chunked (u == 2) datasets */
+    for (u = 0; u < 3; u++) {
+        if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+            TEST_ERROR
+        if (u > 0 && H5Pset_chunk(dcpl, 2, chunk) < 0)
+            TEST_ERROR
+        if (u > 1 && H5Pset_shuffle(dcpl) < 0)
+            TEST_ERROR
+
+        if ((did = H5Dcreate2(fid, dset_names[u], H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) <
+            0)
+            TEST_ERROR
+        for (v = 0; v < BYPASS_CACHE_DIM * BYPASS_CACHE_DIM; v++)
+            wbuf[v] = (int)(v + u);
+        if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+            TEST_ERROR
+
+        /* Re-open the dataset, to start with empty caches */
+        if (H5Dclose(did) < 0)
+            TEST_ERROR
+        if ((did = H5Dopen2(fid, dset_names[u], H5P_DEFAULT)) < 0)
+            TEST_ERROR
+
+        /* Read everything, without and with a type conversion */
+        HDmemset(rbuf, 0, BYPASS_CACHE_DIM * BYPASS_CACHE_DIM * sizeof(int));
+        if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, rbuf) < 0)
+            TEST_ERROR
+        if (H5Dread(did, H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, dxpl, lbuf) < 0)
+            TEST_ERROR
+        for (v = 0; v < BYPASS_CACHE_DIM * BYPASS_CACHE_DIM; v++)
+            if (rbuf[v] != wbuf[v] || lbuf[v] != (long long)wbuf[v]) {
+                H5_FAILED();
+                HDprintf("    %s element %u: expected %d, read %d and %lld\n", dset_names[u], v, wbuf[v],
+                         rbuf[v], lbuf[v]);
+                goto error;
+            } /* end if */
+
+        /* The chunks are whole rows, so each one is read in a single piece
+         * and only the filtered ones are loaded into the chunk cache (if it
+         * can hold them at all) */
+        if (u > 0) {
+            if (H5D__current_cache_size_test(did, NULL, &nused) < 0)
+                TEST_ERROR
+            if ((u == 1 && nused != 0) || (u == 2 && cache_chunks && nused == 0))
+                FAIL_PUTS_ERROR("wrong number of chunks in the chunk cache")
+        } /* end if */
+
+        /* Change a block of elements, leaving the data in the sieve buffer
+         * or chunk cache, then read it around them */
+        val = -1;
+        if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR
+        for (v = 0; v < count[0] * count[1]; v++)
+            wbuf[((start[0] + (v / count[1])) * BYPASS_CACHE_DIM) + start[1] + (v % count[1])] = val--;
+        if (H5Dwrite(did, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, wbuf) < 0)
+            TEST_ERROR
+        if (H5Sselect_all(sid) < 0)
+            TEST_ERROR
+
+        HDmemset(rbuf, 0, BYPASS_CACHE_DIM * BYPASS_CACHE_DIM * sizeof(int));
+        if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, rbuf) < 0)
+            TEST_ERROR
+        for (v = 0; v < BYPASS_CACHE_DIM * BYPASS_CACHE_DIM; v++)
+            if (rbuf[v] != wbuf[v]) {
+                H5_FAILED();
+                HDprintf("    %s element %u: expected %d, read %d\n", dset_names[u], v, wbuf[v], rbuf[v]);
+                goto error;
+            } /* end if */
+
+        /* Read a column, which is made up of small pieces */
+        if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, col_start, NULL, col_count, NULL) < 0)
+            TEST_ERROR
+        if (H5Dread(did, H5T_NATIVE_INT, msid, sid, dxpl, rbuf) < 0)
+            TEST_ERROR
+        if (H5Sselect_all(sid) < 0)
+            TEST_ERROR
+        for (v = 0; v < BYPASS_CACHE_DIM; v++)
+            if (rbuf[v] != wbuf[(v * BYPASS_CACHE_DIM) + col_start[1]]) {
+                H5_FAILED();
+                HDprintf("    %s column element %u: expected %d, read %d\n", dset_names[u], v,
+                         wbuf[(v * BYPASS_CACHE_DIM) + col_start[1]], rbuf[v]);
+                goto error;
+            } /* end if */
+
+        if (H5Dclose(did) < 0)
+            TEST_ERROR
+        did = H5I_INVALID_HID;
+        if (H5Pclose(dcpl) < 0)
+            TEST_ERROR
+        dcpl = H5I_INVALID_HID;
+    } /* end for */
+
+    if (H5Sclose(msid) < 0)
+        TEST_ERROR
+    if (H5Sclose(sid) < 0)
+        TEST_ERROR
+    if (H5Pclose(dxpl) < 0)
+        TEST_ERROR
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+    HDfree(lbuf);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(did);
+        H5Pclose(dcpl);
+        H5Pclose(dxpl);
+        H5Sclose(msid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    HDfree(wbuf);
+    HDfree(rbuf);
+    HDfree(lbuf);
+
+    return FAIL;
+} /* end test_bypass_cache() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_scatter
  *
@@ -15263,6 +16204,11 @@ main(void)
                 nerrors += (test_zero_dim_dset(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_storage_size(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_power2up(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_vlen_inline(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_tconv_overlap(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_sort_points(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_sieve_windows(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_bypass_cache(my_fapl) < 0 ? 1 : 0);
 
                 nerrors += (test_swmr_non_latest(envval, my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_earray_hdr_fd(envval, my_fapl) < 0 ? 1 : 0);
@@ -883,6 +883,415 @@ error:
     return MAX((int)fails_this_test, 1);
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    conv_16bit_except
+ *
+ * Purpose:     Gets called from test_conv_16bit_flt() for data type
+ *              conversion exceptions.  Counts overflows.
+ *
+ * Return:      H5T_CONV_UNHANDLED
+ *-------------------------------------------------------------------------
+ */
+static H5T_conv_ret_t
+conv_16bit_except(H5T_conv_except_t except_type, hid_t H5_ATTR_UNUSED src_id, hid_t H5_ATTR_UNUSED dst_id,
+                  void H5_ATTR_UNUSED *src_buf, void H5_ATTR_UNUSED *dst_buf, void *user_data)
+{
+    if (except_type == H5T_CONV_EXCEPT_RANGE_HI || except_type == H5T_CONV_EXCEPT_RANGE_LOW)
+        (*(unsigned *)user_data)++;
+
+    return H5T_CONV_UNHANDLED;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    test_conv_16bit_flt
+ *
+ * Purpose:     Tests the predefined IEEE half precision and bfloat16
+ *              types and their hardware conversions to and from float and
+ *              double.  Every 16-bit value is converted with the hardware
+ *              conversion and compared against the software conversion
+ *              of the same value in the opposite byte order, and rounding
+ *              and overflow are checked for a few particular values.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        number of errors
+ *-------------------------------------------------------------------------
+ */
+static int
+test_conv_16bit_flt(void)
+{
+    /* Particular values and their expected half precision / bfloat16 encodings */
+    const double vals[]      = {1.0,
+                           -2.0,
+                           65504.0,
+                           65519.0,
+                           65520.0,
+                           5.9604644775390625e-08, /* 2^-24, smallest half denormal */
+                           2.98023223876953125e-08, /* 2^-25, ties to zero */
+                           4.470348358154296875e-08, /* 1.5 * 2^-25, rounds up */
+                           1.00048828125,            /* 1 + 2^-11, ties to even */
+                           1.00146484375};           /* 1 + 3 * 2^-11, ties to even */
+    const uint16_t half_exp[] = {0x3c00, 0xc000, 0x7bff, 0x7bff, 0x7c00,
+                                 0x0001, 0x0000, 0x0001, 0x3c00, 0x3c02};
+    const uint16_t bf16_exp[] = {0x3f80, 0xc000, 0x4780, 0x4780, 0x4780,
+                                 0x3380, 0x3300, 0x3340, 0x3f80, 0x3f80};
+    hid_t          f16_types[2], other_types[2], dxpl = H5I_INVALID_HID;
+    uint16_t *     codes  = NULL;
+    double *       dbl2   = NULL;
+    float *        hard   = NULL;
+    float *        soft   = NULL;
+    double *       dbl    = NULL;
+    double         dvals[NELMTS(vals)];
+    uint16_t       out[NELMTS(vals)];
+    size_t         spos, epos, esize, mpos, msize;
+    unsigned       noverflow = 0;
+    size_t         u, v;
+
+    TESTING("16-bit floating-point types");
+
+    f16_types[0] = H5T_NATIVE_FLOAT16;
+    f16_types[1] = H5T_NATIVE_BFLOAT16;
+    if (H5Tget_order(H5T_NATIVE_FLOAT16) == H5T_ORDER_LE) {
+        other_types[0] = H5T_IEEE_F16BE;
+        other_types[1] = H5T_FLOAT_BFLOAT16BE;
+    }
+    else {
+        other_types[0] = H5T_IEEE_F16LE;
+        other_types[1] = H5T_FLOAT_BFLOAT16LE;
+    }
+
+    /* Check the layouts */
+    if (H5Tget_size(H5T_IEEE_F16LE) != 2 || H5Tget_size(H5T_FLOAT_BFLOAT16BE) != 2)
+        TEST_ERROR
+    if (H5Tget_fields(H5T_IEEE_F16BE, &spos, &epos, &esize, &mpos, &msize) < 0)
+        TEST_ERROR
+    if (spos != 15 || epos != 10 || esize != 5 || mpos != 0 || msize != 10 || H5Tget_ebias(H5T_IEEE_F16BE) != 15)
+        TEST_ERROR
+    if (H5Tget_fields(H5T_FLOAT_BFLOAT16LE, &spos, &epos, &esize, &mpos, &msize) < 0)
+        TEST_ERROR
+    if (spos != 15 || epos != 7 || esize != 8 || mpos != 0 || msize != 7 ||
+        H5Tget_ebias(H5T_FLOAT_BFLOAT16LE) != 127)
+        TEST_ERROR
+    if (H5Tget_order(H5T_NATIVE_BFLOAT16) != H5Tget_order(H5T_NATIVE_INT))
+        TEST_ERROR
+
+    /* Conversions to and from float and double are hard conversions */
+    for (v = 0; v < 2; v++)
+        if (H5Tcompiler_conv(f16_types[v], H5T_NATIVE_FLOAT) != TRUE ||
+            H5Tcompiler_conv(f16_types[v], H5T_NATIVE_DOUBLE) != TRUE ||
+            H5Tcompiler_conv(H5T_NATIVE_FLOAT, f16_types[v]) != TRUE ||
+            H5Tcompiler_conv(H5T_NATIVE_DOUBLE, f16_types[v]) != TRUE)
+            TEST_ERROR
+
+    if (NULL == (codes = (uint16_t *)HDmalloc(65536 * sizeof(uint16_t))))
+        TEST_ERROR
+    if (NULL == (dbl2 = (double *)HDmalloc(65536 * sizeof(double))))
+        TEST_ERROR
+    if (NULL == (hard = (float *)HDmalloc(65536 * sizeof(float))))
+        TEST_ERROR
+    if (NULL == (soft = (float *)HDmalloc(65536 * sizeof(float))))
+        TEST_ERROR
+    if (NULL == (dbl = (double *)HDmalloc(65536 * sizeof(double))))
+        TEST_ERROR
+
+    for (v = 0; v < 2; v++) {
+        /* Every 16-bit value, with the hardware conversion... */
+        for (u = 0; u < 65536; u++)
+            ((uint16_t *)hard)[u] = (uint16_t)u;
+        if (H5Tconvert(f16_types[v], H5T_NATIVE_FLOAT, 65536, hard, NULL, H5P_DEFAULT) < 0)
+            TEST_ERROR
+
+        /* ... and with the software conversion from the opposite byte order */
+        for (u = 0; u < 65536; u++)
+            ((uint16_t *)soft)[u] = (uint16_t)(((u & 0xff) << 8) | (u >> 8));
+        if (H5Tconvert(other_types[v], H5T_NATIVE_FLOAT, 65536, soft, NULL, H5P_DEFAULT) < 0)
+            TEST_ERROR
+
+        for (u = 0; u < 65536; u++) {
+            hbool_t hard_nan = HDisnan(hard[u]) != 0;
+            hbool_t soft_nan = HDisnan(soft[u]) != 0;
+
+            if (hard_nan != soft_nan || (!hard_nan && HDmemcmp(&hard[u], &soft[u], sizeof(float)) != 0)) {
+                H5_FAILED();
+                HDprintf("    %s value 0x%04x: hard %g != soft %g\n", v ? "bfloat16" : "half", (unsigned)u,
+                         (double)hard[u], (double)soft[u]);
+                goto error;
+            }
+            dbl[u] = (double)hard[u];
+        }
+
+        /* Widening to double must agree, and all values must round trip */
+        for (u = 0; u < 65536; u++)
+            codes[u] = (uint16_t)u;
+        HDmemcpy(dbl2, codes, 65536 * sizeof(uint16_t));
+        if (H5Tconvert(H5T_NATIVE_FLOAT, f16_types[v], 65536, hard, NULL, H5P_DEFAULT) < 0)
+            TEST_ERROR
+        if (H5Tconvert(f16_types[v], H5T_NATIVE_DOUBLE, 65536, dbl2, NULL, H5P_DEFAULT) < 0)
+            TEST_ERROR
+        for (u = 0; u < 65536; u++) {
+            if (HDisnan(dbl[u]))
+                continue;
+            if (HDmemcmp(&dbl2[u], &dbl[u], sizeof(double)) != 0 || ((uint16_t *)hard)[u] != codes[u]) {
+                H5_FAILED();
+                HDprintf("    %s value 0x%04x doesn't round trip\n", v ? "bfloat16" : "half", (unsigned)u);
+                goto error;
+            }
+        }
+    }
+
+    /* Rounding of particular values from double & float */
+    for (v = 0; v < 2; v++) {
+        const uint16_t *expect = v ? bf16_exp : half_exp;
+
+        HDmemcpy(dvals, vals, sizeof(vals));
+        if (H5Tconvert(H5T_NATIVE_DOUBLE, f16_types[v], NELMTS(vals), dvals, NULL, H5P_DEFAULT) < 0)
+            TEST_ERROR
+        HDmemcpy(out, dvals, sizeof(out));
+        for (u = 0; u < NELMTS(vals); u++)
+            if (out[u] != expect[u]) {
+                H5_FAILED();
+                HDprintf("    %.17g converted to %s 0x%04x, expected 0x%04x\n", vals[u],
+                         v ? "bfloat16" : "half", (unsigned)out[u], (unsigned)expect[u]);
+                goto error;
+            }
+
+        for (u = 0; u < NELMTS(vals); u++)
+            ((float *)dvals)[u] = (float)vals[u];
+        if (H5Tconvert(H5T_NATIVE_FLOAT, f16_types[v], NELMTS(vals), dvals, NULL, H5P_DEFAULT) < 0)
+            TEST_ERROR
+        HDmemcpy(out, dvals, sizeof(out));
+        for (u = 0; u < NELMTS(vals); u++)
+            if (out[u] != expect[u]) {
+                H5_FAILED();
+                HDprintf("    (float)%.17g converted to %s 0x%04x, expected 0x%04x\n", vals[u],
+                         v ? "bfloat16" : "half", (unsigned)out[u], (unsigned)expect[u]);
+                goto error;
+            }
+    }
+
+    /* Overflows are reported to the conversion exception callback */
+    if ((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        TEST_ERROR
+    if (H5Pset_type_conv_cb(dxpl, conv_16bit_except, &noverflow) < 0)
+        TEST_ERROR
+    dvals[0] = 1.0e6;
+    dvals[1] = -1.0e6;
+    dvals[2] = 1.0;
+    dvals[3] = 1.0e39;
+    if (H5Tconvert(H5T_NATIVE_DOUBLE, H5T_NATIVE_FLOAT16, 3, dvals, NULL, dxpl) < 0)
+        TEST_ERROR
+    HDmemcpy(out, dvals, 3 * sizeof(uint16_t));
+    if (noverflow != 2 || out[0] != 0x7c00 || out[1] != 0xfc00 || out[2] != 0x3c00)
+        TEST_ERROR
+    dvals[0] = 1.0e39;
+    if (H5Tconvert(H5T_NATIVE_DOUBLE, H5T_NATIVE_BFLOAT16, 1, dvals, NULL, dxpl) < 0)
+        TEST_ERROR
+    HDmemcpy(out, dvals, sizeof(uint16_t));
+    if (noverflow != 3 || out[0] != 0x7f80)
+        TEST_ERROR
+    if (H5Pclose(dxpl) < 0)
+        TEST_ERROR
+
+    HDfree(codes);
+    HDfree(dbl2);
+    HDfree(hard);
+    HDfree(soft);
+    HDfree(dbl);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(dxpl);
+    }
+    H5E_END_TRY;
+    HDfree(codes);
+    HDfree(dbl2);
+    HDfree(hard);
+    HDfree(soft);
+    HDfree(dbl);
+    return 1;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    swap_bytes
+ *
+ * Purpose:     Reverses the byte order of each of the NELMTS elements of
+ *              SIZE bytes in BUF.
+ *
+ * Return:      void
+ *-------------------------------------------------------------------------
+ */
+static void
+swap_bytes(void *buf, size_t size, size_t nelmts)
+{
+    unsigned char *p = (unsigned char *)buf;
+    size_t         u, v;
+
+    for (u = 0; u < nelmts; u++, p += size)
+        for (v = 0; v < size / 2; v++) {
+            unsigned char tmp = p[v];
+
+            p[v]              = p[size - (v + 1)];
+            p[size - (v + 1)] = tmp;
+        }
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    test_conv_flt_swap
+ *
+ * Purpose:     Tests the software conversion between float and double
+ *              types that have the native layouts but not both the native
+ *              byte order, e.g. big-endian double to little-endian float
+ *              on a little-endian machine.  These go through native
+ *              arithmetic, so the results must be the same as those of
+ *              the hardware conversion, including rounding to nearest
+ *              even, overflow to infinity, denormals and NaN.  With an
+ *              exception callback set the generic algorithm is used and
+ *              the callback must see the overflows.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        number of errors
+ *-------------------------------------------------------------------------
+ */
+static int
+test_conv_flt_swap(void)
+{
+    const double vals[] = {0.0,
+                           -0.0,
+                           1.0,
+                           -1.5,
+                           1.0 / 3.0,
+                           1.000000059604644775390625, /* 1 + 2^-24, ties to even */
+                           1.000000178813934326171875, /* 1 + 3 * 2^-24, ties to even */
+                           (double)FLT_MAX,
+                           (double)FLT_MAX * 2.0,
+                           -DBL_MAX,
+                           (double)FLT_MIN / 4.0, /* float denormal */
+                           DBL_MIN,               /* underflows to zero */
+                           -1.0e-300,
+                           123456789.0};
+    const size_t nvals = NELMTS(vals);
+    hid_t        flt_swap = H5I_INVALID_HID, dbl_swap = H5I_INVALID_HID;
+    hid_t        dxpl     = H5I_INVALID_HID;
+    H5T_order_t  swapped;
+    double       dbuf[NELMTS(vals) + 2];
+    float        fexp[NELMTS(vals) + 2];
+    float        fbuf[NELMTS(vals) + 2];
+    unsigned     noverflow = 0;
+    size_t       u;
+
+    TESTING("soft float conversions between byte orders");
+
+    swapped = H5Tget_order(H5T_NATIVE_DOUBLE) == H5T_ORDER_LE ? H5T_ORDER_BE : H5T_ORDER_LE;
+    if ((flt_swap = H5Tcopy(H5T_NATIVE_FLOAT)) < 0 || H5Tset_order(flt_swap, swapped) < 0)
+        TEST_ERROR
+    if ((dbl_swap = H5Tcopy(H5T_NATIVE_DOUBLE)) < 0 || H5Tset_order(dbl_swap, swapped) < 0)
+        TEST_ERROR
+    if (H5Tcompiler_conv(dbl_swap, H5T_NATIVE_FLOAT) != FALSE)
+        TEST_ERROR
+
+    /* Expected results, with the hardware conversion's handling of overflow,
+     * plus infinity and NaN at the end */
+    for (u = 0; u < nvals; u++) {
+        if (vals[u] > (double)FLT_MAX)
+            fexp[u] = (float)HUGE_VAL;
+        else if (vals[u] < -(double)FLT_MAX)
+            fexp[u] = -(float)HUGE_VAL;
+        else
+            fexp[u] = (float)vals[u];
+        dbuf[u] = vals[u];
+    }
+    dbuf[nvals]     = HUGE_VAL;
+    fexp[nvals]     = (float)dbuf[nvals];
+    dbuf[nvals + 1] = HDsqrt(-1.0);
+    fexp[nvals + 1] = (float)dbuf[nvals + 1];
+
+    /* Swapped double to native float */
+    swap_bytes(dbuf, sizeof(double), nvals + 2);
+    if (H5Tconvert(dbl_swap, H5T_NATIVE_FLOAT, nvals + 2, dbuf, NULL, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    HDmemcpy(fbuf, dbuf, sizeof(fbuf));
+    for (u = 0; u < nvals + 2; u++)
+        if (HDisnan(fexp[u]) ? !HDisnan(fbuf[u]) : HDmemcmp(&fexp[u], &fbuf[u], sizeof(float)) != 0) {
+            H5_FAILED();
+            HDprintf("    double %.17g -> float %.9g, expected %.9g\n", u < nvals ? vals[u] : 0.0,
+                     (double)fbuf[u], (double)fexp[u]);
+            goto error;
+        }
+
+    /* Native double to swapped float, back to native double through the
+     * swapped float */
+    for (u = 0; u < nvals + 2; u++)
+        dbuf[u] = u < nvals ? vals[u] : (double)fexp[u];
+    if (H5Tconvert(H5T_NATIVE_DOUBLE, flt_swap, nvals + 2, dbuf, NULL, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if (H5Tconvert(flt_swap, H5T_NATIVE_DOUBLE, nvals + 2, dbuf, NULL, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    for (u = 0; u < nvals + 2; u++) {
+        double dexp = (double)fexp[u];
+
+        if (HDisnan(dexp) ? !HDisnan(dbuf[u]) : HDmemcmp(&dexp, &dbuf[u], sizeof(double)) != 0) {
+            H5_FAILED();
+            HDprintf("    double %.17g -> float -> double %.17g, expected %.17g\n",
+                     u < nvals ? vals[u] : 0.0, dbuf[u], dexp);
+            goto error;
+        }
+    }
+
+    /* Swapped float to swapped double, in place */
+    HDmemcpy(dbuf, fexp, nvals * sizeof(float));
+    swap_bytes(dbuf, sizeof(float), nvals);
+    if (H5Tconvert(flt_swap, dbl_swap, nvals, dbuf, NULL, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    swap_bytes(dbuf, sizeof(double), nvals);
+    for (u = 0; u < nvals; u++) {
+        double dexp = (double)fexp[u];
+
+        if (HDmemcmp(&dexp, &dbuf[u], sizeof(double)) != 0) {
+            H5_FAILED();
+            HDprintf("    float %.9g -> double %.17g\n", (double)fexp[u], dbuf[u]);
+            goto error;
+        }
+    }
+
+    /* With an exception callback the overflows are reported */
+    if ((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        TEST_ERROR
+    if (H5Pset_type_conv_cb(dxpl, conv_16bit_except, &noverflow) < 0)
+        TEST_ERROR
+    HDmemcpy(dbuf, vals, sizeof(vals));
+    swap_bytes(dbuf, sizeof(double), nvals);
+    if (H5Tconvert(dbl_swap, H5T_NATIVE_FLOAT, nvals, dbuf, NULL, dxpl) < 0)
+        TEST_ERROR
+    if (noverflow != 2) {
+        H5_FAILED();
+        HDprintf("    %u overflows reported, expected 2\n", noverflow);
+        goto error;
+    }
+
+    if (H5Pclose(dxpl) < 0)
+        TEST_ERROR
+    if (H5Tclose(flt_swap) < 0 || H5Tclose(dbl_swap) < 0)
+        TEST_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(dxpl);
+        H5Tclose(flt_swap);
+        H5Tclose(dbl_swap);
+    }
+    H5E_END_TRY;
+    return 1;
+}
+
 /*-------------------------------------------------------------------------
  * Function:    test_derived_flt
  *
@@ -5423,6 +5832,10 @@ main(void)
     /* Test a few special values for hardware float-integer conversions */
     nerrors += (unsigned long)test_particular_fp_integer();
 
+    /* Test the 16-bit floating-point types and their hardware conversions */
+    nerrors += (unsigned long)test_conv_16bit_flt();
+    nerrors += (unsigned long)test_conv_flt_swap();
+
     /*----------------------------------------------------------------------
      * Software tests
      *----------------------------------------------------------------------
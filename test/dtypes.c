@@ -5247,6 +5247,121 @@ error:
     return 1;
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    test_conv_threads
+ *
+ * Purpose:     Test that splitting conversions across threads with
+ *              H5Pset_type_conv_threads gives the same results as
+ *              converting on the calling thread, for conversions which
+ *              keep, grow and shrink the element size.
+ *
+ * Return:      Success:    0
+ *              Failure:    number of errors
+ *-------------------------------------------------------------------------
+ */
+static int
+test_conv_threads(void)
+{
+    const size_t nelmts = 256 * 1024;
+    hid_t        dxpl   = H5I_INVALID_HID;
+    hid_t        src_types[6], dst_types[6];
+    unsigned     nthreads = 0;
+    int *        orig     = NULL;
+    void *       serial   = NULL;
+    void *       threaded = NULL;
+    size_t       u, v;
+
+    TESTING("conversions split across threads");
+
+    /* Source & destination type pairs: hard int->double (grow), hard
+     * double->float (shrink), soft byte order (same size), soft float->float
+     * between byte orders (shrink), soft int->int (grow) and soft
+     * float->int (same size) */
+    src_types[0] = H5T_NATIVE_INT;
+    dst_types[0] = H5T_NATIVE_DOUBLE;
+    src_types[1] = H5T_NATIVE_DOUBLE;
+    dst_types[1] = H5T_NATIVE_FLOAT;
+    src_types[2] = H5T_STD_I32LE;
+    dst_types[2] = H5T_STD_I32BE;
+    src_types[3] = H5T_IEEE_F64LE;
+    dst_types[3] = H5T_IEEE_F32BE;
+    src_types[4] = H5T_STD_U16BE;
+    dst_types[4] = H5T_STD_U64LE;
+    src_types[5] = H5T_IEEE_F64LE;
+    dst_types[5] = H5T_STD_I64BE;
+
+    if ((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        TEST_ERROR
+    if (H5Pget_type_conv_threads(dxpl, &nthreads) < 0)
+        TEST_ERROR
+    if (nthreads != 0)
+        TEST_ERROR
+    if (H5Pset_type_conv_threads(dxpl, 4) < 0)
+        TEST_ERROR
+    if (H5Pget_type_conv_threads(dxpl, &nthreads) < 0)
+        TEST_ERROR
+    if (nthreads != 4)
+        TEST_ERROR
+
+    if (NULL == (orig = (int *)HDmalloc(nelmts * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (serial = HDmalloc(nelmts * 8)))
+        TEST_ERROR
+    if (NULL == (threaded = HDmalloc(nelmts * 8)))
+        TEST_ERROR
+    for (u = 0; u < nelmts; u++)
+        orig[u] = (int)(u * 7) - (int)(nelmts * 3);
+
+    for (v = 0; v < NELMTS(src_types); v++) {
+        size_t src_size = H5Tget_size(src_types[v]);
+        size_t dst_size = H5Tget_size(dst_types[v]);
+
+        /* Fill the source elements from the original values */
+        if (H5Tequal(src_types[v], H5T_NATIVE_INT) > 0 || H5Tequal(src_types[v], H5T_STD_I32LE) > 0)
+            HDmemcpy(serial, orig, nelmts * sizeof(int));
+        else if (H5Tequal(src_types[v], H5T_STD_U16BE) > 0) {
+            for (u = 0; u < nelmts; u++) {
+                ((unsigned char *)serial)[2 * u]     = (unsigned char)(u >> 8);
+                ((unsigned char *)serial)[2 * u + 1] = (unsigned char)u;
+            }
+        }
+        else
+            for (u = 0; u < nelmts; u++)
+                ((double *)serial)[u] = (double)orig[u] / 3.0;
+        HDmemcpy(threaded, serial, nelmts * src_size);
+
+        if (H5Tconvert(src_types[v], dst_types[v], nelmts, serial, NULL, H5P_DEFAULT) < 0)
+            TEST_ERROR
+        if (H5Tconvert(src_types[v], dst_types[v], nelmts, threaded, NULL, dxpl) < 0)
+            TEST_ERROR
+        if (HDmemcmp(serial, threaded, nelmts * dst_size) != 0) {
+            H5_FAILED();
+            HDprintf("    threaded conversion #%u differs from serial conversion\n", (unsigned)v);
+            goto error;
+        }
+    }
+
+    if (H5Pclose(dxpl) < 0)
+        TEST_ERROR
+    HDfree(orig);
+    HDfree(serial);
+    HDfree(threaded);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(dxpl);
+    }
+    H5E_END_TRY;
+    HDfree(orig);
+    HDfree(serial);
+    HDfree(threaded);
+    return 1;
+}
+
 /*-------------------------------------------------------------------------
  * Function:    test_bitfield_funcs
  *
@@ -8587,6 +8702,7 @@ main(void)
     nerrors += test_conv_enum_1();
     nerrors += test_conv_enum_2();
     nerrors += test_conv_bitfield();
+    nerrors += test_conv_threads();
     nerrors += test_bitfield_funcs();
     nerrors += test_opaque();
     nerrors += test_set_order();
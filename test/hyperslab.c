@@ -32,6 +32,7 @@
 
 #define ARRAY_FILL_SIZE    4
 #define ARRAY_OFFSET_NDIMS 3
+#define VECTOR_MAX_SEQ_LEN 40
 
 /*-------------------------------------------------------------------------
  * Function:    init_full
@@ -1136,6 +1137,192 @@ error:
     return FAIL;
 } /* end test_array_offset_n_calc() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_stride_elmt_sizes
+ *
+ * Purpose:     Tests H5VM_stride_copy() with the element sizes it has
+ *              specialized copy loops for, and some it doesn't, by copying
+ *              every other element of each row of an NX by NX array into a
+ *              packed array.
+ *
+ * Return:      Success:        SUCCEED
+ *
+ *              Failure:        FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_stride_elmt_sizes(size_t nx)
+{
+    const size_t elmt_sizes[] = {1, 2, 3, 4, 8, 12, 16, 24};
+    uint8_t *    src          = NULL; /* Source array, rows of 2*NX+1 elements */
+    uint8_t *    dst          = NULL; /* Destination array, rows of NX elements */
+    hsize_t      size[2];             /* Size of hyperslab */
+    hsize_t      src_stride[2];       /* Source strides */
+    hsize_t      dst_stride[2];       /* Destination strides */
+    size_t       elmt_size;           /* Size of each element */
+    size_t       u, i, j, b;          /* Local index variables */
+    char         s[256];
+
+    HDsprintf(s, "stride copy of %3lux%-3lu elements, all sizes", (unsigned long)nx, (unsigned long)nx);
+    TESTING(s);
+
+    /* Allocate buffers for the largest element size */
+    elmt_size = elmt_sizes[NELMTS(elmt_sizes) - 1];
+    if (NULL == (src = (uint8_t *)HDmalloc(nx * ((2 * nx) + 1) * elmt_size)))
+        TEST_ERROR
+    if (NULL == (dst = (uint8_t *)HDmalloc(nx * nx * elmt_size)))
+        TEST_ERROR
+    for (i = 0; i < nx * ((2 * nx) + 1) * elmt_size; i++)
+        src[i] = (uint8_t)HDrandom();
+
+    for (u = 0; u < NELMTS(elmt_sizes); u++) {
+        elmt_size = elmt_sizes[u];
+
+        /* Copy every other element of each source row */
+        size[0]       = nx;
+        size[1]       = nx;
+        src_stride[0] = elmt_size;
+        src_stride[1] = 2 * elmt_size;
+        dst_stride[0] = 0;
+        dst_stride[1] = elmt_size;
+        HDmemset(dst, 0, nx * nx * elmt_size);
+        if (H5VM_stride_copy(2, (hsize_t)elmt_size, size, dst_stride, dst, src_stride, src) < 0)
+            TEST_ERROR
+
+        /* Check */
+        for (i = 0; i < nx; i++)
+            for (j = 0; j < nx; j++)
+                for (b = 0; b < elmt_size; b++)
+                    if (dst[(((i * nx) + j) * elmt_size) + b] !=
+                        src[(((i * ((2 * nx) + 1)) + (2 * j)) * elmt_size) + b]) {
+                        HDfprintf(stderr, "elmt_size=%zu, i=%zu, j=%zu, b=%zu\n", elmt_size, i, j, b);
+                        TEST_ERROR
+                    } /* end if */
+    }                 /* end for */
+
+    PASSED();
+
+    HDfree(src);
+    HDfree(dst);
+
+    return SUCCEED;
+
+error:
+    if (src)
+        HDfree(src);
+    if (dst)
+        HDfree(dst);
+
+    return FAIL;
+} /* end test_stride_elmt_sizes() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_gather_scatter
+ *
+ * Purpose:     Tests H5VM_gathervv() and H5VM_scattervv() by gathering
+ *              NSEQ sequences from a buffer and scattering them into
+ *              another.  The sequence lengths come in runs, so that both
+ *              the specialized loops for runs of short sequences and the
+ *              general case are used.
+ *
+ * Return:      Success:        SUCCEED
+ *
+ *              Failure:        FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_gather_scatter(size_t nseq)
+{
+    const size_t seq_lens[] = {1, 2, 3, 4, 8, 16, VECTOR_MAX_SEQ_LEN};
+    size_t *     len        = NULL; /* Sequence lengths */
+    hsize_t *    off        = NULL; /* Sequence offsets */
+    uint8_t *    src        = NULL; /* Buffer to gather from */
+    uint8_t *    gath       = NULL; /* Gathered sequences */
+    uint8_t *    dst        = NULL; /* Buffer to scatter into */
+    size_t       buf_size;          /* Size of the source & destination buffers */
+    size_t       nbytes = 0;        /* Number of bytes in all sequences */
+    size_t       u, v, run;         /* Local index variables */
+    char         s[256];
+
+    HDsprintf(s, "gather & scatter of %6lu sequences", (unsigned long)nseq);
+    TESTING(s);
+
+    if (NULL == (len = (size_t *)HDmalloc(nseq * sizeof(size_t))))
+        TEST_ERROR
+    if (NULL == (off = (hsize_t *)HDmalloc(nseq * sizeof(hsize_t))))
+        TEST_ERROR
+
+    /* Generate runs of sequences of the same length, with gaps between them */
+    for (u = 0, buf_size = 0; u < nseq; u += run) {
+        size_t seq_len = seq_lens[(size_t)HDrandom() % NELMTS(seq_lens)];
+
+        run = 1 + ((size_t)HDrandom() % 10);
+        for (v = u; v < u + run && v < nseq; v++) {
+            buf_size += (size_t)HDrandom() % 3;
+            off[v] = buf_size;
+            len[v] = seq_len;
+            buf_size += seq_len;
+            nbytes += seq_len;
+        } /* end for */
+    }     /* end for */
+
+    if (NULL == (src = (uint8_t *)HDmalloc(buf_size)))
+        TEST_ERROR
+    if (NULL == (gath = (uint8_t *)HDmalloc(nbytes)))
+        TEST_ERROR
+    if (NULL == (dst = (uint8_t *)HDcalloc((size_t)1, buf_size)))
+        TEST_ERROR
+    for (u = 0; u < buf_size; u++)
+        src[u] = (uint8_t)(1 + ((size_t)HDrandom() % 255));
+
+    /* Gather the sequences & check them */
+    if (H5VM_gathervv(gath, src, nseq, len, off) != nbytes)
+        TEST_ERROR
+    for (u = 0, run = 0; u < nseq; u++)
+        for (v = 0; v < len[u]; v++, run++)
+            if (gath[run] != src[off[u] + v])
+                TEST_ERROR
+
+    /* Scatter them & check that only the sequences were written */
+    if (H5VM_scattervv(dst, nseq, len, off, gath) != nbytes)
+        TEST_ERROR
+    for (u = 0; u < nseq; u++)
+        for (v = 0; v < len[u]; v++) {
+            if (dst[off[u] + v] != src[off[u] + v])
+                TEST_ERROR
+            dst[off[u] + v] = 0;
+        } /* end for */
+    for (u = 0; u < buf_size; u++)
+        if (dst[u] != 0)
+            TEST_ERROR
+
+    PASSED();
+
+    HDfree(len);
+    HDfree(off);
+    HDfree(src);
+    HDfree(gath);
+    HDfree(dst);
+
+    return SUCCEED;
+
+error:
+    if (len)
+        HDfree(len);
+    if (off)
+        HDfree(off);
+    if (src)
+        HDfree(src);
+    if (gath)
+        HDfree(gath);
+    if (dst)
+        HDfree(dst);
+
+    return FAIL;
+} /* end test_gather_scatter() */
+
 /*-------------------------------------------------------------------------
  * Function:    main
  *
@@ -1381,6 +1568,23 @@ main(int argc, char *argv[])
         nerrors += status < 0 ? 1 : 0;
     } /* end if */
 
+    /*-------------------------
+     * TEST VECTOR COPY OPERATIONS
+     *-------------------------
+     */
+    if (size_of_test & TEST_SMALL) {
+        status = test_stride_elmt_sizes((size_t)7);
+        nerrors += status < 0 ? 1 : 0;
+        status = test_gather_scatter((size_t)100);
+        nerrors += status < 0 ? 1 : 0;
+    } /* end if */
+    if (size_of_test & TEST_MEDIUM) {
+        status = test_stride_elmt_sizes((size_t)257);
+        nerrors += status < 0 ? 1 : 0;
+        status = test_gather_scatter((size_t)100000);
+        nerrors += status < 0 ? 1 : 0;
+    } /* end if */
+
     /*--- END OF TESTS ---*/
 
     if (nerrors) {
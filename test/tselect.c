@@ -15920,6 +15920,485 @@ test_h5s_set_extent_none(void)
 
 } /* test_h5s_set_extent_none() */
 
+/****************************************************************
+**
+**  test_sel_iter_seq_cache_get(): Retrieve all the sequences from
+**      a selection iterator, merging adjacent sequences.
+**
+****************************************************************/
+static size_t
+test_sel_iter_seq_cache_get(hid_t iter_id, size_t maxseq, size_t maxbytes, hsize_t *off, size_t *len)
+{
+    hsize_t tmp_off[SEL_ITER_MAX_SEQ]; /* Offsets for retrieved sequences */
+    size_t  tmp_len[SEL_ITER_MAX_SEQ]; /* Lengths for retrieved sequences */
+    size_t  nseq;                      /* # of sequences retrieved */
+    size_t  nbytes;                    /* # of bytes retrieved */
+    size_t  total = 0;                 /* # of merged sequences */
+    size_t  u;                         /* Local index variable */
+    herr_t  ret;                       /* Generic return value */
+
+    do {
+        ret = H5Ssel_iter_get_seq_list(iter_id, maxseq, maxbytes, &nseq, &nbytes, tmp_off, tmp_len);
+        CHECK(ret, FAIL, "H5Ssel_iter_get_seq_list");
+        if (ret < 0)
+            break;
+
+        for (u = 0; u < nseq; u++)
+            if (total > 0 && off[total - 1] + len[total - 1] == tmp_off[u])
+                len[total - 1] += tmp_len[u];
+            else {
+                off[total] = tmp_off[u];
+                len[total] = tmp_len[u];
+                total++;
+            } /* end else */
+    } while (nseq > 0 && total < SEL_ITER_MAX_SEQ);
+
+    return total;
+} /* test_sel_iter_seq_cache_get() */
+
+/****************************************************************
+**
+**  test_sel_iter_seq_cache(): Test that the sequence lists cached
+**      for irregular hyperslab selections match the ones generated
+**      from the span tree, for several element sizes and selection
+**      offsets.
+**
+****************************************************************/
+static void
+test_sel_iter_seq_cache(void)
+{
+    hid_t    sid;                                        /* Dataspace ID */
+    hid_t    iter_id;                                    /* Dataspace selection iterator ID */
+    hsize_t  dims[]         = {16, 40};                  /* 2-D Dataspace dimensions */
+    hsize_t  start[]        = {1, 2};                    /* Hyperslab start */
+    hsize_t  stride[]       = {4, 7};                    /* Hyperslab stride */
+    hsize_t  count[]        = {3, 4};                    /* Hyperslab block count */
+    hsize_t  block[]        = {2, 3};                    /* Hyperslab block size */
+    hsize_t  start2[]       = {2, 36};                   /* Second hyperslab start */
+    hsize_t  count2[]       = {1, 1};                    /* Second hyperslab block count */
+    hsize_t  block2[]       = {10, 2};                   /* Second hyperslab block size */
+    hssize_t sel_off[][2]   = {{0, 0}, {1, 2}, {2, -1}}; /* Selection offsets */
+    hssize_t adjust[]       = {1, 1};                    /* Offset for H5Sselect_adjust */
+    size_t   elmt_sizes[]   = {4, 8, 1};                 /* Element sizes */
+    hsize_t  ref_off[SEL_ITER_MAX_SEQ];                  /* Offsets for reference sequences */
+    size_t   ref_len[SEL_ITER_MAX_SEQ];                  /* Lengths for reference sequences */
+    hsize_t  off[SEL_ITER_MAX_SEQ];                      /* Offsets for cached sequences */
+    size_t   len[SEL_ITER_MAX_SEQ];                      /* Lengths for cached sequences */
+    size_t   ref_nseq, nseq;                             /* # of sequences */
+    unsigned adjusted, o, e, pass;                       /* Local index variables */
+    herr_t   ret;                                        /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(6, ("Testing Cached Sequence Lists for Irregular Hyperslab Selections\n"));
+
+    /* Create dataspace with an irregular hyperslab selection */
+    sid = H5Screate_simple(2, dims, NULL);
+    CHECK(sid, FAIL, "H5Screate_simple");
+    ret = H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, stride, count, block);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    ret = H5Sselect_hyperslab(sid, H5S_SELECT_OR, start2, NULL, count2, block2);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    ret = H5Sis_regular_hyperslab(sid);
+    VERIFY(ret, FALSE, "H5Sis_regular_hyperslab");
+
+    for (adjusted = 0; adjusted < 2; adjusted++) {
+        for (o = 0; o < sizeof(sel_off) / sizeof(sel_off[0]); o++) {
+            ret = H5Soffset_simple(sid, sel_off[o]);
+            CHECK(ret, FAIL, "H5Soffset_simple");
+
+            for (e = 0; e < sizeof(elmt_sizes) / sizeof(elmt_sizes[0]); e++) {
+                /* Generate the reference sequences from a private copy of the selection */
+                iter_id = H5Ssel_iter_create(sid, elmt_sizes[e], (unsigned)0);
+                CHECK(iter_id, FAIL, "H5Ssel_iter_create");
+                ref_nseq = test_sel_iter_seq_cache_get(iter_id, (size_t)SEL_ITER_MAX_SEQ, (size_t)-1, ref_off,
+                                                       ref_len);
+                ret = H5Ssel_iter_close(iter_id);
+                CHECK(ret, FAIL, "H5Ssel_iter_close");
+
+                /* Iterate over the shared selection twice, so the second pass comes from the cache.
+                 * Use small limits, to split the cached sequences.
+                 */
+                for (pass = 0; pass < 2; pass++) {
+                    iter_id = H5Ssel_iter_create(sid, elmt_sizes[e], H5S_SEL_ITER_SHARE_WITH_DATASPACE);
+                    CHECK(iter_id, FAIL, "H5Ssel_iter_create");
+                    nseq = test_sel_iter_seq_cache_get(iter_id, (size_t)3, 5 * elmt_sizes[e], off, len);
+                    ret  = H5Ssel_iter_close(iter_id);
+                    CHECK(ret, FAIL, "H5Ssel_iter_close");
+
+                    VERIFY(nseq, ref_nseq, "test_sel_iter_seq_cache_get");
+                    if (nseq == ref_nseq) {
+                        if (HDmemcmp(off, ref_off, nseq * sizeof(hsize_t)) != 0)
+                            TestErrPrintf("sequence offsets don't match, adjusted=%u, offset=%u, size=%zu\n",
+                                          adjusted, o, elmt_sizes[e]);
+                        if (HDmemcmp(len, ref_len, nseq * sizeof(size_t)) != 0)
+                            TestErrPrintf("sequence lengths don't match, adjusted=%u, offset=%u, size=%zu\n",
+                                          adjusted, o, elmt_sizes[e]);
+                    } /* end if */
+                }     /* end for */
+            }         /* end for */
+        }             /* end for */
+
+        /* Move the selection itself and check again */
+        if (0 == adjusted) {
+            ret = H5Soffset_simple(sid, sel_off[0]);
+            CHECK(ret, FAIL, "H5Soffset_simple");
+            ret = H5Sselect_adjust(sid, adjust);
+            CHECK(ret, FAIL, "H5Sselect_adjust");
+        } /* end if */
+    }     /* end for */
+
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+} /* test_sel_iter_seq_cache() */
+
+/****************************************************************
+**
+**  test_hyper_blocklist_map(): Mark the elements selected in a
+**      dataspace in a map of the dataspace's elements.
+**
+****************************************************************/
+static void
+test_hyper_blocklist_map(hid_t sid, unsigned rank, const hsize_t *dims, hbool_t *map)
+{
+    H5S_sel_type sel_type; /* Type of selection */
+    hsize_t      nelmts;   /* # of elements in dataspace */
+    hsize_t      u;        /* Local index variable */
+    herr_t       ret;      /* Generic return value */
+
+    nelmts = 1;
+    for (u = 0; u < rank; u++)
+        nelmts *= dims[u];
+    HDmemset(map, 0, (size_t)nelmts * sizeof(hbool_t));
+
+    sel_type = H5Sget_select_type(sid);
+    if (sel_type == H5S_SEL_ALL)
+        for (u = 0; u < nelmts; u++)
+            map[u] = TRUE;
+    else if (sel_type == H5S_SEL_HYPERSLABS) {
+        hssize_t nblocks; /* # of blocks in selection */
+        hsize_t *blocks;  /* List of blocks in selection */
+
+        nblocks = H5Sget_select_hyper_nblocks(sid);
+        CHECK(nblocks, FAIL, "H5Sget_select_hyper_nblocks");
+        blocks = (hsize_t *)HDmalloc((size_t)nblocks * 2 * rank * sizeof(hsize_t));
+        CHECK_PTR(blocks, "HDmalloc");
+        ret = H5Sget_select_hyper_blocklist(sid, (hsize_t)0, (hsize_t)nblocks, blocks);
+        CHECK(ret, FAIL, "H5Sget_select_hyper_blocklist");
+
+        /* Mark the elements of each block */
+        for (u = 0; u < (hsize_t)nblocks; u++) {
+            const hsize_t *blk = blocks + (u * 2 * rank);
+            hsize_t        coord[3];
+            unsigned       v;
+
+            for (v = 0; v < rank; v++)
+                coord[v] = blk[v];
+            while (1) {
+                hsize_t idx = 0;
+                int     d;
+
+                for (v = 0; v < rank; v++)
+                    idx = (idx * dims[v]) + coord[v];
+                map[idx] = TRUE;
+
+                /* Advance to next element in the block */
+                for (d = (int)rank - 1; d >= 0; d--) {
+                    if (coord[d] < blk[rank + (unsigned)d]) {
+                        coord[d]++;
+                        break;
+                    } /* end if */
+                    coord[d] = blk[d];
+                } /* end for */
+                if (d < 0)
+                    break;
+            } /* end while */
+        }     /* end for */
+
+        HDfree(blocks);
+    } /* end if */
+    else
+        VERIFY(sel_type, H5S_SEL_NONE, "H5Sget_select_type");
+} /* test_hyper_blocklist_map() */
+
+/****************************************************************
+**
+**  test_hyper_blocklist(): Test that selecting a list of blocks
+**      with H5Sselect_hyper_blocklist() gives the same selections
+**      as adding the blocks one at a time with H5Sselect_hyperslab().
+**
+****************************************************************/
+#define HYPER_BLOCKLIST_NBLOCKS 300
+static void
+test_hyper_blocklist(void)
+{
+    hsize_t       dims[3]   = {12, 14, 16}; /* Dataspace dimensions */
+    hsize_t       start[3]  = {1, 0, 2};    /* Start of base hyperslab */
+    hsize_t       stride[3] = {3, 2, 5};    /* Stride of base hyperslab */
+    hsize_t       count[3]  = {4, 7, 3};    /* Count of base hyperslab */
+    hsize_t       block[3]  = {2, 1, 3};    /* Block of base hyperslab */
+    H5S_seloper_t ops[]     = {H5S_SELECT_OR, H5S_SELECT_AND, H5S_SELECT_XOR, H5S_SELECT_NOTB,
+                           H5S_SELECT_NOTA}; /* Operations to combine blocks with */
+    hsize_t *     blocks;                   /* List of blocks */
+    hbool_t *     map, *ref_map;            /* Maps of selected elements */
+    hbool_t *     base_map, *exp_map;       /* Maps for combining selections */
+    uint8_t *     buf;                      /* Buffer for encoded selection */
+    size_t        buf_size;                 /* Size of encoded selection */
+    unsigned      seed = 7;                 /* Random number seed */
+    unsigned      rank, u, v, o;            /* Local index variables */
+    hid_t         sid, ref_sid, dec_sid;    /* Dataspace IDs */
+    herr_t        ret;                      /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(6, ("Testing Selecting Lists of Hyperslab Blocks\n"));
+
+    blocks = (hsize_t *)HDmalloc(HYPER_BLOCKLIST_NBLOCKS * 2 * 3 * sizeof(hsize_t));
+    CHECK_PTR(blocks, "HDmalloc");
+    map = (hbool_t *)HDcalloc(12 * 14 * 16, sizeof(hbool_t));
+    CHECK_PTR(map, "HDcalloc");
+    ref_map = (hbool_t *)HDcalloc(12 * 14 * 16, sizeof(hbool_t));
+    CHECK_PTR(ref_map, "HDcalloc");
+    base_map = (hbool_t *)HDcalloc(12 * 14 * 16, sizeof(hbool_t));
+    CHECK_PTR(base_map, "HDcalloc");
+    exp_map = (hbool_t *)HDcalloc(12 * 14 * 16, sizeof(hbool_t));
+    CHECK_PTR(exp_map, "HDcalloc");
+
+    for (rank = 1; rank <= 3; rank++) {
+        /* Pick overlapping blocks, in a repeatable pseudo-random order */
+        for (u = 0; u < HYPER_BLOCKLIST_NBLOCKS; u++)
+            for (v = 0; v < rank; v++) {
+                hsize_t *blk = blocks + (u * 2 * rank);
+
+                seed          = (seed * 1103515245) + 12345;
+                blk[v]        = (seed >> 8) % (dims[v] - 3);
+                seed          = (seed * 1103515245) + 12345;
+                blk[rank + v] = blk[v] + ((seed >> 8) % 4);
+            } /* end for */
+
+        /* Build the reference selection one block at a time */
+        ref_sid = H5Screate_simple((int)rank, dims, NULL);
+        CHECK(ref_sid, FAIL, "H5Screate_simple");
+        for (u = 0; u < HYPER_BLOCKLIST_NBLOCKS; u++) {
+            hsize_t  blk_start[3], blk_count[3];
+            hsize_t *blk = blocks + (u * 2 * rank);
+
+            for (v = 0; v < rank; v++) {
+                blk_start[v] = blk[v];
+                blk_count[v] = (blk[rank + v] - blk[v]) + 1;
+            } /* end for */
+            ret = H5Sselect_hyperslab(ref_sid, u == 0 ? H5S_SELECT_SET : H5S_SELECT_OR, blk_start, NULL,
+                                      blk_count, NULL);
+            CHECK(ret, FAIL, "H5Sselect_hyperslab");
+        } /* end for */
+        test_hyper_blocklist_map(ref_sid, rank, dims, ref_map);
+
+        /* Select the blocks all at once */
+        sid = H5Screate_simple((int)rank, dims, NULL);
+        CHECK(sid, FAIL, "H5Screate_simple");
+        ret = H5Sselect_hyper_blocklist(sid, H5S_SELECT_SET, (size_t)HYPER_BLOCKLIST_NBLOCKS, blocks);
+        CHECK(ret, FAIL, "H5Sselect_hyper_blocklist");
+        VERIFY(H5Sget_select_npoints(sid), H5Sget_select_npoints(ref_sid), "H5Sget_select_npoints");
+        test_hyper_blocklist_map(sid, rank, dims, map);
+        if (HDmemcmp(map, ref_map, 12 * 14 * 16 * sizeof(hbool_t)) != 0)
+            TestErrPrintf("block list selection doesn't match, rank=%u\n", rank);
+
+        /* Check that the selection survives encoding & decoding */
+        buf_size = 0;
+        ret      = H5Sencode2(sid, NULL, &buf_size, H5P_DEFAULT);
+        CHECK(ret, FAIL, "H5Sencode2");
+        buf = (uint8_t *)HDmalloc(buf_size);
+        CHECK_PTR(buf, "HDmalloc");
+        ret = H5Sencode2(sid, buf, &buf_size, H5P_DEFAULT);
+        CHECK(ret, FAIL, "H5Sencode2");
+        dec_sid = H5Sdecode(buf);
+        CHECK(dec_sid, FAIL, "H5Sdecode");
+        HDfree(buf);
+        test_hyper_blocklist_map(dec_sid, rank, dims, map);
+        if (HDmemcmp(map, ref_map, 12 * 14 * 16 * sizeof(hbool_t)) != 0)
+            TestErrPrintf("decoded selection doesn't match, rank=%u\n", rank);
+        ret = H5Sclose(dec_sid);
+        CHECK(ret, FAIL, "H5Sclose");
+
+        /* Combine the blocks with a regular selection, with each operation */
+        for (o = 0; o < sizeof(ops) / sizeof(ops[0]); o++) {
+            /* Combine the maps of the selections for the expected result */
+            ret = H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, stride, count, block);
+            CHECK(ret, FAIL, "H5Sselect_hyperslab");
+            test_hyper_blocklist_map(sid, rank, dims, base_map);
+            for (u = 0; u < 12 * 14 * 16; u++)
+                switch (ops[o]) {
+                    case H5S_SELECT_OR:
+                        exp_map[u] = base_map[u] || ref_map[u];
+                        break;
+                    case H5S_SELECT_AND:
+                        exp_map[u] = base_map[u] && ref_map[u];
+                        break;
+                    case H5S_SELECT_XOR:
+                        exp_map[u] = base_map[u] != ref_map[u];
+                        break;
+                    case H5S_SELECT_NOTB:
+                        exp_map[u] = base_map[u] && !ref_map[u];
+                        break;
+                    default:
+                        exp_map[u] = !base_map[u] && ref_map[u];
+                        break;
+                } /* end switch */
+
+            ret = H5Sselect_hyper_blocklist(sid, ops[o], (size_t)HYPER_BLOCKLIST_NBLOCKS, blocks);
+            CHECK(ret, FAIL, "H5Sselect_hyper_blocklist");
+            test_hyper_blocklist_map(sid, rank, dims, map);
+            if (HDmemcmp(map, exp_map, 12 * 14 * 16 * sizeof(hbool_t)) != 0)
+                TestErrPrintf("combined selection doesn't match, rank=%u, op=%d\n", rank, (int)ops[o]);
+        } /* end for */
+
+        /* Combine the blocks with an "all" selection */
+        ret = H5Sselect_all(sid);
+        CHECK(ret, FAIL, "H5Sselect_all");
+        ret = H5Sselect_hyper_blocklist(sid, H5S_SELECT_AND, (size_t)HYPER_BLOCKLIST_NBLOCKS, blocks);
+        CHECK(ret, FAIL, "H5Sselect_hyper_blocklist");
+        VERIFY(H5Sget_select_npoints(sid), H5Sget_select_npoints(ref_sid), "H5Sget_select_npoints");
+
+        /* An empty list of blocks selects nothing */
+        ret = H5Sselect_hyper_blocklist(sid, H5S_SELECT_SET, (size_t)0, NULL);
+        CHECK(ret, FAIL, "H5Sselect_hyper_blocklist");
+        VERIFY(H5Sget_select_type(sid), H5S_SEL_NONE, "H5Sget_select_type");
+
+        /* A block with its start after its end is an error */
+        blocks[0] = blocks[rank] + 1;
+        H5E_BEGIN_TRY
+        {
+            ret = H5Sselect_hyper_blocklist(sid, H5S_SELECT_SET, (size_t)HYPER_BLOCKLIST_NBLOCKS, blocks);
+        }
+        H5E_END_TRY;
+        VERIFY(ret, FAIL, "H5Sselect_hyper_blocklist");
+
+        ret = H5Sclose(sid);
+        CHECK(ret, FAIL, "H5Sclose");
+        ret = H5Sclose(ref_sid);
+        CHECK(ret, FAIL, "H5Sclose");
+    } /* end for */
+
+    HDfree(blocks);
+    HDfree(map);
+    HDfree(ref_map);
+    HDfree(base_map);
+    HDfree(exp_map);
+} /* test_hyper_blocklist() */
+
+/****************************************************************
+**
+**  test_hyper_shared_spans(): Test that copies of an irregular
+**      hyperslab selection and selection iterators, which share
+**      the selection's span tree, aren't affected when the
+**      selection is moved or closed.
+**
+****************************************************************/
+static void
+test_hyper_shared_spans(void)
+{
+    hsize_t  dims[2]   = {12, 14};            /* Dataspace dimensions */
+    hsize_t  start[2]  = {1, 1};              /* Start of hyperslab */
+    hsize_t  stride[2] = {3, 4};              /* Stride of hyperslab */
+    hsize_t  count[2]  = {3, 3};              /* Count of hyperslab */
+    hsize_t  block[2]  = {2, 3};              /* Block of hyperslab */
+    hsize_t  start2[2] = {5, 3};              /* Start of second hyperslab */
+    hsize_t  count2[2] = {6, 4};              /* Count of second hyperslab */
+    hssize_t shift[2]  = {1, 1};              /* Offset to move the selection by */
+    hbool_t  map[12 * 14], copy_map[12 * 14]; /* Maps of selected elements */
+    hbool_t  exp_map[12 * 14];                /* Map of expected elements */
+    hsize_t  off[64], exp_off[64];            /* Sequence offsets */
+    size_t   len[64], exp_len[64];            /* Sequence lengths */
+    size_t   nseq, exp_nseq;                  /* # of sequences */
+    size_t   nelem, exp_nelem;                /* # of elements */
+    hid_t    sid, copy_sid, sel_sid;          /* Dataspace IDs */
+    hid_t    iter_id;                         /* Selection iterator ID */
+    unsigned u, v;                            /* Local index variables */
+    herr_t   ret;                             /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(6, ("Testing Sharing Span Trees Between Selections\n"));
+
+    /* Create an irregular selection */
+    sid = H5Screate_simple(2, dims, NULL);
+    CHECK(sid, FAIL, "H5Screate_simple");
+    ret = H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, stride, count, block);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    ret = H5Sselect_hyperslab(sid, H5S_SELECT_OR, start2, NULL, count2, NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    VERIFY(H5Sis_regular_hyperslab(sid), FALSE, "H5Sis_regular_hyperslab");
+    test_hyper_blocklist_map(sid, 2, dims, map);
+
+    /* Expected map after moving the selection */
+    HDmemset(exp_map, 0, sizeof(exp_map));
+    for (u = 1; u < 12; u++)
+        for (v = 1; v < 14; v++)
+            exp_map[((u - 1) * 14) + (v - 1)] = map[(u * 14) + v];
+
+    /* Moving a copy of the selection leaves the original alone */
+    copy_sid = H5Scopy(sid);
+    CHECK(copy_sid, FAIL, "H5Scopy");
+    ret = H5Sselect_adjust(copy_sid, shift);
+    CHECK(ret, FAIL, "H5Sselect_adjust");
+    test_hyper_blocklist_map(copy_sid, 2, dims, copy_map);
+    if (HDmemcmp(copy_map, exp_map, sizeof(exp_map)) != 0)
+        TestErrPrintf("moved copy of selection doesn't match\n");
+    test_hyper_blocklist_map(sid, 2, dims, copy_map);
+    if (HDmemcmp(copy_map, map, sizeof(map)) != 0)
+        TestErrPrintf("original selection changed when copy was moved\n");
+    ret = H5Sclose(copy_sid);
+    CHECK(ret, FAIL, "H5Sclose");
+
+    /* Moving the original selection leaves a copy of the selection alone */
+    sel_sid = H5Screate_simple(2, dims, NULL);
+    CHECK(sel_sid, FAIL, "H5Screate_simple");
+    ret = H5Sselect_copy(sel_sid, sid);
+    CHECK(ret, FAIL, "H5Sselect_copy");
+    copy_sid = H5Scopy(sid);
+    CHECK(copy_sid, FAIL, "H5Scopy");
+    ret = H5Sselect_adjust(sid, shift);
+    CHECK(ret, FAIL, "H5Sselect_adjust");
+    test_hyper_blocklist_map(sid, 2, dims, copy_map);
+    if (HDmemcmp(copy_map, exp_map, sizeof(exp_map)) != 0)
+        TestErrPrintf("moved selection doesn't match\n");
+    test_hyper_blocklist_map(sel_sid, 2, dims, copy_map);
+    if (HDmemcmp(copy_map, map, sizeof(map)) != 0)
+        TestErrPrintf("copied selection changed when original was moved\n");
+
+    /* An iterator keeps iterating over the selection it was created for,
+     * after the dataspace is moved and closed
+     */
+    iter_id = H5Ssel_iter_create(sel_sid, (size_t)1, 0);
+    CHECK(iter_id, FAIL, "H5Ssel_iter_create");
+    shift[0] = shift[1] = -1;
+    ret                 = H5Sselect_adjust(sel_sid, shift);
+    CHECK(ret, FAIL, "H5Sselect_adjust");
+    ret = H5Sclose(sel_sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Ssel_iter_get_seq_list(iter_id, (size_t)64, (size_t)-1, &nseq, &nelem, off, len);
+    CHECK(ret, FAIL, "H5Ssel_iter_get_seq_list");
+    ret = H5Ssel_iter_close(iter_id);
+    CHECK(ret, FAIL, "H5Ssel_iter_close");
+
+    /* Compare with the sequences of the unmoved copy */
+    iter_id = H5Ssel_iter_create(copy_sid, (size_t)1, 0);
+    CHECK(iter_id, FAIL, "H5Ssel_iter_create");
+    ret = H5Ssel_iter_get_seq_list(iter_id, (size_t)64, (size_t)-1, &exp_nseq, &exp_nelem, exp_off, exp_len);
+    CHECK(ret, FAIL, "H5Ssel_iter_get_seq_list");
+    ret = H5Ssel_iter_close(iter_id);
+    CHECK(ret, FAIL, "H5Ssel_iter_close");
+    VERIFY(nseq, exp_nseq, "H5Ssel_iter_get_seq_list");
+    VERIFY(nelem, exp_nelem, "H5Ssel_iter_get_seq_list");
+    if (nseq == exp_nseq)
+        for (u = 0; u < (unsigned)nseq; u++) {
+            VERIFY(off[u], exp_off[u], "H5Ssel_iter_get_seq_list");
+            VERIFY(len[u], exp_len[u], "H5Ssel_iter_get_seq_list");
+        } /* end for */
+
+    ret = H5Sclose(copy_sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+} /* test_hyper_shared_spans() */
+
 /****************************************************************
 **
 **  test_select(): Main H5S selection testing routine.
@@ -16119,6 +16598,15 @@ test_select(void)
      */
     test_h5s_set_extent_none();
 
+    /* Test the sequence lists cached for irregular hyperslab selections */
+    test_sel_iter_seq_cache();
+
+    /* Test selecting lists of hyperslab blocks */
+    test_hyper_blocklist();
+
+    /* Test sharing span trees between copies of selections */
+    test_hyper_shared_spans();
+
 } /* test_select() */
 
 /*-------------------------------------------------------------------------
@@ -37,6 +37,8 @@
 /* Definitions for the VL re-writing test */
 #define REWRITE_NDATASETS 32
 
+#define MANY_NSTRINGS 10000
+
 /* String for testing attributes */
 static const char *string_att       = "This is the string for the attribute";
 static char *      string_att_write = NULL;
@@ -384,6 +386,110 @@ test_vlstrings_special(void)
     CHECK(ret, FAIL, "H5Fclose");
 }
 
+/****************************************************************
+**
+**  test_vlstrings_many(): Test I/O on many VL strings at once.
+**      Tests writing, overwriting and reading back enough strings,
+**      including NULL and empty ones, to span several global heap
+**      collections and batches of VL sequences.
+**
+****************************************************************/
+static void
+test_vlstrings_many(void)
+{
+    hid_t    fid;          /* HDF5 File IDs */
+    hid_t    dataset;      /* Dataset ID */
+    hid_t    sid;          /* Dataspace ID */
+    hid_t    tid;          /* Datatype ID */
+    hsize_t  dims[] = {MANY_NSTRINGS};
+    char **  wdata  = NULL; /* Strings to write */
+    char **  rdata  = NULL; /* Strings read */
+    unsigned pass;          /* Whether writing or overwriting the strings */
+    unsigned u;             /* Local index variable */
+    herr_t   ret;           /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing I/O on Many VL Strings\n"));
+
+    wdata = (char **)HDcalloc(MANY_NSTRINGS, sizeof(char *));
+    CHECK_PTR(wdata, "HDcalloc");
+    rdata = (char **)HDcalloc(MANY_NSTRINGS, sizeof(char *));
+    CHECK_PTR(rdata, "HDcalloc");
+
+    /* Create file */
+    fid = H5Fcreate(DATAFILE, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(fid, FAIL, "H5Fcreate");
+
+    sid = H5Screate_simple(1, dims, NULL);
+    CHECK(sid, FAIL, "H5Screate_simple");
+
+    tid = H5Tcopy(H5T_C_S1);
+    CHECK(tid, FAIL, "H5Tcopy");
+
+    ret = H5Tset_size(tid, H5T_VARIABLE);
+    CHECK(ret, FAIL, "H5Tset_size");
+
+    dataset = H5Dcreate2(fid, "Dataset4", tid, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(dataset, FAIL, "H5Dcreate2");
+
+    /* Write the strings, then overwrite them with strings of other lengths */
+    for (pass = 0; pass < 2; pass++) {
+        for (u = 0; u < MANY_NSTRINGS; u++) {
+            size_t len = (u * 7 + pass * 13) % 301;
+
+            HDfree(wdata[u]);
+            if (u % 97 == pass)
+                wdata[u] = NULL;
+            else {
+                wdata[u] = (char *)HDmalloc(len + 1);
+                CHECK_PTR(wdata[u], "HDmalloc");
+                HDmemset(wdata[u], 'a' + (int)((u + pass) % 26), len);
+                wdata[u][len] = '\0';
+            } /* end else */
+        }     /* end for */
+
+        ret = H5Dwrite(dataset, tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata);
+        CHECK(ret, FAIL, "H5Dwrite");
+
+        ret = H5Dread(dataset, tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata);
+        CHECK(ret, FAIL, "H5Dread");
+
+        for (u = 0; u < MANY_NSTRINGS; u++) {
+            if (wdata[u] == NULL || rdata[u] == NULL) {
+                if (wdata[u] != rdata[u])
+                    TestErrPrintf("VL data mismatch for NULL string %u\n", u);
+            } /* end if */
+            else if (HDstrcmp(wdata[u], rdata[u]) != 0)
+                TestErrPrintf("VL data values don't match!, pass=%u, wdata[%u]=%s, rdata[%u]=%s\n", pass, u,
+                              wdata[u], u, rdata[u]);
+        } /* end for */
+
+        ret = H5Treclaim(tid, sid, H5P_DEFAULT, rdata);
+        CHECK(ret, FAIL, "H5Treclaim");
+    } /* end for */
+
+    /* Close Dataset */
+    ret = H5Dclose(dataset);
+    CHECK(ret, FAIL, "H5Dclose");
+
+    /* Close datatype */
+    ret = H5Tclose(tid);
+    CHECK(ret, FAIL, "H5Tclose");
+
+    /* Close disk dataspace */
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+
+    /* Close file */
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    for (u = 0; u < MANY_NSTRINGS; u++)
+        HDfree(wdata[u]);
+    HDfree(wdata);
+    HDfree(rdata);
+} /* end test_vlstrings_many() */
+
 /****************************************************************
 **
 **  test_vlstring_type(): Test VL string type.
@@ -977,6 +1083,7 @@ test_vlstrings(void)
     /* Test basic VL string datatype */
     test_vlstrings_basic();
     test_vlstrings_special();
+    test_vlstrings_many();
     test_vlstring_type();
     test_compact_vlstring();
 
@@ -62,6 +62,11 @@ const char *FILENAME[] = {"sec2_file",          /*0*/
                           "splitter_rw_file",   /*11*/
                           "splitter_wo_file",   /*12*/
                           "splitter.log",       /*13*/
+                          "vector_file",        /*14*/
+                          "selection_file",     /*15*/
+                          "iouring_file",       /*16*/
+                          "mmap_file",          /*17*/
+                          "sec2_stripes_file",  /*18*/
                           NULL};
 
 #define LOG_FILENAME "log_vfd_out.log"
@@ -70,6 +75,29 @@ const char *FILENAME[] = {"sec2_file",          /*0*/
 #define MULTI_COMPAT_BASENAME "multi_file_v16"
 #define SPLITTER_DATASET_NAME "dataset"
 
+#define VECTOR_NPIECES  16
+#define VECTOR_EOA      (8 * KB)
+#define VECTOR_DSET_DIM 64
+
+#define SELECT_DIM 16
+
+/* Macros for striped reads and writes with the sec2 VFD */
+#define STRIPES_NTHREADS    4
+#define STRIPES_THRESHOLD   (4 * KB)
+#define STRIPES_STRIPE_SIZE (1 * KB)
+#define STRIPES_EOA         (64 * KB)
+
+/* Macros for the io_uring VFD */
+#define IOURING_QUEUE_DEPTH 4
+#define IOURING_BUF_SIZE    512
+#define IOURING_EOA         (32 * KB)
+#define IOURING_NGROUPS     64
+
+/* Macros for the mmap VFD */
+#define MMAP_NGROUPS       32
+#define MMAP_SIGNATURE     "\211HDF\r\n\032\n"
+#define MMAP_SIGNATURE_LEN 8
+
 /* Macro: HEXPRINT()
  * Helper macro to pretty-print hexadecimal output of a buffer of known size.
  * Each line has the address of the first printed byte, and four columns of
@@ -219,6 +247,201 @@ error:
     return -1;
 } /* end test_sec2() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_sec2_stripes
+ *
+ * Purpose:     Tests splitting large reads and writes of the SEC2 driver
+ *              into stripes: unaligned reads and writes, reads past the
+ *              end of the file, and a file with a contiguous dataset
+ *              that's read back with the default driver.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_sec2_stripes(void)
+{
+    H5FD_t *       lf = NULL;
+    hid_t          fapl = H5I_INVALID_HID, fapl_out = H5I_INVALID_HID;
+    hid_t          fid = H5I_INVALID_HID, sid = H5I_INVALID_HID, did = H5I_INVALID_HID;
+    char           filename[1024];
+    unsigned       nthreads;
+    size_t         threshold, stripe_size;
+    unsigned char *wdata = NULL, *expect = NULL, *rdata = NULL;
+    int *          dset_data = NULL;
+    hsize_t        dims[2]   = {DSET1_DIM1, DSET1_DIM2};
+    haddr_t        addr;
+    size_t         off;
+    herr_t         ret;
+    int            u;
+
+    TESTING("SEC2 file driver with striped reads and writes");
+
+    if (NULL == (wdata = (unsigned char *)HDmalloc(STRIPES_EOA)))
+        TEST_ERROR
+    if (NULL == (expect = (unsigned char *)HDcalloc(1, STRIPES_EOA)))
+        TEST_ERROR
+    if (NULL == (rdata = (unsigned char *)HDmalloc(STRIPES_EOA)))
+        TEST_ERROR
+    if (NULL == (dset_data = (int *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR
+    for (off = 0; off < STRIPES_EOA; off++)
+        wdata[off] = (unsigned char)(off * 7 + 1);
+
+    /* Check the properties */
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_sec2(fapl) < 0)
+        TEST_ERROR
+    if (H5Pget_fapl_sec2_stripes(fapl, &nthreads, &threshold, &stripe_size) < 0)
+        TEST_ERROR
+    if (nthreads != 1 || threshold != H5FD_SEC2_STRIPE_THRESHOLD_DEF ||
+        stripe_size != H5FD_SEC2_STRIPE_SIZE_DEF)
+        TEST_ERROR
+    H5E_BEGIN_TRY
+    {
+        ret = H5Pset_fapl_sec2_stripes(fapl, 100000, 0, 0);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        FAIL_PUTS_ERROR("too many threads were accepted");
+    if (H5Pset_fapl_sec2_stripes(fapl, STRIPES_NTHREADS, (size_t)STRIPES_THRESHOLD,
+                                 (size_t)STRIPES_STRIPE_SIZE) < 0)
+        TEST_ERROR
+    if (H5Pget_fapl_sec2_stripes(fapl, &nthreads, &threshold, &stripe_size) < 0)
+        TEST_ERROR
+    if (nthreads != STRIPES_NTHREADS || threshold != STRIPES_THRESHOLD || stripe_size != STRIPES_STRIPE_SIZE)
+        TEST_ERROR
+    if (H5FD_SEC2 != H5Pget_driver(fapl))
+        TEST_ERROR
+    h5_fixname(FILENAME[18], fapl, filename, sizeof filename);
+
+    if (NULL == (lf = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl, HADDR_UNDEF)))
+        TEST_ERROR
+    if (H5FDset_eoa(lf, H5FD_MEM_DEFAULT, (haddr_t)STRIPES_EOA) < 0)
+        TEST_ERROR
+
+    /* Write a large piece that starts and ends between stripe boundaries,
+     * and a small piece after it
+     */
+    addr = STRIPES_STRIPE_SIZE / 2 + 3;
+    if (H5FDwrite(lf, H5FD_MEM_DRAW, H5P_DEFAULT, addr, (size_t)(STRIPES_EOA / 2), wdata + addr) < 0)
+        TEST_ERROR
+    HDmemcpy(expect + addr, wdata + addr, (size_t)(STRIPES_EOA / 2));
+    addr += STRIPES_EOA / 2 + STRIPES_STRIPE_SIZE;
+    if (H5FDwrite(lf, H5FD_MEM_DRAW, H5P_DEFAULT, addr, (size_t)(STRIPES_STRIPE_SIZE / 4), wdata + addr) < 0)
+        TEST_ERROR
+    HDmemcpy(expect + addr, wdata + addr, (size_t)(STRIPES_STRIPE_SIZE / 4));
+
+    /* Read everything back, including the part past the end of the file */
+    HDmemset(rdata, 0xff, STRIPES_EOA);
+    if (H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)0, (size_t)STRIPES_EOA, rdata) < 0)
+        TEST_ERROR
+    if (HDmemcmp(expect, rdata, STRIPES_EOA) != 0)
+        FAIL_PUTS_ERROR("data read doesn't match the data written");
+
+    /* Read an unaligned piece */
+    addr = STRIPES_STRIPE_SIZE + 17;
+    if (H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, addr, (size_t)(STRIPES_THRESHOLD * 3 + 5), rdata) < 0)
+        TEST_ERROR
+    if (HDmemcmp(expect + addr, rdata, (size_t)(STRIPES_THRESHOLD * 3 + 5)) != 0)
+        FAIL_PUTS_ERROR("unaligned data read doesn't match the data written");
+    if (H5FDclose(lf) < 0)
+        TEST_ERROR
+    lf = NULL;
+
+    /* Check the file with the default driver */
+    if (NULL == (lf = H5FDopen(filename, H5F_ACC_RDONLY, H5P_DEFAULT, HADDR_UNDEF)))
+        TEST_ERROR
+    if (H5FDset_eoa(lf, H5FD_MEM_DEFAULT, (haddr_t)STRIPES_EOA) < 0)
+        TEST_ERROR
+    if (H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)0, (size_t)STRIPES_EOA, rdata) < 0)
+        TEST_ERROR
+    if (HDmemcmp(expect, rdata, STRIPES_EOA) != 0)
+        FAIL_PUTS_ERROR("file doesn't hold the data written");
+    if (H5FDclose(lf) < 0)
+        TEST_ERROR
+    lf = NULL;
+
+    /* Create a file with a contiguous dataset large enough to be striped */
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR
+    if ((fapl_out = H5Fget_access_plist(fid)) < 0)
+        TEST_ERROR
+    if (H5Pget_fapl_sec2_stripes(fapl_out, &nthreads, &threshold, &stripe_size) < 0)
+        TEST_ERROR
+    if (nthreads != STRIPES_NTHREADS || threshold != STRIPES_THRESHOLD || stripe_size != STRIPES_STRIPE_SIZE)
+        FAIL_PUTS_ERROR("file's access property list doesn't have the striping properties");
+    if (H5Pclose(fapl_out) < 0)
+        TEST_ERROR
+    if ((sid = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR
+    if ((did = H5Dcreate2(fid, DSET1_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    for (u = 0; u < DSET1_DIM1 * DSET1_DIM2; u++)
+        dset_data[u] = u;
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, dset_data) < 0)
+        TEST_ERROR
+    if (H5Dclose(did) < 0)
+        TEST_ERROR
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR
+
+    /* Read it back with the default driver and with stripes */
+    for (u = 0; u < 2; u++) {
+        int v;
+
+        if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, u ? fapl : H5P_DEFAULT)) < 0)
+            TEST_ERROR
+        if ((did = H5Dopen2(fid, DSET1_NAME, H5P_DEFAULT)) < 0)
+            TEST_ERROR
+        HDmemset(dset_data, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+        if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, dset_data) < 0)
+            TEST_ERROR
+        for (v = 0; v < DSET1_DIM1 * DSET1_DIM2; v++)
+            if (dset_data[v] != v)
+                FAIL_PUTS_ERROR("dataset doesn't hold the data written");
+        if (H5Dclose(did) < 0)
+            TEST_ERROR
+        if (H5Fclose(fid) < 0)
+            TEST_ERROR
+    } /* end for */
+
+    if (H5Sclose(sid) < 0)
+        TEST_ERROR
+    h5_delete_test_file(FILENAME[18], fapl);
+    if (H5Pclose(fapl) < 0)
+        TEST_ERROR
+
+    HDfree(dset_data);
+    HDfree(rdata);
+    HDfree(expect);
+    HDfree(wdata);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (lf)
+            H5FDclose(lf);
+        H5Dclose(did);
+        H5Sclose(sid);
+        H5Fclose(fid);
+        H5Pclose(fapl_out);
+        H5Pclose(fapl);
+    }
+    H5E_END_TRY;
+    HDfree(dset_data);
+    HDfree(rdata);
+    HDfree(expect);
+    HDfree(wdata);
+    return -1;
+} /* end test_sec2_stripes() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_core
  *
@@ -804,6 +1027,483 @@ error:
 #endif /*H5_HAVE_DIRECT*/
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    test_iouring
+ *
+ * Purpose:     Tests the io_uring file driver: more queued writes than
+ *              the ring holds, a write that overlaps queued ones, a write
+ *              too large to be staged, reads past the end of the file,
+ *              and a file with groups and chunked datasets that's read
+ *              back with the default driver.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_iouring(void)
+{
+#ifdef H5_HAVE_IOURING
+    H5FD_t *       lf = NULL;
+    hid_t          fapl = H5I_INVALID_HID, fid = H5I_INVALID_HID, gid = H5I_INVALID_HID;
+    hid_t          sid = H5I_INVALID_HID, dcpl = H5I_INVALID_HID, did = H5I_INVALID_HID;
+    char           filename[1024];
+    char           name[32];
+    unsigned       queue_depth;
+    size_t         buf_size;
+    unsigned char *wdata = NULL, *expect = NULL, *rdata = NULL;
+    int *          dset_data = NULL;
+    hsize_t        dims[2]  = {DSET1_DIM1, DSET1_DIM2};
+    hsize_t        chunk[2] = {DSET1_DIM1 / 16, DSET1_DIM2};
+    haddr_t        addr;
+    size_t         off;
+    int            u;
+#endif /* H5_HAVE_IOURING */
+
+    TESTING("io_uring file driver");
+
+#ifndef H5_HAVE_IOURING
+    SKIPPED();
+    return 0;
+#else  /* H5_HAVE_IOURING */
+
+    if (NULL == (wdata = (unsigned char *)HDmalloc(IOURING_EOA)))
+        TEST_ERROR
+    if (NULL == (expect = (unsigned char *)HDcalloc(1, IOURING_EOA)))
+        TEST_ERROR
+    if (NULL == (rdata = (unsigned char *)HDmalloc(IOURING_EOA)))
+        TEST_ERROR
+    if (NULL == (dset_data = (int *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR
+    for (off = 0; off < IOURING_EOA; off++)
+        wdata[off] = (unsigned char)(off * 5 + 3);
+
+    /* Use a tiny ring and tiny staging buffers, so that the ring fills */
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_iouring(fapl, IOURING_QUEUE_DEPTH, (size_t)IOURING_BUF_SIZE) < 0)
+        TEST_ERROR
+    if (H5Pget_fapl_iouring(fapl, &queue_depth, &buf_size) < 0)
+        TEST_ERROR
+    if (queue_depth != IOURING_QUEUE_DEPTH || buf_size != IOURING_BUF_SIZE)
+        TEST_ERROR
+    h5_fixname(FILENAME[16], fapl, filename, sizeof filename);
+
+    H5E_BEGIN_TRY
+    {
+        lf = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl, HADDR_UNDEF);
+    }
+    H5E_END_TRY;
+    if (NULL == lf) {
+        H5Pclose(fapl);
+        HDfree(dset_data);
+        HDfree(rdata);
+        HDfree(expect);
+        HDfree(wdata);
+        SKIPPED();
+        HDprintf("  Probably the kernel doesn't support io_uring\n");
+        return 0;
+    }
+    if (H5FDset_eoa(lf, H5FD_MEM_DEFAULT, (haddr_t)IOURING_EOA) < 0)
+        TEST_ERROR
+
+    /* Write pieces with gaps between them, several times as many as the
+     * ring holds
+     */
+    for (u = 0, addr = 0; u < IOURING_QUEUE_DEPTH * 8; u++, addr += IOURING_BUF_SIZE / 2) {
+        if (H5FDwrite(lf, H5FD_MEM_DRAW, H5P_DEFAULT, addr, (size_t)(IOURING_BUF_SIZE / 4), wdata + addr) < 0)
+            TEST_ERROR
+        HDmemcpy(expect + addr, wdata + addr, (size_t)(IOURING_BUF_SIZE / 4));
+    }
+
+    /* Overwrite the last few pieces, which are still queued */
+    addr -= IOURING_BUF_SIZE;
+    for (off = 0; off < IOURING_BUF_SIZE; off++)
+        expect[addr + off] = (unsigned char)~off;
+    if (H5FDwrite(lf, H5FD_MEM_DRAW, H5P_DEFAULT, addr, (size_t)IOURING_BUF_SIZE, expect + addr) < 0)
+        TEST_ERROR
+
+    /* Write a piece too large for a staging buffer */
+    addr = IOURING_EOA / 2;
+    if (H5FDwrite(lf, H5FD_MEM_DRAW, H5P_DEFAULT, addr, (size_t)(IOURING_EOA / 4), wdata + addr) < 0)
+        TEST_ERROR
+    HDmemcpy(expect + addr, wdata + addr, (size_t)(IOURING_EOA / 4));
+
+    /* Read everything back, including the part past the end of the file */
+    if (H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)0, (size_t)IOURING_EOA, rdata) < 0)
+        TEST_ERROR
+    if (HDmemcmp(expect, rdata, IOURING_EOA) != 0)
+        FAIL_PUTS_ERROR("data read doesn't match the data written");
+
+    /* Leave some writes queued for closing to finish */
+    for (u = 0, addr = IOURING_EOA / 4; u < IOURING_QUEUE_DEPTH - 1; u++, addr += IOURING_BUF_SIZE) {
+        if (H5FDwrite(lf, H5FD_MEM_DRAW, H5P_DEFAULT, addr, (size_t)IOURING_BUF_SIZE, wdata + addr) < 0)
+            TEST_ERROR
+        HDmemcpy(expect + addr, wdata + addr, (size_t)IOURING_BUF_SIZE);
+    }
+    if (H5FDclose(lf) < 0)
+        TEST_ERROR
+    lf = NULL;
+
+    /* Check the file with the sec2 driver */
+    if (NULL == (lf = H5FDopen(filename, H5F_ACC_RDONLY, H5P_DEFAULT, HADDR_UNDEF)))
+        TEST_ERROR
+    if (H5FDset_eoa(lf, H5FD_MEM_DEFAULT, (haddr_t)IOURING_EOA) < 0)
+        TEST_ERROR
+    if (H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)0, (size_t)IOURING_EOA, rdata) < 0)
+        TEST_ERROR
+    if (HDmemcmp(expect, rdata, IOURING_EOA) != 0)
+        FAIL_PUTS_ERROR("file doesn't hold the data written");
+    if (H5FDclose(lf) < 0)
+        TEST_ERROR
+    lf = NULL;
+
+    /* Create a file with many small metadata entries and chunks */
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR
+    for (u = 0; u < IOURING_NGROUPS; u++) {
+        HDsnprintf(name, sizeof(name), "group %d", u);
+        if ((gid = H5Gcreate2(fid, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            TEST_ERROR
+        if (H5Gclose(gid) < 0)
+            TEST_ERROR
+    }
+    if ((sid = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if (H5Pset_chunk(dcpl, 2, chunk) < 0)
+        TEST_ERROR
+    if ((did = H5Dcreate2(fid, DSET1_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    for (u = 0; u < DSET1_DIM1 * DSET1_DIM2; u++)
+        dset_data[u] = u;
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, dset_data) < 0)
+        TEST_ERROR
+    if (H5Dclose(did) < 0)
+        TEST_ERROR
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR
+
+    /* Read it back with the default driver */
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    for (u = 0; u < IOURING_NGROUPS; u++) {
+        HDsnprintf(name, sizeof(name), "group %d", u);
+        if ((gid = H5Gopen2(fid, name, H5P_DEFAULT)) < 0)
+            TEST_ERROR
+        if (H5Gclose(gid) < 0)
+            TEST_ERROR
+    }
+    if ((did = H5Dopen2(fid, DSET1_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    HDmemset(dset_data, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, dset_data) < 0)
+        TEST_ERROR
+    for (u = 0; u < DSET1_DIM1 * DSET1_DIM2; u++)
+        if (dset_data[u] != u)
+            FAIL_PUTS_ERROR("dataset doesn't hold the data written");
+    if (H5Dclose(did) < 0)
+        TEST_ERROR
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR
+
+    /* And once more with the io_uring driver */
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        TEST_ERROR
+    if ((did = H5Dopen2(fid, DSET1_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    HDmemset(dset_data, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, dset_data) < 0)
+        TEST_ERROR
+    for (u = 0; u < DSET1_DIM1 * DSET1_DIM2; u++)
+        if (dset_data[u] != u)
+            FAIL_PUTS_ERROR("dataset read with io_uring doesn't hold the data written");
+    if (H5Dclose(did) < 0)
+        TEST_ERROR
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR
+
+    if (H5Pclose(dcpl) < 0)
+        TEST_ERROR
+    if (H5Sclose(sid) < 0)
+        TEST_ERROR
+    h5_delete_test_file(FILENAME[16], fapl);
+    if (H5Pclose(fapl) < 0)
+        TEST_ERROR
+
+    HDfree(dset_data);
+    HDfree(rdata);
+    HDfree(expect);
+    HDfree(wdata);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (lf)
+            H5FDclose(lf);
+        H5Dclose(did);
+        H5Pclose(dcpl);
+        H5Sclose(sid);
+        H5Gclose(gid);
+        H5Fclose(fid);
+        H5Pclose(fapl);
+    }
+    H5E_END_TRY;
+    HDfree(dset_data);
+    HDfree(rdata);
+    HDfree(expect);
+    HDfree(wdata);
+    return -1;
+#endif /* H5_HAVE_IOURING */
+} /* end test_iouring() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_mmap
+ *
+ * Purpose:     Tests the read-only memory-mapped file driver: a file with
+ *              groups, a contiguous dataset and a chunked dataset that's
+ *              written with the default driver is read back, and the
+ *              mapping lookup, reads past the end of the file and the
+ *              refusal to write are checked through the low-level calls.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_mmap(void)
+{
+#ifdef H5_HAVE_MMAP_VFD
+    H5FD_t *       lf = NULL;
+    hid_t          fapl = H5I_INVALID_HID, fid = H5I_INVALID_HID, gid = H5I_INVALID_HID;
+    hid_t          sid = H5I_INVALID_HID, dcpl = H5I_INVALID_HID, did = H5I_INVALID_HID;
+    hid_t          msid = H5I_INVALID_HID;
+    char           filename[1024];
+    char           name[32];
+    unsigned       advice;
+    int *          dset_data = NULL;
+    int *          rdata     = NULL;
+    hsize_t        dims[2]   = {DSET1_DIM1, DSET1_DIM2};
+    hsize_t        chunk[2]  = {DSET1_DIM1 / 16, DSET1_DIM2};
+    hsize_t        start[2]  = {DSET1_DIM1 / 4, 0};
+    hsize_t        count[2]  = {DSET1_DIM1 / 8, DSET1_DIM2};
+    haddr_t        eof;
+    const void *   ptr = NULL;
+    unsigned char  buf[2 * MMAP_SIGNATURE_LEN];
+    int            u;
+#endif /* H5_HAVE_MMAP_VFD */
+
+    TESTING("mmap file driver");
+
+#ifndef H5_HAVE_MMAP_VFD
+    SKIPPED();
+    return 0;
+#else  /* H5_HAVE_MMAP_VFD */
+
+    if (NULL == (dset_data = (int *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (rdata = (int *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR
+    for (u = 0; u < DSET1_DIM1 * DSET1_DIM2; u++)
+        dset_data[u] = u;
+
+    /* Check the file access properties */
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    H5E_BEGIN_TRY
+    {
+        if (H5Pset_fapl_mmap(fapl, H5FD_MMAP_ADVISE_RANDOM | H5FD_MMAP_ADVISE_SEQUENTIAL) >= 0)
+            FAIL_PUTS_ERROR("conflicting advice was accepted");
+    }
+    H5E_END_TRY;
+    if (H5Pset_fapl_mmap(fapl, H5FD_MMAP_ADVISE_RANDOM | H5FD_MMAP_ADVISE_WILLNEED) < 0)
+        TEST_ERROR
+    if (H5Pget_fapl_mmap(fapl, &advice) < 0)
+        TEST_ERROR
+    if (advice != (H5FD_MMAP_ADVISE_RANDOM | H5FD_MMAP_ADVISE_WILLNEED))
+        TEST_ERROR
+    h5_fixname(FILENAME[17], fapl, filename, sizeof filename);
+
+    /* The driver can't create files */
+    H5E_BEGIN_TRY
+    {
+        fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+    }
+    H5E_END_TRY;
+    if (fid >= 0)
+        FAIL_PUTS_ERROR("file was created with the mmap driver");
+
+    /* Create a file with groups, a contiguous and a chunked dataset */
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    for (u = 0; u < MMAP_NGROUPS; u++) {
+        HDsnprintf(name, sizeof(name), "group %d", u);
+        if ((gid = H5Gcreate2(fid, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            TEST_ERROR
+        if (H5Gclose(gid) < 0)
+            TEST_ERROR
+    }
+    if ((sid = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR
+    if ((did = H5Dcreate2(fid, DSET1_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, dset_data) < 0)
+        TEST_ERROR
+    if (H5Dclose(did) < 0)
+        TEST_ERROR
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if (H5Pset_chunk(dcpl, 2, chunk) < 0)
+        TEST_ERROR
+    if ((did = H5Dcreate2(fid, DSET3_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, dset_data) < 0)
+        TEST_ERROR
+    if (H5Dclose(did) < 0)
+        TEST_ERROR
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR
+
+    /* The driver only opens files for reading */
+    H5E_BEGIN_TRY
+    {
+        fid = H5Fopen(filename, H5F_ACC_RDWR, fapl);
+    }
+    H5E_END_TRY;
+    if (fid >= 0)
+        FAIL_PUTS_ERROR("file was opened for writing with the mmap driver");
+
+    /* Read the file back through the mapping */
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        TEST_ERROR
+    for (u = 0; u < MMAP_NGROUPS; u++) {
+        HDsnprintf(name, sizeof(name), "group %d", u);
+        if ((gid = H5Gopen2(fid, name, H5P_DEFAULT)) < 0)
+            TEST_ERROR
+        if (H5Gclose(gid) < 0)
+            TEST_ERROR
+    }
+
+    /* All of the contiguous dataset, then part of it */
+    if ((did = H5Dopen2(fid, DSET1_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    HDmemset(rdata, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata) < 0)
+        TEST_ERROR
+    if (HDmemcmp(rdata, dset_data, DSET1_DIM1 * DSET1_DIM2 * sizeof(int)) != 0)
+        FAIL_PUTS_ERROR("contiguous dataset doesn't hold the data written");
+    if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR
+    if ((msid = H5Screate_simple(2, count, NULL)) < 0)
+        TEST_ERROR
+    HDmemset(rdata, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+    if (H5Dread(did, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, rdata) < 0)
+        TEST_ERROR
+    if (HDmemcmp(rdata, dset_data + start[0] * DSET1_DIM2, count[0] * count[1] * sizeof(int)) != 0)
+        FAIL_PUTS_ERROR("part of the contiguous dataset doesn't hold the data written");
+    if (H5Dclose(did) < 0)
+        TEST_ERROR
+
+    /* The chunked dataset */
+    if ((did = H5Dopen2(fid, DSET3_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    HDmemset(rdata, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata) < 0)
+        TEST_ERROR
+    if (HDmemcmp(rdata, dset_data, DSET1_DIM1 * DSET1_DIM2 * sizeof(int)) != 0)
+        FAIL_PUTS_ERROR("chunked dataset doesn't hold the data written");
+    if (H5Dclose(did) < 0)
+        TEST_ERROR
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR
+
+    /* Check the mapping lookup and the low-level reads and writes */
+    if (NULL == (lf = H5FDopen(filename, H5F_ACC_RDONLY, fapl, HADDR_UNDEF)))
+        TEST_ERROR
+    if (HADDR_UNDEF == (eof = H5FDget_eof(lf, H5FD_MEM_DEFAULT)))
+        TEST_ERROR
+    if (H5FDset_eoa(lf, H5FD_MEM_DEFAULT, eof + KB) < 0)
+        TEST_ERROR
+    if (H5FDget_mapping(lf, H5FD_MEM_SUPER, (haddr_t)0, (size_t)MMAP_SIGNATURE_LEN, &ptr) < 0)
+        TEST_ERROR
+    if (NULL == ptr || HDmemcmp(ptr, MMAP_SIGNATURE, (size_t)MMAP_SIGNATURE_LEN) != 0)
+        FAIL_PUTS_ERROR("mapping doesn't start with the file signature");
+    if (H5FDget_mapping(lf, H5FD_MEM_DRAW, eof - MMAP_SIGNATURE_LEN, (size_t)(2 * MMAP_SIGNATURE_LEN),
+                        &ptr) < 0)
+        TEST_ERROR
+    if (NULL != ptr)
+        FAIL_PUTS_ERROR("bytes past the end of the file were mapped");
+    HDmemset(buf, 0xff, sizeof(buf));
+    if (H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, eof - MMAP_SIGNATURE_LEN, sizeof(buf), buf) < 0)
+        TEST_ERROR
+    for (u = MMAP_SIGNATURE_LEN; u < (int)sizeof(buf); u++)
+        if (buf[u] != 0)
+            FAIL_PUTS_ERROR("bytes past the end of the file didn't read as zeros");
+    H5E_BEGIN_TRY
+    {
+        if (H5FDwrite(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)0, sizeof(buf), buf) >= 0)
+            FAIL_PUTS_ERROR("write with the mmap driver succeeded");
+    }
+    H5E_END_TRY;
+    if (H5FDclose(lf) < 0)
+        TEST_ERROR
+    lf = NULL;
+
+    /* Drivers that don't map the file give no mapping */
+    if (NULL == (lf = H5FDopen(filename, H5F_ACC_RDONLY, H5P_DEFAULT, HADDR_UNDEF)))
+        TEST_ERROR
+    if (H5FDset_eoa(lf, H5FD_MEM_DEFAULT, eof) < 0)
+        TEST_ERROR
+    if (H5FDget_mapping(lf, H5FD_MEM_SUPER, (haddr_t)0, (size_t)MMAP_SIGNATURE_LEN, &ptr) < 0)
+        TEST_ERROR
+    if (NULL != ptr)
+        FAIL_PUTS_ERROR("the default driver mapped the file");
+    if (H5FDclose(lf) < 0)
+        TEST_ERROR
+    lf = NULL;
+
+    if (H5Sclose(msid) < 0)
+        TEST_ERROR
+    if (H5Pclose(dcpl) < 0)
+        TEST_ERROR
+    if (H5Sclose(sid) < 0)
+        TEST_ERROR
+    h5_delete_test_file(FILENAME[17], fapl);
+    if (H5Pclose(fapl) < 0)
+        TEST_ERROR
+
+    HDfree(rdata);
+    HDfree(dset_data);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (lf)
+            H5FDclose(lf);
+        H5Dclose(did);
+        H5Pclose(dcpl);
+        H5Sclose(msid);
+        H5Sclose(sid);
+        H5Gclose(gid);
+        H5Fclose(fid);
+        H5Pclose(fapl);
+    }
+    H5E_END_TRY;
+    HDfree(rdata);
+    HDfree(dset_data);
+    return -1;
+#endif /* H5_HAVE_MMAP_VFD */
+} /* end test_mmap() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_family_opens
  *
@@ -3304,6 +4004,555 @@ error:
 
 #undef SPLITTER_TEST_FAULT
 
+/*-------------------------------------------------------------------------
+ * Function:    test_vector_io_driver
+ *
+ * Purpose:     Writes and reads back vectors of pieces through a file
+ *              driver, both directly and through a dataset that is
+ *              accessed without the sieve buffer.
+ *
+ *              Half of the pieces follow each other in the file and the
+ *              rest are separated by gaps, and with the family driver
+ *              some of them cross member boundaries.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_vector_io_driver(const char *drv_name, hid_t fapl_id)
+{
+    H5FD_t *       lf = NULL;
+    hid_t          fid = H5I_INVALID_HID, dxfapl = H5I_INVALID_HID;
+    hid_t          sid = H5I_INVALID_HID, mid = H5I_INVALID_HID, did = H5I_INVALID_HID;
+    char           filename[1024];
+    char           msg[80];
+    H5FD_mem_t     types[VECTOR_NPIECES];
+    haddr_t        addrs[VECTOR_NPIECES];
+    size_t         sizes[VECTOR_NPIECES];
+    const void *   wbufs[VECTOR_NPIECES];
+    void *         rbufs[VECTOR_NPIECES];
+    unsigned char *wdata = NULL, *rdata = NULL, *whole = NULL;
+    hsize_t        dims[2]   = {VECTOR_DSET_DIM, VECTOR_DSET_DIM};
+    hsize_t        start[2]  = {1, 3};
+    hsize_t        stride[2] = {2, 8};
+    hsize_t        count[2]  = {VECTOR_DSET_DIM / 2, 7};
+    hsize_t        block[2]  = {1, 5};
+    hsize_t        nelmts    = (VECTOR_DSET_DIM / 2) * 7 * 5;
+    int *          dset_data = NULL, *sel_data = NULL;
+    size_t         off, total;
+    haddr_t        addr;
+    hsize_t        i, j, k;
+    int            u;
+
+    HDsnprintf(msg, sizeof(msg), "vector I/O with %s driver", drv_name);
+    TESTING(msg);
+
+    if (NULL == (wdata = (unsigned char *)HDmalloc(VECTOR_EOA)))
+        TEST_ERROR
+    if (NULL == (rdata = (unsigned char *)HDcalloc(1, VECTOR_EOA)))
+        TEST_ERROR
+    if (NULL == (whole = (unsigned char *)HDmalloc(VECTOR_EOA)))
+        TEST_ERROR
+    if (NULL == (dset_data = (int *)HDmalloc(VECTOR_DSET_DIM * VECTOR_DSET_DIM * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (sel_data = (int *)HDcalloc((size_t)nelmts, sizeof(int))))
+        TEST_ERROR
+
+    /* Lay out the pieces */
+    for (u = 0, total = 0, addr = 0; u < VECTOR_NPIECES; u++) {
+        if (u >= VECTOR_NPIECES / 2)
+            addr += 100;
+        types[u] = H5FD_MEM_DRAW;
+        addrs[u] = addr;
+        sizes[u] = (size_t)(17 + 37 * u);
+        wbufs[u] = wdata + total;
+        rbufs[u] = rdata + total;
+        addr += sizes[u];
+        total += sizes[u];
+    }
+    for (off = 0; off < VECTOR_EOA; off++)
+        wdata[off] = (unsigned char)(off * 7 + 1);
+
+    /* Write the pieces, then read them back, last piece first */
+    h5_fixname(FILENAME[14], fapl_id, filename, sizeof(filename));
+    if (NULL == (lf = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl_id, HADDR_UNDEF)))
+        TEST_ERROR
+    if (H5FDset_eoa(lf, H5FD_MEM_DEFAULT, (haddr_t)VECTOR_EOA) < 0)
+        TEST_ERROR
+    if (H5FDwrite_vector(lf, H5P_DEFAULT, (uint32_t)VECTOR_NPIECES, types, addrs, sizes, wbufs) < 0)
+        TEST_ERROR
+    for (u = 0; u < VECTOR_NPIECES / 2; u++) {
+        H5FD_mem_t tmp_type = types[u];
+        haddr_t    tmp_addr = addrs[u];
+        size_t     tmp_size = sizes[u];
+        void *     tmp_buf  = rbufs[u];
+
+        types[u] = types[VECTOR_NPIECES - 1 - u];
+        addrs[u] = addrs[VECTOR_NPIECES - 1 - u];
+        sizes[u] = sizes[VECTOR_NPIECES - 1 - u];
+        rbufs[u] = rbufs[VECTOR_NPIECES - 1 - u];
+
+        types[VECTOR_NPIECES - 1 - u] = tmp_type;
+        addrs[VECTOR_NPIECES - 1 - u] = tmp_addr;
+        sizes[VECTOR_NPIECES - 1 - u] = tmp_size;
+        rbufs[VECTOR_NPIECES - 1 - u] = tmp_buf;
+    }
+    if (H5FDread_vector(lf, H5P_DEFAULT, (uint32_t)VECTOR_NPIECES, types, addrs, sizes, rbufs) < 0)
+        TEST_ERROR
+    if (HDmemcmp(wdata, rdata, total) != 0)
+        FAIL_PUTS_ERROR("vector read didn't return the data written");
+
+    /* Check the pieces and the gaps between them with a plain read, which
+     * also reads zeros past the end of the data written
+     */
+    if (H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)0, (size_t)VECTOR_EOA, whole) < 0)
+        TEST_ERROR
+    for (u = VECTOR_NPIECES - 1, addr = 0; u >= 0; u--) {
+        for (; addr < addrs[u]; addr++)
+            if (whole[addr] != 0)
+                FAIL_PUTS_ERROR("data found between the pieces written");
+        if (HDmemcmp(whole + addrs[u], (unsigned char *)rbufs[u], sizes[u]) != 0)
+            FAIL_PUTS_ERROR("plain read doesn't match vector read");
+        addr += sizes[u];
+    }
+    for (; addr < VECTOR_EOA; addr++)
+        if (whole[addr] != 0)
+            FAIL_PUTS_ERROR("data found after the pieces written");
+
+    if (H5FDclose(lf) < 0)
+        TEST_ERROR
+    lf = NULL;
+    h5_delete_test_file(FILENAME[14], fapl_id);
+
+    /* Access a dataset without the sieve buffer, so that its sequences are
+     * passed to the driver as vectors
+     */
+    if ((dxfapl = H5Pcopy(fapl_id)) < 0)
+        TEST_ERROR
+    if (H5Pset_sieve_buf_size(dxfapl, (size_t)0) < 0)
+        TEST_ERROR
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, dxfapl)) < 0)
+        TEST_ERROR
+    if ((sid = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR
+    if ((mid = H5Screate_simple(1, &nelmts, NULL)) < 0)
+        TEST_ERROR
+    if ((did = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    for (i = 0; i < VECTOR_DSET_DIM * VECTOR_DSET_DIM; i++)
+        dset_data[i] = (int)i;
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, dset_data) < 0)
+        TEST_ERROR
+
+    /* Read a strided selection */
+    if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, stride, count, block) < 0)
+        TEST_ERROR
+    if (H5Dread(did, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, sel_data) < 0)
+        TEST_ERROR
+    for (i = 0, u = 0; i < count[0]; i++)
+        for (j = 0; j < count[1]; j++)
+            for (k = 0; k < block[1]; k++, u++)
+                if (sel_data[u] != (int)((start[0] + i * stride[0]) * VECTOR_DSET_DIM + start[1] +
+                                         j * stride[1] + k))
+                    FAIL_PUTS_ERROR("wrong data read from strided selection");
+
+    /* Overwrite the selection and check the whole dataset */
+    for (u = 0; u < (int)nelmts; u++)
+        sel_data[u] = -u;
+    if (H5Dwrite(did, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, sel_data) < 0)
+        TEST_ERROR
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, dset_data) < 0)
+        TEST_ERROR
+    for (i = 0, u = 0; i < VECTOR_DSET_DIM; i++)
+        for (j = 0; j < VECTOR_DSET_DIM; j++) {
+            int expect = (int)(i * VECTOR_DSET_DIM + j);
+
+            if (i >= start[0] && (i - start[0]) % stride[0] == 0 && j >= start[1] &&
+                (j - start[1]) / stride[1] < count[1] && (j - start[1]) % stride[1] < block[1])
+                expect = -(u++);
+            if (dset_data[i * VECTOR_DSET_DIM + j] != expect)
+                FAIL_PUTS_ERROR("wrong data after writing strided selection");
+        }
+
+    if (H5Dclose(did) < 0)
+        TEST_ERROR
+    if (H5Sclose(mid) < 0)
+        TEST_ERROR
+    if (H5Sclose(sid) < 0)
+        TEST_ERROR
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR
+    h5_delete_test_file(FILENAME[14], dxfapl);
+    if (H5Pclose(dxfapl) < 0)
+        TEST_ERROR
+
+    HDfree(sel_data);
+    HDfree(dset_data);
+    HDfree(whole);
+    HDfree(rdata);
+    HDfree(wdata);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (lf)
+            H5FDclose(lf);
+        H5Dclose(did);
+        H5Sclose(mid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+        H5Pclose(dxfapl);
+    }
+    H5E_END_TRY;
+    HDfree(sel_data);
+    HDfree(dset_data);
+    HDfree(whole);
+    HDfree(rdata);
+    HDfree(wdata);
+    return -1;
+} /* end test_vector_io_driver() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_vector_io
+ *
+ * Purpose:     Tests vector I/O with drivers that have their own
+ *              read_vector/write_vector callbacks and with one that
+ *              relies on the library reading the pieces one at a time.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_vector_io(void)
+{
+    hid_t fapl_id = H5I_INVALID_HID;
+    int   nerrors = 0;
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_sec2(fapl_id) < 0)
+        TEST_ERROR
+    nerrors += test_vector_io_driver("sec2", fapl_id) < 0 ? 1 : 0;
+    if (H5Pset_fapl_core(fapl_id, (size_t)CORE_INCREMENT, FALSE) < 0)
+        TEST_ERROR
+    nerrors += test_vector_io_driver("core", fapl_id) < 0 ? 1 : 0;
+    if (H5Pset_fapl_family(fapl_id, (hsize_t)FAMILY_SIZE, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    nerrors += test_vector_io_driver("family", fapl_id) < 0 ? 1 : 0;
+    if (H5Pset_fapl_stdio(fapl_id) < 0)
+        TEST_ERROR
+    nerrors += test_vector_io_driver("stdio", fapl_id) < 0 ? 1 : 0;
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+
+    return nerrors ? -1 : 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl_id);
+    }
+    H5E_END_TRY;
+    return -1;
+} /* end test_vector_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_selection_io_driver
+ *
+ * Purpose:     Writes and reads back selections through a file driver,
+ *              both directly and through contiguous and chunked datasets.
+ *              Drivers without selection callbacks are checked too, as
+ *              the library passes their selections on as vectors.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_selection_io_driver(const char *drv_name, hid_t fapl_id)
+{
+    H5FD_t *    lf  = NULL;
+    hid_t       fid = H5I_INVALID_HID, dcpl = H5I_INVALID_HID, dapl = H5I_INVALID_HID;
+    hid_t       fsids[2] = {H5I_INVALID_HID, H5I_INVALID_HID};
+    hid_t       msids[2] = {H5I_INVALID_HID, H5I_INVALID_HID};
+    hid_t       did      = H5I_INVALID_HID;
+    char        filename[1024];
+    char        msg[80];
+    haddr_t     offsets[2];
+    size_t      elmt_sizes[2] = {sizeof(int), sizeof(int)};
+    const void *wbufs[2];
+    void *      rbufs[2];
+    int *       wdata = NULL, *rdata = NULL, *whole = NULL, *expect = NULL;
+    long long * ldata = NULL;
+    hsize_t     dims[2]    = {SELECT_DIM, SELECT_DIM};
+    hsize_t     chunk[2]   = {SELECT_DIM / 4, SELECT_DIM / 2};
+    hsize_t     start[2]   = {1, 2};
+    hsize_t     stride[2]  = {3, 5};
+    hsize_t     count[2]   = {SELECT_DIM / 3, 3};
+    hsize_t     block[2]   = {2, 3};
+    hsize_t     fstart     = 1;
+    hsize_t     fstride    = 2;
+    hsize_t     mdims[2]   = {6, SELECT_DIM * 2};
+    hsize_t     mstart[2]  = {0, 1};
+    hsize_t     mstride[2] = {1, 2};
+    hsize_t     mcount[2]  = {6, 15};
+    hsize_t     nelmts     = 90;
+    hsize_t     flat       = SELECT_DIM * SELECT_DIM;
+    hsize_t     i, j;
+    size_t      n;
+    herr_t      ret;
+    int         u, v;
+
+    HDsnprintf(msg, sizeof(msg), "selection I/O with %s driver", drv_name);
+    TESTING(msg);
+
+    if (NULL == (wdata = (int *)HDmalloc(2 * SELECT_DIM * SELECT_DIM * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (rdata = (int *)HDcalloc(2 * SELECT_DIM * SELECT_DIM, sizeof(int))))
+        TEST_ERROR
+    if (NULL == (whole = (int *)HDmalloc(2 * SELECT_DIM * SELECT_DIM * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (expect = (int *)HDcalloc(2 * SELECT_DIM * SELECT_DIM, sizeof(int))))
+        TEST_ERROR
+    if (NULL == (ldata = (long long *)HDmalloc(SELECT_DIM * SELECT_DIM * sizeof(long long))))
+        TEST_ERROR
+    for (n = 0; n < 2 * SELECT_DIM * SELECT_DIM; n++)
+        wdata[n] = (int)n + 1;
+
+    /* The first selection is a strided block pattern in a 2-D extent,
+     * gathered from a flat memory buffer.  The second is every other
+     * element of a 1-D extent, scattered from a strided pattern in a 2-D
+     * memory buffer.
+     */
+    if ((fsids[0] = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR
+    if (H5Sselect_hyperslab(fsids[0], H5S_SELECT_SET, start, stride, count, block) < 0)
+        TEST_ERROR
+    if ((msids[0] = H5Screate_simple(1, &flat, NULL)) < 0)
+        TEST_ERROR
+    if (H5Sselect_hyperslab(msids[0], H5S_SELECT_SET, &start[1], NULL, &nelmts, NULL) < 0)
+        TEST_ERROR
+    if ((fsids[1] = H5Screate_simple(1, &flat, NULL)) < 0)
+        TEST_ERROR
+    if (H5Sselect_hyperslab(fsids[1], H5S_SELECT_SET, &fstart, &fstride, &nelmts, NULL) < 0)
+        TEST_ERROR
+    if ((msids[1] = H5Screate_simple(2, mdims, NULL)) < 0)
+        TEST_ERROR
+    if (H5Sselect_hyperslab(msids[1], H5S_SELECT_SET, mstart, mstride, mcount, NULL) < 0)
+        TEST_ERROR
+    offsets[0] = (haddr_t)0;
+    offsets[1] = (haddr_t)(SELECT_DIM * SELECT_DIM * sizeof(int));
+    wbufs[0]   = wdata;
+    wbufs[1]   = wdata + SELECT_DIM * SELECT_DIM;
+    rbufs[0]   = rdata;
+    rbufs[1]   = rdata + SELECT_DIM * SELECT_DIM;
+
+    /* Work out what the file should hold */
+    for (i = 0, v = 0; i < count[0] * block[0]; i++)
+        for (j = 0; j < count[1] * block[1]; j++, v++)
+            expect[(start[0] + (i / block[0]) * stride[0] + i % block[0]) * SELECT_DIM + start[1] +
+                   (j / block[1]) * stride[1] + j % block[1]] = wdata[start[1] + (hsize_t)v];
+    for (i = 0; i < nelmts; i++)
+        expect[SELECT_DIM * SELECT_DIM + fstart + i * fstride] =
+            wdata[SELECT_DIM * SELECT_DIM + (i / mcount[1]) * mdims[1] + mstart[1] +
+                  (i % mcount[1]) * mstride[1]];
+
+    /* Write the selections, then check the file with a plain read */
+    h5_fixname(FILENAME[15], fapl_id, filename, sizeof(filename));
+    if (NULL == (lf = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl_id, HADDR_UNDEF)))
+        TEST_ERROR
+    if (H5FDset_eoa(lf, H5FD_MEM_DEFAULT, (haddr_t)(2 * SELECT_DIM * SELECT_DIM * sizeof(int))) < 0)
+        TEST_ERROR
+    if (H5FDwrite_selection(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (uint32_t)2, msids, fsids, offsets, elmt_sizes,
+                            wbufs) < 0)
+        TEST_ERROR
+    if (H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)0, 2 * SELECT_DIM * SELECT_DIM * sizeof(int),
+                 whole) < 0)
+        TEST_ERROR
+    if (HDmemcmp(whole, expect, 2 * SELECT_DIM * SELECT_DIM * sizeof(int)) != 0)
+        FAIL_PUTS_ERROR("selection write didn't put the elements in the right places");
+
+    /* Read the selections back, which should leave the unselected elements
+     * of the buffers alone
+     */
+    if (H5FDread_selection(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (uint32_t)2, msids, fsids, offsets, elmt_sizes,
+                           rbufs) < 0)
+        TEST_ERROR
+    for (n = 0; n < SELECT_DIM * SELECT_DIM; n++)
+        if (rdata[n] != ((n >= start[1] && n < start[1] + nelmts) ? wdata[n] : 0))
+            FAIL_PUTS_ERROR("wrong data read from first selection");
+    for (i = 0; i < mdims[0]; i++)
+        for (j = 0; j < mdims[1]; j++) {
+            n = (size_t)(SELECT_DIM * SELECT_DIM + i * mdims[1] + j);
+            if (rdata[n] != ((j >= mstart[1] && (j - mstart[1]) % mstride[1] == 0 &&
+                              (j - mstart[1]) / mstride[1] < mcount[1])
+                                 ? wdata[n]
+                                 : 0))
+                FAIL_PUTS_ERROR("wrong data read from second selection");
+        }
+
+    /* Selections that reach past the EOA fail */
+    offsets[1] += SELECT_DIM * SELECT_DIM * sizeof(int) / 2;
+    H5E_BEGIN_TRY
+    {
+        ret = H5FDread_selection(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (uint32_t)2, msids, fsids, offsets,
+                                 elmt_sizes, rbufs);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        FAIL_PUTS_ERROR("selection read past the EOA succeeded");
+
+    if (H5FDclose(lf) < 0)
+        TEST_ERROR
+    lf = NULL;
+    h5_delete_test_file(FILENAME[15], fapl_id);
+
+    /* Read and write the same selections in contiguous and chunked
+     * datasets, with the chunk cache turned off so chunks are accessed in
+     * the file
+     */
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if ((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_chunk_cache(dapl, (size_t)0, (size_t)0, H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+        TEST_ERROR
+    for (u = 0; u < 2; u++) {
+        const char *name = u ? "chunked" : "contig";
+
+        if (u && H5Pset_chunk(dcpl, 2, chunk) < 0)
+            TEST_ERROR
+        if ((did = H5Dcreate2(fid, name, H5T_NATIVE_INT, fsids[0], H5P_DEFAULT, dcpl, dapl)) < 0)
+            TEST_ERROR
+        if (H5Dwrite(did, H5T_NATIVE_INT, msids[0], fsids[0], H5P_DEFAULT, wdata) < 0)
+            TEST_ERROR
+        if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, whole) < 0)
+            TEST_ERROR
+        if (HDmemcmp(whole, expect, SELECT_DIM * SELECT_DIM * sizeof(int)) != 0)
+            FAIL_PUTS_ERROR("wrong data in dataset after selection write");
+        HDmemset(rdata, 0, SELECT_DIM * SELECT_DIM * sizeof(int));
+        if (H5Dread(did, H5T_NATIVE_INT, msids[0], fsids[0], H5P_DEFAULT, rdata) < 0)
+            TEST_ERROR
+        for (n = 0; n < SELECT_DIM * SELECT_DIM; n++)
+            if (rdata[n] != ((n >= start[1] && n < start[1] + nelmts) ? wdata[n] : 0))
+                FAIL_PUTS_ERROR("wrong data read from dataset selection");
+
+        /* Converting the elements sends them through the sieve buffer, and
+         * what's held there must be seen by the reads that follow
+         */
+        for (n = 0; n < SELECT_DIM * SELECT_DIM; n++)
+            ldata[n] = -(long long)n;
+        if (H5Dwrite(did, H5T_NATIVE_LLONG, msids[0], fsids[0], H5P_DEFAULT, ldata) < 0)
+            TEST_ERROR
+        if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, whole) < 0)
+            TEST_ERROR
+        for (i = 0, v = 0; i < count[0] * block[0]; i++)
+            for (j = 0; j < count[1] * block[1]; j++, v++)
+                if (whole[(start[0] + (i / block[0]) * stride[0] + i % block[0]) * SELECT_DIM + start[1] +
+                          (j / block[1]) * stride[1] + j % block[1]] != -(int)(start[1] + (hsize_t)v))
+                    FAIL_PUTS_ERROR("converted data written to dataset not read back");
+
+        if (H5Dclose(did) < 0)
+            TEST_ERROR
+    }
+    if (H5Pclose(dapl) < 0)
+        TEST_ERROR
+    if (H5Pclose(dcpl) < 0)
+        TEST_ERROR
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR
+    h5_delete_test_file(FILENAME[15], fapl_id);
+
+    for (u = 0; u < 2; u++) {
+        if (H5Sclose(fsids[u]) < 0)
+            TEST_ERROR
+        if (H5Sclose(msids[u]) < 0)
+            TEST_ERROR
+    }
+
+    HDfree(ldata);
+    HDfree(expect);
+    HDfree(whole);
+    HDfree(rdata);
+    HDfree(wdata);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (lf)
+            H5FDclose(lf);
+        H5Dclose(did);
+        H5Pclose(dapl);
+        H5Pclose(dcpl);
+        H5Fclose(fid);
+        for (u = 0; u < 2; u++) {
+            H5Sclose(fsids[u]);
+            H5Sclose(msids[u]);
+        }
+    }
+    H5E_END_TRY;
+    HDfree(ldata);
+    HDfree(expect);
+    HDfree(whole);
+    HDfree(rdata);
+    HDfree(wdata);
+    return -1;
+} /* end test_selection_io_driver() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_selection_io
+ *
+ * Purpose:     Tests selection I/O with a driver that has its own
+ *              read_selection/write_selection callbacks and with one
+ *              that relies on the library breaking selections into
+ *              vectors.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_selection_io(void)
+{
+    hid_t fapl_id = H5I_INVALID_HID;
+    int   nerrors = 0;
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_sec2(fapl_id) < 0)
+        TEST_ERROR
+    nerrors += test_selection_io_driver("sec2", fapl_id) < 0 ? 1 : 0;
+    if (H5Pset_fapl_core(fapl_id, (size_t)CORE_INCREMENT, FALSE) < 0)
+        TEST_ERROR
+    nerrors += test_selection_io_driver("core", fapl_id) < 0 ? 1 : 0;
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+
+    return nerrors ? -1 : 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl_id);
+    }
+    H5E_END_TRY;
+    return -1;
+} /* end test_selection_io() */
+
 /*-------------------------------------------------------------------------
  * Function:    main
  *
@@ -3323,8 +4572,11 @@ main(void)
     HDprintf("Testing basic Virtual File Driver functionality.\n");
 
     nerrors += test_sec2() < 0 ? 1 : 0;
+    nerrors += test_sec2_stripes() < 0 ? 1 : 0;
     nerrors += test_core() < 0 ? 1 : 0;
     nerrors += test_direct() < 0 ? 1 : 0;
+    nerrors += test_iouring() < 0 ? 1 : 0;
+    nerrors += test_mmap() < 0 ? 1 : 0;
     nerrors += test_family() < 0 ? 1 : 0;
     nerrors += test_family_compat() < 0 ? 1 : 0;
     nerrors += test_family_member_fapl() < 0 ? 1 : 0;
@@ -3335,6 +4587,8 @@ main(void)
     nerrors += test_windows() < 0 ? 1 : 0;
     nerrors += test_ros3() < 0 ? 1 : 0;
     nerrors += test_splitter() < 0 ? 1 : 0;
+    nerrors += test_vector_io() < 0 ? 1 : 0;
+    nerrors += test_selection_io() < 0 ? 1 : 0;
 
     if (nerrors) {
         HDprintf("***** %d Virtual File Driver TEST%s FAILED! *****\n", nerrors, nerrors > 1 ? "S" : "");
@@ -46,6 +46,8 @@ if (HDF5_TEST_SERIAL)
           overhead.txt.err
           perf_meta.txt
           perf_meta.txt.err
+          sel_perf.txt
+          sel_perf.txt.err
           zip_perf-h.txt
           zip_perf-h.txt.err
           zip_perf.txt
@@ -152,6 +154,25 @@ if (HDF5_TEST_SERIAL)
       DEPENDS "PERFORM_h5perform-clearall-objects"
   )
 
+  if (HDF5_ENABLE_USING_MEMCHECKER)
+    add_test (NAME PERFORM_sel_perf COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:sel_perf>)
+  else ()
+    add_test (NAME PERFORM_sel_perf COMMAND "${CMAKE_COMMAND}"
+        -D "TEST_EMULATOR=${CMAKE_CROSSCOMPILING_EMULATOR}"
+        -D "TEST_PROGRAM=$<TARGET_FILE:sel_perf>"
+        -D "TEST_ARGS:STRING="
+        -D "TEST_EXPECT=0"
+        -D "TEST_SKIP_COMPARE=TRUE"
+        -D "TEST_OUTPUT=sel_perf.txt"
+        #-D "TEST_REFERENCE=sel_perf.out"
+        -D "TEST_FOLDER=${PROJECT_BINARY_DIR}"
+        -P "${HDF_RESOURCES_EXT_DIR}/runTest.cmake"
+    )
+  endif ()
+  set_tests_properties (PERFORM_sel_perf PROPERTIES
+      DEPENDS "PERFORM_h5perform-clearall-objects"
+  )
+
   if (HDF5_ENABLE_USING_MEMCHECKER)
     add_test (NAME PERFORM_zip_perf_help COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:zip_perf> "-h")
   else ()
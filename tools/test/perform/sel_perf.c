@@ -0,0 +1,249 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:  Measures the cost of building, copying, shifting, iterating over
+ *           and releasing an irregular hyperslab selection.  No file I/O is
+ *           performed, so the times are dominated by the span tree code.
+ *
+ *           usage: sel_perf [NBLOCKS [NREPS]]
+ */
+
+/* See H5private.h for how to include headers */
+#include "hdf5.h"
+
+#include "H5private.h"
+
+#define HEADING "%-16s"
+
+/* Default parameters */
+#define SEL_PERF_RANK    2
+#define SEL_PERF_DIM     8192
+#define SEL_PERF_BLOCK   8
+#define SEL_PERF_NBLOCKS 10000
+#define SEL_PERF_NREPS   20
+#define SEL_PERF_NSEQ    1024
+
+/* Simple linear congruential generator, so runs are repeatable */
+static unsigned sel_perf_seed_g = 12345;
+
+static hsize_t
+sel_perf_rand(hsize_t range)
+{
+    sel_perf_seed_g = sel_perf_seed_g * 1103515245 + 12345;
+
+    return (hsize_t)((sel_perf_seed_g >> 8) % range);
+}
+
+/*-------------------------------------------------------------------------
+ * Function:  print_stats
+ *
+ * Purpose:   Prints the time taken per operation
+ *
+ * Return:    void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+print_stats(const char *prefix, double t_start, double t_stop, unsigned nops)
+{
+    HDprintf(HEADING "%10.3f ms total %10.3f us/op\n", prefix, (t_stop - t_start) * 1000.0,
+             ((t_stop - t_start) * 1000000.0) / (double)nops);
+}
+
+/*-------------------------------------------------------------------------
+ * Function:  main
+ *
+ * Purpose:   Builds an irregular selection from NBLOCKS random blocks, then
+ *            times NREPS repetitions of the common selection operations.
+ *
+ * Return:    Success:  0
+ *            Failure:  1
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(int argc, char *argv[])
+{
+    hsize_t  dims[SEL_PERF_RANK] = {SEL_PERF_DIM, SEL_PERF_DIM};
+    hssize_t shift[SEL_PERF_RANK];
+    hsize_t *blocks = NULL;
+    hid_t *  copies = NULL;
+    hid_t    space  = H5I_INVALID_HID;
+    hid_t    dst    = H5I_INVALID_HID;
+    hid_t    iter   = H5I_INVALID_HID;
+    hsize_t  off[SEL_PERF_NSEQ];
+    size_t   len[SEL_PERF_NSEQ];
+    size_t   nseq, nelem;
+    hssize_t nspans;
+    size_t   nblocks = SEL_PERF_NBLOCKS;
+    unsigned nreps   = SEL_PERF_NREPS;
+    double   t_start, t_stop;
+    size_t   i;
+    unsigned u, v;
+
+    if (argc > 1)
+        nblocks = (size_t)HDatol(argv[1]);
+    if (argc > 2)
+        nreps = (unsigned)HDatoi(argv[2]);
+    if (nblocks == 0 || nreps == 0) {
+        HDfprintf(stderr, "usage: %s [NBLOCKS [NREPS]]\n", argv[0]);
+        return 1;
+    }
+
+    /* Generate the random blocks, leaving room to shift the selection */
+    if (NULL == (blocks = (hsize_t *)HDmalloc(nblocks * 2 * SEL_PERF_RANK * sizeof(hsize_t))))
+        goto error;
+    for (i = 0; i < nblocks; i++)
+        for (u = 0; u < SEL_PERF_RANK; u++) {
+            hsize_t *start = &blocks[(i * 2 * SEL_PERF_RANK) + u];
+
+            *start               = 1 + sel_perf_rand(dims[u] - (SEL_PERF_BLOCK + 1));
+            start[SEL_PERF_RANK] = *start + sel_perf_rand(SEL_PERF_BLOCK);
+        }
+    for (u = 0; u < SEL_PERF_RANK; u++)
+        shift[u] = 1;
+
+    if ((space = H5Screate_simple(SEL_PERF_RANK, dims, NULL)) < 0)
+        goto error;
+    if ((dst = H5Screate_simple(SEL_PERF_RANK, dims, NULL)) < 0)
+        goto error;
+    if (NULL == (copies = (hid_t *)HDcalloc(nreps, sizeof(hid_t))))
+        goto error;
+
+    /* Build the selection */
+    t_start = H5_get_time();
+    for (u = 0; u < nreps; u++)
+        if (H5Sselect_hyper_blocklist(space, H5S_SELECT_SET, nblocks, blocks) < 0)
+            goto error;
+    t_stop = H5_get_time();
+    if ((nspans = H5Sget_select_hyper_nblocks(space)) < 0)
+        goto error;
+    HDprintf("%lu random blocks, %ld spans, %lu elements\n", (unsigned long)nblocks, (long)nspans,
+             (unsigned long)H5Sget_select_npoints(space));
+    print_stats("build", t_start, t_stop, nreps);
+
+    /* Copy the dataspace, keeping all the copies open */
+    t_start = H5_get_time();
+    for (u = 0; u < nreps; u++)
+        if ((copies[u] = H5Scopy(space)) < 0)
+            goto error;
+    t_stop = H5_get_time();
+    print_stats("copy", t_start, t_stop, nreps);
+
+    /* Release the copies */
+    t_start = H5_get_time();
+    for (u = 0; u < nreps; u++) {
+        if (H5Sclose(copies[u]) < 0)
+            goto error;
+        copies[u] = H5I_INVALID_HID;
+    }
+    t_stop = H5_get_time();
+    print_stats("close copy", t_start, t_stop, nreps);
+
+    /* Copy the selection into another dataspace */
+    t_start = H5_get_time();
+    for (u = 0; u < nreps; u++)
+        if (H5Sselect_copy(dst, space) < 0)
+            goto error;
+    t_stop = H5_get_time();
+    print_stats("select copy", t_start, t_stop, nreps);
+
+    /* Copy the dataspace and move the copy's selection */
+    t_start = H5_get_time();
+    for (u = 0; u < nreps; u++) {
+        hid_t tmp;
+
+        if ((tmp = H5Scopy(space)) < 0)
+            goto error;
+        if (H5Sselect_adjust(tmp, shift) < 0)
+            goto error;
+        if (H5Sclose(tmp) < 0)
+            goto error;
+    }
+    t_stop = H5_get_time();
+    print_stats("copy+adjust", t_start, t_stop, nreps);
+
+    /* Iterate over the selection's sequences */
+    t_start = H5_get_time();
+    for (u = 0; u < nreps; u++) {
+        if ((iter = H5Ssel_iter_create(space, (size_t)1, 0)) < 0)
+            goto error;
+        do {
+            if (H5Ssel_iter_get_seq_list(iter, (size_t)SEL_PERF_NSEQ, (size_t)-1, &nseq, &nelem, off, len) <
+                0)
+                goto error;
+        } while (nseq > 0);
+        if (H5Ssel_iter_close(iter) < 0)
+            goto error;
+        iter = H5I_INVALID_HID;
+    }
+    t_stop = H5_get_time();
+    print_stats("iterate", t_start, t_stop, nreps);
+
+    /* Iterate over a copy of the selection while the copy is moved */
+    t_start = H5_get_time();
+    for (u = 0; u < nreps; u++) {
+        if ((iter = H5Ssel_iter_create(dst, (size_t)1, 0)) < 0)
+            goto error;
+        for (v = 0; v < SEL_PERF_RANK; v++)
+            shift[v] = (u % 2) ? -1 : 1;
+        if (H5Sselect_adjust(dst, shift) < 0)
+            goto error;
+        do {
+            if (H5Ssel_iter_get_seq_list(iter, (size_t)SEL_PERF_NSEQ, (size_t)-1, &nseq, &nelem, off, len) <
+                0)
+                goto error;
+        } while (nseq > 0);
+        if (H5Ssel_iter_close(iter) < 0)
+            goto error;
+        iter = H5I_INVALID_HID;
+    }
+    t_stop = H5_get_time();
+    print_stats("iterate+adjust", t_start, t_stop, nreps);
+
+    if (H5Sclose(dst) < 0)
+        goto error;
+    dst = H5I_INVALID_HID;
+
+    /* Release the selection */
+    t_start = H5_get_time();
+    if (H5Sclose(space) < 0)
+        goto error;
+    space = H5I_INVALID_HID;
+    t_stop = H5_get_time();
+    print_stats("close", t_start, t_stop, 1);
+
+    HDfree(copies);
+    HDfree(blocks);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (copies)
+            for (u = 0; u < nreps; u++)
+                if (copies[u] > 0)
+                    H5Sclose(copies[u]);
+        H5Ssel_iter_close(iter);
+        H5Sclose(dst);
+        H5Sclose(space);
+    }
+    H5E_END_TRY;
+    HDfree(copies);
+    HDfree(blocks);
+
+    HDfprintf(stderr, "sel_perf: failed\n");
+
+    return 1;
+}
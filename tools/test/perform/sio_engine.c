@@ -39,6 +39,9 @@
 /* sizes of various items. these sizes won't change during program execution */
 #define ELMT_H5_TYPE H5T_NATIVE_UCHAR
 
+/* Type of the HDF5 dataset elements, when they need conversion */
+#define ELMT_H5_CONV_TYPE H5T_NATIVE_USHORT
+
 #define GOTOERROR(errcode)                                                                                   \
     {                                                                                                        \
         ret_code = errcode;                                                                                  \
@@ -493,6 +496,12 @@ do_write(results *res, file_descr *fd, parameters *parms, void *buffer)
                 GOTOERROR(FAIL);
             }
 
+            /* Overlap the I/O with the datatype conversion, if requested */
+            if (parms->h5_overlap && H5Pset_tconv_overlap(h5dxpl, TRUE) < 0) {
+                HDfprintf(stderr, "HDF5 Property List Set failed\n");
+                GOTOERROR(FAIL);
+            }
+
             break;
 
         default:
@@ -525,7 +534,8 @@ do_write(results *res, file_descr *fd, parameters *parms, void *buffer)
 
             HDsprintf(dname, "Dataset_%ld", (unsigned long)parms->num_bytes);
             h5ds_id =
-                H5Dcreate2(fd->h5fd, dname, ELMT_H5_TYPE, h5dset_space_id, H5P_DEFAULT, h5dcpl, H5P_DEFAULT);
+                H5Dcreate2(fd->h5fd, dname, (parms->h5_convert ? ELMT_H5_CONV_TYPE : ELMT_H5_TYPE),
+                           h5dset_space_id, H5P_DEFAULT, h5dcpl, H5P_DEFAULT);
 
             if (h5ds_id < 0) {
                 HDfprintf(stderr, "HDF5 Dataset Create failed\n");
@@ -837,6 +847,12 @@ do_read(results *res, file_descr *fd, parameters *parms, void *buffer)
                 HDfprintf(stderr, "HDF5 Property List Create failed\n");
                 GOTOERROR(FAIL);
             }
+
+            /* Overlap the I/O with the datatype conversion, if requested */
+            if (parms->h5_overlap && H5Pset_tconv_overlap(h5dxpl, TRUE) < 0) {
+                HDfprintf(stderr, "HDF5 Property List Set failed\n");
+                GOTOERROR(FAIL);
+            }
             break;
 
         default:
@@ -1204,6 +1220,19 @@ set_vfd(parameters *param)
             return -1;
 #endif
     }
+    else if (vfd == iouring) {
+#ifdef H5_HAVE_IOURING
+        /* Linux io_uring queue.  Use the default queue depth and write staging buffer size. */
+        if (H5Pset_fapl_iouring(my_fapl, 0, 0) < 0)
+            return -1;
+#endif
+    }
+    else if (vfd == stripes) {
+        /* Unix pread() and pwrite() system calls, with transfers of 4MB or more split
+         * into 1MB stripes transferred by 4 threads */
+        if (H5Pset_fapl_sec2_stripes(my_fapl, 4, (size_t)4 * 1024 * 1024, (size_t)1024 * 1024) < 0)
+            return -1;
+    }
     else {
         /* Unknown driver */
         return -1;
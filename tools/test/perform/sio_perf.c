@@ -98,7 +98,7 @@ static const char *progname = "h5perf_serial";
  * It seems that only the options that accept additional information
  * such as dataset size (-e) require the colon next to it.
  */
-static const char *        s_opts   = "a:A:B:c:Cd:D:e:F:ghi:Imno:p:P:r:stT:v:wx:X:";
+static const char *        s_opts   = "a:A:B:c:Cd:D:e:F:ghi:Imno:Op:P:r:stT:v:wx:X:y";
 static struct long_options l_opts[] = {{"align", require_arg, 'a'},
                                        {"alig", require_arg, 'a'},
                                        {"ali", require_arg, 'a'},
@@ -232,6 +232,11 @@ static struct long_options l_opts[] = {{"align", require_arg, 'a'},
                                        {"orde", require_arg, 'r'},
                                        {"ord", require_arg, 'r'},
                                        {"or", require_arg, 'r'},
+                                       {"overlap", no_arg, 'O'},
+                                       {"overla", no_arg, 'O'},
+                                       {"overl", no_arg, 'O'},
+                                       {"over", no_arg, 'O'},
+                                       {"ove", no_arg, 'O'},
                                        {"output", require_arg, 'o'},
                                        {"outpu", require_arg, 'o'},
                                        {"outp", require_arg, 'o'},
@@ -262,6 +267,11 @@ static struct long_options l_opts[] = {{"align", require_arg, 'a'},
                                        {"writ", require_arg, 'w'},
                                        {"wri", require_arg, 'w'},
                                        {"wr", require_arg, 'w'},
+                                       {"convert", no_arg, 'y'},
+                                       {"conver", no_arg, 'y'},
+                                       {"conve", no_arg, 'y'},
+                                       {"conv", no_arg, 'y'},
+                                       {"con", no_arg, 'y'},
                                        {NULL, 0, '\0'}};
 
 struct options {
@@ -287,6 +297,8 @@ struct options {
     int         h5_write_only;       /* Perform the write tests only         */
     int         h5_extendable;       /* Perform the write tests only         */
     int         verify;              /* Verify data correctness              */
+    int         h5_convert;          /* Store HDF5 dataset in another type   */
+    int         h5_overlap;          /* Overlap HDF5 I/O and type conversion */
     vfdtype     vfd;                 /* File driver */
     size_t      page_buffer_size;
     size_t      page_size;
@@ -397,6 +409,8 @@ run_test_loop(struct options *opts)
     parms.h5_extendable    = opts->h5_extendable;
     parms.h5_write_only    = opts->h5_write_only;
     parms.verify           = opts->verify;
+    parms.h5_convert       = opts->h5_convert;
+    parms.h5_overlap       = opts->h5_overlap;
     parms.vfd              = opts->vfd;
     parms.page_buffer_size = opts->page_buffer_size;
     parms.page_size        = opts->page_size;
@@ -910,6 +924,9 @@ report_parameters(struct options *opts)
             HDfprintf(output, "Contiguous\n");
         }
 
+        HDfprintf(output, "HDF5 datatype conversion=%s\n",
+                  opts->h5_convert ? (opts->h5_overlap ? "Overlapped with I/O" : "On") : "Off");
+
         HDfprintf(output, "HDF5 file driver=");
         if (opts->vfd == sec2) {
             HDfprintf(output, "sec2\n");
@@ -932,6 +949,12 @@ report_parameters(struct options *opts)
         else if (opts->vfd == direct) {
             HDfprintf(output, "direct\n");
         }
+        else if (opts->vfd == iouring) {
+            HDfprintf(output, "iouring\n");
+        }
+        else if (opts->vfd == stripes) {
+            HDfprintf(output, "stripes\n");
+        }
     }
 
     {
@@ -993,6 +1016,8 @@ parse_command_line(int argc, const char *argv[])
     cl_opts->h5_write_only = FALSE; /* Do both read and write by default */
     cl_opts->h5_extendable = FALSE; /* Use extendable dataset */
     cl_opts->verify        = FALSE; /* No Verify data correctness by default */
+    cl_opts->h5_convert    = FALSE; /* Store HDF5 dataset in memory type by default */
+    cl_opts->h5_overlap    = FALSE; /* Don't overlap I/O and conversion by default */
 
     while ((opt = get_option(argc, argv, s_opts, l_opts)) != EOF) {
         switch ((char)opt) {
@@ -1159,6 +1184,9 @@ parse_command_line(int argc, const char *argv[])
             case 'o':
                 cl_opts->output_file = opt_arg;
                 break;
+            case 'O':
+                cl_opts->h5_overlap = TRUE;
+                break;
             case 'T':
                 cl_opts->h5_threshold = parse_size_directive(opt_arg);
                 break;
@@ -1184,6 +1212,12 @@ parse_command_line(int argc, const char *argv[])
                 else if (!HDstrcasecmp(opt_arg, "direct")) {
                     cl_opts->vfd = direct;
                 }
+                else if (!HDstrcasecmp(opt_arg, "iouring")) {
+                    cl_opts->vfd = iouring;
+                }
+                else if (!HDstrcasecmp(opt_arg, "stripes")) {
+                    cl_opts->vfd = stripes;
+                }
                 else {
                     HDfprintf(stderr, "sio_perf: invalid --api option %s\n", opt_arg);
                     HDexit(EXIT_FAILURE);
@@ -1195,6 +1229,9 @@ parse_command_line(int argc, const char *argv[])
             case 't':
                 cl_opts->h5_extendable = TRUE;
                 break;
+            case 'y':
+                cl_opts->h5_convert = TRUE;
+                break;
             case 'x': {
                 const char *end = opt_arg;
                 int         j   = 0;
@@ -1381,6 +1418,8 @@ usage(const char *prog)
     HDprintf("                       [default: 100,200]\n");
     HDprintf("     -i N              Number of iterations to perform\n");
     HDprintf("                       [default: 1]\n");
+    HDprintf("     -O                Overlap HDF5 I/O with datatype conversion\n");
+    HDprintf("                       [default: Off]\n");
     HDprintf("     -r NL             Dimension access order (see below for description)\n");
     HDprintf("                       [default: 1,2]\n");
     HDprintf("     -t                Selects extendable dimensions for HDF5 dataset\n");
@@ -1391,6 +1430,9 @@ usage(const char *prog)
     HDprintf("                       [default: Off]\n");
     HDprintf("     -x SL             Dimensions and sizes of the transfer buffer\n");
     HDprintf("                       [default: 10,20]\n");
+    HDprintf("     -y                Store HDF5 dataset as 16-bit integers, which are\n");
+    HDprintf("                       converted from/to the transfer buffer's bytes\n");
+    HDprintf("                       [default: Off]\n");
     HDprintf("\n");
     HDprintf("  N  - is an integer > 0.\n");
     HDprintf("\n");
@@ -1420,7 +1462,8 @@ usage(const char *prog)
     HDprintf("      the total size of the object increases exponentially.\n");
     HDprintf("\n");
     HDprintf("  VFD  - is an HDF5 file driver specifier. Valid values are:\n");
-    HDprintf("          sec2, stdio, core, split, multi, family, direct\n");
+    HDprintf("          sec2, stdio, core, split, multi, family, direct,\n");
+    HDprintf("          iouring, stripes (sec2 with large transfers split across threads)\n");
     HDprintf("\n");
     HDprintf("  Dimension access order:\n");
     HDprintf("      Data access starts at the cardinal origin of the dataset using the\n");
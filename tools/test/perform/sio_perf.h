@@ -43,7 +43,9 @@ typedef enum vfdtype_ {
     split,
     multi,
     family,
-    direct
+    direct,
+    iouring,
+    stripes
     /*NUM_TYPES*/
 } vfdtype;
 
@@ -65,6 +67,8 @@ typedef struct parameters_ {
     int     h5_extendable;       /* Make HDF5 dataset chunked            */
     int     h5_write_only;       /* Perform the write tests only         */
     int     verify;              /* Verify data correctness              */
+    int     h5_convert;          /* Store HDF5 dataset in another type   */
+    int     h5_overlap;          /* Overlap HDF5 I/O and type conversion */
     size_t  page_size;
     size_t  page_buffer_size;
 } parameters;